@@ -34,6 +34,7 @@ Page *BufferPoolManager::FetchPage(page_id_t page_id) {
   // 2.     If R is dirty, write it back to the disk.
   // 3.     Delete R from the page table and insert P.
   // 4.     Update P's metadata, read in the page content from disk, and then return a pointer to P.
+  std::scoped_lock<std::recursive_mutex> lock(latch_);
   if (page_table_.find(page_id) != page_table_.end()) {
     replacer_->Pin(page_table_[page_id]);
     Page *P = pages_ + page_table_[page_id]; // requested page P
@@ -64,6 +65,7 @@ Page *BufferPoolManager::FetchPage(page_id_t page_id) {
     R->page_id_ = page_id;
     R->pin_count_ = 1;
     R->is_dirty_ = false;
+    R->version_latch_.Reset();
     replacer_->Pin(frame_id);
     return R;
   }
@@ -79,38 +81,41 @@ Page *BufferPoolManager::NewPage(page_id_t &page_id) {
   // 2.   Pick a victim page P from either the free list or the replacer. Always pick from the free list first.
   // 3.   Update P's metadata, zero out memory and add P to the page table.
   // 4.   Set the page ID output parameter. Return a pointer to P.
-  int flag = false; // flag为false当所有页面都被pin时，返回nullptr
-  for (uint32_t i = 0; i < pool_size_; i++) {
-    if (pages_[i].GetPinCount() == 0) {
-      flag = true;
-      break;
-    }
-  }
-  if (!flag) return nullptr;
+  std::scoped_lock<std::recursive_mutex> lock(latch_);
+  // 所有页面都被pin时，free_list_与replacer均为空，返回nullptr
+  if (free_list_.empty() && replacer_->Size() == 0) return nullptr;
   Page *P;
   frame_id_t frame_id;
-  if (free_list_.empty()) {
-    // free_list为空，从replacer中获取Victim页
-    if (!replacer_->Victim(&frame_id)) {
-      return nullptr;
-    }
+  page_id = disk_manager_->AllocatePage();
+  if (page_table_.find(page_id) != page_table_.end()) {
+    // 该页号释放后又被读入过（并发的索引读者拿着过期的页号），直接复用这一帧，避免同一页号对应两帧
+    frame_id = page_table_[page_id];
+    replacer_->Pin(frame_id);
+    P = pages_ + frame_id;
   } else {
-    // free_list不为空，从free_list中获取Victim页
-    frame_id = free_list_.front();
-    free_list_.pop_front();
-  }
-  P = pages_ + frame_id;
-  if (P->is_dirty_) {
-    // 将脏页写入磁盘
-    disk_manager_->WritePage(P->page_id_, P->GetData());
-    P->is_dirty_ = false;
+    if (free_list_.empty()) {
+      // free_list为空，从replacer中获取Victim页
+      if (!replacer_->Victim(&frame_id)) {
+        disk_manager_->DeAllocatePage(page_id);
+        return nullptr;
+      }
+    } else {
+      // free_list不为空，从free_list中获取Victim页
+      frame_id = free_list_.front();
+      free_list_.pop_front();
+    }
+    P = pages_ + frame_id;
+    if (P->is_dirty_) {
+      // 将脏页写入磁盘
+      disk_manager_->WritePage(P->page_id_, P->GetData());
+    }
+    page_table_.erase(P->page_id_);
+    page_table_[page_id] = frame_id;
   }
-  page_table_.erase(P->page_id_);
-  page_id = disk_manager_->AllocatePage();
-  page_table_[page_id] = frame_id;
   P->page_id_ = page_id;
   P->pin_count_ += 1;
   P->is_dirty_ = false;
+  P->version_latch_.Reset();
   return P;
 }
 
@@ -123,6 +128,7 @@ bool BufferPoolManager::DeletePage(page_id_t page_id) {
   // 1.   If P does not exist, return true.
   // 2.   If P exists, but has a non-zero pin-count, return false. Someone is using the page.
   // 3.   Otherwise, P can be deleted. Remove P from the page table, reset its metadata and return it to the free list.
+  std::scoped_lock<std::recursive_mutex> lock(latch_);
   if (page_table_.find(page_id) == page_table_.end()) {
     // P 不存在
     return true;
@@ -134,9 +140,13 @@ bool BufferPoolManager::DeletePage(page_id_t page_id) {
       return false;
     } else {
       // P 不被固定
+      frame_id_t frame_id = page_table_[page_id];
       page_table_.erase(page_id);
+      replacer_->Pin(frame_id);  // 从replacer中移除，避免同一帧同时出现在free_list_和replacer中
+      P->page_id_ = INVALID_PAGE_ID;
+      P->is_dirty_ = false;
       DeallocatePage(page_id);
-      free_list_.push_back(page_table_[page_id]);
+      free_list_.push_back(frame_id);
       return true;
     }
   }
@@ -148,6 +158,7 @@ bool BufferPoolManager::DeletePage(page_id_t page_id) {
  * TODO: Student Implement
  */
 bool BufferPoolManager::UnpinPage(page_id_t page_id, bool is_dirty) {
+  std::scoped_lock<std::recursive_mutex> lock(latch_);
   if (page_table_.find(page_id) == page_table_.end()) {
     // 没有对应数据页
     return true;
@@ -171,6 +182,7 @@ bool BufferPoolManager::UnpinPage(page_id_t page_id, bool is_dirty) {
  * TODO: Student Implement
  */
 bool BufferPoolManager::FlushPage(page_id_t page_id) {
+  std::scoped_lock<std::recursive_mutex> lock(latch_);
   if (page_table_.find(page_id) == page_table_.end()) {
     // 页面不存在
     return false;
@@ -192,11 +204,13 @@ void BufferPoolManager::DeallocatePage(__attribute__((unused)) page_id_t page_id
 }
 
 bool BufferPoolManager::IsPageFree(page_id_t page_id) {
+  std::scoped_lock<std::recursive_mutex> lock(latch_);
   return disk_manager_->IsPageFree(page_id);
 }
 
 // Only used for debug
 bool BufferPoolManager::CheckAllUnpinned() {
+  std::scoped_lock<std::recursive_mutex> lock(latch_);
   bool res = true;
   for (size_t i = 0; i < pool_size_; i++) {
     if (pages_[i].pin_count_ != 0) {
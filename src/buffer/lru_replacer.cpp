@@ -17,6 +17,7 @@ bool LRUReplacer::Victim(frame_id_t *frame_id) {
   }
   *frame_id = lru_list_.front();
   lru_list_.pop_front();
+  lru_map_.erase(*frame_id);
   return true;
 }
 
@@ -27,11 +28,10 @@ bool LRUReplacer::Victim(frame_id_t *frame_id) {
  * TODO: Student Implement
  */
 void LRUReplacer::Pin(frame_id_t frame_id) {
-  for (auto it = lru_list_.begin(); it != lru_list_.end(); it++) {
-    if (*it == frame_id) {
-      lru_list_.erase(it);
-      break;
-    }
+  auto it = lru_map_.find(frame_id);
+  if (it != lru_map_.end()) {
+    lru_list_.erase(it->second);
+    lru_map_.erase(it);
   }
 }
 
@@ -41,15 +41,15 @@ void LRUReplacer::Pin(frame_id_t frame_id) {
  * TODO: Student Implement
  */
 void LRUReplacer::Unpin(frame_id_t frame_id) {
+  if (lru_map_.count(frame_id)) {
+    return;
+  }
   while (lru_list_.size() >= Replace_Size) {
+    lru_map_.erase(lru_list_.back());
     lru_list_.pop_back();
   }
-  for (auto it = lru_list_.begin(); it != lru_list_.end(); it++) {
-    if (*it == frame_id) {
-      return;
-    }
-  }
   lru_list_.push_back(frame_id);
+  lru_map_[frame_id] = std::prev(lru_list_.end());
 }
 
 /**
@@ -87,7 +87,9 @@ CatalogManager::CatalogManager(BufferPoolManager *buffer_pool_manager, LockManag
     Page *catalog_meta_page = buffer_pool_manager_->FetchPage(CATALOG_META_PAGE_ID);
     char *buf = catalog_meta_page->GetData();
     // 反序列化，获取catalog_meta
-    CatalogMeta *catalog_meta = CatalogMeta::DeserializeFrom(buf);
+    catalog_meta_ = CatalogMeta::DeserializeFrom(buf);
+    buffer_pool_manager_->UnpinPage(CATALOG_META_PAGE_ID, false);
+    CatalogMeta *catalog_meta = catalog_meta_;
     // 加载table
     for (auto it = catalog_meta->table_meta_pages_.begin(); it != catalog_meta->table_meta_pages_.end(); ++it) {
       table_id_t table_id = it->first;
@@ -105,6 +107,12 @@ CatalogManager::CatalogManager(BufferPoolManager *buffer_pool_manager, LockManag
 
 CatalogManager::~CatalogManager() {
   FlushCatalogMetaPage();
+  // 执行器增量维护的统计信息随索引元数据一起写回
+  for (auto iter : indexes_) {
+    if (iter.second->GetStatistics().IsAnalyzed()) {
+      FlushIndexStatistics(iter.first);
+    }
+  }
   delete catalog_meta_;
   for (auto iter : tables_) {
     delete iter.second;
@@ -125,26 +133,23 @@ dberr_t CatalogManager::CreateTable(const string &table_name, TableSchema *schem
   }
   table_id_t table_id = catalog_meta_->GetNextTableId(); // 从catalog元数据中获取下一个表id
   page_id_t meta_page_id; // 表元数据页id
-  page_id_t page_id; // 表页id
-  // 创建表元数据页和表堆页
+  // 创建表元数据页
   if (buffer_pool_manager_->NewPage(meta_page_id) == nullptr) {
     // 没有空闲页
     return DB_FAILED;
   }
-  if (buffer_pool_manager_->NewPage(page_id) == nullptr) {
-    // 没有空闲页
-    return DB_FAILED;
-  }
+  schema = Schema::DeepCopySchema(schema); // 表元数据拥有自己的schema
   table_info = TableInfo::Create(); // 创建表信息
-  TableMetadata *table_meta = TableMetadata::Create(table_id, table_name, page_id, schema); // 创建表元数据，注意使用的是page_id，meta指向表的id
   TableHeap *table_heap = TableHeap::Create(buffer_pool_manager_, schema, txn, log_manager_, lock_manager_); // 创建表堆
+  // 创建表元数据，记录表堆的第一页
+  TableMetadata *table_meta = TableMetadata::Create(table_id, table_name, table_heap->GetFirstPageId(), schema);
   table_info->Init(table_meta, table_heap); // 初始化表信息
   table_names_.emplace(table_name, table_id); // 存储到table_names_中
   tables_.emplace(table_id, table_info); // 存储到tables_中
   catalog_meta_->table_meta_pages_.emplace(table_id, meta_page_id); // 存储到catalog_meta_中
   // 永久化写入元数据
   Page *metaPage = buffer_pool_manager_->FetchPage(meta_page_id); // 获取表元数据页
-  char *buf = reinterpret_cast<char *> (metaPage); // 使用buf来存储表元数据
+  char *buf = metaPage->GetData(); // 使用buf来存储表元数据
   table_meta->SerializeTo(buf); // 序列化表元数据
   buffer_pool_manager_->FlushPage(meta_page_id); // 写入磁盘
   return DB_SUCCESS;
@@ -187,7 +192,7 @@ dberr_t CatalogManager::GetTables(vector<TableInfo *> &tables) const {
  */
 dberr_t CatalogManager::CreateIndex(const std::string &table_name, const string &index_name,
                                     const std::vector<std::string> &index_keys, Txn *txn, IndexInfo *&index_info,
-                                    const string &index_type) {
+                                    const string &index_type, const IndexPredicate &predicate) {
   if (table_names_.find(table_name) == table_names_.end()) {
     // 没有对应名称的表
     return DB_TABLE_NOT_EXIST;
@@ -215,15 +220,54 @@ dberr_t CatalogManager::CreateIndex(const std::string &table_name, const string
     }
     key_map.push_back(index);
   }
+  for (const auto &term : predicate.GetTerms()) {
+    // 谓词只能比较表中的列与同类型的常量
+    if (term.column >= schema->GetColumnCount() ||
+        term.value.GetTypeId() != schema->GetColumn(term.column)->GetType()) {
+      return DB_FAILED;
+    }
+  }
   // 从catalog元数据中获取下一个索引id
   index_id_t index_id = catalog_meta_->GetNextIndexId();
   // 创建索引元数据
-  IndexMetadata *index_meta = IndexMetadata::Create(index_id, index_name, table_id, key_map);
+  IndexMetadata *index_meta = IndexMetadata::Create(index_id, index_name, table_id, key_map, index_type, predicate);
   // 初始化索引信息
+  index_info = IndexInfo::Create();
   index_info->Init(index_meta, table_info, buffer_pool_manager_);
+  if (index_info->GetIndex() == nullptr) {
+    // 不支持的索引类型或键
+    delete index_info;
+    index_info = nullptr;
+    return DB_FAILED;
+  }
+  // 用表中已有的记录批量构建索引，而不是逐条插入
+  TableHeap *table_heap = table_info->GetTableHeap();
+  auto iter = table_heap->Begin(txn);
+  auto end = table_heap->End();
+  auto next_entry = [&](Row &key, RowId &row_id) {
+    // 部分索引只收录满足谓词的记录
+    while (iter != end && !index_info->Includes(*iter)) {
+      ++iter;
+    }
+    if (iter == end) {
+      return false;
+    }
+    Row row = *iter;
+    row.GetKeyFromRow(schema, index_info->GetIndexKeySchema(), key);
+    row_id = row.GetRowId();
+    ++iter;
+    return true;
+  };
+  if (index_info->GetIndex()->BulkLoad(next_entry, txn) != DB_SUCCESS) {
+    // 已有记录中存在重复的键
+    index_info->GetIndex()->Destroy();
+    delete index_info;
+    index_info = nullptr;
+    return DB_FAILED;
+  }
   // 存入catalog元数据
   indexes_.emplace(index_id, index_info);
-  (index_names_.find(table_name)->second).emplace(index_name, index_id);
+  index_names_[table_name].emplace(index_name, index_id);
   // 永久化写入索引元数据
   page_id_t index_meta_page_id;
   buffer_pool_manager_->NewPage(index_meta_page_id);
@@ -313,6 +357,71 @@ dberr_t CatalogManager::DropIndex(const string &table_name, const string &index_
   return DB_SUCCESS;
 }
 
+/**
+ * 扫描一遍表，重建表上所有索引的统计信息并写入索引元数据页
+ */
+dberr_t CatalogManager::AnalyzeTable(const std::string &table_name, Txn *txn) {
+  TableInfo *table_info;
+  if (GetTable(table_name, table_info) != DB_SUCCESS) {
+    return DB_TABLE_NOT_EXIST;
+  }
+  std::vector<IndexInfo *> indexes;
+  GetTableIndexes(table_name, indexes);
+  std::vector<IndexStatisticsBuilder> builders;
+  for (auto index_info : indexes) {
+    builders.emplace_back(index_info->GetIndexKeySchema());
+  }
+  // 一次扫描同时为每个索引采样键
+  Schema *schema = table_info->GetSchema();
+  TableHeap *table_heap = table_info->GetTableHeap();
+  Row key;
+  for (auto iter = table_heap->Begin(txn); iter != table_heap->End(); ++iter) {
+    for (size_t i = 0; i < indexes.size(); i++) {
+      if (!indexes[i]->Includes(*iter)) {
+        continue;
+      }
+      iter->GetKeyFromRow(schema, indexes[i]->GetIndexKeySchema(), key);
+      builders[i].Add(key);
+    }
+  }
+  // 沿页链统计表的页数
+  uint32_t table_pages = 0;
+  for (page_id_t page_id = table_heap->GetFirstPageId(); page_id != INVALID_PAGE_ID; table_pages++) {
+    auto *page = reinterpret_cast<TablePage *>(buffer_pool_manager_->FetchPage(page_id));
+    page_id_t next_page_id = page->GetNextPageId();
+    buffer_pool_manager_->UnpinPage(page_id, false);
+    page_id = next_page_id;
+  }
+  for (size_t i = 0; i < indexes.size(); i++) {
+    uint32_t height;
+    uint32_t leaf_pages;
+    indexes[i]->GetIndex()->GetShape(height, leaf_pages);
+    builders[i].Finish(height, leaf_pages, table_pages, indexes[i]->GetStatistics());
+    FlushIndexStatistics(indexes[i]->GetIndexMetadata()->GetIndexId());
+  }
+  return DB_SUCCESS;
+}
+
+/**
+ * 统计信息紧跟在索引元数据之后，放不下时直方图会被合并
+ */
+dberr_t CatalogManager::FlushIndexStatistics(const index_id_t index_id) {
+  auto index_iter = indexes_.find(index_id);
+  auto page_iter = catalog_meta_->index_meta_pages_.find(index_id);
+  if (index_iter == indexes_.end() || page_iter == catalog_meta_->index_meta_pages_.end()) {
+    return DB_INDEX_NOT_FOUND;
+  }
+  IndexInfo *index_info = index_iter->second;
+  Page *index_meta_page = buffer_pool_manager_->FetchPage(page_iter->second);
+  if (index_meta_page == nullptr) {
+    return DB_FAILED;
+  }
+  uint32_t offset = index_info->GetIndexMetadata()->GetSerializedSize();
+  index_info->GetStatistics().SerializeTo(index_meta_page->GetData() + offset, PAGE_SIZE - offset);
+  buffer_pool_manager_->UnpinPage(page_iter->second, true);
+  return DB_SUCCESS;
+}
+
 /**
  * 将catalogmetaFlush
  * TODO: Student Implement
@@ -339,10 +448,11 @@ dberr_t CatalogManager::LoadTable(const table_id_t table_id, const page_id_t pag
   Page *table_meta_page = buffer_pool_manager_->FetchPage(page_id); 
   char *buf = table_meta_page->GetData();
   // 反序列化，获取table_meta
-  TableMetadata *table_meta;
+  TableMetadata *table_meta = nullptr;
   TableMetadata::DeserializeFrom(buf, table_meta);
   // 获取table_heap
-  TableHeap *table_heap = TableHeap::Create(buffer_pool_manager_, page_id, table_meta->GetSchema(), log_manager_, lock_manager_);
+  TableHeap *table_heap = TableHeap::Create(buffer_pool_manager_, table_meta->GetFirstPageId(), table_meta->GetSchema(),
+                                            log_manager_, lock_manager_);
   // 获取table_info
   TableInfo *table_info = TableInfo::Create();
   table_info->Init(table_meta, table_heap);
@@ -366,7 +476,7 @@ dberr_t CatalogManager::LoadIndex(const index_id_t index_id, const page_id_t pag
   Page *index_meta_page = buffer_pool_manager_->FetchPage(page_id);
   char *buf = index_meta_page->GetData();
   // 反序列化，获取index_meta
-  IndexMetadata *index_meta;
+  IndexMetadata *index_meta = nullptr;
   IndexMetadata::DeserializeFrom(buf, index_meta);
   // 获取table_info
   table_id_t table_id = index_meta->GetTableId();
@@ -374,6 +484,9 @@ dberr_t CatalogManager::LoadIndex(const index_id_t index_id, const page_id_t pag
   // 获取index_info
   IndexInfo *index_info = IndexInfo::Create();
   index_info->Init(index_meta, table_info, buffer_pool_manager_);
+  // 读取元数据之后的统计信息，未分析过的索引没有
+  uint32_t offset = index_meta->GetSerializedSize();
+  index_info->GetStatistics().DeserializeFrom(buf + offset, PAGE_SIZE - offset);
   // 更新catalogmeta
   catalog_meta_->index_meta_pages_[index_id] = page_id;
   indexes_[index_id] = index_info;
@@ -0,0 +1,112 @@
+#include "catalog/index_predicate.h"
+
+bool IndexPredicate::Compare(const Field &field, const std::string &op, const Field &value) {
+  if (field.IsNull() || value.IsNull() || !field.CheckComparable(value)) {
+    return false;
+  }
+  CmpBool result = CmpBool::kNull;
+  if (op == "=") {
+    result = field.CompareEquals(value);
+  } else if (op == "<>") {
+    result = field.CompareNotEquals(value);
+  } else if (op == "<") {
+    result = field.CompareLessThan(value);
+  } else if (op == "<=") {
+    result = field.CompareLessThanEquals(value);
+  } else if (op == ">") {
+    result = field.CompareGreaterThan(value);
+  } else if (op == ">=") {
+    result = field.CompareGreaterThanEquals(value);
+  }
+  return result == CmpBool::kTrue;
+}
+
+bool IndexPredicate::Evaluate(const Row &row) const {
+  for (const auto &term : terms_) {
+    if (!Compare(*row.GetField(term.column), term.op, term.value)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/*
+ * An equality implies the term if its value satisfies the term. A lower bound
+ * "> v" or ">= v" implies a lower bound or an inequality of the term if v is
+ * not below the term's bound, with v equal to the bound only when that bound is
+ * no stricter than the query's; upper bounds are the mirror image. An
+ * inequality only implies the same inequality.
+ */
+bool IndexPredicate::Implies(uint32_t column, const std::string &op, const Field &value, const Term &term) {
+  if (column != term.column || value.IsNull() || !value.CheckComparable(term.value)) {
+    return false;
+  }
+  if (op == "=") {
+    return Compare(value, term.op, term.value);
+  }
+  if (op == "<>") {
+    return term.op == "<>" && Compare(value, "=", term.value);
+  }
+  bool lower = op == ">" || op == ">=";
+  bool upper = op == "<" || op == "<=";
+  bool strict = op == ">" || op == "<";
+  if (lower && (term.op == ">=" || term.op == ">" || term.op == "<>")) {
+    return Compare(value, (term.op == ">=" || strict) ? ">=" : ">", term.value);
+  }
+  if (upper && (term.op == "<=" || term.op == "<" || term.op == "<>")) {
+    return Compare(value, (term.op == "<=" || strict) ? "<=" : "<", term.value);
+  }
+  return false;
+}
+
+uint32_t IndexPredicate::SerializeTo(char *buf) const {
+  char *p = buf;
+  // term count
+  MACH_WRITE_UINT32(buf, terms_.size());
+  buf += 4;
+  for (const auto &term : terms_) {
+    // column
+    MACH_WRITE_UINT32(buf, term.column);
+    buf += 4;
+    // compare operator
+    MACH_WRITE_UINT32(buf, term.op.length());
+    buf += 4;
+    MACH_WRITE_STRING(buf, term.op);
+    buf += term.op.length();
+    // constant, never null
+    MACH_WRITE_TO(TypeId, buf, term.value.GetTypeId());
+    buf += sizeof(TypeId);
+    buf += term.value.SerializeTo(buf);
+  }
+  return buf - p;
+}
+
+uint32_t IndexPredicate::GetSerializedSize() const {
+  uint32_t size = sizeof(uint32_t);
+  for (const auto &term : terms_) {
+    size += 2 * sizeof(uint32_t) + term.op.length() + sizeof(TypeId) + term.value.GetSerializedSize();
+  }
+  return size;
+}
+
+uint32_t IndexPredicate::DeserializeFrom(char *buf, IndexPredicate &predicate) {
+  char *p = buf;
+  predicate.terms_.clear();
+  uint32_t term_count = MACH_READ_UINT32(buf);
+  buf += 4;
+  for (uint32_t i = 0; i < term_count; i++) {
+    uint32_t column = MACH_READ_UINT32(buf);
+    buf += 4;
+    uint32_t op_len = MACH_READ_UINT32(buf);
+    buf += 4;
+    std::string op(buf, op_len);
+    buf += op_len;
+    TypeId type_id = MACH_READ_FROM(TypeId, buf);
+    buf += sizeof(TypeId);
+    Field *value = nullptr;
+    buf += Field::DeserializeFrom(buf, type_id, &value, false);
+    predicate.terms_.emplace_back(column, op, *value);
+    delete value;
+  }
+  return buf - p;
+}
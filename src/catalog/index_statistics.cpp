@@ -0,0 +1,276 @@
+#include "catalog/index_statistics.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "index/prefix_b_plus_tree_index.h"
+#include "storage/bloom_filter.h"
+
+void HyperLogLog::Add(uint64_t hash) {
+  // the low bits pick the register, the rank is the position of the first set bit in the rest
+  uint32_t index = static_cast<uint32_t>(hash & (REGISTER_COUNT - 1));
+  uint64_t rest = hash >> PRECISION;
+  auto rank = static_cast<uint8_t>(rest == 0 ? 64 - PRECISION + 1 : __builtin_ctzll(rest) + 1);
+  registers_[index] = std::max(registers_[index], rank);
+}
+
+uint64_t HyperLogLog::Estimate() const {
+  double sum = 0;
+  uint32_t zeros = 0;
+  for (uint8_t reg : registers_) {
+    sum += std::ldexp(1.0, -reg);
+    zeros += reg == 0;
+  }
+  double m = REGISTER_COUNT;
+  double estimate = 0.7213 / (1 + 1.079 / m) * m * m / sum;
+  // linear counting is more accurate while many registers are still empty
+  if (estimate <= 2.5 * m && zeros > 0) {
+    estimate = m * std::log(m / zeros);
+  }
+  return static_cast<uint64_t>(estimate + 0.5);
+}
+
+IndexStatistics::IndexStatistics(const IndexStatistics &other) { *this = other; }
+
+IndexStatistics &IndexStatistics::operator=(const IndexStatistics &other) {
+  if (this == &other) {
+    return *this;
+  }
+  std::scoped_lock guard(latch_, other.latch_);
+  analyzed_ = other.analyzed_;
+  entry_count_ = other.entry_count_;
+  height_ = other.height_;
+  leaf_pages_ = other.leaf_pages_;
+  table_pages_ = other.table_pages_;
+  leading_distinct_ = other.leading_distinct_;
+  distinct_ = other.distinct_;
+  bounds_ = other.bounds_;
+  return *this;
+}
+
+uint64_t IndexStatistics::GetDistinctKeys() const {
+  std::lock_guard<std::mutex> guard(latch_);
+  // the sketch never forgets removed keys, entries bound the estimate
+  return std::min(distinct_.Estimate(), entry_count_);
+}
+
+double IndexStatistics::CumulativeFraction(const std::string &value, bool inclusive) const {
+  if (bounds_.empty()) {
+    return 0.5;
+  }
+  auto bound = inclusive ? std::upper_bound(bounds_.begin(), bounds_.end(), value)
+                         : std::lower_bound(bounds_.begin(), bounds_.end(), value);
+  if (bound == bounds_.begin()) {
+    return 0;
+  }
+  if (bound == bounds_.end()) {
+    return 1;
+  }
+  size_t bucket = bound - bounds_.begin() - 1;
+  // interpolate inside the bucket on the leading 8 bytes, the encoding keeps their order
+  auto prefix = [](const std::string &key) {
+    uint64_t bits = 0;
+    for (size_t i = 0; i < 8; i++) {
+      bits = bits << 8 | (i < key.size() ? static_cast<uint8_t>(key[i]) : 0);
+    }
+    return static_cast<double>(bits);
+  };
+  double low = prefix(bounds_[bucket]);
+  double high = prefix(bounds_[bucket + 1]);
+  double within = high > low ? std::clamp((prefix(value) - low) / (high - low), 0.0, 1.0) : 0.5;
+  return (bucket + within) / GetBucketCount();
+}
+
+double IndexStatistics::EqualSelectivity(const std::string &value) const {
+  std::lock_guard<std::mutex> guard(latch_);
+  if (bounds_.empty()) {
+    return 0;
+  }
+  // a value spanning several bounds is frequent, it covers the buckets between them
+  auto range = std::equal_range(bounds_.begin(), bounds_.end(), value);
+  double frequent = range.second - range.first > 1 ? (range.second - range.first - 1.0) / GetBucketCount() : 0;
+  return std::max(frequent, 1.0 / std::max<uint64_t>(leading_distinct_, 1));
+}
+
+double IndexStatistics::RangeSelectivity(const std::string *lower, bool lower_inclusive, const std::string *upper,
+                                         bool upper_inclusive) const {
+  std::lock_guard<std::mutex> guard(latch_);
+  double high = upper == nullptr ? 1 : CumulativeFraction(*upper, upper_inclusive);
+  double low = lower == nullptr ? 0 : CumulativeFraction(*lower, !lower_inclusive);
+  return std::max(high - low, 0.0);
+}
+
+double IndexStatistics::ScanCost(double selectivity) const {
+  std::lock_guard<std::mutex> guard(latch_);
+  double rows = selectivity * entry_count_;
+  double ordered_rows = std::min<double>(rows, INDEX_SCAN_BITMAP_THRESHOLD);
+  double bitmap_pages = std::min<double>(rows - ordered_rows, table_pages_);
+  return height_ + selectivity * leaf_pages_ + ordered_rows * INDEX_RANDOM_PAGE_COST + bitmap_pages;
+}
+
+void IndexStatistics::RecordInsert(uint64_t key_hash) {
+  std::lock_guard<std::mutex> guard(latch_);
+  entry_count_++;
+  distinct_.Add(key_hash);
+}
+
+void IndexStatistics::RecordRemove() {
+  std::lock_guard<std::mutex> guard(latch_);
+  if (entry_count_ > 0) {
+    entry_count_--;
+  }
+}
+
+bool IndexStatistics::KeyHash(const Row &key, const IndexSchema *key_schema, uint64_t &hash) {
+  std::string encoded;
+  if (!PrefixBPlusTreeIndex::EncodeKey(key, key_schema, encoded)) {
+    return false;
+  }
+  hash = BloomFilter::Hash(encoded);
+  return true;
+}
+
+bool IndexStatistics::EncodeValue(const Field &value, const IndexSchema *key_schema, std::string &encoded) {
+  if (value.IsNull() || value.GetTypeId() != key_schema->GetColumn(0)->GetType()) {
+    return false;
+  }
+  std::vector<Field> fields;
+  fields.emplace_back(value);
+  return PrefixBPlusTreeIndex::EncodeKey(Row(fields), key_schema, encoded);
+}
+
+uint32_t IndexStatistics::GetSerializedSize(const std::vector<const std::string *> &bounds) {
+  uint32_t size = 4 + 1 + 8 + 4 * 3 + 8 + HyperLogLog::REGISTER_COUNT + 4;
+  for (auto bound : bounds) {
+    size += 4 + bound->size();
+  }
+  return size;
+}
+
+uint32_t IndexStatistics::SerializeTo(char *buf, uint32_t size) const {
+  std::lock_guard<std::mutex> guard(latch_);
+  std::vector<const std::string *> bounds;
+  for (const auto &bound : bounds_) {
+    bounds.push_back(&bound);
+  }
+  // merge pairs of buckets until the histogram fits, the last bound is always kept
+  while (bounds.size() > 2 && GetSerializedSize(bounds) > size) {
+    std::vector<const std::string *> merged;
+    for (size_t i = 0; i + 1 < bounds.size(); i += 2) {
+      merged.push_back(bounds[i]);
+    }
+    merged.push_back(bounds.back());
+    bounds.swap(merged);
+  }
+  if (GetSerializedSize(bounds) > size) {
+    bounds.clear();
+  }
+  char *p = buf;
+  MACH_WRITE_UINT32(buf, INDEX_STATISTICS_MAGIC_NUM);
+  buf += 4;
+  MACH_WRITE_TO(uint8_t, buf, analyzed_);
+  buf += 1;
+  MACH_WRITE_TO(uint64_t, buf, entry_count_);
+  buf += 8;
+  MACH_WRITE_UINT32(buf, height_);
+  buf += 4;
+  MACH_WRITE_UINT32(buf, leaf_pages_);
+  buf += 4;
+  MACH_WRITE_UINT32(buf, table_pages_);
+  buf += 4;
+  MACH_WRITE_TO(uint64_t, buf, leading_distinct_);
+  buf += 8;
+  memcpy(buf, distinct_.GetRegisters().data(), HyperLogLog::REGISTER_COUNT);
+  buf += HyperLogLog::REGISTER_COUNT;
+  MACH_WRITE_UINT32(buf, bounds.size());
+  buf += 4;
+  for (auto bound : bounds) {
+    MACH_WRITE_UINT32(buf, bound->size());
+    buf += 4;
+    memcpy(buf, bound->data(), bound->size());
+    buf += bound->size();
+  }
+  return buf - p;
+}
+
+uint32_t IndexStatistics::DeserializeFrom(const char *buf, uint32_t size) {
+  std::lock_guard<std::mutex> guard(latch_);
+  const char *p = buf;
+  analyzed_ = false;
+  entry_count_ = 0;
+  bounds_.clear();
+  if (size < GetSerializedSize({}) || MACH_READ_UINT32(buf) != INDEX_STATISTICS_MAGIC_NUM) {
+    return 0;
+  }
+  buf += 4;
+  analyzed_ = MACH_READ_FROM(uint8_t, buf) != 0;
+  buf += 1;
+  entry_count_ = MACH_READ_FROM(uint64_t, buf);
+  buf += 8;
+  height_ = MACH_READ_UINT32(buf);
+  buf += 4;
+  leaf_pages_ = MACH_READ_UINT32(buf);
+  buf += 4;
+  table_pages_ = MACH_READ_UINT32(buf);
+  buf += 4;
+  leading_distinct_ = MACH_READ_FROM(uint64_t, buf);
+  buf += 8;
+  memcpy(distinct_.GetRegisters().data(), buf, HyperLogLog::REGISTER_COUNT);
+  buf += HyperLogLog::REGISTER_COUNT;
+  uint32_t bound_count = MACH_READ_UINT32(buf);
+  buf += 4;
+  for (uint32_t i = 0; i < bound_count; i++) {
+    uint32_t len = MACH_READ_UINT32(buf);
+    buf += 4;
+    bounds_.emplace_back(buf, len);
+    buf += len;
+  }
+  return buf - p;
+}
+
+IndexStatisticsBuilder::IndexStatisticsBuilder(const IndexSchema *key_schema) : key_schema_(key_schema) {}
+
+void IndexStatisticsBuilder::Add(const Row &key) {
+  std::string encoded;
+  if (!PrefixBPlusTreeIndex::EncodeKey(key, key_schema_, encoded)) {
+    return;
+  }
+  entry_count_++;
+  distinct_.Add(BloomFilter::Hash(encoded));
+  std::string leading;
+  std::vector<Field> fields;
+  fields.emplace_back(*key.GetField(0));
+  PrefixBPlusTreeIndex::EncodeKey(Row(fields), key_schema_, leading);
+  leading_distinct_.Add(BloomFilter::Hash(leading));
+  // reservoir sampling, every value is kept with the same probability
+  if (sample_.size() < STATISTICS_SAMPLE_SIZE) {
+    sample_.push_back(std::move(leading));
+  } else {
+    uint64_t slot = rng_() % entry_count_;
+    if (slot < STATISTICS_SAMPLE_SIZE) {
+      sample_[slot] = std::move(leading);
+    }
+  }
+}
+
+void IndexStatisticsBuilder::Finish(uint32_t height, uint32_t leaf_pages, uint32_t table_pages,
+                                    IndexStatistics &stats) {
+  std::sort(sample_.begin(), sample_.end());
+  std::vector<std::string> bounds;
+  if (!sample_.empty()) {
+    size_t buckets = std::min<size_t>(STATISTICS_HISTOGRAM_BUCKETS, sample_.size());
+    for (size_t i = 0; i < buckets; i++) {
+      bounds.push_back(sample_[i * sample_.size() / buckets]);
+    }
+    bounds.push_back(sample_.back());
+  }
+  std::lock_guard<std::mutex> guard(stats.latch_);
+  stats.analyzed_ = true;
+  stats.entry_count_ = entry_count_;
+  stats.height_ = height;
+  stats.leaf_pages_ = leaf_pages;
+  stats.table_pages_ = table_pages;
+  stats.leading_distinct_ = std::min(leading_distinct_.Estimate(), entry_count_);
+  stats.distinct_ = distinct_;
+  stats.bounds_ = std::move(bounds);
+}
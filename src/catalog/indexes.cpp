@@ -1,12 +1,19 @@
 #include "../include/catalog/indexes.h"
 
 IndexMetadata::IndexMetadata(const index_id_t index_id, const std::string &index_name, const table_id_t table_id,
-                             const std::vector<uint32_t> &key_map)
-    : index_id_(index_id), index_name_(index_name), table_id_(table_id), key_map_(key_map) {}
+                             const std::vector<uint32_t> &key_map, const std::string &index_type,
+                             const IndexPredicate &predicate)
+    : index_id_(index_id),
+      index_name_(index_name),
+      table_id_(table_id),
+      key_map_(key_map),
+      index_type_(index_type),
+      predicate_(predicate) {}
 
 IndexMetadata *IndexMetadata::Create(const index_id_t index_id, const string &index_name, const table_id_t table_id,
-                                     const vector<uint32_t> &key_map) {
-  return new IndexMetadata(index_id, index_name, table_id, key_map);
+                                     const vector<uint32_t> &key_map, const string &index_type,
+                                     const IndexPredicate &predicate) {
+  return new IndexMetadata(index_id, index_name, table_id, key_map, index_type, predicate);
 }
 
 uint32_t IndexMetadata::SerializeTo(char *buf) const {
@@ -35,6 +42,13 @@ uint32_t IndexMetadata::SerializeTo(char *buf) const {
     MACH_WRITE_UINT32(buf, col_index);
     buf += 4;
   }
+  // index type
+  MACH_WRITE_UINT32(buf, index_type_.length());
+  buf += 4;
+  MACH_WRITE_STRING(buf, index_type_);
+  buf += index_type_.length();
+  // predicate of a partial index
+  buf += predicate_.SerializeTo(buf);
   ASSERT(buf - p == ofs, "Unexpected serialize size.");
   return ofs;
 }
@@ -43,11 +57,12 @@ uint32_t IndexMetadata::SerializeTo(char *buf) const {
  * TODO: Student Implement
  */
 uint32_t IndexMetadata::GetSerializedSize() const {
-  // uint32_t: magic num, index name的长度, key count
+  // uint32_t: magic num, index name的长度, key count, index type的长度
   // index_id_t: index id
   // table_id_t: table id
   // index_name_.length(): index_name_是字符串，所以需要计算字符串的长度
-  return 3 * sizeof(uint32_t) + sizeof(index_id_t) + sizeof(table_id_t) + index_name_.length() + sizeof(uint32_t) * key_map_.size();
+  return 4 * sizeof(uint32_t) + sizeof(index_id_t) + sizeof(table_id_t) + index_name_.length() +
+         sizeof(uint32_t) * key_map_.size() + index_type_.length() + predicate_.GetSerializedSize();
 }
 
 uint32_t IndexMetadata::DeserializeFrom(char *buf, IndexMetadata *&index_meta) {
@@ -80,12 +95,86 @@ uint32_t IndexMetadata::DeserializeFrom(char *buf, IndexMetadata *&index_meta) {
     buf += 4;
     key_map.push_back(key_index);
   }
+  // index type
+  uint32_t type_len = MACH_READ_UINT32(buf);
+  buf += 4;
+  std::string index_type(buf, type_len);
+  buf += type_len;
+  // predicate of a partial index
+  IndexPredicate predicate;
+  buf += IndexPredicate::DeserializeFrom(buf, predicate);
   // allocate space for index meta data
-  index_meta = new IndexMetadata(index_id, index_name, table_id, key_map);
+  index_meta = new IndexMetadata(index_id, index_name, table_id, key_map, index_type, predicate);
   return buf - p;
 }
 
 Index *IndexInfo::CreateIndex(BufferPoolManager *buffer_pool_manager, const string &index_type) {
+  // 单个非空的INT/FLOAT列使用定长原生键的B+树，避免GenericKey的序列化与反序列化
+  if (index_type == "bptree" && key_schema_->GetColumnCount() == 1 && !key_schema_->GetColumn(0)->IsNullable()) {
+    TypeId key_type = key_schema_->GetColumn(0)->GetType();
+    if (key_type == TypeId::kTypeInt) {
+      return new TypedBPlusTreeIndex<int32_t, BasicComparator<int32_t>>(meta_data_->index_id_, key_schema_,
+                                                                         buffer_pool_manager);
+    }
+    if (key_type == TypeId::kTypeFloat) {
+      return new TypedBPlusTreeIndex<float, BasicComparator<float>>(meta_data_->index_id_, key_schema_,
+                                                                     buffer_pool_manager);
+    }
+  }
+  // 两个非空的INT/FLOAT列拼接成一个64位的键，保持(第一列, 第二列)的字典序，可按前缀扫描
+  if (index_type == "bptree" && key_schema_->GetColumnCount() == 2) {
+    bool packable = true;
+    for (auto col : key_schema_->GetColumns()) {
+      if (col->IsNullable() || (col->GetType() != TypeId::kTypeInt && col->GetType() != TypeId::kTypeFloat)) {
+        packable = false;
+      }
+    }
+    if (packable) {
+      return new TypedBPlusTreeIndex<int64_t, BasicComparator<int64_t>>(meta_data_->index_id_, key_schema_,
+                                                                         buffer_pool_manager);
+    }
+  }
+  // 其余的键（CHAR列、多列组合等）编码为变长字节串，存入按页压缩公共前缀的B+树
+  if (index_type == "bptree") {
+    if (PrefixBPlusTreeIndex::MaxEncodedKeySize(key_schema_) > PrefixBPlusTree::MAX_KEY_SIZE) {
+      LOG(ERROR) << "Index key size is too large";
+      return nullptr;
+    }
+    return new PrefixBPlusTreeIndex(meta_data_->index_id_, key_schema_, buffer_pool_manager);
+  }
+  // 写密集的表可选LSM树：插入只写内存中的跳表，磁盘页由后台的刷盘与合并顺序写出
+  if (index_type == "lsm") {
+    if (PrefixBPlusTreeIndex::MaxEncodedKeySize(key_schema_) > LsmTree::MAX_KEY_SIZE) {
+      LOG(ERROR) << "Index key size is too large";
+      return nullptr;
+    }
+    return new LsmIndex(meta_data_->index_id_, key_schema_, buffer_pool_manager);
+  }
+  // 允许重复键的索引：每个键对应一个RowId的倒排列表
+  if (index_type == "posting") {
+    if (key_schema_->GetColumnCount() == 1 && !key_schema_->GetColumn(0)->IsNullable()) {
+      TypeId key_type = key_schema_->GetColumn(0)->GetType();
+      if (key_type == TypeId::kTypeInt) {
+        return new PostingListIndex<int32_t, BasicComparator<int32_t>>(meta_data_->index_id_, key_schema_,
+                                                                       buffer_pool_manager);
+      }
+      if (key_type == TypeId::kTypeFloat) {
+        return new PostingListIndex<float, BasicComparator<float>>(meta_data_->index_id_, key_schema_,
+                                                                   buffer_pool_manager);
+      }
+    }
+    LOG(ERROR) << "Posting index only supports a single non-null INT or FLOAT column";
+    return nullptr;
+  }
+  // 读多写少的整数键可选learned索引：分段线性模型代替内部节点，建成后只读
+  if (index_type == "learned") {
+    if (key_schema_->GetColumnCount() == 1 && !key_schema_->GetColumn(0)->IsNullable() &&
+        key_schema_->GetColumn(0)->GetType() == TypeId::kTypeInt) {
+      return new LearnedIndex(meta_data_->index_id_, key_schema_, buffer_pool_manager);
+    }
+    LOG(ERROR) << "Learned index only supports a single non-null INT column";
+    return nullptr;
+  }
   size_t max_size = 0;
   uint32_t column_cnt = key_schema_->GetColumns().size();
   size_t size_bitmap = (column_cnt % 8) ? column_cnt / 8 + 1 : column_cnt / 8;
@@ -98,23 +187,15 @@ Index *IndexInfo::CreateIndex(BufferPoolManager *buffer_pool_manager, const stri
     max_size += col->GetLength();
   }
 
-  if (index_type == "bptree") {
-    if (max_size <= 8)
-      max_size = 16;
-    else if (max_size <= 24)
-      max_size = 32;
-    else if (max_size <= 56)
-      max_size = 64;
-    else if (max_size <= 120)
-      max_size = 128;
-    else if (max_size <= 248)
-      max_size = 256;
-    else {
-      LOG(ERROR) << "GenericKey size is too large";
+  if (index_type == "hash") {
+    // Row::SerializeTo写入8字节的null bitmap，按8字节对齐使RowId与键在桶中对齐
+    max_size += sizeof(uint64_t);
+    max_size = (max_size + 7) / 8 * 8;
+    if (max_size > PAGE_SIZE / 8) {
+      LOG(ERROR) << "Hash index key size is too large";
       return nullptr;
     }
-  } else {
-    return nullptr;
+    return new ExtendibleHashIndex(meta_data_->index_id_, key_schema_, max_size, buffer_pool_manager);
   }
-  return new BPlusTreeIndex(meta_data_->index_id_, key_schema_, max_size, buffer_pool_manager);
+  return nullptr;
 }
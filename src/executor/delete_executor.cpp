@@ -12,20 +12,52 @@ void DeleteExecutor::Init() {
   child_executor_->Init();
   exec_ctx_->GetCatalog()->GetTable(plan_->GetTableName(), table_info_);
   exec_ctx_->GetCatalog()->GetTableIndexes(table_info_->GetTableName(), index_info_);
+  for (auto info : index_info_) {
+    if (info->GetIndex()->IsReadOnly()) {
+      // 只读索引（如learned）建成后不能修改，需先删除索引
+      throw std::logic_error("Cannot delete from a table with the read-only index " + info->GetIndexName());
+    }
+  }
   txn_ = exec_ctx_->GetTransaction();
+  done_ = false;
 }
 
-bool DeleteExecutor::Next([[maybe_unused]] Row *row, RowId *rid) {
-  if (child_executor_->Next(row, rid)) {
-    if (!table_info_->GetTableHeap()->MarkDelete(*rid, txn_)) {
-      return false;
+bool DeleteExecutor::DeleteRow(Row &row, RowId rid) {
+  if (!table_info_->GetTableHeap()->MarkDelete(rid, txn_)) {
+    return false;
+  }
+  Row key_row;
+  for (auto info : index_info_) {  // 更新索引
+    if (!info->Includes(row)) {
+      // 部分索引中没有这条记录
+      continue;
     }
-    Row key_row;
-    for (auto info : index_info_) {  // 更新索引
-      row->GetKeyFromRow(table_info_->GetSchema(), info->GetIndexKeySchema(), key_row);
-      info->GetIndex()->RemoveEntry(key_row, *rid, txn_);
+    row.GetKeyFromRow(table_info_->GetSchema(), info->GetIndexKeySchema(), key_row);
+    info->GetIndex()->RemoveEntry(key_row, rid, txn_);
+    info->RecordRemove();
+  }
+  return true;
+}
+
+bool DeleteExecutor::Next([[maybe_unused]] Row *row, RowId *rid) {
+  return child_executor_->Next(row, rid) && DeleteRow(*row, *rid);
+}
+
+/*
+ * A row that cannot be deleted ends the delete, as it does for Next.
+ */
+bool DeleteExecutor::NextBatch(RowBatch &batch) {
+  batch.Clear();
+  Row row;
+  while (!done_ && batch.GetSize() == 0 && child_executor_->NextBatch(child_batch_)) {
+    for (auto i : child_batch_.GetSelection()) {
+      child_batch_.GetRow(i, row);
+      if (!DeleteRow(row, row.GetRowId())) {
+        done_ = true;
+        break;
+      }
+      batch.AppendRowId(row.GetRowId());
     }
-    return true;
   }
-  return false;
+  return batch.GetSize() > 0;
 }
\ No newline at end of file
@@ -5,11 +5,15 @@
 #include <sys/types.h>
 
 #include <chrono>
+#include <stdexcept>
 
 #include "common/result_writer.h"
 #include "executor/executors/delete_executor.h"
+#include "executor/executors/hash_join_executor.h"
+#include "executor/executors/index_nested_loop_join_executor.h"
 #include "executor/executors/index_scan_executor.h"
 #include "executor/executors/insert_executor.h"
+#include "executor/executors/merge_join_executor.h"
 #include "executor/executors/seq_scan_executor.h"
 #include "executor/executors/update_executor.h"
 #include "executor/executors/values_executor.h"
@@ -70,6 +74,25 @@ std::unique_ptr<AbstractExecutor> ExecuteEngine::CreateExecutor(ExecuteContext *
     case PlanType::Values: {
       return std::make_unique<ValuesExecutor>(exec_ctx, dynamic_cast<const ValuesPlanNode *>(plan.get()));
     }
+    case PlanType::HashJoin: {
+      auto join_plan = dynamic_cast<const HashJoinPlanNode *>(plan.get());
+      auto left_executor = CreateExecutor(exec_ctx, join_plan->GetLeftPlan());
+      auto right_executor = CreateExecutor(exec_ctx, join_plan->GetRightPlan());
+      return std::make_unique<HashJoinExecutor>(exec_ctx, join_plan, std::move(left_executor),
+                                                std::move(right_executor));
+    }
+    case PlanType::IndexNestedLoopJoin: {
+      auto join_plan = dynamic_cast<const IndexNestedLoopJoinPlanNode *>(plan.get());
+      auto outer_executor = CreateExecutor(exec_ctx, join_plan->GetOuterPlan());
+      return std::make_unique<IndexNestedLoopJoinExecutor>(exec_ctx, join_plan, std::move(outer_executor));
+    }
+    case PlanType::MergeJoin: {
+      auto join_plan = dynamic_cast<const MergeJoinPlanNode *>(plan.get());
+      auto left_executor = CreateExecutor(exec_ctx, join_plan->GetLeftPlan());
+      auto right_executor = CreateExecutor(exec_ctx, join_plan->GetRightPlan());
+      return std::make_unique<MergeJoinExecutor>(exec_ctx, join_plan, std::move(left_executor),
+                                                 std::move(right_executor));
+    }
     default:
       throw std::logic_error("Unsupported plan type.");
   }
@@ -82,11 +105,14 @@ dberr_t ExecuteEngine::ExecutePlan(const AbstractPlanNodeRef &plan, std::vector<
 
   try {
     executor->Init();
-    RowId rid{};
-    Row row{};
-    while (executor->Next(&row, &rid)) {
+    RowBatch batch;
+    while (executor->NextBatch(batch)) {
       if (result_set != nullptr) {
-        result_set->push_back(row);
+        result_set->reserve(result_set->size() + batch.GetSelection().size());
+        for (auto i : batch.GetSelection()) {
+          result_set->emplace_back();
+          batch.GetRow(i, result_set->back());
+        }
       }
     }
   } catch (const exception &ex) {
@@ -137,6 +163,8 @@ dberr_t ExecuteEngine::Execute(pSyntaxNode ast) {
       return ExecuteExecfile(ast, context.get());
     case kNodeQuit:
       return ExecuteQuit(ast, context.get());
+    case kNodeAnalyze:
+      return ExecuteAnalyze(ast, context.get());
     default:
       break;
   }
@@ -158,7 +186,7 @@ dberr_t ExecuteEngine::Execute(pSyntaxNode ast) {
   std::stringstream ss;
   ResultWriter writer(ss);
 
-  if (planner.plan_->GetType() == PlanType::SeqScan || planner.plan_->GetType() == PlanType::IndexScan) {
+  if (ast->type_ == kNodeSelect) {
     auto schema = planner.plan_->OutputSchema();
     auto num_of_columns = schema->GetColumnCount();
     if (!result_set.empty()) {
@@ -367,14 +395,124 @@ dberr_t ExecuteEngine::ExecuteShowIndexes(pSyntaxNode ast, ExecuteContext *conte
   return DB_FAILED;
 }
 
+/*
+ * Parse a number literal as the constant of an INT column, false unless the
+ * whole literal is an integer in the range of int32_t.
+ */
+static bool ParseInt(const char *literal, int32_t &value) {
+  size_t length = 0;
+  long long parsed;
+  try {
+    parsed = std::stoll(literal, &length);
+  } catch (const std::invalid_argument &) {
+    return false;
+  } catch (const std::out_of_range &) {
+    return false;
+  }
+  if (literal[length] != '\0' || parsed < INT32_MIN || parsed > INT32_MAX) {
+    return false;
+  }
+  value = static_cast<int32_t>(parsed);
+  return true;
+}
+
+/*
+ * Parse a number literal as the constant of a FLOAT column, false unless the
+ * whole literal is a number in the range of float.
+ */
+static bool ParseFloat(const char *literal, float &value) {
+  size_t length = 0;
+  try {
+    value = std::stof(literal, &length);
+  } catch (const std::invalid_argument &) {
+    return false;
+  } catch (const std::out_of_range &) {
+    return false;
+  }
+  return literal[length] == '\0';
+}
+
+/*
+ * Add the comparisons of a WHERE clause of CREATE INDEX to the predicate, false
+ * if it is not a conjunction of comparisons of a column with a non-null
+ * constant of the column's type.
+ */
+static bool AddPredicateTerms(pSyntaxNode node, Schema *schema, IndexPredicate &predicate) {
+  if (node->type_ == kNodeConnector) {
+    return strcmp(node->val_, "and") == 0 && AddPredicateTerms(node->child_, schema, predicate) &&
+           AddPredicateTerms(node->child_->next_, schema, predicate);
+  }
+  std::string op = node->val_;
+  if (op != "=" && op != "<>" && op != "<" && op != "<=" && op != ">" && op != ">=") {
+    return false;
+  }
+  uint32_t column_index;
+  if (schema->GetColumnIndex(node->child_->val_, column_index) != DB_SUCCESS) {
+    return false;
+  }
+  pSyntaxNode value = node->child_->next_;
+  TypeId type = schema->GetColumn(column_index)->GetType();
+  if (type == TypeId::kTypeChar && value->type_ == kNodeString) {
+    predicate.AddTerm(column_index, op, Field(type, value->val_, strlen(value->val_), true));
+  } else if (type == TypeId::kTypeInt && value->type_ == kNodeNumber) {
+    int32_t constant;
+    if (!ParseInt(value->val_, constant)) {
+      return false;
+    }
+    predicate.AddTerm(column_index, op, Field(type, constant));
+  } else if (type == TypeId::kTypeFloat && value->type_ == kNodeNumber) {
+    float constant;
+    if (!ParseFloat(value->val_, constant)) {
+      return false;
+    }
+    predicate.AddTerm(column_index, op, Field(type, constant));
+  } else {
+    return false;
+  }
+  return true;
+}
+
 /**
- * TODO: Student Implement
+ * CREATE INDEX name ON table (keys) [USING type] [WHERE conditions], the
+ * conditions make a partial index holding only the rows that satisfy them.
  */
 dberr_t ExecuteEngine::ExecuteCreateIndex(pSyntaxNode ast, ExecuteContext *context) {
 #ifdef ENABLE_EXECUTE_DEBUG
   LOG(INFO) << "ExecuteCreateIndex" << std::endl;
 #endif
-  return DB_FAILED;
+  if (current_db_.empty()) {
+    cout << "No database selected" << endl;
+    return DB_FAILED;
+  }
+  pSyntaxNode node = ast->child_;
+  string index_name = node->val_;
+  node = node->next_;
+  string table_name = node->val_;
+  node = node->next_;
+  vector<string> index_keys;
+  for (pSyntaxNode key = node->child_; key != nullptr; key = key->next_) {
+    index_keys.emplace_back(key->val_);
+  }
+  string index_type = "bptree";
+  IndexPredicate predicate;
+  for (node = node->next_; node != nullptr; node = node->next_) {
+    if (node->type_ == kNodeIndexType) {
+      index_type = node->child_->val_;
+    } else if (node->type_ == kNodeConditions) {
+      TableInfo *table_info;
+      if (context->GetCatalog()->GetTable(table_name, table_info) != DB_SUCCESS) {
+        return DB_TABLE_NOT_EXIST;
+      }
+      if (!AddPredicateTerms(node->child_, table_info->GetSchema(), predicate)) {
+        cout << "The predicate of an index must be an AND of comparisons of columns with non-null constants of "
+                "their types" << endl;
+        return DB_FAILED;
+      }
+    }
+  }
+  IndexInfo *index_info;
+  return context->GetCatalog()->CreateIndex(table_name, index_name, index_keys, context->GetTransaction(), index_info,
+                                            index_type, predicate);
 }
 
 /**
@@ -427,3 +565,15 @@ dberr_t ExecuteEngine::ExecuteQuit(pSyntaxNode ast, ExecuteContext *context) {
 #endif
  return DB_FAILED;
 }
+
+dberr_t ExecuteEngine::ExecuteAnalyze(pSyntaxNode ast, ExecuteContext *context) {
+#ifdef ENABLE_EXECUTE_DEBUG
+  LOG(INFO) << "ExecuteAnalyze" << std::endl;
+#endif
+  if (current_db_.empty()) {
+    cout << "No database selected" << endl;
+    return DB_FAILED;
+  }
+  string table_name = ast->child_->val_;
+  return context->GetCatalog()->AnalyzeTable(table_name, context->GetTransaction());
+}
@@ -0,0 +1,288 @@
+#include "executor/executors/hash_join_executor.h"
+
+#include <functional>
+#include <stdexcept>
+#include <tuple>
+
+namespace {
+// bytes a hash table entry takes besides its key and row, a rough estimate
+constexpr size_t kEntryOverhead = 64;
+}  // namespace
+
+HashJoinExecutor::HashJoinExecutor(ExecuteContext *exec_ctx, const HashJoinPlanNode *plan,
+                                   std::unique_ptr<AbstractExecutor> &&left_executor,
+                                   std::unique_ptr<AbstractExecutor> &&right_executor)
+    : AbstractExecutor(exec_ctx),
+      plan_(plan),
+      left_executor_(std::move(left_executor)),
+      right_executor_(std::move(right_executor)) {}
+
+HashJoinExecutor::~HashJoinExecutor() { Clear(); }
+
+void HashJoinExecutor::Clear() {
+  table_.clear();
+  table_bytes_ = 0;
+  spilled_ = false;
+  for (auto &partition : build_partitions_) {
+    Close(partition);
+  }
+  for (auto &partition : probe_partitions_) {
+    Close(partition);
+  }
+  for (auto &pair : pending_) {
+    Close(pair.build);
+    Close(pair.probe);
+  }
+  build_partitions_.clear();
+  probe_partitions_.clear();
+  pending_.clear();
+  Close(probe_file_);
+}
+
+void HashJoinExecutor::Init() {
+  Clear();
+  left_executor_->Init();
+  right_executor_->Init();
+  const Schema *left_schema = left_executor_->GetOutputSchema();
+  const Schema *right_schema = right_executor_->GetOutputSchema();
+  Row row;
+  RowId rid;
+  std::string key;
+  while (left_executor_->Next(&row, &rid)) {
+    if (!MakeKey(plan_->GetLeftKeys(), row, key)) {
+      continue;
+    }
+    if (spilled_) {
+      WriteRow(build_partitions_[PartitionOf(key, 0)], row, left_schema, buffer_);
+      continue;
+    }
+    Insert(std::move(key), row);
+    if (table_bytes_ > plan_->GetMemoryBudget()) {
+      Spill();
+    }
+  }
+  if (spilled_) {
+    // the probe side is partitioned the same way, only matching partitions can join
+    probe_partitions_.resize(HASH_JOIN_PARTITIONS);
+    while (right_executor_->Next(&row, &rid)) {
+      if (MakeKey(plan_->GetRightKeys(), row, key)) {
+        WriteRow(probe_partitions_[PartitionOf(key, 0)], row, right_schema, buffer_);
+      }
+    }
+    for (size_t i = 0; i < HASH_JOIN_PARTITIONS; i++) {
+      if (build_partitions_[i].rows == 0 || probe_partitions_[i].rows == 0) {
+        Close(build_partitions_[i]);
+        Close(probe_partitions_[i]);
+      } else {
+        pending_.push_back({build_partitions_[i], probe_partitions_[i], 0});
+      }
+    }
+    build_partitions_.clear();
+    probe_partitions_.clear();
+  }
+  match_ = match_end_ = table_.end();
+}
+
+bool HashJoinExecutor::Next(Row *row, RowId *rid) {
+  const auto &predicate = plan_->GetPredicate();
+  std::string key;
+  while (true) {
+    while (match_ != match_end_) {
+      const Row &build_row = match_->second;
+      ++match_;
+      if (predicate != nullptr &&
+          predicate->EvaluateJoin(&build_row, &probe_row_).CompareEquals(Field(kTypeInt, 1)) != CmpBool::kTrue) {
+        continue;
+      }
+      std::vector<Field> fields;
+      fields.reserve(plan_->GetOutputExprs().size());
+      for (const auto &expr : plan_->GetOutputExprs()) {
+        fields.emplace_back(expr->EvaluateJoin(&build_row, &probe_row_));
+      }
+      *row = Row(fields);
+      *rid = RowId();
+      return true;
+    }
+    if (!NextProbeRow(probe_row_)) {
+      return false;
+    }
+    if (MakeKey(plan_->GetRightKeys(), probe_row_, key)) {
+      std::tie(match_, match_end_) = table_.equal_range(key);
+    }
+  }
+}
+
+/*
+ * Every key field is appended in its serialized form, which starts with the
+ * length for CHAR values so that the concatenation stays unambiguous. -0.0 is
+ * written as 0.0 since the two compare equal.
+ */
+bool HashJoinExecutor::MakeKey(const std::vector<AbstractExpressionRef> &keys, const Row &row,
+                               std::string &key) const {
+  key.clear();
+  for (const auto &expr : keys) {
+    Field field = expr->Evaluate(&row);
+    if (field.IsNull()) {
+      return false;
+    }
+    if (field.GetTypeId() == TypeId::kTypeFloat && field.CompareEquals(Field(kTypeFloat, 0.0f)) == CmpBool::kTrue) {
+      float zero = 0.0f;
+      key.append(reinterpret_cast<const char *>(&zero), sizeof(float));
+      continue;
+    }
+    size_t offset = key.size();
+    key.resize(offset + field.GetSerializedSize());
+    field.SerializeTo(&key[offset]);
+  }
+  return true;
+}
+
+size_t HashJoinExecutor::PartitionOf(const std::string &key, uint32_t depth) {
+  // every depth mixes the hash with its own seed, so a partition splits again when it is partitioned anew
+  uint64_t hash = std::hash<std::string>{}(key) ^ ((depth + 1) * 0x9e3779b97f4a7c15ULL);
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  return hash % HASH_JOIN_PARTITIONS;
+}
+
+void HashJoinExecutor::Insert(std::string &&key, const Row &row) {
+  table_bytes_ += key.size() + row.GetSerializedSize(const_cast<Schema *>(left_executor_->GetOutputSchema())) +
+                  kEntryOverhead;
+  table_.emplace(std::move(key), row);
+}
+
+void HashJoinExecutor::Spill() {
+  spilled_ = true;
+  build_partitions_.resize(HASH_JOIN_PARTITIONS);
+  for (const auto &entry : table_) {
+    WriteRow(build_partitions_[PartitionOf(entry.first, 0)], entry.second, left_executor_->GetOutputSchema(),
+             buffer_);
+  }
+  table_.clear();
+  table_bytes_ = 0;
+}
+
+bool HashJoinExecutor::NextProbeRow(Row &row) {
+  if (!spilled_) {
+    RowId rid;
+    return right_executor_->Next(&row, &rid);
+  }
+  while (true) {
+    if (probe_file_.file != nullptr && ReadRow(probe_file_.file, row, right_executor_->GetOutputSchema(), buffer_)) {
+      return true;
+    }
+    if (!LoadNextPartition()) {
+      return false;
+    }
+  }
+}
+
+bool HashJoinExecutor::LoadNextPartition() {
+  const Schema *left_schema = left_executor_->GetOutputSchema();
+  const Schema *right_schema = right_executor_->GetOutputSchema();
+  Row row;
+  std::string key;
+  while (!pending_.empty()) {
+    PartitionPair pair = pending_.back();
+    pending_.pop_back();
+    Close(probe_file_);
+    table_.clear();
+    table_bytes_ = 0;
+    rewind(pair.build.file);
+    bool fits = true;
+    while (ReadRow(pair.build.file, row, left_schema, buffer_)) {
+      MakeKey(plan_->GetLeftKeys(), row, key);
+      Insert(std::move(key), row);
+      if (table_bytes_ > plan_->GetMemoryBudget() && pair.depth + 1 < HASH_JOIN_MAX_DEPTH) {
+        fits = false;
+        break;
+      }
+    }
+    if (fits) {
+      // past the last depth the partition is joined in memory however large it is
+      Close(pair.build);
+      probe_file_ = pair.probe;
+      rewind(probe_file_.file);
+      match_ = match_end_ = table_.end();
+      return true;
+    }
+    table_.clear();
+    table_bytes_ = 0;
+    std::vector<Partition> build_targets;
+    std::vector<Partition> probe_targets;
+    Repartition(pair.build, left_schema, plan_->GetLeftKeys(), pair.depth + 1, build_targets);
+    Repartition(pair.probe, right_schema, plan_->GetRightKeys(), pair.depth + 1, probe_targets);
+    for (size_t i = 0; i < HASH_JOIN_PARTITIONS; i++) {
+      if (build_targets[i].rows == 0 || probe_targets[i].rows == 0) {
+        Close(build_targets[i]);
+        Close(probe_targets[i]);
+      } else {
+        pending_.push_back({build_targets[i], probe_targets[i], pair.depth + 1});
+      }
+    }
+  }
+  Close(probe_file_);
+  table_.clear();
+  table_bytes_ = 0;
+  match_ = match_end_ = table_.end();
+  return false;
+}
+
+void HashJoinExecutor::Repartition(Partition &source, const Schema *schema,
+                                   const std::vector<AbstractExpressionRef> &keys, uint32_t depth,
+                                   std::vector<Partition> &targets) {
+  targets.resize(HASH_JOIN_PARTITIONS);
+  rewind(source.file);
+  Row row;
+  std::string key;
+  while (ReadRow(source.file, row, schema, buffer_)) {
+    MakeKey(keys, row, key);
+    WriteRow(targets[PartitionOf(key, depth)], row, schema, buffer_);
+  }
+  Close(source);
+}
+
+/*
+ * A row is written as its serialized size followed by the row itself, the file
+ * of a partition is created with its first row.
+ */
+void HashJoinExecutor::WriteRow(Partition &partition, const Row &row, const Schema *schema,
+                                std::vector<char> &buffer) {
+  if (partition.file == nullptr) {
+    partition.file = tmpfile();
+    if (partition.file == nullptr) {
+      throw std::runtime_error("failed to create hash join partition file");
+    }
+  }
+  auto *row_schema = const_cast<Schema *>(schema);
+  uint32_t size = row.GetSerializedSize(row_schema);
+  buffer.resize(sizeof(uint32_t) + size);
+  MACH_WRITE_UINT32(buffer.data(), size);
+  row.SerializeTo(buffer.data() + sizeof(uint32_t), row_schema);
+  if (fwrite(buffer.data(), 1, buffer.size(), partition.file) != buffer.size()) {
+    throw std::runtime_error("failed to write hash join partition file");
+  }
+  partition.rows++;
+}
+
+bool HashJoinExecutor::ReadRow(FILE *file, Row &row, const Schema *schema, std::vector<char> &buffer) {
+  uint32_t size;
+  if (fread(&size, sizeof(uint32_t), 1, file) != 1) {
+    return false;
+  }
+  buffer.resize(size);
+  if (fread(buffer.data(), 1, size, file) != size) {
+    throw std::runtime_error("failed to read hash join partition file");
+  }
+  row.destroy();
+  row.DeserializeFrom(buffer.data(), const_cast<Schema *>(schema));
+  return true;
+}
+
+void HashJoinExecutor::Close(Partition &partition) {
+  if (partition.file != nullptr) {
+    fclose(partition.file);
+  }
+  partition = Partition();
+}
@@ -0,0 +1,142 @@
+#include "executor/executors/index_nested_loop_join_executor.h"
+
+#include <algorithm>
+
+namespace {
+bool KeyLess(const Row &a, const Row &b) {
+  for (uint32_t i = 0; i < a.GetFieldCount(); i++) {
+    if (a.GetField(i)->CompareLessThan(*b.GetField(i)) == CmpBool::kTrue) {
+      return true;
+    }
+    if (b.GetField(i)->CompareLessThan(*a.GetField(i)) == CmpBool::kTrue) {
+      return false;
+    }
+  }
+  return false;
+}
+}  // namespace
+
+IndexNestedLoopJoinExecutor::IndexNestedLoopJoinExecutor(ExecuteContext *exec_ctx,
+                                                         const IndexNestedLoopJoinPlanNode *plan,
+                                                         std::unique_ptr<AbstractExecutor> &&outer_executor)
+    : AbstractExecutor(exec_ctx), plan_(plan), outer_executor_(std::move(outer_executor)) {}
+
+void IndexNestedLoopJoinExecutor::Init() {
+  outer_executor_->Init();
+  exec_ctx_->GetCatalog()->GetTable(plan_->GetInnerTableName(), inner_table_);
+  done_ = false;
+  results_.clear();
+  result_index_ = 0;
+}
+
+bool IndexNestedLoopJoinExecutor::Next(Row *row, RowId *rid) {
+  while (result_index_ == results_.size()) {
+    if (done_) {
+      return false;
+    }
+    JoinBatch();
+  }
+  *row = results_[result_index_++];
+  *rid = RowId();
+  return true;
+}
+
+/*
+ * Outer rows with equal keys share one lookup. The row ids found for the whole
+ * batch are read in page order, so that an inner page matching several outer
+ * rows is fetched once instead of once per match.
+ */
+bool IndexNestedLoopJoinExecutor::JoinBatch() {
+  Txn *txn = exec_ctx_->GetTransaction();
+  results_.clear();
+  result_index_ = 0;
+  std::vector<Row> outer_rows;
+  while (outer_rows.size() < INDEX_BATCH_SIZE) {
+    if (!outer_executor_->NextBatch(outer_batch_)) {
+      done_ = true;
+      break;
+    }
+    outer_rows.reserve(outer_rows.size() + outer_batch_.GetSelection().size());
+    for (auto i : outer_batch_.GetSelection()) {
+      outer_rows.emplace_back();
+      outer_batch_.GetRow(i, outer_rows.back());
+    }
+  }
+  // the index key of every outer row, a row with a null key matches nothing
+  std::vector<Row> keys(outer_rows.size());
+  std::vector<size_t> order;
+  for (size_t j = 0; j < outer_rows.size(); j++) {
+    std::vector<Field> fields;
+    bool has_null = false;
+    for (const auto &expr : plan_->GetOuterKeys()) {
+      fields.emplace_back(expr->Evaluate(&outer_rows[j]));
+      has_null = has_null || fields.back().IsNull();
+    }
+    if (!has_null) {
+      keys[j] = Row(fields);
+      order.push_back(j);
+    }
+  }
+  std::stable_sort(order.begin(), order.end(), [&keys](size_t a, size_t b) { return KeyLess(keys[a], keys[b]); });
+  std::vector<Row> probe_keys;
+  std::vector<size_t> key_of(outer_rows.size());
+  for (auto j : order) {
+    if (probe_keys.empty() || KeyLess(probe_keys.back(), keys[j])) {
+      probe_keys.push_back(keys[j]);
+    }
+    key_of[j] = probe_keys.size() - 1;
+  }
+  if (probe_keys.empty()) {
+    return false;
+  }
+  std::vector<std::vector<RowId>> found;
+  plan_->GetIndex()->GetIndex()->ScanKeys(probe_keys, found, txn);
+
+  std::vector<RowId> row_ids;
+  for (const auto &matches : found) {
+    row_ids.insert(row_ids.end(), matches.begin(), matches.end());
+  }
+  auto rid_less = [](const RowId &a, const RowId &b) { return a.Get() < b.Get(); };
+  std::sort(row_ids.begin(), row_ids.end(), rid_less);
+  row_ids.erase(std::unique(row_ids.begin(), row_ids.end()), row_ids.end());
+  std::vector<Row> inner_rows;
+  std::vector<uint32_t> slots;
+  for (size_t i = 0; i < row_ids.size();) {
+    page_id_t page_id = row_ids[i].GetPageId();
+    slots.clear();
+    for (; i < row_ids.size() && row_ids[i].GetPageId() == page_id; i++) {
+      slots.push_back(row_ids[i].GetSlotNum());
+    }
+    inner_table_->GetTableHeap()->GetTuples(page_id, slots, inner_rows, txn);
+  }
+  // the inner rows are in row id order, those the inner predicate rejects are skipped
+  std::vector<bool> accepted(inner_rows.size());
+  for (size_t i = 0; i < inner_rows.size(); i++) {
+    accepted[i] = plan_->GetCompiledInnerPredicate().Evaluate(inner_rows[i]);
+  }
+
+  const auto &predicate = plan_->GetPredicate();
+  for (auto j : order) {
+    const Row &outer_row = outer_rows[j];
+    for (const auto &row_id : found[key_of[j]]) {
+      auto it = std::lower_bound(inner_rows.begin(), inner_rows.end(), row_id,
+                                 [](const Row &row, const RowId &id) { return row.GetRowId().Get() < id.Get(); });
+      if (it == inner_rows.end() || !(it->GetRowId() == row_id) || !accepted[it - inner_rows.begin()]) {
+        continue;
+      }
+      const Row *left = plan_->IsInnerLeft() ? &*it : &outer_row;
+      const Row *right = plan_->IsInnerLeft() ? &outer_row : &*it;
+      if (predicate != nullptr &&
+          predicate->EvaluateJoin(left, right).CompareEquals(Field(kTypeInt, 1)) != CmpBool::kTrue) {
+        continue;
+      }
+      std::vector<Field> fields;
+      fields.reserve(plan_->GetOutputExprs().size());
+      for (const auto &expr : plan_->GetOutputExprs()) {
+        fields.emplace_back(expr->EvaluateJoin(left, right));
+      }
+      results_.emplace_back(fields);
+    }
+  }
+  return !results_.empty();
+}
@@ -1,18 +1,166 @@
 #include "executor/executors/index_scan_executor.h"
 
-class RowidCompare {
- public:
-  bool operator()(RowId rid1, RowId rid2) { return rid1.Get() < rid2.Get(); }
-};
-
 IndexScanExecutor::IndexScanExecutor(ExecuteContext *exec_ctx, const IndexScanPlanNode *plan)
     : AbstractExecutor(exec_ctx), plan_(plan) {}
 
 void IndexScanExecutor::Init() {
   exec_ctx_->GetCatalog()->GetTable(plan_->GetTableName(), table_info_);
-  auto first_row = table_info_->GetTableHeap()->Begin(nullptr);
-  result_ = IndexScan(plan_->GetPredicate());
+  index_ = nullptr;
+  index_info_ = nullptr;
+  auto predicate = plan_->GetPredicate();
+  int rank = ChooseAccessPath(predicate);
+  range_index_ = 0;
+  cursor_.reset();
   is_schema_same_ = SchemaEqual(table_info_->GetSchema(), plan_->OutputSchema());
+  column_map_.clear();
+  for (auto column : plan_->OutputSchema()->GetColumns()) {
+    column_map_.push_back(column->GetTableInd());
+  }
+  index_only_ = index_ != nullptr && index_->SupportsIndexOnlyScan() && IsCoveredBy(index_info_);
+  key_columns_.clear();
+  if (index_only_) {
+    for (auto column : index_info_->GetIndexKeySchema()->GetColumns()) {
+      key_columns_.push_back(column->GetTableInd());
+    }
+  }
+  bitmap_.Clear();
+  bitmap_mode_ = false;
+  streamed_ = 0;
+  page_rows_.clear();
+  page_row_index_ = 0;
+  if (index_only_ || plan_->IsKeyOrdered()) {
+    return;
+  }
+  // an OR, or several conjuncts with an index of their own when no point lookup
+  // drives the scan, is answered by combining the row id bitmaps of the indexes
+  std::vector<AbstractExpressionRef> conjuncts;
+  SplitConjuncts(predicate, conjuncts);
+  size_t indexed = 0;
+  bool has_or = false;
+  for (const auto &conjunct : conjuncts) {
+    has_or = has_or || dynamic_pointer_cast<LogicExpression>(conjunct) != nullptr;
+    auto comparison = dynamic_pointer_cast<ComparisonExpression>(conjunct);
+    if (comparison != nullptr && ComparisonIndex(comparison) != nullptr) {
+      indexed++;
+    }
+  }
+  if ((has_or || (rank < 4 && indexed > 1)) && BuildBitmap(predicate, bitmap_)) {
+    need_filter_ = true;
+    bitmap_mode_ = true;
+    page_iter_ = bitmap_.Begin();
+  }
+}
+
+void IndexScanExecutor::SplitConjuncts(const AbstractExpressionRef &predicate,
+                                       std::vector<AbstractExpressionRef> &conjuncts) {
+  std::vector<AbstractExpressionRef> stack{predicate};
+  while (!stack.empty()) {
+    auto expr = stack.back();
+    stack.pop_back();
+    auto logic = dynamic_pointer_cast<LogicExpression>(expr);
+    if (logic != nullptr && logic->logic_type_ == LogicType::And) {
+      stack.push_back(logic->GetChildAt(1));
+      stack.push_back(logic->GetChildAt(0));
+    } else {
+      conjuncts.push_back(expr);
+    }
+  }
+}
+
+/**
+ * A single column index answering a comparison of its column with a constant
+ * on its own, hash indexes only answer "=" and are preferred for it.
+ */
+IndexInfo *IndexScanExecutor::ComparisonIndex(const std::shared_ptr<ComparisonExpression> &comparison) {
+  auto column = dynamic_pointer_cast<ColumnValueExpression>(comparison->GetChildAt(0));
+  auto constant = dynamic_pointer_cast<ConstantValueExpression>(comparison->GetChildAt(1));
+  if (column == nullptr || constant == nullptr) {
+    return nullptr;
+  }
+  bool equal = comparison->GetComparisonType() == "=";
+  IndexInfo *result = nullptr;
+  for (auto index : plan_->indexes_) {
+    auto key_schema = index->GetIndexKeySchema();
+    if (key_schema->GetColumnCount() != 1 || key_schema->GetColumn(0)->GetTableInd() != column->GetColIdx() ||
+        (!equal && !index->IsOrdered())) {
+      continue;
+    }
+    if (result == nullptr || !index->IsOrdered()) {
+      result = index;
+    }
+  }
+  return result;
+}
+
+/**
+ * Conjuncts without an index are left to the filter, so an AND needs an index
+ * on one side only, while both sides of an OR must be answered by indexes.
+ */
+bool IndexScanExecutor::BuildBitmap(const AbstractExpressionRef &expr, RowIdBitmap &bitmap) {
+  auto logic = dynamic_pointer_cast<LogicExpression>(expr);
+  if (logic != nullptr) {
+    RowIdBitmap right;
+    bool has_left = BuildBitmap(logic->GetChildAt(0), bitmap);
+    bool has_right = BuildBitmap(logic->GetChildAt(1), right);
+    if (logic->logic_type_ == LogicType::Or) {
+      if (!has_left || !has_right) {
+        return false;
+      }
+      bitmap.Union(right);
+    } else if (has_left && has_right) {
+      bitmap.Intersect(right);
+    } else if (has_right) {
+      bitmap = std::move(right);
+    }
+    return has_left || has_right;
+  }
+  auto comparison = dynamic_pointer_cast<ComparisonExpression>(expr);
+  IndexInfo *index = comparison == nullptr ? nullptr : ComparisonIndex(comparison);
+  if (index == nullptr) {
+    return false;
+  }
+  std::vector<Field> fields{comparison->GetChildAt(1)->Evaluate(nullptr)};
+  std::vector<RowId> row_ids;
+  index->GetIndex()->ScanKey(Row(fields), row_ids, exec_ctx_->GetTransaction(), comparison->GetComparisonType());
+  for (const auto &row_id : row_ids) {
+    bitmap.Add(row_id);
+  }
+  return true;
+}
+
+/**
+ * An index covers the scan when the output columns and every column of the
+ * predicate are key columns of it, the rows can then be rebuilt from the keys.
+ */
+bool IndexScanExecutor::IsCoveredBy(IndexInfo *index) {
+  std::vector<uint32_t> key_columns;
+  for (auto column : index->GetIndexKeySchema()->GetColumns()) {
+    key_columns.push_back(column->GetTableInd());
+  }
+  auto is_key_column = [&key_columns](uint32_t column) {
+    return std::find(key_columns.begin(), key_columns.end(), column) != key_columns.end();
+  };
+  for (auto column : plan_->OutputSchema()->GetColumns()) {
+    if (!is_key_column(column->GetTableInd())) {
+      return false;
+    }
+  }
+  std::vector<AbstractExpressionRef> stack{plan_->GetPredicate()};
+  while (!stack.empty()) {
+    auto expr = stack.back();
+    stack.pop_back();
+    if (expr == nullptr) {
+      continue;
+    }
+    auto column = dynamic_pointer_cast<ColumnValueExpression>(expr);
+    if (column != nullptr && !is_key_column(column->GetColIdx())) {
+      return false;
+    }
+    for (const auto &child : expr->GetChildren()) {
+      stack.push_back(child);
+    }
+  }
+  return true;
 }
 
 bool IndexScanExecutor::SchemaEqual(const Schema *table_schema, const Schema *output_schema) {
@@ -44,66 +192,266 @@ void IndexScanExecutor::TupleTransfer(const Schema *table_schema, const Schema *
   *output_row = Row(dest_row);
 }
 
-vector<RowId> IndexScanExecutor::IndexScan(AbstractExpressionRef predicate) {
-  switch (predicate->GetType()) {
-    case ExpressionType::LogicExpression: {
-      vector<RowId> lhs = IndexScan(predicate->GetChildAt(0));
-      vector<RowId> rhs = IndexScan(predicate->GetChildAt(1));
-      // The function cannot differentiate between the case where the number of rows that
-      // meet the criteria in the indexed column is zero and the case where the column is
-      // not indexed. Writing it this way will ignore the filtering effect brought about
-      // by having zero rows that meet the criteria in the indexed column.
-      if (plan_->need_filter_) {
-        if (lhs.empty()) return rhs;
-        if (rhs.empty()) return lhs;
+/**
+ * Every index is matched against the comparisons between a column and a
+ * constant: equalities on a prefix of its key columns, then one or two range
+ * bounds on the next key column. Equality on the whole key is preferred (on a
+ * hash index, then a unique B+ tree, then a posting index), then prefix and
+ * range matches, the one covering more comparisons first, and "<>" on the
+ * leading column (scanned as the two ranges around the key) last. Hash indexes
+ * are only used for equality on the whole key. Other conjuncts are checked on
+ * the fetched rows.
+ */
+int IndexScanExecutor::ChooseAccessPath(const AbstractExpressionRef &predicate) {
+  std::vector<AbstractExpressionRef> conjuncts;
+  SplitConjuncts(predicate, conjuncts);
+  struct Comparison {
+    uint32_t column;
+    std::string op;
+    AbstractExpressionRef constant;
+  };
+  std::vector<Comparison> comparisons;
+  for (const auto &conjunct : conjuncts) {
+    auto comparison = dynamic_pointer_cast<ComparisonExpression>(conjunct);
+    if (comparison == nullptr) {
+      continue;
+    }
+    auto column = dynamic_pointer_cast<ColumnValueExpression>(comparison->GetChildAt(0));
+    auto constant = dynamic_pointer_cast<ConstantValueExpression>(comparison->GetChildAt(1));
+    if (column != nullptr && constant != nullptr) {
+      comparisons.push_back({column->GetColIdx(), comparison->GetComparisonType(), constant});
+    }
+  }
+  int best_rank = -1;
+  size_t best_matched = 0;
+  std::vector<const Comparison *> best_equal;
+  const Comparison *best_lower = nullptr;
+  const Comparison *best_upper = nullptr;
+  const Comparison *best_not_equal = nullptr;
+  for (auto index : plan_->indexes_) {
+    const auto &key_columns = index->GetIndexKeySchema()->GetColumns();
+    std::vector<const Comparison *> equal;
+    const Comparison *lower = nullptr;
+    const Comparison *upper = nullptr;
+    const Comparison *not_equal = nullptr;
+    for (auto key_column : key_columns) {
+      auto on_column = [&](std::initializer_list<const char *> ops) -> const Comparison * {
+        for (const auto &comparison : comparisons) {
+          if (comparison.column == key_column->GetTableInd() &&
+              std::find(ops.begin(), ops.end(), comparison.op) != ops.end()) {
+            return &comparison;
+          }
+        }
+        return nullptr;
+      };
+      if (auto comparison = on_column({"="})) {
+        equal.push_back(comparison);
+        continue;
+      }
+      lower = on_column({">", ">="});
+      upper = on_column({"<", "<="});
+      not_equal = on_column({"<>"});
+      break;
+    }
+    int rank;
+    if (equal.size() == key_columns.size()) {
+      rank = !index->IsOrdered() ? 5 : index->IsUnique() ? 4 : 3;
+    } else if (!index->IsOrdered()) {
+      continue;
+    } else if (!equal.empty() || lower != nullptr || upper != nullptr) {
+      rank = 2;
+    } else if (not_equal != nullptr) {
+      rank = 1;
+    } else {
+      continue;
+    }
+    if (rank != 1) {
+      not_equal = nullptr;
+    }
+    size_t matched = 2 * equal.size() + (lower != nullptr) + (upper != nullptr);
+    if (rank > best_rank || (rank == best_rank && matched > best_matched)) {
+      best_rank = rank;
+      best_matched = matched;
+      best_equal = equal;
+      best_lower = lower;
+      best_upper = upper;
+      best_not_equal = not_equal;
+      index_ = index->GetIndex();
+      index_info_ = index;
+    }
+  }
+  ranges_.clear();
+  if (best_rank <= 0) {
+    need_filter_ = true;
+    // no usable comparison, walk the whole first ordered index and filter
+    for (auto index : plan_->indexes_) {
+      if (index->IsOrdered()) {
+        index_ = index->GetIndex();
+        index_info_ = index;
+        ranges_.push_back({nullptr, true, nullptr, true});
+        break;
+      }
+    }
+    return best_rank;
+  }
+  size_t used = best_equal.size() + (best_lower != nullptr) + (best_upper != nullptr) + (best_not_equal != nullptr);
+  need_filter_ = conjuncts.size() > used;
+  if (best_not_equal != nullptr) {
+    std::vector<Field> fields{best_not_equal->constant->Evaluate(nullptr)};
+    lower_key_ = Row(fields);
+    ranges_.push_back({nullptr, true, &lower_key_, false});
+    ranges_.push_back({&lower_key_, false, nullptr, true});
+    return best_rank;
+  }
+  // bound keys are the equality prefix followed by the range constant, a bare
+  // prefix bound covers every key starting with it
+  auto bound_key = [&best_equal](const Comparison *bound) {
+    std::vector<Field> fields;
+    for (auto comparison : best_equal) {
+      fields.push_back(comparison->constant->Evaluate(nullptr));
+    }
+    if (bound != nullptr) {
+      fields.push_back(bound->constant->Evaluate(nullptr));
+    }
+    return Row(fields);
+  };
+  IndexRange range;
+  if (best_lower != nullptr || !best_equal.empty()) {
+    lower_key_ = bound_key(best_lower);
+    range.lower = &lower_key_;
+    range.lower_inclusive = best_lower == nullptr || best_lower->op == ">=";
+  }
+  if (best_upper != nullptr || !best_equal.empty()) {
+    upper_key_ = bound_key(best_upper);
+    range.upper = &upper_key_;
+    range.upper_inclusive = best_upper == nullptr || best_upper->op == "<=";
+  }
+  ranges_.push_back(range);
+  return best_rank;
+}
+
+/**
+ * Row ids are pulled from the index cursor one at a time, so the first rows
+ * are returned without scanning the whole range. Once a scan returned more
+ * than INDEX_SCAN_BITMAP_THRESHOLD rows in index order, the rest of the range
+ * is collected into the bitmap and read a heap page at a time, unless the plan
+ * asks for the rows in key order. Index-only
+ * scans take the key columns from the cursor and never read the table heap.
+ */
+bool IndexScanExecutor::FetchRow(Row &table_row) {
+  auto table_schema = table_info_->GetSchema();
+  while (true) {
+    if (bitmap_mode_) {
+      if (page_row_index_ < page_rows_.size()) {
+        auto &page_row = page_rows_[page_row_index_++];
+        table_row.SetRowId(page_row.GetRowId());
+        table_row.GetFields().swap(page_row.GetFields());
+        return true;
+      }
+      if (page_iter_ == bitmap_.End()) {
+        return false;
       }
-      sort(lhs.begin(), lhs.end(), RowidCompare());
-      sort(rhs.begin(), rhs.end(), RowidCompare());
-      vector<RowId> result;
-      set_intersection(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), back_inserter(result), RowidCompare());
-      return result;
-    }
-    case ExpressionType::ComparisonExpression: {
-      std::vector<RowId> ret;
-      std::vector<Field> fields{predicate->GetChildAt(1)->Evaluate(nullptr)};
-      Row key(fields);
-      for (auto index : plan_->indexes_) {
-        uint32_t col_idx = dynamic_pointer_cast<ColumnValueExpression>(predicate->GetChildAt(0))->GetColIdx();
-        if (col_idx == index->GetIndexKeySchema()->GetColumn(0)->GetTableInd()) {
-          index->GetIndex()->ScanKey(key, ret, nullptr,
-                                     dynamic_pointer_cast<ComparisonExpression>(predicate)->GetComparisonType());
-          break;
+      std::vector<uint32_t> slots;
+      RowIdBitmap::DecodeSlots(page_iter_->second, slots);
+      page_rows_.clear();
+      page_row_index_ = 0;
+      table_info_->GetTableHeap()->GetTuples(page_iter_->first, slots, page_rows_, exec_ctx_->GetTransaction());
+      ++page_iter_;
+      continue;
+    }
+    if (cursor_ == nullptr) {
+      if (index_ == nullptr || range_index_ >= ranges_.size()) {
+        return false;
+      }
+      cursor_ = index_->ScanRange(ranges_[range_index_++], exec_ctx_->GetTransaction());
+    }
+    if (!index_only_ && !plan_->IsKeyOrdered() && streamed_ >= INDEX_SCAN_BITMAP_THRESHOLD) {
+      // the cursors only move forward, the rows returned so far are not collected again
+      RowId row_id;
+      while (cursor_ != nullptr) {
+        while (cursor_->Next(row_id)) {
+          bitmap_.Add(row_id);
         }
+        cursor_ = range_index_ < ranges_.size()
+                      ? index_->ScanRange(ranges_[range_index_++], exec_ctx_->GetTransaction())
+                      : nullptr;
       }
-      return ret;
+      bitmap_mode_ = true;
+      page_iter_ = bitmap_.Begin();
+      continue;
     }
-    default:
-      break;
+    RowId row_id;
+    Row key;
+    if (index_only_ ? !cursor_->NextEntry(row_id, key) : !cursor_->Next(row_id)) {
+      cursor_.reset();
+      continue;
+    }
+    table_row.SetRowId(row_id);
+    if (index_only_) {
+      // rebuild the referenced columns from the key, the others stay null
+      for (auto column : table_schema->GetColumns()) {
+        table_row.GetFields().push_back(new Field(column->GetType()));
+      }
+      for (size_t i = 0; i < key_columns_.size(); i++) {
+        Swap(*table_row.GetField(key_columns_[i]), *key.GetField(i));
+      }
+    } else {
+      table_info_->GetTableHeap()->GetTuple(&table_row, nullptr);
+      streamed_++;
+    }
+    return true;
   }
 }
 
 bool IndexScanExecutor::Next(Row *row, RowId *rid) {
-  auto predicate = plan_->GetPredicate();
+  const auto &predicate = plan_->GetCompiledPredicate();
   auto table_schema = table_info_->GetSchema();
-  while (cursor_ < result_.size()) {
-    auto p_row = new Row(result_[cursor_]);
-    table_info_->GetTableHeap()->GetTuple(p_row, nullptr);
-    if (plan_->need_filter_) {
-      if (!predicate->Evaluate(p_row).CompareEquals(Field(kTypeInt, 1))) {
-        cursor_++;
-        delete p_row;
-        continue;
-      }
+  while (true) {
+    Row table_row;
+    if (!FetchRow(table_row)) {
+      return false;
+    }
+    if (need_filter_ && !predicate.Evaluate(table_row)) {
+      continue;
     }
-    *rid = result_[cursor_];
+    *rid = table_row.GetRowId();
     if (!is_schema_same_) {
-      TupleTransfer(table_schema, plan_->OutputSchema(), p_row, row);
+      TupleTransfer(table_schema, plan_->OutputSchema(), &table_row, row);
+    } else {
+      *row = table_row;
+    }
+    return true;
+  }
+}
+
+/*
+ * The candidate rows are collected into a batch of table columns first, so
+ * the predicate is rechecked over whole columns.
+ */
+bool IndexScanExecutor::NextBatch(RowBatch &batch) {
+  const auto &predicate = plan_->GetCompiledPredicate();
+  while (true) {
+    scan_batch_.Init(table_info_->GetSchema());
+    Row table_row;
+    while (!scan_batch_.IsFull() && FetchRow(table_row)) {
+      scan_batch_.AppendRow(table_row);
+      table_row.destroy();
+    }
+    if (scan_batch_.GetSize() == 0) {
+      batch.Reset();
+      return false;
+    }
+    if (need_filter_) {
+      predicate.EvaluateBatch(scan_batch_, scan_batch_.GetSelection());
+    }
+    if (scan_batch_.GetSelection().empty()) {
+      continue;
+    }
+    if (is_schema_same_) {
+      std::swap(batch, scan_batch_);
     } else {
-      *row = *p_row;
+      batch.Project(scan_batch_, column_map_);
     }
-    delete p_row;
-    cursor_++;
     return true;
   }
-  return false;
 }
@@ -4,6 +4,8 @@
 
 #include "executor/executors/insert_executor.h"
 
+#include <algorithm>
+
 InsertExecutor::InsertExecutor(ExecuteContext *exec_ctx, const InsertPlanNode *plan,
                                std::unique_ptr<AbstractExecutor> &&child_executor)
     : AbstractExecutor(exec_ctx), plan_(plan), child_executor_(std::move(child_executor)) {}
@@ -13,30 +15,175 @@ void InsertExecutor::Init() {
   exec_ctx_->GetCatalog()->GetTable(plan_->GetTableName(), table_info_);
   schema_ = table_info_->GetSchema();
   exec_ctx_->GetCatalog()->GetTableIndexes(table_info_->GetTableName(), index_info_);
+  for (auto info : index_info_) {
+    if (info->GetIndex()->IsReadOnly()) {
+      // 只读索引（如learned）建成后不能修改，需先删除索引
+      throw std::logic_error("Cannot insert into a table with the read-only index " + info->GetIndexName());
+    }
+  }
+  pending_ = 0;
+  done_ = false;
+}
+
+/*
+ * Order of two key rows, null fields first. Keys are only compared with keys
+ * of the same index.
+ */
+static int CompareKeys(const Row &a, const Row &b) {
+  for (uint32_t i = 0; i < a.GetFieldCount(); i++) {
+    Field *x = a.GetField(i);
+    Field *y = b.GetField(i);
+    if (x->IsNull() || y->IsNull()) {
+      if (x->IsNull() != y->IsNull()) {
+        return x->IsNull() ? -1 : 1;
+      }
+      continue;
+    }
+    if (x->CompareLessThan(*y) == CmpBool::kTrue) {
+      return -1;
+    }
+    if (x->CompareGreaterThan(*y) == CmpBool::kTrue) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/*
+ * Position of the first key equal to an earlier one of keys[0, count), count
+ * if there is none. Keys with a null field never equal another key.
+ */
+static size_t FirstRepeatedKey(const std::vector<Row> &keys, size_t count) {
+  std::vector<size_t> order(count);
+  for (size_t i = 0; i < count; i++) {
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(), [&keys](size_t a, size_t b) {
+    int cmp = CompareKeys(keys[a], keys[b]);
+    return cmp != 0 ? cmp < 0 : a < b;
+  });
+  size_t first = count;
+  for (size_t i = 1; i < count; i++) {
+    const Row &key = keys[order[i]];
+    bool has_null = false;
+    for (uint32_t j = 0; j < key.GetFieldCount(); j++) {
+      has_null = has_null || key.GetField(j)->IsNull();
+    }
+    if (!has_null && CompareKeys(keys[order[i - 1]], key) == 0) {
+      first = std::min(first, order[i]);
+    }
+  }
+  return first;
+}
+
+/*
+ * Pull child batches until INDEX_BATCH_SIZE rows or all of them are in hand,
+ * and insert them. The keys of the whole batch are checked against every
+ * unique index with one ScanKeys call and added with one InsertEntries call,
+ * instead of a lookup and an insert per row and index. A partial index only
+ * checks and receives the rows its predicate accepts. Rows are inserted in
+ * order up to the first one with a duplicate key, which ends the insert.
+ */
+size_t InsertExecutor::InsertBatch() {
+  std::vector<Row> rows;
+  while (rows.size() < INDEX_BATCH_SIZE) {
+    if (!child_executor_->NextBatch(child_batch_)) {
+      done_ = true;
+      break;
+    }
+    rows.reserve(rows.size() + child_batch_.GetSelection().size());
+    for (auto i : child_batch_.GetSelection()) {
+      rows.emplace_back();
+      child_batch_.GetRow(i, rows.back());
+    }
+  }
+  Txn *txn = exec_ctx_->GetTransaction();
+  size_t accepted = rows.size();
+  // positions in rows of the keys of each index, in increasing order
+  std::vector<std::vector<size_t>> index_rows(index_info_.size());
+  std::vector<std::vector<Row>> index_keys(index_info_.size());
+  for (size_t i = 0; i < index_info_.size(); i++) {
+    auto &positions = index_rows[i];
+    auto &keys = index_keys[i];
+    for (size_t j = 0; j < rows.size(); j++) {
+      if (index_info_[i]->Includes(rows[j])) {
+        positions.push_back(j);
+        keys.emplace_back();
+        rows[j].GetKeyFromRow(schema_, index_info_[i]->GetIndexKeySchema(), keys.back());
+      }
+    }
+    if (!index_info_[i]->IsUnique() || keys.empty() || keys[0].GetFields().empty()) {
+      continue;
+    }
+    std::vector<std::vector<RowId>> found;
+    index_info_[i]->GetIndex()->ScanKeys(keys, found, txn);
+    size_t count = 0;
+    while (count < keys.size() && positions[count] < accepted) {
+      if (!found[count].empty()) {
+        accepted = positions[count];
+        break;
+      }
+      count++;
+    }
+    size_t repeated = FirstRepeatedKey(keys, count);
+    if (repeated < count) {
+      accepted = positions[repeated];
+    }
+  }
+  if (accepted < rows.size()) {
+    std::cout << "key already exists" << std::endl;
+    done_ = true;
+  }
+  std::vector<RowId> row_ids;
+  for (size_t j = 0; j < accepted; j++) {
+    if (!table_info_->GetTableHeap()->InsertTuple(rows[j], txn)) {
+      accepted = j;
+      done_ = true;
+      break;
+    }
+    row_ids.push_back(rows[j].GetRowId());
+  }
+  if (accepted == 0) {
+    return 0;
+  }
+  for (size_t i = 0; i < index_info_.size(); i++) {  // 更新索引
+    auto &keys = index_keys[i];
+    std::vector<RowId> key_row_ids;
+    size_t count = 0;
+    while (count < keys.size() && index_rows[i][count] < accepted) {
+      key_row_ids.push_back(row_ids[index_rows[i][count]]);
+      count++;
+    }
+    keys.resize(count);
+    index_info_[i]->GetIndex()->InsertEntries(keys, key_row_ids, txn);
+    for (const auto &key : keys) {
+      index_info_[i]->RecordInsert(key);
+    }
+  }
+  return accepted;
 }
 
 bool InsertExecutor::Next([[maybe_unused]] Row *row, RowId *rid) {
-    Row insert_row;
-    RowId insert_rid;
-    if (child_executor_->Next(&insert_row, &insert_rid)) {
-        for (auto info: index_info_) {
-            Row key_row;
-            insert_row.GetKeyFromRow(table_info_->GetSchema(), info->GetIndexKeySchema(), key_row);
-            std::vector<RowId> result;
-            if (!key_row.GetFields().empty() &&
-                info->GetIndex()->ScanKey(key_row, result, exec_ctx_->GetTransaction()) == DB_SUCCESS) {
-                std::cout << "key already exists" << std::endl;
-                return false;
-            }
-        }
-        if (table_info_->GetTableHeap()->InsertTuple(insert_row, exec_ctx_->GetTransaction())) {
-            Row key_row;
-            for (auto info: index_info_) {  // 更新索引
-                insert_row.GetKeyFromRow(schema_, info->GetIndexKeySchema(), key_row);
-                info->GetIndex()->InsertEntry(key_row, insert_row.GetRowId(), exec_ctx_->GetTransaction());
-            }
-            return true;
-        }
-  }
-  return false;
-}
\ No newline at end of file
+  if (pending_ == 0) {
+    if (done_) {
+      return false;
+    }
+    pending_ = InsertBatch();
+    if (pending_ == 0) {
+      return false;
+    }
+  }
+  pending_--;
+  return true;
+}
+
+bool InsertExecutor::NextBatch(RowBatch &batch) {
+  batch.Clear();
+  if (pending_ == 0 && !done_) {
+    pending_ = InsertBatch();
+  }
+  for (; pending_ > 0; pending_--) {
+    batch.AppendRowId(RowId());
+  }
+  return batch.GetSize() > 0;
+}
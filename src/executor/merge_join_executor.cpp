@@ -0,0 +1,134 @@
+#include "executor/executors/merge_join_executor.h"
+
+#include "planner/expressions/column_value_expression.h"
+
+MergeJoinExecutor::MergeJoinExecutor(ExecuteContext *exec_ctx, const MergeJoinPlanNode *plan,
+                                     std::unique_ptr<AbstractExecutor> &&left_executor,
+                                     std::unique_ptr<AbstractExecutor> &&right_executor)
+    : AbstractExecutor(exec_ctx), plan_(plan), children_{std::move(left_executor), std::move(right_executor)} {}
+
+void MergeJoinExecutor::Init() {
+  const std::vector<AbstractExpressionRef> *keys[] = {&plan_->GetLeftKeys(), &plan_->GetRightKeys()};
+  const bool sorts[] = {plan_->SortsLeft(), plan_->SortsRight()};
+  for (uint32_t side : {0u, 1u}) {
+    children_[side]->Init();
+    key_columns_[side].clear();
+    for (const auto &key : *keys[side]) {
+      key_columns_[side].push_back(dynamic_pointer_cast<ColumnValueExpression>(key)->GetColIdx());
+    }
+    sorters_[side].reset();
+    if (!sorts[side]) {
+      continue;
+    }
+    auto less = [this, side](const Row &a, const Row &b) { return CompareKeys(side, a, side, b) < 0; };
+    sorters_[side] = std::make_unique<ExternalRowSorter>(children_[side]->GetOutputSchema(), less,
+                                                         plan_->GetMemoryLimit());
+    Row row;
+    while (NextChildRow(side, row)) {
+      sorters_[side]->Add(row);
+    }
+    sorters_[side]->Finish();
+  }
+  group_.clear();
+  group_index_ = 0;
+  in_group_ = false;
+  for (uint32_t side : {0u, 1u}) {
+    has_row_[side] = NextRow(side, rows_[side]);
+  }
+}
+
+/*
+ * Both sides advance past the smaller key until the keys meet. The right rows
+ * of a key are collected once and joined with each left row of the same key,
+ * so that duplicates on both sides give every pair.
+ */
+bool MergeJoinExecutor::Next(Row *row, RowId *rid) {
+  const auto &predicate = plan_->GetPredicate();
+  while (true) {
+    if (in_group_) {
+      const Row &left = rows_[0];
+      while (group_index_ < group_.size()) {
+        const Row &right = group_[group_index_++];
+        if (predicate != nullptr &&
+            predicate->EvaluateJoin(&left, &right).CompareEquals(Field(kTypeInt, 1)) != CmpBool::kTrue) {
+          continue;
+        }
+        std::vector<Field> fields;
+        fields.reserve(plan_->GetOutputExprs().size());
+        for (const auto &expr : plan_->GetOutputExprs()) {
+          fields.emplace_back(expr->EvaluateJoin(&left, &right));
+        }
+        *row = Row(fields);
+        *rid = RowId();
+        return true;
+      }
+      has_row_[0] = NextRow(0, rows_[0]);
+      if (!has_row_[0]) {
+        return false;
+      }
+      // the next left row joins the same group if it has the same key
+      if (CompareKeys(0, rows_[0], 1, group_[0]) == 0) {
+        group_index_ = 0;
+        continue;
+      }
+      in_group_ = false;
+    }
+    if (!has_row_[0] || !has_row_[1]) {
+      return false;
+    }
+    int cmp = CompareKeys(0, rows_[0], 1, rows_[1]);
+    if (cmp < 0) {
+      has_row_[0] = NextRow(0, rows_[0]);
+    } else if (cmp > 0) {
+      has_row_[1] = NextRow(1, rows_[1]);
+    } else {
+      group_.clear();
+      do {
+        group_.push_back(rows_[1]);
+        has_row_[1] = NextRow(1, rows_[1]);
+      } while (has_row_[1] && CompareKeys(0, rows_[0], 1, rows_[1]) == 0);
+      group_index_ = 0;
+      in_group_ = true;
+    }
+  }
+}
+
+size_t MergeJoinExecutor::GetRunCount() const {
+  size_t runs = 0;
+  for (const auto &sorter : sorters_) {
+    runs += sorter == nullptr ? 0 : sorter->GetRunCount();
+  }
+  return runs;
+}
+
+bool MergeJoinExecutor::NextChildRow(uint32_t side, Row &row) {
+  RowId rid;
+  while (children_[side]->Next(&row, &rid)) {
+    bool has_null = false;
+    for (auto column : key_columns_[side]) {
+      has_null = has_null || row.GetField(column)->IsNull();
+    }
+    if (!has_null) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool MergeJoinExecutor::NextRow(uint32_t side, Row &row) {
+  return sorters_[side] != nullptr ? sorters_[side]->Next(row) : NextChildRow(side, row);
+}
+
+int MergeJoinExecutor::CompareKeys(uint32_t lhs_side, const Row &lhs, uint32_t rhs_side, const Row &rhs) const {
+  for (size_t i = 0; i < key_columns_[lhs_side].size(); i++) {
+    const Field *a = lhs.GetField(key_columns_[lhs_side][i]);
+    const Field *b = rhs.GetField(key_columns_[rhs_side][i]);
+    if (a->CompareLessThan(*b) == CmpBool::kTrue) {
+      return -1;
+    }
+    if (b->CompareLessThan(*a) == CmpBool::kTrue) {
+      return 1;
+    }
+  }
+  return 0;
+}
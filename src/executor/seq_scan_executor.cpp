@@ -44,18 +44,21 @@ void SeqScanExecutor::Init() {
   iterator_ = (table_info_->GetTableHeap()->Begin(exec_ctx_->GetTransaction()));
   schema_ = plan_->OutputSchema();
   is_schema_same_ = SchemaEqual(table_info_->GetSchema(), schema_);
+  position_ = RowId(table_info_->GetTableHeap()->GetFirstPageId(), 0);
+  column_map_.clear();
+  for (auto column : schema_->GetColumns()) {
+    column_map_.push_back(column->GetTableInd());
+  }
 }
 
 bool SeqScanExecutor::Next(Row *row, RowId *rid) {
-  auto predicate = plan_->GetPredicate();
+  const auto &predicate = plan_->GetCompiledPredicate();
   auto table_schema = table_info_->GetSchema();
   while (iterator_ != table_info_->GetTableHeap()->End()) {
     auto p_row = &(*iterator_);
-    if (predicate != nullptr) {
-      if (!predicate->Evaluate(p_row).CompareEquals(Field(kTypeInt, 1))) {
-        iterator_++;
-        continue;
-      }
+    if (!predicate.Evaluate(*p_row)) {
+      iterator_++;
+      continue;
     }
     *rid = iterator_->GetRowId();
     if (!is_schema_same_) {
@@ -68,3 +71,29 @@ bool SeqScanExecutor::Next(Row *row, RowId *rid) {
   }
   return false;
 }
+
+/*
+ * Tuples are decoded from the table pages straight into the columns of the
+ * scan batch, the predicate shrinks its selection over whole columns and only
+ * the selected rows are copied into the output columns.
+ */
+bool SeqScanExecutor::NextBatch(RowBatch &batch) {
+  const auto &predicate = plan_->GetCompiledPredicate();
+  while (true) {
+    scan_batch_.Init(table_info_->GetSchema());
+    if (!table_info_->GetTableHeap()->ScanBatch(position_, scan_batch_, exec_ctx_->GetTransaction())) {
+      batch.Reset();
+      return false;
+    }
+    predicate.EvaluateBatch(scan_batch_, scan_batch_.GetSelection());
+    if (scan_batch_.GetSelection().empty()) {
+      continue;
+    }
+    if (is_schema_same_) {
+      std::swap(batch, scan_batch_);
+    } else {
+      batch.Project(scan_batch_, column_map_);
+    }
+    return true;
+  }
+}
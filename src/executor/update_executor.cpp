@@ -12,28 +12,62 @@ void UpdateExecutor::Init() {
   child_executor_->Init();
   exec_ctx_->GetCatalog()->GetTable(plan_->GetTableName(), table_info_);
   exec_ctx_->GetCatalog()->GetTableIndexes(table_info_->GetTableName(), index_info_);
+  for (auto info : index_info_) {
+    if (info->GetIndex()->IsReadOnly()) {
+      // 只读索引（如learned）建成后不能修改，需先删除索引
+      throw std::logic_error("Cannot update a table with the read-only index " + info->GetIndexName());
+    }
+  }
   txn_ = exec_ctx_->GetTransaction();
+  done_ = false;
 }
 
-bool UpdateExecutor::Next([[maybe_unused]] Row *row, RowId *rid) {
-  Row src_row;
-  RowId src_rid;
-  if (child_executor_->Next(&src_row, &src_rid)) {
-    Row dest_row = GenerateUpdatedTuple(src_row);
-    if (!table_info_->GetTableHeap()->UpdateTuple(dest_row, src_rid, txn_)) {
-      return false;
-    }
-    Row src_key_row;
-    Row dest_key_row;
-    for (auto info : index_info_) {  // 更新索引
+bool UpdateExecutor::UpdateRow(Row &src_row, RowId src_rid) {
+  Row dest_row = GenerateUpdatedTuple(src_row);
+  if (!table_info_->GetTableHeap()->UpdateTuple(dest_row, src_rid, txn_)) {
+    return false;
+  }
+  Row src_key_row;
+  Row dest_key_row;
+  for (auto info : index_info_) {  // 更新索引
+    // 部分索引中，记录可能因更新而进入或离开索引
+    if (info->Includes(src_row)) {
       src_row.GetKeyFromRow(table_info_->GetSchema(), info->GetIndexKeySchema(), src_key_row);
-      dest_row.GetKeyFromRow(table_info_->GetSchema(), info->GetIndexKeySchema(), dest_key_row);
       info->GetIndex()->RemoveEntry(src_key_row, src_rid, txn_);
+      info->RecordRemove();
+    }
+    if (info->Includes(dest_row)) {
+      dest_row.GetKeyFromRow(table_info_->GetSchema(), info->GetIndexKeySchema(), dest_key_row);
       info->GetIndex()->InsertEntry(dest_key_row, src_rid, txn_);
+      info->RecordInsert(dest_key_row);
+    }
+  }
+  return true;
+}
+
+bool UpdateExecutor::Next([[maybe_unused]] Row *row, RowId *rid) {
+  Row src_row;
+  RowId src_rid;
+  return child_executor_->Next(&src_row, &src_rid) && UpdateRow(src_row, src_rid);
+}
+
+/*
+ * A row that cannot be updated ends the update, as it does for Next.
+ */
+bool UpdateExecutor::NextBatch(RowBatch &batch) {
+  batch.Clear();
+  Row src_row;
+  while (!done_ && batch.GetSize() == 0 && child_executor_->NextBatch(child_batch_)) {
+    for (auto i : child_batch_.GetSelection()) {
+      child_batch_.GetRow(i, src_row);
+      if (!UpdateRow(src_row, src_row.GetRowId())) {
+        done_ = true;
+        break;
+      }
+      batch.AppendRowId(src_row.GetRowId());
     }
-    return true;
   }
-  return false;
+  return batch.GetSize() > 0;
 }
 
 Row UpdateExecutor::GenerateUpdatedTuple(const Row &src_row) {
@@ -23,4 +23,17 @@ bool ValuesExecutor::Next(Row *row, RowId *rid) {
     return true;
   }
   return false;
-}
\ No newline at end of file
+}
+
+bool ValuesExecutor::NextBatch(RowBatch &batch) {
+  batch.Reset();
+  const auto &rows = plan_->GetValues();
+  for (; cursor_ < value_size_ && !batch.IsFull(); cursor_++) {
+    std::vector<Field> values;
+    for (const auto &expr : rows[cursor_]) {
+      values.emplace_back(expr->Evaluate(nullptr));
+    }
+    batch.AppendRow(Row{values});
+  }
+  return batch.GetSize() > 0;
+}
@@ -3,6 +3,7 @@
 
 #include <list>
 #include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -38,6 +39,7 @@ class LRUReplacer : public Replacer {
   private:
   // add your own private member variables here
   list<frame_id_t> lru_list_; // 队列，记录最近使用的页面
+  unordered_map<frame_id_t, list<frame_id_t>::iterator> lru_map_; // 页帧在队列中的位置，使Pin/Unpin为O(1)
   size_t Replace_Size; // 最多缓存的页面数
 };
 
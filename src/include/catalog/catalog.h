@@ -84,7 +84,7 @@ class CatalogManager {
 
   dberr_t CreateIndex(const std::string &table_name, const std::string &index_name,
                       const std::vector<std::string> &index_keys, Txn *txn, IndexInfo *&index_info,
-                      const string &index_type);
+                      const string &index_type, const IndexPredicate &predicate = IndexPredicate());
 
   dberr_t GetIndex(const std::string &table_name, const std::string &index_name, IndexInfo *&index_info) const;
 
@@ -94,6 +94,9 @@ class CatalogManager {
 
   dberr_t DropIndex(const std::string &table_name, const std::string &index_name);
 
+  // rebuild the statistics of every index of the table from one scan of it and persist them
+  dberr_t AnalyzeTable(const std::string &table_name, Txn *txn);
+
  private:
   dberr_t DropTable(table_id_t table_id);
 
@@ -105,6 +108,9 @@ class CatalogManager {
 
   dberr_t GetTable(const table_id_t table_id, TableInfo *&table_info);
 
+  // write the statistics of the index into its meta page, after the index metadata
+  dberr_t FlushIndexStatistics(const index_id_t index_id);
+
  private:
   [[maybe_unused]] BufferPoolManager *buffer_pool_manager_;
   [[maybe_unused]] LockManager *lock_manager_;
@@ -0,0 +1,57 @@
+#ifndef MINISQL_INDEX_PREDICATE_H
+#define MINISQL_INDEX_PREDICATE_H
+
+#include <string>
+#include <vector>
+
+#include "record/field.h"
+#include "record/row.h"
+
+/**
+ * Predicate of a partial index, the conjunction of comparisons of a table
+ * column with a non-null constant given by CREATE INDEX ... WHERE. Only the
+ * rows it accepts have an entry in the index, an empty predicate accepts every
+ * row.
+ *
+ * A comparison with a null field is unknown and rejects the row, as it would
+ * in a WHERE clause. The predicate is stored with the index metadata.
+ */
+class IndexPredicate {
+ public:
+  // column op value, op is one of "=", "<>", "<", "<=", ">", ">="
+  struct Term {
+    Term(uint32_t column, std::string op, const Field &value) : column(column), op(std::move(op)), value(value) {}
+
+    uint32_t column;
+    std::string op;
+    Field value;
+  };
+
+  IndexPredicate() = default;
+
+  bool IsEmpty() const { return terms_.empty(); }
+
+  void AddTerm(uint32_t column, const std::string &op, const Field &value) { terms_.emplace_back(column, op, value); }
+
+  const std::vector<Term> &GetTerms() const { return terms_; }
+
+  // whether the table row satisfies every term
+  bool Evaluate(const Row &row) const;
+
+  // whether every row satisfying "column op value" satisfies term, false when it cannot be shown
+  static bool Implies(uint32_t column, const std::string &op, const Field &value, const Term &term);
+
+  // whether "field op value" is true, false if it is unknown
+  static bool Compare(const Field &field, const std::string &op, const Field &value);
+
+  uint32_t SerializeTo(char *buf) const;
+
+  uint32_t GetSerializedSize() const;
+
+  static uint32_t DeserializeFrom(char *buf, IndexPredicate &predicate);
+
+ private:
+  std::vector<Term> terms_;
+};
+
+#endif  // MINISQL_INDEX_PREDICATE_H
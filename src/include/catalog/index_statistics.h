@@ -0,0 +1,151 @@
+#ifndef MINISQL_INDEX_STATISTICS_H
+#define MINISQL_INDEX_STATISTICS_H
+
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "record/row.h"
+#include "record/schema.h"
+
+/**
+ * HyperLogLog sketch of the number of distinct 64-bit hashes added to it,
+ * 2^PRECISION one-byte registers with a standard error of about 3%.
+ */
+class HyperLogLog {
+ public:
+  static constexpr uint32_t PRECISION = 10;
+  static constexpr uint32_t REGISTER_COUNT = 1u << PRECISION;
+
+  HyperLogLog() : registers_(REGISTER_COUNT, 0) {}
+
+  void Add(uint64_t hash);
+
+  uint64_t Estimate() const;
+
+  std::vector<uint8_t> &GetRegisters() { return registers_; }
+
+  const std::vector<uint8_t> &GetRegisters() const { return registers_; }
+
+ private:
+  std::vector<uint8_t> registers_;
+};
+
+/**
+ * Statistics of an index used to cost the plans reading it: entry count,
+ * shape of the structure, distinct keys and an equi-depth histogram of the
+ * leading key column.
+ *
+ * Key values are kept in the order-preserving encoding of
+ * PrefixBPlusTreeIndex, so the histogram compares INT, FLOAT and CHAR keys as
+ * plain byte strings. bounds_ splits the sampled values of the leading column
+ * into buckets holding the same number of entries, bounds_[0] is the smallest
+ * value and bounds_.back() the largest.
+ *
+ * ANALYZE rebuilds the statistics from a scan of the table. Between two runs
+ * the executors keep the entry count and the distinct-key sketch current, the
+ * histogram is assumed to keep its shape.
+ */
+class IndexStatistics {
+ public:
+  IndexStatistics() = default;
+
+  IndexStatistics(const IndexStatistics &other);
+
+  IndexStatistics &operator=(const IndexStatistics &other);
+
+  // whether ANALYZE ran on the index
+  bool IsAnalyzed() const { return analyzed_; }
+
+  uint64_t GetEntryCount() const { return entry_count_; }
+
+  uint32_t GetHeight() const { return height_; }
+
+  uint32_t GetLeafPages() const { return leaf_pages_; }
+
+  // pages of the indexed table when it was analyzed
+  uint32_t GetTablePages() const { return table_pages_; }
+
+  uint64_t GetDistinctKeys() const;
+
+  uint64_t GetLeadingDistinct() const { return leading_distinct_; }
+
+  uint32_t GetBucketCount() const { return bounds_.empty() ? 0 : static_cast<uint32_t>(bounds_.size() - 1); }
+
+  // fraction of the entries whose leading column equals value
+  double EqualSelectivity(const std::string &value) const;
+
+  // fraction of the entries whose leading column lies within the bounds, a null bound is open
+  double RangeSelectivity(const std::string *lower, bool lower_inclusive, const std::string *upper,
+                          bool upper_inclusive) const;
+
+  /**
+   * Estimated cost, in sequential page reads, of an index scan returning the
+   * given fraction of the entries. Mirrors the index scan executor: the first
+   * INDEX_SCAN_BITMAP_THRESHOLD rows are fetched from the heap in key order at
+   * INDEX_RANDOM_PAGE_COST each, the rest through a bitmap in page order.
+   */
+  double ScanCost(double selectivity) const;
+
+  // incremental maintenance by the executors, the key hash comes from KeyHash
+  void RecordInsert(uint64_t key_hash);
+
+  void RecordRemove();
+
+  // hash of a full key row and encoding of the leading column, false if a field is null or of another type
+  static bool KeyHash(const Row &key, const IndexSchema *key_schema, uint64_t &hash);
+
+  static bool EncodeValue(const Field &value, const IndexSchema *key_schema, std::string &encoded);
+
+  // write the statistics into at most size bytes, histogram buckets are merged until they fit
+  uint32_t SerializeTo(char *buf, uint32_t size) const;
+
+  // read statistics written by SerializeTo, leaves them unanalyzed if buf holds none
+  uint32_t DeserializeFrom(const char *buf, uint32_t size);
+
+ private:
+  friend class IndexStatisticsBuilder;
+
+  static constexpr uint32_t INDEX_STATISTICS_MAGIC_NUM = 172031;
+
+  // fraction of the entries whose leading column is less than value (not greater than value if inclusive)
+  double CumulativeFraction(const std::string &value, bool inclusive) const;
+
+  static uint32_t GetSerializedSize(const std::vector<const std::string *> &bounds);
+
+  bool analyzed_{false};
+  uint64_t entry_count_{0};
+  uint32_t height_{0};
+  uint32_t leaf_pages_{0};
+  uint32_t table_pages_{0};
+  uint64_t leading_distinct_{0};
+  HyperLogLog distinct_;
+  std::vector<std::string> bounds_;
+  mutable std::mutex latch_;
+};
+
+/**
+ * Collects the statistics of one index during the table scan of ANALYZE.
+ * Keys feed both HyperLogLog sketches, the leading column values go through
+ * a reservoir sample of STATISTICS_SAMPLE_SIZE that is sorted into the
+ * histogram at the end.
+ */
+class IndexStatisticsBuilder {
+ public:
+  explicit IndexStatisticsBuilder(const IndexSchema *key_schema);
+
+  void Add(const Row &key);
+
+  void Finish(uint32_t height, uint32_t leaf_pages, uint32_t table_pages, IndexStatistics &stats);
+
+ private:
+  const IndexSchema *key_schema_;
+  uint64_t entry_count_{0};
+  HyperLogLog distinct_;
+  HyperLogLog leading_distinct_;
+  std::vector<std::string> sample_;
+  std::mt19937_64 rng_;
+};
+
+#endif  // MINISQL_INDEX_STATISTICS_H
@@ -4,10 +4,19 @@
 #include <memory>
 
 #include "table.h"
+#include "catalog/index_predicate.h"
+#include "catalog/index_statistics.h"
 #include "common/macros.h"
 #include "common/rowid.h"
 #include "index/b_plus_tree_index.h"
+#include "index/basic_comparator.h"
+#include "index/extendible_hash_index.h"
+#include "index/typed_b_plus_tree_index.h"
 #include "index/generic_key.h"
+#include "index/learned_index.h"
+#include "index/lsm_index.h"
+#include "index/posting_list_index.h"
+#include "index/prefix_b_plus_tree_index.h"
 #include "record/schema.h"
 
 class IndexMetadata {
@@ -15,7 +24,8 @@ class IndexMetadata {
 
  public:
   static IndexMetadata *Create(const index_id_t index_id, const std::string &index_name, const table_id_t table_id,
-                               const std::vector<uint32_t> &key_map);
+                               const std::vector<uint32_t> &key_map, const std::string &index_type = "bptree",
+                               const IndexPredicate &predicate = IndexPredicate());
 
   uint32_t SerializeTo(char *buf) const;
 
@@ -33,11 +43,16 @@ class IndexMetadata {
 
   inline index_id_t GetIndexId() const { return index_id_; }
 
+  inline const std::string &GetIndexType() const { return index_type_; }
+
+  inline const IndexPredicate &GetPredicate() const { return predicate_; }
+
  private:
   IndexMetadata() = delete;
 
   explicit IndexMetadata(const index_id_t index_id, const std::string &index_name, const table_id_t table_id,
-                         const std::vector<uint32_t> &key_map);
+                         const std::vector<uint32_t> &key_map, const std::string &index_type,
+                         const IndexPredicate &predicate);
 
  private:
   static constexpr uint32_t INDEX_METADATA_MAGIC_NUM = 344528;
@@ -45,6 +60,8 @@ class IndexMetadata {
   std::string index_name_;
   table_id_t table_id_;
   std::vector<uint32_t> key_map_; /** The mapping of index key to tuple key */
+  std::string index_type_;        /** "bptree", "hash", "lsm" or "learned" for unique keys, "posting" for duplicate keys */
+  IndexPredicate predicate_;      /** Rows indexed by a partial index, empty for a full index */
 };
 
 /**
@@ -70,8 +87,7 @@ class IndexInfo {
     meta_data_ = meta_data; // 索引元数据
     Schema *table_schema = table_info->GetSchema(); // 获取元数据中的schema
     key_schema_ = Schema::ShallowCopySchema(table_schema, meta_data_->GetKeyMapping()); // 使用浅拷贝避免浪费
-    string index_type = "bptree"; // 没有给对应的index_type，在这里我们使用B+树构建索引
-    index_ = CreateIndex(buffer_pool_manager, index_type);
+    index_ = CreateIndex(buffer_pool_manager, meta_data_->GetIndexType()); // 按元数据中记录的索引类型创建
   }
 
   inline Index *GetIndex() { return index_; }
@@ -80,6 +96,37 @@ class IndexInfo {
 
   IndexSchema *GetIndexKeySchema() { return key_schema_; }
 
+  // whether every key maps to at most one row
+  bool IsUnique() const { return meta_data_->GetIndexType() != "posting"; }
+
+  // whether the index can answer range predicates, hash indexes only serve "="
+  bool IsOrdered() const { return meta_data_->GetIndexType() != "hash"; }
+
+  IndexMetadata *GetIndexMetadata() { return meta_data_; }
+
+  // whether the table row has an entry in the index, a partial index skips the rows its predicate rejects
+  bool Includes(const Row &row) const { return meta_data_->GetPredicate().Evaluate(row); }
+
+  bool IsPartial() const { return !meta_data_->GetPredicate().IsEmpty(); }
+
+  // statistics gathered by ANALYZE, persisted in the index meta page after the metadata
+  IndexStatistics &GetStatistics() { return statistics_; }
+
+  // keep analyzed statistics current after an executor added or removed a key
+  void RecordInsert(const Row &key) {
+    uint64_t hash;
+    if (ENABLE_INCREMENTAL_STATISTICS && statistics_.IsAnalyzed() &&
+        IndexStatistics::KeyHash(key, key_schema_, hash)) {
+      statistics_.RecordInsert(hash);
+    }
+  }
+
+  void RecordRemove() {
+    if (ENABLE_INCREMENTAL_STATISTICS && statistics_.IsAnalyzed()) {
+      statistics_.RecordRemove();
+    }
+  }
+
  private:
   explicit IndexInfo() : meta_data_{nullptr}, index_{nullptr}, key_schema_{nullptr} {}
 
@@ -89,6 +136,7 @@ class IndexInfo {
   IndexMetadata *meta_data_;
   Index *index_;
   IndexSchema *key_schema_;
+  IndexStatistics statistics_;
 };
 
 #endif  // MINISQL_INDEXES_H
@@ -15,6 +15,28 @@ static constexpr int INDEX_ROOTS_PAGE_ID = 1;   // logical page id of the index
 
 static constexpr int PAGE_SIZE = 4096;                  // size of a data page in byte
 static constexpr int DEFAULT_BUFFER_POOL_SIZE = 20480;  // default size of buffer pool
+static constexpr size_t DEFAULT_SORT_MEMORY_LIMIT = 64 << 20;  // memory budget of an external sort in byte
+static constexpr double DEFAULT_INDEX_FILL_FACTOR = 1.0;      // fraction of a page filled by index bulk loading
+static constexpr size_t INDEX_SCAN_BITMAP_THRESHOLD = 256;    // index scan rows read in key order before page order
+static constexpr size_t INDEX_BATCH_SIZE = 1024;              // keys looked up or inserted by one batched index call
+static constexpr size_t EXECUTOR_BATCH_SIZE = 1024;           // rows of a RowBatch passed between executors
+static constexpr bool ENABLE_ADAPTIVE_HASH_INDEX = true;       // hash hot B+ tree leaves for point lookups
+static constexpr uint32_t ADAPTIVE_HASH_BUILD_THRESHOLD = 16;  // lookups landing on a leaf before it is hashed
+static constexpr size_t ADAPTIVE_HASH_MAX_ENTRIES = 1 << 20;   // keys hashed per index before the hash is reset
+static constexpr size_t LSM_MEMTABLE_SIZE = 4 << 20;           // bytes buffered by an LSM tree before a flush
+static constexpr size_t LSM_L0_COMPACTION_TRIGGER = 8;         // level 0 runs of an LSM tree merged into level 1
+static constexpr size_t LSM_L0_STOP_WRITES_TRIGGER = 20;       // level 0 runs at which LSM tree writers wait
+static constexpr size_t LSM_LEVEL1_SIZE = 32 << 20;            // bytes of LSM level 1 before it is compacted
+static constexpr size_t LSM_LEVEL_SIZE_RATIO = 10;             // size of an LSM level relative to the one above
+static constexpr size_t LSM_BLOOM_BITS_PER_KEY = 10;           // Bloom filter bits per key of an LSM run
+static constexpr uint32_t LEARNED_INDEX_ERROR_BOUND = 32;      // max distance of a learned index prediction
+static constexpr size_t STATISTICS_SAMPLE_SIZE = 30000;        // leading key values sampled by ANALYZE per index
+static constexpr size_t STATISTICS_HISTOGRAM_BUCKETS = 64;     // buckets of an equi-depth index histogram
+static constexpr bool ENABLE_INCREMENTAL_STATISTICS = true;    // executors update analyzed index statistics
+static constexpr double INDEX_RANDOM_PAGE_COST = 4.0;          // cost of a heap fetch in key order, a page read is 1
+static constexpr size_t HASH_JOIN_MEMORY_BUDGET = 64 << 20;     // bytes of build rows a hash join keeps in memory
+static constexpr size_t HASH_JOIN_PARTITIONS = 32;             // partitions a hash join spills each side into
+static constexpr uint32_t HASH_JOIN_MAX_DEPTH = 3;             // times a spilled partition is partitioned again
 
 static constexpr uint32_t FIELD_NULL_LEN = UINT32_MAX;
 static constexpr uint32_t VARCHAR_MAX_LEN = PAGE_SIZE / 2;  // max length of varchar
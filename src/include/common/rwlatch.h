@@ -1,9 +1,11 @@
 #ifndef MINISQL_RWLATCH_H
 #define MINISQL_RWLATCH_H
 
+#include <atomic>
 #include <climits>
 #include <condition_variable>
 #include <mutex>
+#include <thread>
 
 #include "macros.h"
 
@@ -85,4 +87,73 @@ class ReaderWriterLatch {
   bool writer_entered_{false};
 };
 
+/**
+ * Version latch for optimistic lock coupling.
+ *
+ * Readers never write the latch: they remember the version before reading and
+ * validate it afterwards, restarting on mismatch. Writers upgrade a version
+ * they have read (or spin for it), which bumps the version on release.
+ * Bit 1 marks a writer, bit 0 marks the protected node as obsolete.
+ */
+class OptimisticLatch {
+ public:
+  OptimisticLatch() = default;
+
+  DISALLOW_COPY(OptimisticLatch);
+
+  /**
+   * Read the current version, return false if it is write locked or obsolete.
+   */
+  bool ReadLock(uint64_t &version) const {
+    version = version_.load(std::memory_order_acquire);
+    return (version & 0b11) == 0;
+  }
+
+  /**
+   * Return true if no writer has touched the latch since version was read.
+   */
+  bool Validate(uint64_t version) const {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return version_.load(std::memory_order_relaxed) == version;
+  }
+
+  /**
+   * Turn a read version into a write latch, fail if anyone wrote in between.
+   */
+  bool TryUpgrade(uint64_t version) {
+    return version_.compare_exchange_strong(version, version + 0b10, std::memory_order_acquire);
+  }
+
+  /**
+   * Acquire a write latch, spinning while another writer holds it.
+   */
+  void WLock() {
+    while (true) {
+      uint64_t version = version_.load(std::memory_order_relaxed);
+      if ((version & 0b10) == 0 && TryUpgrade(version)) {
+        return;
+      }
+      std::this_thread::yield();
+    }
+  }
+
+  /**
+   * Release a write latch.
+   */
+  void WUnlock() { version_.fetch_add(0b10, std::memory_order_release); }
+
+  /**
+   * Release a write latch and mark the node obsolete, readers holding it restart.
+   */
+  void WUnlockObsolete() { version_.fetch_add(0b11, std::memory_order_release); }
+
+  /**
+   * Clear the obsolete mark before the latch guards a new node, the version keeps growing.
+   */
+  void Reset() { version_.store((version_.load(std::memory_order_relaxed) | 0b11) + 1, std::memory_order_release); }
+
+ private:
+  std::atomic<uint64_t> version_{0};
+};
+
 #endif  // MINISQL_RWLATCH_H
@@ -2,8 +2,11 @@
 #define MINISQL_ABSTRACT_EXECUTOR_H
 
 #include "executor/execute_context.h"
+#include "record/row_batch.h"
 /**
- * The AbstractExecutor implements the Volcano row-at-a-time iterator model.
+ * The AbstractExecutor implements the Volcano iterator model, pulling either
+ * one row at a time with Next() or a batch of rows with NextBatch(). An
+ * executor is pulled through only one of the two after Init().
  * This is the base class from which all executors in the execution engine
  * inherit, and defines the minimal interface that all executors support.
  */
@@ -32,6 +35,23 @@ class AbstractExecutor {
    */
   virtual bool Next(Row *row, RowId *rid) = 0;
 
+  /**
+   * Yield the next batch of rows from this executor, by default the rows of up to
+   * EXECUTOR_BATCH_SIZE calls to Next().
+   * @param[out] batch The rows produced, at least one row of it is selected
+   * @return `true` if rows were produced, `false` if there are no more rows
+   */
+  virtual bool NextBatch(RowBatch &batch) {
+    batch.Reset();
+    Row row;
+    RowId rid;
+    while (!batch.IsFull() && Next(&row, &rid)) {
+      row.SetRowId(rid);
+      batch.AppendRow(row);
+    }
+    return batch.GetSize() > 0;
+  }
+
   /** @return The schema of the rows that this executor produces */
   virtual const Schema *GetOutputSchema() const = 0;
 
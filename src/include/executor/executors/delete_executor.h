@@ -40,10 +40,20 @@ class DeleteExecutor : public AbstractExecutor {
    */
   bool Next(Row *row, RowId *rid) override;
 
+  /**
+   * Delete the rows of the next child batch.
+   * @param[out] batch One row without columns for every row deleted
+   * @return `true` if rows were deleted, `false` if there are no more rows
+   */
+  bool NextBatch(RowBatch &batch) override;
+
   /** @return The output schema for the delete */
   const Schema *GetOutputSchema() const override { return plan_->OutputSchema(); }
 
  private:
+  /** Delete a row and its index entries, @return `false` if the row could not be deleted */
+  bool DeleteRow(Row &row, RowId rid);
+
   /** The delete plan node to be executed */
   const DeletePlanNode *plan_;
   TableInfo *table_info_{};
@@ -51,6 +61,10 @@ class DeleteExecutor : public AbstractExecutor {
   std::vector<IndexInfo *> index_info_;
   /** The child executor from which RIDs for deleted rows are pulled */
   std::unique_ptr<AbstractExecutor> child_executor_;
+  /** Batch of rows pulled from the child */
+  RowBatch child_batch_;
+  /** Whether a row could not be deleted, which ends the delete */
+  bool done_{false};
 };
 
 #endif  // MINISQL_DELETE_EXECUTOR_H
@@ -0,0 +1,118 @@
+#ifndef MINISQL_HASH_JOIN_EXECUTOR_H
+#define MINISQL_HASH_JOIN_EXECUTOR_H
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "executor/execute_context.h"
+#include "executor/executors/abstract_executor.h"
+#include "executor/plans/hash_join_plan.h"
+
+/**
+ * HashJoinExecutor executes an inner equi-join. The rows of the build side are
+ * hashed on their join keys and the probe side is streamed through the table.
+ *
+ * When the build rows outgrow the memory budget, the join turns into a grace
+ * hash join: both sides are partitioned by the hash of their keys into
+ * temporary files, and matching partitions are joined one pair at a time. A
+ * partition still too large for the budget is partitioned again with another
+ * hash seed, up to HASH_JOIN_MAX_DEPTH times.
+ */
+class HashJoinExecutor : public AbstractExecutor {
+ public:
+  /**
+   * Construct a new HashJoinExecutor instance.
+   * @param exec_ctx The executor context
+   * @param plan The hash join plan to be executed
+   * @param left_executor The build side
+   * @param right_executor The probe side
+   */
+  HashJoinExecutor(ExecuteContext *exec_ctx, const HashJoinPlanNode *plan,
+                   std::unique_ptr<AbstractExecutor> &&left_executor,
+                   std::unique_ptr<AbstractExecutor> &&right_executor);
+
+  ~HashJoinExecutor() override;
+
+  /** Initialize the join and build the hash table */
+  void Init() override;
+
+  /**
+   * Yield the next joined row.
+   * @param[out] row The next row of the output schema
+   * @param[out] rid Unused, joined rows have no row id
+   * @return `true` if a row was produced, `false` if there are no more rows
+   */
+  bool Next(Row *row, RowId *rid) override;
+
+  /** @return The output schema of the join */
+  const Schema *GetOutputSchema() const override { return plan_->OutputSchema(); }
+
+  /** @return Whether the build side did not fit into the memory budget */
+  bool IsSpilled() const { return spilled_; }
+
+ private:
+  // rows of one side in one hash partition, in the format of Row::SerializeTo
+  struct Partition {
+    FILE *file{nullptr};
+    size_t rows{0};
+  };
+
+  // a pair of partitions still to be joined and the hash seed that made them
+  struct PartitionPair {
+    Partition build;
+    Partition probe;
+    uint32_t depth;
+  };
+
+  // the key bytes of the row, false if a key is null and the row matches nothing
+  bool MakeKey(const std::vector<AbstractExpressionRef> &keys, const Row &row, std::string &key) const;
+
+  static size_t PartitionOf(const std::string &key, uint32_t depth);
+
+  // add a build row to the hash table, spilling the table once it exceeds the budget
+  void Insert(std::string &&key, const Row &row);
+
+  void Spill();
+
+  // the next row of the probe side, from the right child or the current probe partition
+  bool NextProbeRow(Row &row);
+
+  // load the build partition of the next pair into the hash table, false when every pair is joined
+  bool LoadNextPartition();
+
+  // split a partition of one side into HASH_JOIN_PARTITIONS partitions of the next depth
+  void Repartition(Partition &source, const Schema *schema, const std::vector<AbstractExpressionRef> &keys,
+                   uint32_t depth, std::vector<Partition> &targets);
+
+  static void WriteRow(Partition &partition, const Row &row, const Schema *schema, std::vector<char> &buffer);
+
+  static bool ReadRow(FILE *file, Row &row, const Schema *schema, std::vector<char> &buffer);
+
+  static void Close(Partition &partition);
+
+  void Clear();
+
+  /** The hash join plan node to be executed */
+  const HashJoinPlanNode *plan_;
+  std::unique_ptr<AbstractExecutor> left_executor_;
+  std::unique_ptr<AbstractExecutor> right_executor_;
+  // build rows by key and the bytes they take
+  std::unordered_multimap<std::string, Row> table_;
+  size_t table_bytes_{0};
+  bool spilled_{false};
+  // partitions of the first depth, filled while both children are read
+  std::vector<Partition> build_partitions_;
+  std::vector<Partition> probe_partitions_;
+  std::vector<PartitionPair> pending_;
+  Partition probe_file_;
+  // the probe row and its build rows not joined yet
+  Row probe_row_;
+  std::unordered_multimap<std::string, Row>::const_iterator match_;
+  std::unordered_multimap<std::string, Row>::const_iterator match_end_;
+  std::vector<char> buffer_;
+};
+
+#endif  // MINISQL_HASH_JOIN_EXECUTOR_H
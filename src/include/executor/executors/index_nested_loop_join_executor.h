@@ -0,0 +1,60 @@
+#ifndef MINISQL_INDEX_NESTED_LOOP_JOIN_EXECUTOR_H
+#define MINISQL_INDEX_NESTED_LOOP_JOIN_EXECUTOR_H
+
+#include <memory>
+#include <vector>
+
+#include "executor/execute_context.h"
+#include "executor/executors/abstract_executor.h"
+#include "executor/plans/index_nested_loop_join_plan.h"
+
+/**
+ * IndexNestedLoopJoinExecutor executes an inner join by looking up the rows of
+ * the inner table that match each outer row in an index.
+ *
+ * Outer rows are taken INDEX_BATCH_SIZE at a time and their keys are sorted,
+ * so that the distinct keys of the batch are looked up with one ScanKeys call
+ * walking the index from left to right. The inner rows found are then read from
+ * the table page by page, each page once per batch.
+ */
+class IndexNestedLoopJoinExecutor : public AbstractExecutor {
+ public:
+  /**
+   * Construct a new IndexNestedLoopJoinExecutor instance.
+   * @param exec_ctx The executor context
+   * @param plan The index nested loop join plan to be executed
+   * @param outer_executor The outer side
+   */
+  IndexNestedLoopJoinExecutor(ExecuteContext *exec_ctx, const IndexNestedLoopJoinPlanNode *plan,
+                              std::unique_ptr<AbstractExecutor> &&outer_executor);
+
+  /** Initialize the join */
+  void Init() override;
+
+  /**
+   * Yield the next joined row.
+   * @param[out] row The next row of the output schema
+   * @param[out] rid Unused, joined rows have no row id
+   * @return `true` if a row was produced, `false` if there are no more rows
+   */
+  bool Next(Row *row, RowId *rid) override;
+
+  /** @return The output schema of the join */
+  const Schema *GetOutputSchema() const override { return plan_->OutputSchema(); }
+
+ private:
+  // join the next batch of outer rows into results_, return whether any row was joined
+  bool JoinBatch();
+
+  /** The index nested loop join plan node to be executed */
+  const IndexNestedLoopJoinPlanNode *plan_;
+  std::unique_ptr<AbstractExecutor> outer_executor_;
+  TableInfo *inner_table_{};
+  RowBatch outer_batch_;
+  bool done_{false};
+  // joined rows of the current batch not returned yet
+  std::vector<Row> results_;
+  size_t result_index_{0};
+};
+
+#endif  // MINISQL_INDEX_NESTED_LOOP_JOIN_EXECUTOR_H
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "executor/execute_context.h"
@@ -7,6 +8,9 @@
 #include "executor/plans/index_scan_plan.h"
 #include "planner/expressions/column_value_expression.h"
 #include "planner/expressions/comparison_expression.h"
+#include "planner/expressions/constant_value_expression.h"
+#include "planner/expressions/logic_expression.h"
+#include "storage/row_id_bitmap.h"
 
 /**
  * The IndexScanExecutor executor can over a table.
@@ -31,6 +35,13 @@ class IndexScanExecutor : public AbstractExecutor {
    */
   bool Next(Row *row, RowId *rid) override;
 
+  /**
+   * Yield the next batch of rows from the index scan.
+   * @param[out] batch The rows of the output schema that satisfy the predicate
+   * @return `true` if rows were produced, `false` if there are no more rows
+   */
+  bool NextBatch(RowBatch &batch) override;
+
   /** @return The output schema for the sequential scan */
   const Schema *GetOutputSchema() const override { return plan_->OutputSchema(); }
 
@@ -39,12 +50,50 @@ class IndexScanExecutor : public AbstractExecutor {
   void TupleTransfer(const Schema *table_schema, const Schema *output_schema, const Row *row, Row *output_row);
 
  private:
-  vector<RowId> IndexScan(AbstractExpressionRef predicate);
+  // pick the comparisons of the predicate that drive the scan and turn them into
+  // index ranges, return the rank of the chosen access path
+  int ChooseAccessPath(const AbstractExpressionRef &predicate);
+
+  static void SplitConjuncts(const AbstractExpressionRef &predicate, std::vector<AbstractExpressionRef> &conjuncts);
+
+  IndexInfo *ComparisonIndex(const std::shared_ptr<ComparisonExpression> &comparison);
+
+  // collect the row ids of the rows that may satisfy expr, false if no index narrows them down
+  bool BuildBitmap(const AbstractExpressionRef &expr, RowIdBitmap &bitmap);
+
+  // fetch the next candidate row, before the predicate is checked
+  bool FetchRow(Row &table_row);
+
+  // whether the output and the predicate only read key columns of the index
+  bool IsCoveredBy(IndexInfo *index);
 
   /** The sequential scan plan node to be executed */
   const IndexScanPlanNode *plan_;
   TableInfo *table_info_{};
-  vector<RowId> result_;
-  size_t cursor_ = 0;
+  // index the rows come from and the ranges scanned on it, one after another
+  Index *index_{nullptr};
+  IndexInfo *index_info_{nullptr};
+  Row lower_key_;
+  Row upper_key_;
+  std::vector<IndexRange> ranges_;
+  size_t range_index_{0};
+  std::unique_ptr<IndexCursor> cursor_;
+  // whether the predicate has to be rechecked on every row
+  bool need_filter_{true};
+  // whether rows are rebuilt from the index keys instead of read from the heap,
+  // key_columns_ holds the table column of every key column
+  bool index_only_{false};
+  std::vector<uint32_t> key_columns_;
+  // bitmap heap scan: the row ids still to read, grouped by page, and the rows
+  // of the page being returned
+  bool bitmap_mode_{false};
+  size_t streamed_{0};
+  RowIdBitmap bitmap_;
+  RowIdBitmap::ConstIterator page_iter_;
+  std::vector<Row> page_rows_;
+  size_t page_row_index_{0};
   bool is_schema_same_;
+  // batch scan: the candidate rows before the predicate and the table column of every output column
+  RowBatch scan_batch_;
+  std::vector<uint32_t> column_map_;
 };
\ No newline at end of file
@@ -38,16 +38,32 @@ class InsertExecutor : public AbstractExecutor {
    */
   bool Next([[maybe_unused]] Row *row, RowId *rid) override;
 
+  /**
+   * Insert the next batch of rows.
+   * @param[out] batch One row without columns for every row inserted
+   * @return `true` if rows were inserted, `false` if there are no more rows
+   */
+  bool NextBatch(RowBatch &batch) override;
+
   /** @return The output schema for the insert */
   const Schema *GetOutputSchema() const override { return plan_->OutputSchema(); }
 
  private:
+  /** Insert the next batch of child rows, @return the number of rows inserted */
+  size_t InsertBatch();
+
   /** The insert plan node to be executed*/
   const InsertPlanNode *plan_;
   std::unique_ptr<AbstractExecutor> child_executor_;
   TableInfo *table_info_{};
   const Schema *schema_{};
   std::vector<IndexInfo *> index_info_;
+  /** Rows of the last batch not reported by Next yet */
+  size_t pending_{0};
+  /** Batch of rows pulled from the child */
+  RowBatch child_batch_;
+  /** Whether the child is exhausted or the insert stopped at a duplicate key */
+  bool done_{false};
 };
 
 #endif  // MINISQL_INSERT_EXECUTOR_H
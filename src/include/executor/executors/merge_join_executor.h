@@ -0,0 +1,76 @@
+#ifndef MINISQL_MERGE_JOIN_EXECUTOR_H
+#define MINISQL_MERGE_JOIN_EXECUTOR_H
+
+#include <memory>
+#include <vector>
+
+#include "executor/execute_context.h"
+#include "executor/executors/abstract_executor.h"
+#include "executor/plans/merge_join_plan.h"
+#include "storage/external_row_sorter.h"
+
+/**
+ * MergeJoinExecutor executes an inner equi-join of two inputs ordered on their
+ * join keys. A side the plan asks to sort is read completely in Init() and
+ * sorted with an ExternalRowSorter, which spills sorted runs to disk beyond the
+ * memory limit, so both inputs are then read once and in order.
+ *
+ * The right rows sharing a key are buffered as a group and joined with every
+ * left row of that key, rows with a null key are skipped on both sides.
+ */
+class MergeJoinExecutor : public AbstractExecutor {
+ public:
+  /**
+   * Construct a new MergeJoinExecutor instance.
+   * @param exec_ctx The executor context
+   * @param plan The merge join plan to be executed
+   * @param left_executor The left side
+   * @param right_executor The right side
+   */
+  MergeJoinExecutor(ExecuteContext *exec_ctx, const MergeJoinPlanNode *plan,
+                    std::unique_ptr<AbstractExecutor> &&left_executor,
+                    std::unique_ptr<AbstractExecutor> &&right_executor);
+
+  /** Initialize the join and sort the sides that are not ordered yet */
+  void Init() override;
+
+  /**
+   * Yield the next joined row.
+   * @param[out] row The next row of the output schema
+   * @param[out] rid Unused, joined rows have no row id
+   * @return `true` if a row was produced, `false` if there are no more rows
+   */
+  bool Next(Row *row, RowId *rid) override;
+
+  /** @return The output schema of the join */
+  const Schema *GetOutputSchema() const override { return plan_->OutputSchema(); }
+
+  /** @return The number of runs the sorts spilled to disk, 0 if they were done in memory */
+  size_t GetRunCount() const;
+
+ private:
+  // the next row of a child whose key has no null
+  bool NextChildRow(uint32_t side, Row &row);
+
+  // the next row of a side in key order
+  bool NextRow(uint32_t side, Row &row);
+
+  // compare the keys of two rows, each from the side given, returns <0, 0 or >0
+  int CompareKeys(uint32_t lhs_side, const Row &lhs, uint32_t rhs_side, const Row &rhs) const;
+
+  /** The merge join plan node to be executed */
+  const MergeJoinPlanNode *plan_;
+  std::unique_ptr<AbstractExecutor> children_[2];
+  // the key columns of each side
+  std::vector<uint32_t> key_columns_[2];
+  std::unique_ptr<ExternalRowSorter> sorters_[2];
+  // the current row of each side and whether there is one
+  Row rows_[2];
+  bool has_row_[2]{false, false};
+  // the right rows with the key of the current left row, and the next one to join
+  std::vector<Row> group_;
+  size_t group_index_{0};
+  bool in_group_{false};
+};
+
+#endif  // MINISQL_MERGE_JOIN_EXECUTOR_H
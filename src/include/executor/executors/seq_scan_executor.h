@@ -34,6 +34,13 @@ class SeqScanExecutor : public AbstractExecutor {
    */
   bool Next(Row *row, RowId *rid) override;
 
+  /**
+   * Yield the next batch of rows from the sequential scan.
+   * @param[out] batch The rows of the output schema that satisfy the predicate
+   * @return `true` if rows were produced, `false` if there are no more rows
+   */
+  bool NextBatch(RowBatch &batch) override;
+
   /** @return The output schema for the sequential scan */
   const Schema *GetOutputSchema() const override { return plan_->OutputSchema(); }
 
@@ -48,6 +55,11 @@ class SeqScanExecutor : public AbstractExecutor {
   TableIterator iterator_;
   const Schema *schema_{};
   bool is_schema_same_;
+  // batch scan: the next tuple to read, the batch the table pages are decoded
+  // into and the table column of every output column
+  RowId position_;
+  RowBatch scan_batch_;
+  std::vector<uint32_t> column_map_;
 };
 
 #endif  // MINISQL_SEQ_SCAN_EXECUTOR_H
@@ -40,6 +40,13 @@ class UpdateExecutor : public AbstractExecutor {
    */
   bool Next([[maybe_unused]] Row *row, RowId *rid) override;
 
+  /**
+   * Update the rows of the next child batch.
+   * @param[out] batch One row without columns for every row updated
+   * @return `true` if rows were updated, `false` if there are no more rows
+   */
+  bool NextBatch(RowBatch &batch) override;
+
   /** @return The output schema for the update */
   const Schema *GetOutputSchema() const override { return plan_->OutputSchema(); }
 
@@ -51,6 +58,9 @@ class UpdateExecutor : public AbstractExecutor {
    */
   Row GenerateUpdatedTuple(const Row &src_row);
 
+  /** Update a row and its index entries, @return `false` if the row could not be updated */
+  bool UpdateRow(Row &src_row, RowId src_rid);
+
   /** The update plan node to be executed */
   const UpdatePlanNode *plan_;
   /** Metadata identifying the table that should be updated */
@@ -59,6 +69,10 @@ class UpdateExecutor : public AbstractExecutor {
   std::vector<IndexInfo *> index_info_;
   /** The child executor to obtain value from */
   std::unique_ptr<AbstractExecutor> child_executor_;
+  /** Batch of rows pulled from the child */
+  RowBatch child_batch_;
+  /** Whether a row could not be updated, which ends the update */
+  bool done_{false};
 };
 
 #endif  // MINISQL_UPDATE_EXECUTOR_H
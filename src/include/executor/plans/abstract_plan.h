@@ -23,6 +23,9 @@ enum class PlanType {
   Limit,
   Distinct,
   NestedLoopJoin,
+  HashJoin,
+  IndexNestedLoopJoin,
+  MergeJoin,
 };
 
 class AbstractPlanNode;
@@ -0,0 +1,74 @@
+#ifndef MINISQL_HASH_JOIN_PLAN_H
+#define MINISQL_HASH_JOIN_PLAN_H
+
+#include <utility>
+#include <vector>
+
+#include "abstract_plan.h"
+#include "common/config.h"
+#include "planner/expressions/abstract_expression.h"
+
+/**
+ * HashJoinPlanNode joins the rows of its two children on the equality of their
+ * join keys. The left child is the build side, hashed on its keys, the right
+ * child is the probe side. Join keys are evaluated on the row of their own side,
+ * the remaining predicate and the output expressions on the pair of rows.
+ */
+class HashJoinPlanNode : public AbstractPlanNode {
+ public:
+  /**
+   * Construct a new HashJoinPlanNode instance.
+   * @param output The output schema of the join
+   * @param left The build side
+   * @param right The probe side
+   * @param left_keys The join keys of the build side
+   * @param right_keys The join keys of the probe side, compared with left_keys one by one
+   * @param predicate The conjuncts other than the key equalities, nullptr if there are none
+   * @param output_exprs The expression of each output column
+   * @param memory_budget Bytes of build rows hashed in memory before the join partitions both sides to disk
+   */
+  HashJoinPlanNode(const Schema *output, AbstractPlanNodeRef left, AbstractPlanNodeRef right,
+                   std::vector<AbstractExpressionRef> left_keys, std::vector<AbstractExpressionRef> right_keys,
+                   AbstractExpressionRef predicate, std::vector<AbstractExpressionRef> output_exprs,
+                   size_t memory_budget = HASH_JOIN_MEMORY_BUDGET)
+      : AbstractPlanNode(output, {std::move(left), std::move(right)}),
+        left_keys_(std::move(left_keys)),
+        right_keys_(std::move(right_keys)),
+        predicate_(std::move(predicate)),
+        output_exprs_(std::move(output_exprs)),
+        memory_budget_(memory_budget) {}
+
+  /** @return The type of the plan node */
+  PlanType GetType() const override { return PlanType::HashJoin; }
+
+  /** @return The build side */
+  AbstractPlanNodeRef GetLeftPlan() const { return GetChildAt(0); }
+
+  /** @return The probe side */
+  AbstractPlanNodeRef GetRightPlan() const { return GetChildAt(1); }
+
+  const std::vector<AbstractExpressionRef> &GetLeftKeys() const { return left_keys_; }
+
+  const std::vector<AbstractExpressionRef> &GetRightKeys() const { return right_keys_; }
+
+  AbstractExpressionRef GetPredicate() const { return predicate_; }
+
+  const std::vector<AbstractExpressionRef> &GetOutputExprs() const { return output_exprs_; }
+
+  size_t GetMemoryBudget() const { return memory_budget_; }
+
+  /** The join keys of each side */
+  std::vector<AbstractExpressionRef> left_keys_;
+  std::vector<AbstractExpressionRef> right_keys_;
+
+  /** The rest of the join condition */
+  AbstractExpressionRef predicate_;
+
+  /** The expressions of the output columns */
+  std::vector<AbstractExpressionRef> output_exprs_;
+
+  /** Memory of the in-memory hash table in byte */
+  size_t memory_budget_;
+};
+
+#endif  // MINISQL_HASH_JOIN_PLAN_H
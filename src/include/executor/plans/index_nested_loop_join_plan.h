@@ -0,0 +1,91 @@
+#ifndef MINISQL_INDEX_NESTED_LOOP_JOIN_PLAN_H
+#define MINISQL_INDEX_NESTED_LOOP_JOIN_PLAN_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "abstract_plan.h"
+#include "catalog/catalog.h"
+#include "planner/expressions/compiled_predicate.h"
+
+/**
+ * IndexNestedLoopJoinPlanNode joins the rows of its child, the outer side, with
+ * the rows of the inner table found through an index on the inner join columns.
+ * The outer keys are evaluated on the outer row and give the index key, column
+ * by column. Inner rows are filtered by the inner predicate, the remaining join
+ * predicate and the output expressions see the left and the right row of the
+ * join, whichever of them is the inner one.
+ */
+class IndexNestedLoopJoinPlanNode : public AbstractPlanNode {
+ public:
+  /**
+   * Construct a new IndexNestedLoopJoinPlanNode instance.
+   * @param output The output schema of the join
+   * @param outer The plan of the outer side
+   * @param inner_table_name The table probed through the index
+   * @param index The index on the inner join columns
+   * @param outer_keys The expressions of the outer row giving each column of the index key
+   * @param inner_predicate The conjuncts on the inner table alone, nullptr if there are none
+   * @param predicate The rest of the join condition, nullptr if there is none
+   * @param output_exprs The expression of each output column
+   * @param inner_is_left Whether the inner table is the left side of the join
+   */
+  IndexNestedLoopJoinPlanNode(const Schema *output, AbstractPlanNodeRef outer, std::string inner_table_name,
+                              IndexInfo *index, std::vector<AbstractExpressionRef> outer_keys,
+                              AbstractExpressionRef inner_predicate, AbstractExpressionRef predicate,
+                              std::vector<AbstractExpressionRef> output_exprs, bool inner_is_left)
+      : AbstractPlanNode(output, {std::move(outer)}),
+        inner_table_name_(std::move(inner_table_name)),
+        index_(index),
+        outer_keys_(std::move(outer_keys)),
+        inner_predicate_(std::move(inner_predicate)),
+        compiled_inner_predicate_(inner_predicate_),
+        predicate_(std::move(predicate)),
+        output_exprs_(std::move(output_exprs)),
+        inner_is_left_(inner_is_left) {}
+
+  /** @return The type of the plan node */
+  PlanType GetType() const override { return PlanType::IndexNestedLoopJoin; }
+
+  /** @return The plan of the outer side */
+  AbstractPlanNodeRef GetOuterPlan() const { return GetChildAt(0); }
+
+  std::string GetInnerTableName() const { return inner_table_name_; }
+
+  IndexInfo *GetIndex() const { return index_; }
+
+  const std::vector<AbstractExpressionRef> &GetOuterKeys() const { return outer_keys_; }
+
+  AbstractExpressionRef GetInnerPredicate() const { return inner_predicate_; }
+
+  const CompiledPredicate &GetCompiledInnerPredicate() const { return compiled_inner_predicate_; }
+
+  AbstractExpressionRef GetPredicate() const { return predicate_; }
+
+  const std::vector<AbstractExpressionRef> &GetOutputExprs() const { return output_exprs_; }
+
+  bool IsInnerLeft() const { return inner_is_left_; }
+
+  /** The inner table and its index */
+  std::string inner_table_name_;
+  IndexInfo *index_;
+
+  /** The index key of an outer row */
+  std::vector<AbstractExpressionRef> outer_keys_;
+
+  /** The filter of the inner rows, and its compiled form */
+  AbstractExpressionRef inner_predicate_;
+  CompiledPredicate compiled_inner_predicate_;
+
+  /** The rest of the join condition */
+  AbstractExpressionRef predicate_;
+
+  /** The expressions of the output columns */
+  std::vector<AbstractExpressionRef> output_exprs_;
+
+  /** Whether the inner table is row index 0 of the join expressions */
+  bool inner_is_left_;
+};
+
+#endif  // MINISQL_INDEX_NESTED_LOOP_JOIN_PLAN_H
@@ -5,7 +5,7 @@
 
 #include "abstract_plan.h"
 #include "catalog/catalog.h"
-#include "planner/expressions/abstract_expression.h"
+#include "planner/expressions/compiled_predicate.h"
 
 /**
  * IndexScanPlanNode identifies a table that should be scanned with an optional predicate.
@@ -16,14 +16,17 @@ class IndexScanPlanNode : public AbstractPlanNode {
    * Creates a new index scan plan node.
    * @param output the output format of this scan plan node
    * @param table_name The identifier of table to be scanned
+   * @param key_ordered Whether the rows must come in the key order of the (single) index
    */
   IndexScanPlanNode(const Schema *output, std::string table_name, std::vector<IndexInfo *> indexes, bool need_filter,
-                    AbstractExpressionRef filter_predicate = nullptr)
+                    AbstractExpressionRef filter_predicate = nullptr, bool key_ordered = false)
       : AbstractPlanNode(output, {}),
         table_name_(std::move(table_name)),
         indexes_(std::move(indexes)),
         need_filter_(need_filter),
-        filter_predicate_(std::move(filter_predicate)) {}
+        filter_predicate_(std::move(filter_predicate)),
+        compiled_predicate_(filter_predicate_),
+        key_ordered_(key_ordered) {}
 
   /** @return The type of the plan node */
   PlanType GetType() const override { return PlanType::IndexScan; }
@@ -33,6 +36,10 @@ class IndexScanPlanNode : public AbstractPlanNode {
 
   AbstractExpressionRef GetPredicate() const { return filter_predicate_; }
 
+  const CompiledPredicate &GetCompiledPredicate() const { return compiled_predicate_; }
+
+  bool IsKeyOrdered() const { return key_ordered_; }
+
   /** The table name */
   std::string table_name_;
 
@@ -44,4 +51,10 @@ class IndexScanPlanNode : public AbstractPlanNode {
 
   /** The predicate to filter in IndexScan.*/
   AbstractExpressionRef filter_predicate_;
+
+  /** The predicate compiled for evaluation.*/
+  CompiledPredicate compiled_predicate_;
+
+  /** Whether the scan keeps to index order instead of switching to row id bitmaps.*/
+  bool key_ordered_ = false;
 };
\ No newline at end of file
@@ -0,0 +1,88 @@
+#ifndef MINISQL_MERGE_JOIN_PLAN_H
+#define MINISQL_MERGE_JOIN_PLAN_H
+
+#include <utility>
+#include <vector>
+
+#include "abstract_plan.h"
+#include "common/config.h"
+#include "planner/expressions/abstract_expression.h"
+
+/**
+ * MergeJoinPlanNode joins its two children on the equality of their join keys
+ * by merging both sides in key order. A child read through an ordered index on
+ * its join keys already returns its rows in that order, the other children are
+ * sorted by the join with an external merge sort first.
+ *
+ * The join keys are columns of the rows of their own side, compared in the order
+ * they are listed. The remaining predicate and the output expressions are
+ * evaluated on the pair of rows.
+ */
+class MergeJoinPlanNode : public AbstractPlanNode {
+ public:
+  /**
+   * Construct a new MergeJoinPlanNode instance.
+   * @param output The output schema of the join
+   * @param left The left side
+   * @param right The right side
+   * @param left_keys The join key columns of the left side
+   * @param right_keys The join key columns of the right side, compared with left_keys one by one
+   * @param predicate The conjuncts other than the key equalities, nullptr if there are none
+   * @param output_exprs The expression of each output column
+   * @param sort_left Whether the left rows have to be sorted on their keys
+   * @param sort_right Whether the right rows have to be sorted on their keys
+   * @param memory_limit Bytes of rows a sort keeps in memory before it spills runs to disk
+   */
+  MergeJoinPlanNode(const Schema *output, AbstractPlanNodeRef left, AbstractPlanNodeRef right,
+                    std::vector<AbstractExpressionRef> left_keys, std::vector<AbstractExpressionRef> right_keys,
+                    AbstractExpressionRef predicate, std::vector<AbstractExpressionRef> output_exprs, bool sort_left,
+                    bool sort_right, size_t memory_limit = DEFAULT_SORT_MEMORY_LIMIT)
+      : AbstractPlanNode(output, {std::move(left), std::move(right)}),
+        left_keys_(std::move(left_keys)),
+        right_keys_(std::move(right_keys)),
+        predicate_(std::move(predicate)),
+        output_exprs_(std::move(output_exprs)),
+        sort_left_(sort_left),
+        sort_right_(sort_right),
+        memory_limit_(memory_limit) {}
+
+  /** @return The type of the plan node */
+  PlanType GetType() const override { return PlanType::MergeJoin; }
+
+  AbstractPlanNodeRef GetLeftPlan() const { return GetChildAt(0); }
+
+  AbstractPlanNodeRef GetRightPlan() const { return GetChildAt(1); }
+
+  const std::vector<AbstractExpressionRef> &GetLeftKeys() const { return left_keys_; }
+
+  const std::vector<AbstractExpressionRef> &GetRightKeys() const { return right_keys_; }
+
+  AbstractExpressionRef GetPredicate() const { return predicate_; }
+
+  const std::vector<AbstractExpressionRef> &GetOutputExprs() const { return output_exprs_; }
+
+  bool SortsLeft() const { return sort_left_; }
+
+  bool SortsRight() const { return sort_right_; }
+
+  size_t GetMemoryLimit() const { return memory_limit_; }
+
+  /** The join keys of each side */
+  std::vector<AbstractExpressionRef> left_keys_;
+  std::vector<AbstractExpressionRef> right_keys_;
+
+  /** The rest of the join condition */
+  AbstractExpressionRef predicate_;
+
+  /** The expressions of the output columns */
+  std::vector<AbstractExpressionRef> output_exprs_;
+
+  /** Whether each side is sorted by the join */
+  bool sort_left_;
+  bool sort_right_;
+
+  /** Memory of each sort in byte */
+  size_t memory_limit_;
+};
+
+#endif  // MINISQL_MERGE_JOIN_PLAN_H
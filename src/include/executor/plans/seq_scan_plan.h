@@ -7,7 +7,7 @@
 
 #include "abstract_plan.h"
 #include "catalog/catalog.h"
-#include "planner/expressions/abstract_expression.h"
+#include "planner/expressions/compiled_predicate.h"
 
 class SeqScanPlanNode : public AbstractPlanNode {
  public:
@@ -19,7 +19,8 @@ class SeqScanPlanNode : public AbstractPlanNode {
   SeqScanPlanNode(const Schema *output, std::string table_name, AbstractExpressionRef filter_predicate = nullptr)
       : AbstractPlanNode(output, {}),
         table_name_(std::move(table_name)),
-        filter_predicate_(std::move(filter_predicate)) {}
+        filter_predicate_(std::move(filter_predicate)),
+        compiled_predicate_(filter_predicate_) {}
 
   /** @return The type of the plan node */
   PlanType GetType() const override { return PlanType::SeqScan; }
@@ -29,11 +30,16 @@ class SeqScanPlanNode : public AbstractPlanNode {
 
   AbstractExpressionRef GetPredicate() const { return filter_predicate_; }
 
+  const CompiledPredicate &GetCompiledPredicate() const { return compiled_predicate_; }
+
   /** The table name */
   std::string table_name_;
 
   /** The predicate to filter in SeqScan.*/
   AbstractExpressionRef filter_predicate_;
+
+  /** The predicate compiled for evaluation.*/
+  CompiledPredicate compiled_predicate_;
 };
 
 #endif  // MINISQL_SEQ_SCAN_PLAN_H
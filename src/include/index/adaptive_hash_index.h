@@ -0,0 +1,101 @@
+#ifndef MINISQL_ADAPTIVE_HASH_INDEX_H
+#define MINISQL_ADAPTIVE_HASH_INDEX_H
+
+#include <atomic>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "common/config.h"
+
+/**
+ * In-memory hash from key to the (leaf page id, slot) holding it, kept by a
+ * TypedBPlusTree for the leaves its point lookups keep landing on.
+ *
+ * Every lookup answered by a descent is counted against its leaf. Once a leaf
+ * has been reached ADAPTIVE_HASH_BUILD_THRESHOLD times all its keys are
+ * hashed, later lookups of those keys probe the hash and read the slot
+ * directly. Locations are hints only: the tree checks the slot still holds
+ * the key under the leaf version and falls back to a descent otherwise.
+ * Splits, merges and redistributions invalidate the leaves they touch by
+ * bumping the page generation, which drops every entry of the page at once.
+ * When the hash grows past ADAPTIVE_HASH_MAX_ENTRIES it is emptied and
+ * rebuilt from the leaves that are still hot.
+ */
+template <typename KeyType>
+class AdaptiveHashIndex {
+ public:
+  struct Location {
+    page_id_t page_id{INVALID_PAGE_ID};
+    int slot{0};
+  };
+
+  // what a descent to a leaf means for the hash, see RecordDescent
+  enum class LeafState { kCold, kBuild, kHashed };
+
+  struct Stats {
+    uint64_t hits{0};
+    uint64_t misses{0};
+    size_t entries{0};
+    size_t hashed_pages{0};
+    size_t memory_bytes{0};
+
+    // fraction of lookups answered by the hash
+    double HitRate() const { return hits + misses == 0 ? 0 : static_cast<double>(hits) / (hits + misses); }
+  };
+
+  bool IsEnabled() const { return enabled_; }
+
+  // turning the hash off empties it
+  void SetEnabled(bool enabled);
+
+  // location hashed for key, false if none or the page was invalidated since
+  bool Lookup(const KeyType &key, Location &location);
+
+  void RecordHit() { hits_++; }
+
+  // count a lookup answered by a descent to page_id, kBuild asks the caller to pass
+  // the keys of the leaf to AddPage, kHashed that the page is hashed already
+  LeafState RecordDescent(page_id_t page_id);
+
+  // hash every key of a hot leaf, keys[i] being at slot i
+  void AddPage(page_id_t page_id, const std::vector<KeyType> &keys);
+
+  // refresh the location of one key of a hashed leaf
+  void Add(const KeyType &key, page_id_t page_id, int slot);
+
+  // drop the location hinted for key after it was found stale
+  void Remove(const KeyType &key);
+
+  // drop every entry of a page whose keys moved
+  void InvalidatePage(page_id_t page_id);
+
+  void Clear();
+
+  Stats GetStats();
+
+ private:
+  struct Entry {
+    Location location;
+    uint32_t generation;
+  };
+
+  struct PageState {
+    uint32_t accesses{0};
+    uint32_t generation{0};
+    bool hashed{false};
+  };
+
+  // drop every entry and access count, with latch_ held exclusively
+  void Reset();
+
+  std::atomic<bool> enabled_{ENABLE_ADAPTIVE_HASH_INDEX};
+  std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> misses_{0};
+  // shared by lookups, exclusive for updates
+  std::shared_mutex latch_;
+  std::unordered_map<KeyType, Entry> entries_;
+  std::unordered_map<page_id_t, PageState> pages_;
+};
+
+#endif  // MINISQL_ADAPTIVE_HASH_INDEX_H
@@ -0,0 +1,41 @@
+#ifndef MINISQL_EXTENDIBLE_HASH_INDEX_H
+#define MINISQL_EXTENDIBLE_HASH_INDEX_H
+
+#include "index/extendible_hash_table.h"
+#include "index/generic_key.h"
+#include "index/index.h"
+
+/**
+ * Equality-only index backed by an ExtendibleHashTable, created with
+ * CREATE INDEX ... USING hash. Keys of any column types are serialized into
+ * fixed-size GenericKeys, a point lookup costs a constant number of page
+ * accesses instead of the height of a B+ tree.
+ */
+class ExtendibleHashIndex : public Index {
+ public:
+  ExtendibleHashIndex(index_id_t index_id, IndexSchema *key_schema, size_t key_size,
+                      BufferPoolManager *buffer_pool_manager);
+
+  dberr_t InsertEntry(const Row &key, RowId row_id, Txn *txn) override;
+
+  dberr_t RemoveEntry(const Row &key, RowId row_id, Txn *txn) override;
+
+  // only "=" is supported, other operators fail
+  dberr_t ScanKey(const Row &key, std::vector<RowId> &result, Txn *txn, string compare_operator = "=") override;
+
+  // only point ranges (equal inclusive bounds) are supported
+  std::unique_ptr<IndexCursor> ScanRange(const IndexRange &range, Txn *txn) override;
+
+  dberr_t Destroy() override;
+
+ protected:
+  // serialize the key row into a new GenericKey, return nullptr if a key field is null
+  GenericKey *MakeKey(const Row &key) const;
+
+  // comparator for key
+  KeyManager processor_;
+  // container
+  ExtendibleHashTable container_;
+};
+
+#endif  // MINISQL_EXTENDIBLE_HASH_INDEX_H
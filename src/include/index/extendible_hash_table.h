@@ -0,0 +1,74 @@
+#ifndef MINISQL_EXTENDIBLE_HASH_TABLE_H
+#define MINISQL_EXTENDIBLE_HASH_TABLE_H
+
+#include <shared_mutex>
+#include <vector>
+
+#include "buffer/buffer_pool_manager.h"
+#include "index/generic_key.h"
+#include "page/hash_table_bucket_page.h"
+#include "page/hash_table_directory_page.h"
+#include "page/hash_table_header_page.h"
+
+/**
+ * Disk-backed extendible hash table mapping fixed-size serialized keys to
+ * row ids, every page lives in the buffer pool.
+ *
+ * A lookup reads the header page, one directory page and one bucket page, no
+ * matter how many keys the table holds. A full bucket is split in two (the
+ * directory doubles when the bucket is already at the global depth), an
+ * emptied bucket is merged back into its split image and the directory shrinks
+ * when it can.
+ * (1) We only support unique key
+ * (2) Only equality lookups, the hash order says nothing about the key order
+ *
+ * Concurrency: lookups, and inserts/removes that neither split nor merge, hold
+ * table_latch_ shared and latch the bucket page. Splits and merges rewrite
+ * the directory and hold table_latch_ exclusively.
+ */
+class ExtendibleHashTable {
+ public:
+  ExtendibleHashTable(index_id_t index_id, BufferPoolManager *buffer_pool_manager, uint32_t key_size);
+
+  // Insert a key-value pair, DB_ALREADY_EXIST on a duplicate key, DB_FAILED when the bucket
+  // can no longer split or a page cannot be fetched.
+  dberr_t Insert(const GenericKey *key, const RowId &value);
+
+  // Remove a key and its value, DB_KEY_NOT_FOUND if the key does not exist.
+  dberr_t Remove(const GenericKey *key);
+
+  // append the value associated with a given key, DB_KEY_NOT_FOUND if there is none
+  dberr_t GetValue(const GenericKey *key, std::vector<RowId> &result);
+
+  // release every page of the table, including its record in the index roots page
+  dberr_t Destroy();
+
+  // global depth of the directory covering key, for tests
+  uint32_t GetGlobalDepth(const GenericKey *key);
+
+ private:
+  uint32_t Hash(const GenericKey *key) const;
+
+  const char *KeyData(const GenericKey *key) const { return reinterpret_cast<const char *>(key); }
+
+  // pinned directory page of a hash, created when create is set, nullptr if there is none;
+  // DB_FAILED if a page cannot be fetched
+  dberr_t FetchDirectory(uint32_t hash, bool create, HashTableDirectoryPage *&directory);
+
+  HashTableBucketPage *NewBucketPage(page_id_t &page_id);
+
+  dberr_t SplitInsert(const GenericKey *key, const RowId &value);
+
+  bool SplitBucket(HashTableDirectoryPage *directory, uint32_t bucket_idx);
+
+  void Merge(const GenericKey *key);
+
+  index_id_t index_id_;
+  BufferPoolManager *buffer_pool_manager_;
+  uint32_t key_size_;
+  page_id_t header_page_id_{INVALID_PAGE_ID};
+  // shared by lookups and in-bucket updates, exclusive for splits and merges
+  std::shared_mutex table_latch_;
+};
+
+#endif  // MINISQL_EXTENDIBLE_HASH_TABLE_H
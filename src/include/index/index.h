@@ -1,11 +1,63 @@
 #ifndef MINISQL_INDEX_H
 #define MINISQL_INDEX_H
 
+#include <algorithm>
+#include <functional>
 #include <memory>
+#include <vector>
 
 #include "common/dberr.h"
 #include "concurrency/txn.h"
 #include "record/row.h"
+#include "storage/row_id_bitmap.h"
+
+/**
+ * Bounds of an index range scan, a null bound leaves that side of the range open.
+ * The rows are only read while the scan is opened. A descending range is
+ * returned from the upper bound down, by indexes that SupportsDescendingScan.
+ */
+struct IndexRange {
+  const Row *lower{nullptr};
+  bool lower_inclusive{true};
+  const Row *upper{nullptr};
+  bool upper_inclusive{true};
+  bool descending{false};
+};
+
+/**
+ * Cursor over the row ids of an index range, pulled one at a time.
+ */
+class IndexCursor {
+ public:
+  virtual ~IndexCursor() = default;
+
+  // fetch the next row id, return false once the range is exhausted
+  virtual bool Next(RowId &row_id) = 0;
+
+  // fetch the next row id together with its key row decoded from the index,
+  // only cursors of indexes that support index-only scans provide the key
+  virtual bool NextEntry(RowId & /*row_id*/, Row & /*key*/) { return false; }
+};
+
+/**
+ * Cursor over row ids collected up front, for indexes that cannot stream a range.
+ */
+class VectorIndexCursor : public IndexCursor {
+ public:
+  explicit VectorIndexCursor(std::vector<RowId> row_ids) : row_ids_(std::move(row_ids)) {}
+
+  bool Next(RowId &row_id) override {
+    if (pos_ >= row_ids_.size()) {
+      return false;
+    }
+    row_id = row_ids_[pos_++];
+    return true;
+  }
+
+ private:
+  std::vector<RowId> row_ids_;
+  size_t pos_{0};
+};
 
 class Index {
  public:
@@ -21,6 +73,129 @@ class Index {
 
   virtual dberr_t Destroy() = 0;
 
+  /**
+   * Look up many full keys at once, result[i] receives the row ids of keys[i].
+   * Tree indexes override this to probe the keys in sorted order, answering all
+   * consecutive keys covered by a leaf from that leaf instead of descending from
+   * the root for each of them; the default calls ScanKey for every key.
+   * @return: DB_SUCCESS if any key was found
+   */
+  virtual dberr_t ScanKeys(const std::vector<Row> &keys, std::vector<std::vector<RowId>> &result, Txn *txn) {
+    result.assign(keys.size(), std::vector<RowId>());
+    bool found = false;
+    for (size_t i = 0; i < keys.size(); i++) {
+      found = ScanKey(keys[i], result[i], txn) == DB_SUCCESS || found;
+    }
+    return found ? DB_SUCCESS : DB_KEY_NOT_FOUND;
+  }
+
+  /**
+   * Insert the entries (keys[i], row_ids[i]) at once, in the same way as
+   * ScanKeys batches lookups. Every entry is attempted even if some fail.
+   * @return: DB_SUCCESS if every entry was inserted
+   */
+  virtual dberr_t InsertEntries(const std::vector<Row> &keys, const std::vector<RowId> &row_ids, Txn *txn) {
+    dberr_t status = DB_SUCCESS;
+    for (size_t i = 0; i < keys.size(); i++) {
+      if (InsertEntry(keys[i], row_ids[i], txn) != DB_SUCCESS) {
+        status = DB_FAILED;
+      }
+    }
+    return status;
+  }
+
+  /**
+   * Whether the cursors of the index return the key of every row through
+   * NextEntry, so a query reading only key columns never touches the table heap.
+   */
+  virtual bool SupportsIndexOnlyScan() const { return false; }
+
+  /**
+   * Whether ScanRange honors IndexRange::descending, walking the keys from the
+   * upper bound down so that the last entries of a range are read first. The
+   * other indexes ignore the flag.
+   */
+  virtual bool SupportsDescendingScan() const { return false; }
+
+  /**
+   * Whether the entries are fixed once the index is built, InsertEntry and
+   * RemoveEntry then always fail and the executors refuse to modify the table.
+   */
+  virtual bool IsReadOnly() const { return false; }
+
+  /**
+   * Open a cursor over the row ids whose key lies in range. Indexes that can
+   * walk their keys in order override this to produce row ids lazily, the
+   * default collects them with ScanKey first and needs at least one bound.
+   */
+  virtual std::unique_ptr<IndexCursor> ScanRange(const IndexRange &range, Txn *txn) {
+    std::vector<RowId> result;
+    if (range.lower != nullptr) {
+      ScanKey(*range.lower, result, txn, range.lower_inclusive ? ">=" : ">");
+    }
+    if (range.upper != nullptr) {
+      std::vector<RowId> upper_result;
+      ScanKey(*range.upper, upper_result, txn, range.upper_inclusive ? "<=" : "<");
+      if (range.lower == nullptr) {
+        result.swap(upper_result);
+      } else {
+        // both sides of the range, the result is in page order
+        RowIdBitmap lower_rows;
+        RowIdBitmap upper_rows;
+        for (const auto &row_id : result) {
+          lower_rows.Add(row_id);
+        }
+        for (const auto &row_id : upper_result) {
+          upper_rows.Add(row_id);
+        }
+        lower_rows.Intersect(upper_rows);
+        result = lower_rows.ToRowIds();
+      }
+    }
+    return std::make_unique<VectorIndexCursor>(std::move(result));
+  }
+
+  /**
+   * Fill an empty index with (key, row id) pairs in any order, next returns
+   * false once they are exhausted. Indexes that can be built bottom-up override
+   * this, the default inserts the pairs INDEX_BATCH_SIZE at a time with
+   * InsertEntries.
+   */
+  virtual dberr_t BulkLoad(const std::function<bool(Row &, RowId &)> &next, Txn *txn,
+                           double /*fill_factor*/ = DEFAULT_INDEX_FILL_FACTOR) {
+    std::vector<Row> keys;
+    std::vector<RowId> row_ids;
+    keys.reserve(INDEX_BATCH_SIZE);
+    Row key;
+    RowId row_id;
+    bool more = true;
+    while (more) {
+      more = next(key, row_id);
+      if (more) {
+        keys.emplace_back(key);
+        row_ids.push_back(row_id);
+      }
+      if (keys.size() >= INDEX_BATCH_SIZE || (!more && !keys.empty())) {
+        if (InsertEntries(keys, row_ids, txn) != DB_SUCCESS) {
+          return DB_FAILED;
+        }
+        keys.clear();
+        row_ids.clear();
+      }
+    }
+    return DB_SUCCESS;
+  }
+
+  /**
+   * Shape of the index for the statistics of ANALYZE: pages read by a lookup
+   * before it reaches the entries, and pages holding the entries. Indexes
+   * that do not know it leave both at 0.
+   */
+  virtual void GetShape(uint32_t &height, uint32_t &leaf_pages) {
+    height = 0;
+    leaf_pages = 0;
+  }
+
  protected:
   index_id_t index_id_;
   IndexSchema *key_schema_;
@@ -0,0 +1,82 @@
+#ifndef MINISQL_KEY_SEARCH_H
+#define MINISQL_KEY_SEARCH_H
+
+#include <cstdint>
+
+/**
+ * In-page search over a sorted array of contiguous fixed-width keys.
+ *
+ * The range is first narrowed with binary search until it fits in a few cache
+ * lines, then the remaining window is resolved with SIMD compare + movemask
+ * (count the keys below the target). The instruction set is detected once at
+ * runtime: AVX2, then SSE4.2, otherwise a scalar loop.
+ */
+class KeySearch {
+ public:
+  enum class Isa { kScalar = 0, kSSE42, kAVX2 };
+
+  // best instruction set supported by the running cpu
+  static Isa DetectIsa();
+
+  // instruction set used by the kernels, can be lowered for tests and benchmarks
+  static Isa GetIsa() { return isa_; }
+
+  // set the instruction set, an unsupported one falls back to the detected one
+  static void SetIsa(Isa isa);
+
+  // first index i in [0, n) such that keys[i] >= key, n if not exist
+  template <typename T>
+  static int LowerBound(const T *keys, int n, T key) {
+    int left = 0;
+    int right = n;
+    while (right - left > Window<T>()) {
+      int mid = left + (right - left) / 2;
+      if (keys[mid] < key) {
+        left = mid + 1;
+      } else {
+        right = mid;
+      }
+    }
+    return left + CountLess(keys + left, right - left, key);
+  }
+
+  // first index i in [0, n) such that keys[i] > key, n if not exist
+  template <typename T>
+  static int UpperBound(const T *keys, int n, T key) {
+    int left = 0;
+    int right = n;
+    while (right - left > Window<T>()) {
+      int mid = left + (right - left) / 2;
+      if (keys[mid] <= key) {
+        left = mid + 1;
+      } else {
+        right = mid;
+      }
+    }
+    return left + CountLessEqual(keys + left, right - left, key);
+  }
+
+  // number of keys in [0, n) that are less than (or equal to) key
+  static int CountLess(const int32_t *keys, int n, int32_t key);
+
+  static int CountLess(const int64_t *keys, int n, int64_t key);
+
+  static int CountLess(const float *keys, int n, float key);
+
+  static int CountLessEqual(const int32_t *keys, int n, int32_t key);
+
+  static int CountLessEqual(const int64_t *keys, int n, int64_t key);
+
+  static int CountLessEqual(const float *keys, int n, float key);
+
+ private:
+  // keys left for the linear kernel once binary search stops, 4 cache lines
+  template <typename T>
+  static constexpr int Window() {
+    return static_cast<int>(256 / sizeof(T));
+  }
+
+  static Isa isa_;
+};
+
+#endif  // MINISQL_KEY_SEARCH_H
@@ -0,0 +1,74 @@
+#ifndef MINISQL_LEARNED_INDEX_H
+#define MINISQL_LEARNED_INDEX_H
+
+#include "index/learned_key_array.h"
+#include "index/index.h"
+
+/**
+ * Streams the entries at positions [begin, end) of a LearnedKeyArray, one
+ * leaf page at a time. A descending cursor reads the pages from end down.
+ */
+class LearnedIndexCursor : public IndexCursor {
+ public:
+  LearnedIndexCursor(LearnedKeyArray *container, uint64_t begin, uint64_t end, bool descending)
+      : container_(container), begin_(begin), end_(end), descending_(descending) {}
+
+  bool Next(RowId &row_id) override;
+
+  bool NextEntry(RowId &row_id, Row &key) override;
+
+ private:
+  // fetch the next entry, reading the next page of them when the batch is drained
+  bool NextItem(LearnedKeyArray::Entry &entry);
+
+  LearnedKeyArray *container_;
+  // positions not read yet
+  uint64_t begin_;
+  uint64_t end_;
+  bool descending_;
+  std::vector<LearnedKeyArray::Entry> batch_;
+  size_t pos_{0};
+};
+
+/**
+ * Read-only index over a single non-null INT column of unique keys, backed by
+ * a LearnedKeyArray. It is built once from the rows of the table by BulkLoad
+ * when the index is created; entries cannot be inserted or removed later, so
+ * the executors refuse to modify a table with such an index. The index is
+ * rebuilt by dropping and creating it again.
+ */
+class LearnedIndex : public Index {
+ public:
+  LearnedIndex(index_id_t index_id, IndexSchema *key_schema, BufferPoolManager *buffer_pool_manager);
+
+  dberr_t InsertEntry(const Row &, RowId, Txn *) override { return DB_FAILED; }
+
+  dberr_t RemoveEntry(const Row &, RowId, Txn *) override { return DB_FAILED; }
+
+  dberr_t ScanKey(const Row &key, std::vector<RowId> &result, Txn *txn, string compare_operator = "=") override;
+
+  dberr_t Destroy() override;
+
+  std::unique_ptr<IndexCursor> ScanRange(const IndexRange &range, Txn *txn) override;
+
+  dberr_t BulkLoad(const std::function<bool(Row &, RowId &)> &next, Txn *txn,
+                   double fill_factor = DEFAULT_INDEX_FILL_FACTOR) override;
+
+  bool SupportsIndexOnlyScan() const override { return true; }
+
+  bool SupportsDescendingScan() const override { return true; }
+
+  bool IsReadOnly() const override { return true; }
+
+  void GetShape(uint32_t &height, uint32_t &leaf_pages) override { container_.GetShape(height, leaf_pages); }
+
+  LearnedKeyArray::Stats GetStats() const { return container_.GetStats(); }
+
+ private:
+  // read the int key of the row, return false if it is null
+  static bool ToNativeKey(const Row &key, int32_t &native_key);
+
+  LearnedKeyArray container_;
+};
+
+#endif  // MINISQL_LEARNED_INDEX_H
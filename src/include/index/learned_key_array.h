@@ -0,0 +1,109 @@
+#ifndef MINISQL_LEARNED_KEY_ARRAY_H
+#define MINISQL_LEARNED_KEY_ARRAY_H
+
+#include <functional>
+#include <vector>
+
+#include "buffer/buffer_pool_manager.h"
+#include "page/learned_index_page.h"
+
+/**
+ * Read-only sorted array of unique int keys with a learned model in place of
+ * inner tree nodes.
+ *
+ * The entries are packed into LearnedIndexLeafPages in key order. The model
+ * is a piecewise linear function from a key to its position in the array,
+ * fitted greedily when the array is built: a segment grows while one slope
+ * keeps every key of it within error_bound positions of its prediction (the
+ * shrinking cone algorithm). A lookup picks the segment of the key by a
+ * binary search over the in-memory segments, predicts the position and binary
+ * searches the few entries around it, which lie on one or two leaf pages.
+ *
+ * The model and the leaf page ids take a few bytes per leaf page, they are
+ * persisted in a chain of LearnedIndexModelPages and loaded into memory when
+ * the array is opened. Once built the pages are never modified, so readers
+ * need no latches.
+ */
+class LearnedKeyArray {
+ public:
+  struct Entry {
+    int32_t key;
+    int64_t value;
+  };
+
+  // the linear model of a run of positions starting at first_pos
+  struct Segment {
+    int32_t first_key;
+    uint32_t first_pos;
+    double slope;
+  };
+
+  // size of the array and of its model, see GetStats
+  struct Stats {
+    uint64_t entries{0};
+    uint32_t leaf_pages{0};
+    uint32_t model_pages{0};
+    uint32_t segments{0};
+    // bytes of the segments and leaf page ids kept in memory
+    size_t model_bytes{0};
+  };
+
+  explicit LearnedKeyArray(index_id_t index_id, BufferPoolManager *buffer_pool_manager,
+                           uint32_t error_bound = LEARNED_INDEX_ERROR_BOUND);
+
+  // whether Build ran, an array built from no entries is built but empty
+  bool IsBuilt() const { return root_page_id_ != INVALID_PAGE_ID; }
+
+  uint64_t GetSize() const { return entry_count_; }
+
+  // build the array from entries produced in strictly increasing key order, false if it is built already
+  bool Build(const std::function<bool(Entry &)> &next);
+
+  // position of the first entry whose key is not less than key, GetSize() if there is none
+  uint64_t LowerBound(int32_t key) { return Locate(key, nullptr); }
+
+  // position of the first entry whose key is greater than key
+  uint64_t UpperBound(int32_t key) { return key == INT32_MAX ? entry_count_ : LowerBound(key + 1); }
+
+  bool GetValue(int32_t key, int64_t &value);
+
+  // append the entries at positions [begin, end) to entries, pinning each leaf page once
+  void Read(uint64_t begin, uint64_t end, std::vector<Entry> &entries);
+
+  Stats GetStats() const;
+
+  // the model is in memory, so a lookup reads one level of pages
+  void GetShape(uint32_t &height, uint32_t &leaf_pages) const;
+
+  // release every page of the array, including its record in the index roots page
+  void Destroy();
+
+  // the segments, exposed for tests
+  const std::vector<Segment> &GetSegments() const { return segments_; }
+
+ private:
+  // first position in [begin, end) whose key is not less than key, entry receives
+  // the entry there if it is on the page searched last
+  uint64_t SearchRange(int32_t key, uint64_t begin, uint64_t end, Entry *entry);
+
+  // LowerBound, also reading the entry found into entry unless it is null
+  uint64_t Locate(int32_t key, Entry *entry);
+
+  // write the model into a new chain of model pages, return the first one
+  page_id_t WriteModel();
+
+  void LoadModel(page_id_t model_page_id, uint32_t segment_count, uint32_t leaf_count);
+
+  void UpdateRootPageId(bool insert_record);
+
+  index_id_t index_id_;
+  BufferPoolManager *buffer_pool_manager_;
+  uint32_t error_bound_;
+  page_id_t root_page_id_{INVALID_PAGE_ID};
+  uint64_t entry_count_{0};
+  std::vector<Segment> segments_;
+  std::vector<page_id_t> leaf_pages_;
+  std::vector<page_id_t> model_pages_;
+};
+
+#endif  // MINISQL_LEARNED_KEY_ARRAY_H
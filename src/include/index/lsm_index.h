@@ -0,0 +1,79 @@
+#ifndef MINISQL_LSM_INDEX_H
+#define MINISQL_LSM_INDEX_H
+
+#include "storage/lsm_tree.h"
+#include "index/index.h"
+
+/**
+ * Streams the entries of a key range from an LsmTree a batch at a time, each
+ * batch merges the memtables and runs again right after the last key returned.
+ */
+class LsmIndexCursor : public IndexCursor {
+ public:
+  LsmIndexCursor(LsmTree *container, const IndexSchema *key_schema, std::string lower, bool lower_inclusive,
+                 bool has_upper, std::string upper, bool upper_inclusive)
+      : container_(container),
+        key_schema_(key_schema),
+        last_key_(std::move(lower)),
+        last_inclusive_(lower_inclusive),
+        has_upper_(has_upper),
+        upper_(std::move(upper)),
+        upper_inclusive_(upper_inclusive) {}
+
+  bool Next(RowId &row_id) override;
+
+  bool NextEntry(RowId &row_id, Row &key) override;
+
+ private:
+  // fetch the next entry within the range
+  const LsmTree::Entry *NextItem();
+
+  LsmTree *container_;
+  const IndexSchema *key_schema_;
+  std::vector<LsmTree::Entry> batch_;
+  size_t pos_{0};
+  bool exhausted_{false};
+  std::string last_key_;
+  bool last_inclusive_;
+  bool has_upper_;
+  std::string upper_;
+  bool upper_inclusive_;
+};
+
+/**
+ * Write-optimized index over any non-null key columns, backed by an LsmTree.
+ * Keys are encoded like PrefixBPlusTreeIndex keys, so prefix rows work the
+ * same way for ScanKey("=") and ScanRange. Inserts only touch the in-memory
+ * memtable, pages are written sequentially by flushes and compactions, which
+ * suits append-mostly tables with several indexes.
+ */
+class LsmIndex : public Index {
+ public:
+  LsmIndex(index_id_t index_id, IndexSchema *key_schema, BufferPoolManager *buffer_pool_manager);
+
+  dberr_t InsertEntry(const Row &key, RowId row_id, Txn *txn) override;
+
+  dberr_t RemoveEntry(const Row &key, RowId row_id, Txn *txn) override;
+
+  dberr_t ScanKey(const Row &key, std::vector<RowId> &result, Txn *txn, string compare_operator = "=") override;
+
+  dberr_t Destroy() override;
+
+  std::unique_ptr<IndexCursor> ScanRange(const IndexRange &range, Txn *txn) override;
+
+  bool SupportsIndexOnlyScan() const override { return true; }
+
+  LsmTree::Stats GetStats() { return container_.GetStats(); }
+
+  // a lookup reads at most one page of every run, the runs hold the entries
+  void GetShape(uint32_t &height, uint32_t &leaf_pages) override;
+
+  // write the memtable out and wait for pending compactions
+  void Flush() { container_.Flush(); }
+
+ protected:
+  // container
+  LsmTree container_;
+};
+
+#endif  // MINISQL_LSM_INDEX_H
@@ -0,0 +1,115 @@
+#ifndef MINISQL_POSTING_LIST_INDEX_H
+#define MINISQL_POSTING_LIST_INDEX_H
+
+#include <mutex>
+
+#include "index/typed_b_plus_tree_index.h"
+#include "page/posting_list_page.h"
+
+// slot number of a tree value that references a posting list head page instead of a row
+static constexpr uint32_t POSTING_LIST_SLOT = UINT32_MAX;
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+class PostingListIndex;
+
+/**
+ * Range cursor of a PostingListIndex, the posting list of a key is read when
+ * the cursor reaches the key.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+class PostingListIndexCursor : public TypedBPlusTreeIndexCursor<KeyType, KeyComparator> {
+  using Iterator = TypedIndexIterator<KeyType, KeyComparator>;
+
+ public:
+  PostingListIndexCursor(PostingListIndex<KeyType, KeyComparator> *index, const IndexSchema *key_schema,
+                         Iterator begin, Iterator end, const KeyComparator &comparator, bool has_stop,
+                         const KeyType &stop, bool stop_inclusive, bool descending)
+      : TypedBPlusTreeIndexCursor<KeyType, KeyComparator>(key_schema, std::move(begin), std::move(end), comparator,
+                                                          has_stop, stop, stop_inclusive, descending),
+        index_(index) {}
+
+  bool Next(RowId &row_id) override;
+
+  bool NextEntry(RowId &row_id, Row &key) override;
+
+ private:
+  PostingListIndex<KeyType, KeyComparator> *index_;
+  // key of the posting list being returned
+  KeyType key_{};
+  std::vector<RowId> postings_;
+  size_t pos_{0};
+};
+
+/**
+ * Non-unique index over a single non-null INT or FLOAT column.
+ *
+ * The tree keeps one entry per distinct key. A key with a single row stores
+ * that row id inline, once a second row arrives the value is replaced by a
+ * reference (POSTING_LIST_SLOT) to the head of a PostingListPage chain, which
+ * holds the delta-encoded row ids of the key and grows by overflow pages.
+ *
+ * Writers of the same key are serialized by a striped key latch, the chain of
+ * a key is written under the head page's write latch and read under its read
+ * latch, so readers never see a half updated list.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+class PostingListIndex : public TypedBPlusTreeIndex<KeyType, KeyComparator> {
+  using Container = TypedBPlusTree<KeyType, KeyComparator>;
+
+ public:
+  using Iterator = TypedIndexIterator<KeyType, KeyComparator>;
+
+  PostingListIndex(index_id_t index_id, IndexSchema *key_schema, BufferPoolManager *buffer_pool_manager);
+
+  dberr_t InsertEntry(const Row &key, RowId row_id, Txn *txn) override;
+
+  dberr_t RemoveEntry(const Row &key, RowId row_id, Txn *txn) override;
+
+  dberr_t ScanKey(const Row &key, std::vector<RowId> &result, Txn *txn, string compare_operator = "=") override;
+
+  dberr_t ScanKeys(const std::vector<Row> &keys, std::vector<std::vector<RowId>> &result, Txn *txn) override;
+
+  // entries go through InsertEntry one by one, a key may already hold a posting list
+  dberr_t InsertEntries(const std::vector<Row> &keys, const std::vector<RowId> &row_ids, Txn *txn) override {
+    return Index::InsertEntries(keys, row_ids, txn);
+  }
+
+  dberr_t Destroy() override;
+
+  dberr_t BulkLoad(const std::function<bool(Row &, RowId &)> &next, Txn *txn,
+                   double fill_factor = DEFAULT_INDEX_FILL_FACTOR) override;
+
+  // append the row ids stored under the tree value of key to result
+  void ReadPostings(const KeyType &key, const RowId &value, std::vector<RowId> &result);
+
+ protected:
+  std::unique_ptr<IndexCursor> MakeCursor(Iterator begin, Iterator end, bool has_stop, const KeyType &stop,
+                                          bool stop_inclusive, bool descending) override;
+
+ private:
+  static constexpr size_t KEY_LATCH_COUNT = 64;
+
+  static bool IsPostingRef(const RowId &value) { return value.GetSlotNum() == POSTING_LIST_SLOT; }
+
+  // owner tag written into the posting pages of key
+  static uint64_t OwnerOf(const KeyType &key);
+
+  std::mutex &KeyLatch(const KeyType &key);
+
+  PostingListPage *NewPostingPage(const KeyType &key, page_id_t &page_id);
+
+  page_id_t BuildPostingList(const KeyType &key, const int64_t *rids, size_t size);
+
+  bool InsertPosting(const KeyType &key, page_id_t head_id, int64_t rid);
+
+  void RemovePosting(const KeyType &key, page_id_t head_id, int64_t rid, Txn *txn);
+
+  void FreePostingList(page_id_t head_id);
+
+  void DeletePostingPage(page_id_t page_id);
+
+  BufferPoolManager *buffer_pool_manager_;
+  std::mutex key_latches_[KEY_LATCH_COUNT];
+};
+
+#endif  // MINISQL_POSTING_LIST_INDEX_H
@@ -0,0 +1,108 @@
+#ifndef MINISQL_PREFIX_B_PLUS_TREE_H
+#define MINISQL_PREFIX_B_PLUS_TREE_H
+
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include "buffer/buffer_pool_manager.h"
+#include "common/rowid.h"
+#include "page/prefix_b_plus_tree_page.h"
+
+/**
+ * B+ tree over variable-length byte string keys (compared with memcmp),
+ * mapping every key to one row id.
+ *
+ * Pages store the common prefix of their keys once (see PrefixBPlusTreePage)
+ * and full pages are split by bytes rather than by entry count. The separator
+ * pushed up by a leaf split is the shortest prefix of the first right key that
+ * is still greater than the last left key, so internal pages hold short keys
+ * and the fan-out stays high even for long keys.
+ * (1) We only support unique key
+ * (2) Removing keys never merges pages, an emptied leaf stays in the leaf chain
+ *
+ * Concurrency: lookups and scans hold tree_latch_ shared, inserts and removes
+ * hold it exclusively.
+ */
+class PrefixBPlusTree {
+ public:
+  using Entry = PrefixBPlusTreePage::Entry;
+
+  // shape of the tree, see GetStats
+  struct Stats {
+    uint32_t height{0};
+    uint32_t leaf_pages{0};
+    uint32_t internal_pages{0};
+    uint64_t entries{0};
+    uint64_t key_bytes{0};
+    // bytes of the leaves taken by entries, and by their encoded row ids alone
+    uint64_t leaf_bytes{0};
+    uint64_t value_bytes{0};
+  };
+
+  // longest key accepted, a page always holds at least four keys
+  static constexpr size_t MAX_KEY_SIZE = PrefixBPlusTreePage::CAPACITY / 4 - 16;
+
+  PrefixBPlusTree(index_id_t index_id, BufferPoolManager *buffer_pool_manager);
+
+  // Insert a key-value pair, return false on a duplicate key or a key longer than MAX_KEY_SIZE.
+  bool Insert(const std::string &key, const RowId &value);
+
+  // Remove a key and its value, return false if the key does not exist.
+  bool Remove(const std::string &key);
+
+  // return the value associated with a given key
+  bool GetValue(const std::string &key, RowId &value);
+
+  // look up keys given in increasing order, found[i] tells whether values[i] holds the value of keys[i]
+  void GetValues(const std::vector<std::string> &keys, std::vector<RowId> &values, std::vector<bool> &found);
+
+  // insert entries given in increasing key order, inserted[i] is false for a duplicate or too long key
+  void InsertBatch(const std::vector<Entry> &entries, std::vector<bool> &inserted);
+
+  // append up to max_count entries in key order, starting at the first key not less than
+  // from (greater than from unless inclusive)
+  void Scan(const std::string &from, bool inclusive, size_t max_count, std::vector<Entry> &entries);
+
+  // count pages, entries and key bytes of the tree
+  Stats GetStats();
+
+  // release every page of the tree, including its record in the index roots page
+  void Destroy();
+
+ private:
+  PrefixBPlusTreePage *FetchTreePage(page_id_t page_id);
+
+  PrefixBPlusTreePage *NewTreePage(page_id_t &page_id, bool is_leaf);
+
+  // number of keys of an internal page not greater than key, 0 stands for the first child
+  static int ChildIndex(const PrefixBPlusTreePage *page, const std::string &key);
+
+  // descend to the leaf covering key, the internal pages passed are appended to path when given,
+  // fence receives the smallest separator above the leaf (empty for the right most leaf) when given
+  page_id_t FindLeaf(const std::string &key, std::vector<page_id_t> *path, std::string *fence = nullptr);
+
+  // insert with tree_latch_ held exclusively
+  bool InsertLocked(const std::string &key, const RowId &value);
+
+  // index splitting entries into two halves of about the same number of bytes
+  static size_t SplitPoint(const PrefixBPlusTreePage *page, const std::vector<Entry> &entries);
+
+  // insert (key, right child) into the parent of the page split last, splitting upwards as needed
+  void InsertIntoParent(std::vector<page_id_t> &path, page_id_t left_page_id, std::string key,
+                        page_id_t right_page_id);
+
+  void UpdateRootPageId(bool insert_record);
+
+  void CollectStats(page_id_t page_id, uint32_t depth, Stats &stats);
+
+  void DestroyPage(page_id_t page_id);
+
+  index_id_t index_id_;
+  BufferPoolManager *buffer_pool_manager_;
+  page_id_t root_page_id_{INVALID_PAGE_ID};
+  // shared by lookups and scans, exclusive for inserts and removes
+  std::shared_mutex tree_latch_;
+};
+
+#endif  // MINISQL_PREFIX_B_PLUS_TREE_H
@@ -0,0 +1,99 @@
+#ifndef MINISQL_PREFIX_B_PLUS_TREE_INDEX_H
+#define MINISQL_PREFIX_B_PLUS_TREE_INDEX_H
+
+#include "index/prefix_b_plus_tree.h"
+#include "index/index.h"
+
+/**
+ * Streams the entries of a key range from a PrefixBPlusTree. Entries are read
+ * a leaf-sized batch at a time, each batch starts a new descent right after
+ * the last key returned, so no page stays pinned between calls.
+ */
+class PrefixBPlusTreeIndexCursor : public IndexCursor {
+ public:
+  PrefixBPlusTreeIndexCursor(PrefixBPlusTree *container, const IndexSchema *key_schema, std::string lower,
+                             bool lower_inclusive, bool has_upper, std::string upper, bool upper_inclusive)
+      : container_(container),
+        key_schema_(key_schema),
+        last_key_(std::move(lower)),
+        last_inclusive_(lower_inclusive),
+        has_upper_(has_upper),
+        upper_(std::move(upper)),
+        upper_inclusive_(upper_inclusive) {}
+
+  bool Next(RowId &row_id) override;
+
+  bool NextEntry(RowId &row_id, Row &key) override;
+
+ private:
+  // fetch the next entry within the range
+  const PrefixBPlusTree::Entry *NextItem();
+
+  PrefixBPlusTree *container_;
+  const IndexSchema *key_schema_;
+  std::vector<PrefixBPlusTree::Entry> batch_;
+  size_t pos_{0};
+  bool exhausted_{false};
+  std::string last_key_;
+  bool last_inclusive_;
+  bool has_upper_;
+  std::string upper_;
+  bool upper_inclusive_;
+};
+
+/**
+ * Index over any non-null key columns (CHAR columns included), backed by a
+ * PrefixBPlusTree. The key row is encoded into a byte string that sorts like
+ * the key: INT and FLOAT columns become 4 big-endian bytes with the sign
+ * flipped, CHAR columns are written with 0x00 escaped as 0x00 0xFF and end with
+ * 0x00 0x00. Keys take only the bytes they need instead of a GenericKey of the
+ * largest possible size.
+ *
+ * Every encoded column ends where the next one starts, so a key row holding
+ * only the leading columns encodes to a prefix of all keys starting with them,
+ * ScanKey("=") and ScanRange accept such prefix rows.
+ */
+class PrefixBPlusTreeIndex : public Index {
+ public:
+  PrefixBPlusTreeIndex(index_id_t index_id, IndexSchema *key_schema, BufferPoolManager *buffer_pool_manager);
+
+  dberr_t InsertEntry(const Row &key, RowId row_id, Txn *txn) override;
+
+  dberr_t RemoveEntry(const Row &key, RowId row_id, Txn *txn) override;
+
+  dberr_t ScanKey(const Row &key, std::vector<RowId> &result, Txn *txn, string compare_operator = "=") override;
+
+  dberr_t ScanKeys(const std::vector<Row> &keys, std::vector<std::vector<RowId>> &result, Txn *txn) override;
+
+  dberr_t InsertEntries(const std::vector<Row> &keys, const std::vector<RowId> &row_ids, Txn *txn) override;
+
+  dberr_t Destroy() override;
+
+  std::unique_ptr<IndexCursor> ScanRange(const IndexRange &range, Txn *txn) override;
+
+  bool SupportsIndexOnlyScan() const override { return true; }
+
+  PrefixBPlusTree::Stats GetStats() { return container_.GetStats(); }
+
+  void GetShape(uint32_t &height, uint32_t &leaf_pages) override;
+
+  // encode the key row, return false if a key field is null
+  static bool EncodeKey(const Row &key, const IndexSchema *key_schema, std::string &encoded);
+
+  // rebuild the key row of the key schema from an encoded key, the inverse of EncodeKey
+  static void DecodeKey(const std::string &encoded, const IndexSchema *key_schema, Row &key);
+
+  // encode the bounds of range, bounds given as prefix rows are turned into bounds on the encoded keys,
+  // return false if no key lies in the range
+  static bool EncodeRange(const IndexRange &range, const IndexSchema *key_schema, std::string &lower,
+                          bool &lower_inclusive, bool &has_upper, std::string &upper, bool &upper_inclusive);
+
+  // largest encoded key of the key schema
+  static size_t MaxEncodedKeySize(const IndexSchema *key_schema);
+
+ protected:
+  // container
+  PrefixBPlusTree container_;
+};
+
+#endif  // MINISQL_PREFIX_B_PLUS_TREE_INDEX_H
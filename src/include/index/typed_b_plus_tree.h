@@ -0,0 +1,200 @@
+#ifndef MINISQL_TYPED_B_PLUS_TREE_H
+#define MINISQL_TYPED_B_PLUS_TREE_H
+
+#include <atomic>
+#include <functional>
+#include <shared_mutex>
+#include <vector>
+
+#include "concurrency/txn.h"
+#include "index/adaptive_hash_index.h"
+#include "index/typed_index_iterator.h"
+#include "page/b_plus_tree_page.h"
+#include "page/b_plus_tree_typed_internal_page.h"
+#include "page/b_plus_tree_typed_leaf_page.h"
+
+/**
+ * B+ tree specialized for fixed-width native keys (int32_t/int64_t/float).
+ *
+ * It follows the same structure and page protocol as BPlusTree, but keys are
+ * stored unboxed in the pages and compared with KeyComparator directly, which
+ * avoids deserializing a Row for every comparison and packs many more
+ * entries into a page.
+ * (1) We only support unique key
+ * (2) support insert & remove
+ * (3) The structure should shrink and grow dynamically
+ *
+ * Concurrency follows optimistic lock coupling (OLC): every page carries a
+ * version latch (Page::GetVersionLatch) and the root pointer has one of its own.
+ * - Readers descend without writing any latch, validating each node's version
+ *   after reading it and restarting from the root on conflict.
+ * - Inserts descend the same way, split full inner nodes eagerly, and then
+ *   write-latch the leaf only, or the leaf and its parent when the leaf splits.
+ * - Removes that keep the leaf above its minimum size latch the leaf only.
+ *   Removes that need a merge/redistribution are structure modifications,
+ *   serialized by smo_latch_ and write-latching every page they modify.
+ * - A page deleted by a merge is marked obsolete first. A reader may still
+ *   fetch its id afterwards (the buffer pool reads it back or it was reused),
+ *   the validation of the node the id came from then fails and it restarts.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+class TypedBPlusTree {
+  using InternalPage = BPlusTreeTypedInternalPage<KeyType, KeyComparator>;
+  using LeafPage = BPlusTreeTypedLeafPage<KeyType, KeyComparator>;
+  friend class TypedIndexIterator<KeyType, KeyComparator>;
+
+ public:
+  using Iterator = TypedIndexIterator<KeyType, KeyComparator>;
+  using MappingType = std::pair<KeyType, RowId>;
+
+  explicit TypedBPlusTree(index_id_t index_id, BufferPoolManager *buffer_pool_manager,
+                          const KeyComparator &comparator = KeyComparator(), int leaf_max_size = UNDEFINED_SIZE,
+                          int internal_max_size = UNDEFINED_SIZE);
+
+  // Returns true if this B+ tree has no keys and values.
+  bool IsEmpty() const;
+
+  // Insert a key-value pair into this B+ tree.
+  bool Insert(const KeyType &key, const RowId &value, Txn *transaction = nullptr);
+
+  // Remove a key and its value from this B+ tree.
+  void Remove(const KeyType &key, Txn *transaction = nullptr);
+
+  // Build an empty B+ tree bottom-up from entries produced in increasing key order.
+  bool BulkLoad(const std::function<bool(MappingType &)> &next, double fill_factor = DEFAULT_INDEX_FILL_FACTOR);
+
+  // return the value associated with a given key
+  bool GetValue(const KeyType &key, std::vector<RowId> &result, Txn *transaction = nullptr);
+
+  // look up keys given in increasing order, found[i] tells whether values[i] holds the value of keys[i]
+  void GetValues(const std::vector<KeyType> &keys, std::vector<RowId> &values, std::vector<bool> &found);
+
+  // insert entries given in increasing key order, inserted[i] is false for a duplicate key
+  void InsertBatch(const std::vector<MappingType> &entries, std::vector<bool> &inserted);
+
+  // replace the value associated with an existing key
+  bool Update(const KeyType &key, const RowId &value, Txn *transaction = nullptr);
+
+  Iterator Begin();
+
+  Iterator Begin(const KeyType &key);
+
+  Iterator End();
+
+  // iterate in descending key order from the last entry, or from the last entry <= key (< key unless inclusive)
+  Iterator RBegin();
+
+  Iterator RBegin(const KeyType &key, bool inclusive = true);
+
+  // turn the adaptive hash of GetValue on or off, it is emptied when turned off
+  void SetAdaptiveHashEnabled(bool enabled) { adaptive_hash_.SetEnabled(enabled); }
+
+  // hit rate and memory use of the adaptive hash
+  typename AdaptiveHashIndex<KeyType>::Stats GetAdaptiveHashStats() { return adaptive_hash_.GetStats(); }
+
+  // number of levels and of leaf pages, counted with structure modifications held off
+  void GetShape(uint32_t &height, uint32_t &leaf_pages);
+
+  // expose for test purpose, not safe against concurrent writers
+  Page *FindLeafPage(const KeyType &key, page_id_t page_id = INVALID_PAGE_ID, bool leftMost = false);
+
+  // used to check whether all pages are unpinned
+  bool Check();
+
+  // destroy the b plus tree
+  void Destroy(page_id_t current_page_id = INVALID_PAGE_ID);
+
+ private:
+  // a pinned page and the version read from it, page == nullptr stands for the root pointer
+  struct NodeRef {
+    Page *page{nullptr};
+    uint64_t version{0};
+  };
+
+  enum class OpResult { kDone, kFailed, kRestart, kEmpty, kNeedSmo };
+
+  OptimisticLatch *LatchOf(const NodeRef &ref);
+
+  void Release(NodeRef &ref, bool is_dirty = false);
+
+  bool Descend(const KeyType &key, bool left_most, bool split_full, NodeRef &parent, NodeRef &leaf);
+
+  void SplitInner(NodeRef &parent, NodeRef &node);
+
+  // read the separator after leaf in its parent (none if leaf is the last child), releases parent,
+  // false on conflict with leaf released too
+  bool LeafFence(NodeRef &parent, NodeRef &leaf, bool &has_fence, KeyType &fence);
+
+  // descend to the leaf holding the last entries <= key (< key unless inclusive), the right most leaf if key is
+  // nullptr; has_fence/fence receive the separator the leaf's keys start at, there is none for the left most leaf
+  bool DescendBefore(const KeyType *key, bool inclusive, NodeRef &leaf, bool &has_fence, KeyType &fence);
+
+  // whether key belongs in the leaf whose fence was read by LeafFence
+  bool LeafCovers(const LeafPage *node, bool has_fence, const KeyType &fence, const KeyType &key) const;
+
+  // answer a point lookup from the adaptive hash, false if the key is not hashed or its hint is stale
+  bool HashLookup(const KeyType &key, RowId &value);
+
+  OpResult OptimisticInsert(const KeyType &key, const RowId &value);
+
+  OpResult OptimisticRemove(const KeyType &key);
+
+  page_id_t ReadLeaf(const KeyType *key, bool exclusive, std::vector<MappingType> &batch, int &start_index,
+                     bool &has_next);
+
+  page_id_t ReadLeafReverse(const KeyType *key, bool inclusive, std::vector<MappingType> &batch, bool &has_prev);
+
+  void StartNewTree(const KeyType &key, const RowId &value);
+
+  void BuildInternalLevel(std::vector<std::pair<KeyType, page_id_t>> &level, int target_size);
+
+  void InsertIntoParent(NodeRef &parent, BPlusTreePage *old_node, const KeyType &key, BPlusTreePage *new_node);
+
+  LeafPage *Split(LeafPage *node, Txn *transaction);
+
+  InternalPage *Split(InternalPage *node, Txn *transaction);
+
+  void RemoveWithSmo(const KeyType &key, Txn *transaction);
+
+  Page *FetchForSmo(page_id_t page_id);
+
+  void FinishSmo();
+
+  template <typename N>
+  bool CoalesceOrRedistribute(N *&node, Txn *transaction = nullptr);
+
+  bool Coalesce(InternalPage *&neighbor_node, InternalPage *&node, InternalPage *&parent, int index,
+                Txn *transaction = nullptr);
+
+  bool Coalesce(LeafPage *&neighbor_node, LeafPage *&node, InternalPage *&parent, int index,
+                Txn *transaction = nullptr);
+
+  void Redistribute(LeafPage *neighbor_node, LeafPage *node, int index);
+
+  void Redistribute(InternalPage *neighbor_node, InternalPage *node, int index);
+
+  bool AdjustRoot(BPlusTreePage *node);
+
+  void UpdateRootPageId(int insert_record = 0);
+
+  // member variable
+  index_id_t index_id_;
+  std::atomic<page_id_t> root_page_id_{INVALID_PAGE_ID};
+  BufferPoolManager *buffer_pool_manager_;
+  KeyComparator comparator_;
+  int leaf_max_size_;
+  int internal_max_size_;
+  // guards root_page_id_, acts as the parent latch of the root page
+  OptimisticLatch root_latch_;
+  // shared by optimistic writers, exclusive for merges and tree creation/destruction
+  std::shared_mutex smo_latch_;
+  // pages latched (and pinned once more) by the running structure modification
+  std::vector<Page *> smo_pages_;
+  // pages released by the running structure modification, deleted once it finishes
+  std::vector<page_id_t> smo_deleted_pages_;
+  bool smo_root_latched_{false};
+  // key -> (leaf, slot) hints for the leaves point lookups land on most
+  AdaptiveHashIndex<KeyType> adaptive_hash_;
+};
+
+#endif  // MINISQL_TYPED_B_PLUS_TREE_H
@@ -0,0 +1,127 @@
+#ifndef MINISQL_TYPED_B_PLUS_TREE_INDEX_H
+#define MINISQL_TYPED_B_PLUS_TREE_INDEX_H
+
+#include "index/typed_b_plus_tree.h"
+#include "index/index.h"
+
+/**
+ * Streams the row ids of a key range straight from the leaf chain, nothing is
+ * collected up front. A descending cursor walks a reverse iterator, the bound
+ * it stops at is then the lower one.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+class TypedBPlusTreeIndexCursor : public IndexCursor {
+  using Iterator = TypedIndexIterator<KeyType, KeyComparator>;
+
+ public:
+  using MappingType = std::pair<KeyType, RowId>;
+
+  TypedBPlusTreeIndexCursor(const IndexSchema *key_schema, Iterator begin, Iterator end,
+                            const KeyComparator &comparator, bool has_stop, const KeyType &stop, bool stop_inclusive,
+                            bool descending = false)
+      : key_schema_(key_schema),
+        iter_(std::move(begin)),
+        end_(std::move(end)),
+        comparator_(comparator),
+        has_stop_(has_stop),
+        stop_(stop),
+        stop_inclusive_(stop_inclusive),
+        descending_(descending) {}
+
+  bool Next(RowId &row_id) override;
+
+  bool NextEntry(RowId &row_id, Row &key) override;
+
+ protected:
+  // fetch the next (key, row id) pair within the range
+  bool NextItem(MappingType &item);
+
+  const IndexSchema *key_schema_;
+
+ private:
+  Iterator iter_;
+  Iterator end_;
+  KeyComparator comparator_;
+  bool has_stop_;
+  KeyType stop_;
+  bool stop_inclusive_;
+  bool descending_;
+};
+
+/**
+ * Index over a single non-null INT or FLOAT column, backed by a
+ * TypedBPlusTree instead of the GenericKey tree. The key column of the index
+ * row is converted to the native KeyType on every call.
+ *
+ * With an int64_t key the index may also cover two non-null INT or FLOAT
+ * columns, packed order-preservingly into the high and low 32 bits. A key row
+ * holding only the first column then stands for all keys with that prefix, so
+ * ScanKey("=") and ScanRange accept such prefix rows.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+class TypedBPlusTreeIndex : public Index {
+  using Container = TypedBPlusTree<KeyType, KeyComparator>;
+
+ public:
+  using Iterator = TypedIndexIterator<KeyType, KeyComparator>;
+
+  TypedBPlusTreeIndex(index_id_t index_id, IndexSchema *key_schema, BufferPoolManager *buffer_pool_manager);
+
+  dberr_t InsertEntry(const Row &key, RowId row_id, Txn *txn) override;
+
+  dberr_t RemoveEntry(const Row &key, RowId row_id, Txn *txn) override;
+
+  dberr_t ScanKey(const Row &key, std::vector<RowId> &result, Txn *txn, string compare_operator = "=") override;
+
+  dberr_t ScanKeys(const std::vector<Row> &keys, std::vector<std::vector<RowId>> &result, Txn *txn) override;
+
+  dberr_t InsertEntries(const std::vector<Row> &keys, const std::vector<RowId> &row_ids, Txn *txn) override;
+
+  dberr_t Destroy() override;
+
+  std::unique_ptr<IndexCursor> ScanRange(const IndexRange &range, Txn *txn) override;
+
+  dberr_t BulkLoad(const std::function<bool(Row &, RowId &)> &next, Txn *txn,
+                   double fill_factor = DEFAULT_INDEX_FILL_FACTOR) override;
+
+  bool SupportsIndexOnlyScan() const override { return true; }
+
+  bool SupportsDescendingScan() const override { return true; }
+
+  void GetShape(uint32_t &height, uint32_t &leaf_pages) override { container_.GetShape(height, leaf_pages); }
+
+  void SetAdaptiveHashEnabled(bool enabled) { container_.SetAdaptiveHashEnabled(enabled); }
+
+  typename AdaptiveHashIndex<KeyType>::Stats GetAdaptiveHashStats() { return container_.GetAdaptiveHashStats(); }
+
+  // rebuild the key row of the key schema from a native key, the inverse of ToNativeKey
+  static void FromNativeKey(const KeyType &native_key, const IndexSchema *key_schema, Row &key);
+
+  Iterator GetBeginIterator();
+
+  Iterator GetBeginIterator(const KeyType &key);
+
+  Iterator GetEndIterator();
+
+  Iterator GetReverseBeginIterator();
+
+  Iterator GetReverseBeginIterator(const KeyType &key, bool inclusive);
+
+ protected:
+  // convert the key row into the native key, return false if a key field is null,
+  // key columns missing from the row are filled with their highest value if fill_high.
+  // A FLOAT value of an INT column that is not an integer has no key, unless rounding
+  // asks to round it up (> 0) or down (< 0); rounded then tells whether that happened
+  bool ToNativeKey(const Row &key, KeyType &native_key, bool fill_high = false, int rounding = 0,
+                   bool *rounded = nullptr) const;
+
+  // cursor over the positioned iterator, up to the stop bound if there is one
+  virtual std::unique_ptr<IndexCursor> MakeCursor(Iterator begin, Iterator end, bool has_stop, const KeyType &stop,
+                                                  bool stop_inclusive, bool descending);
+
+  KeyComparator comparator_;
+  // container
+  Container container_;
+};
+
+#endif  // MINISQL_TYPED_B_PLUS_TREE_INDEX_H
@@ -0,0 +1,59 @@
+#ifndef MINISQL_TYPED_INDEX_ITERATOR_H
+#define MINISQL_TYPED_INDEX_ITERATOR_H
+
+#include <vector>
+
+#include "page/b_plus_tree_typed_leaf_page.h"
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+class TypedBPlusTree;
+
+/**
+ * Iterator over the leaf chain of a TypedBPlusTree, forward or in reverse.
+ *
+ * The iterator holds no pin: it copies the entries of the current leaf under
+ * an optimistic version check, and once they are consumed re-enters the tree
+ * with the last returned key to load the following leaf. It therefore stays
+ * valid while other threads modify the tree, and sees each key at most once.
+ * A reverse iterator keeps the copied entries in descending order and loads
+ * the leaf before the smallest key it returned the same way.
+ * End() is represented by INVALID_PAGE_ID with index 0, in both directions.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+class TypedIndexIterator {
+  using Tree = TypedBPlusTree<KeyType, KeyComparator>;
+
+ public:
+  explicit TypedIndexIterator();
+
+  // position at the first entry >= key, or at the left most entry if key is nullptr
+  explicit TypedIndexIterator(Tree *tree, const KeyType *key = nullptr);
+
+  // position at the last entry <= key (< key unless inclusive), or at the right most entry if key is nullptr,
+  // operator++ then moves to smaller keys
+  TypedIndexIterator(Tree *tree, const KeyType *key, bool inclusive, bool reverse);
+
+  /** Return the key/value pair this iterator is currently pointing at. */
+  std::pair<KeyType, RowId> operator*();
+
+  /** Move to the next key/value pair.*/
+  TypedIndexIterator &operator++();
+
+  /** Return whether two iterators are equal */
+  bool operator==(const TypedIndexIterator &itr) const;
+
+  /** Return whether two iterators are not equal. */
+  bool operator!=(const TypedIndexIterator &itr) const;
+
+ private:
+  Tree *tree_{nullptr};
+  page_id_t current_page_id{INVALID_PAGE_ID};
+  // entries copied from the current leaf
+  std::vector<std::pair<KeyType, RowId>> items_;
+  int item_index{0};
+  // whether the current leaf had a sibling in the direction of iteration when it was copied
+  bool has_next_{false};
+  bool reverse_{false};
+};
+
+#endif  // MINISQL_TYPED_INDEX_ITERATOR_H
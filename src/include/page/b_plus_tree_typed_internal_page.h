@@ -0,0 +1,101 @@
+#ifndef MINISQL_B_PLUS_TREE_TYPED_INTERNAL_PAGE_H
+#define MINISQL_B_PLUS_TREE_TYPED_INTERNAL_PAGE_H
+
+#include "page/b_plus_tree_page.h"
+#include "page/b_plus_tree_typed_leaf_page.h"
+
+#define TYPED_INTERNAL_PAGE_TYPE BPlusTreeTypedInternalPage<KeyType, KeyComparator>
+
+// BPlusTreePage header (28 bytes) padded so that int64_t keys stay aligned
+#define TYPED_INTERNAL_PAGE_HEADER_SIZE 32
+
+/**
+ * Internal page of the type-specialized B+ tree, storing n packed native keys
+ * and n child pointers (page_id). As in BPlusTreeInternalPage the first key is
+ * always invalid, and PAGE_ID(i) points to a subtree in which all keys K
+ * satisfy K(i) <= K < K(i+1).
+ *
+ * Keys are kept apart from the child pointers so Lookup() scans a dense key
+ * array.
+ *
+ * Internal page format (keys are stored in increasing order):
+ *  ------------------------------------------------------------------------------------
+ * | HEADER | KEY(1) | KEY(2) | ... | KEY(cap) | PAGE_ID(1) | PAGE_ID(2) | ... | PAGE_ID(cap) |
+ *  ------------------------------------------------------------------------------------
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+class BPlusTreeTypedInternalPage : public BPlusTreePage {
+ public:
+  // must call initialize method after "create" a new node
+  void Init(page_id_t page_id, page_id_t parent_id = INVALID_PAGE_ID, int max_size = UNDEFINED_SIZE);
+
+  // number of entries that physically fit into one page
+  static constexpr int Capacity() {
+    return static_cast<int>((PAGE_SIZE - TYPED_INTERNAL_PAGE_HEADER_SIZE - alignof(page_id_t)) /
+                            (sizeof(KeyType) + sizeof(page_id_t)));
+  }
+
+  KeyType KeyAt(int index) const;
+
+  void SetKeyAt(int index, const KeyType &key);
+
+  int ValueIndex(const page_id_t &value) const;
+
+  page_id_t ValueAt(int index) const;
+
+  void SetValueAt(int index, page_id_t value);
+
+  page_id_t Lookup(const KeyType &key, const KeyComparator &comparator) const;
+
+  void PopulateNewRoot(const page_id_t &old_value, const KeyType &new_key, const page_id_t &new_value);
+
+  int InsertNodeAfter(const page_id_t &old_value, const KeyType &new_key, const page_id_t &new_value);
+
+  // append a child after the last one and adopt it, used by bulk loading
+  void Append(const KeyType &key, const page_id_t &value, BufferPoolManager *buffer_pool_manager);
+
+  void Remove(int index);
+
+  page_id_t RemoveAndReturnOnlyChild();
+
+  // Split and Merge utility methods
+  void MoveAllTo(BPlusTreeTypedInternalPage *recipient, const KeyType &middle_key,
+                 BufferPoolManager *buffer_pool_manager);
+
+  void MoveHalfTo(BPlusTreeTypedInternalPage *recipient, BufferPoolManager *buffer_pool_manager);
+
+  void MoveFirstToEndOf(BPlusTreeTypedInternalPage *recipient, const KeyType &middle_key,
+                        BufferPoolManager *buffer_pool_manager);
+
+  void MoveLastToFrontOf(BPlusTreeTypedInternalPage *recipient, const KeyType &middle_key,
+                         BufferPoolManager *buffer_pool_manager);
+
+ private:
+  static constexpr size_t kValuesOffset =
+      TYPED_INTERNAL_PAGE_HEADER_SIZE +
+      (Capacity() * sizeof(KeyType) + alignof(page_id_t) - 1) / alignof(page_id_t) * alignof(page_id_t);
+
+  KeyType *Keys() {
+    return reinterpret_cast<KeyType *>(reinterpret_cast<char *>(this) + TYPED_INTERNAL_PAGE_HEADER_SIZE);
+  }
+
+  const KeyType *Keys() const {
+    return reinterpret_cast<const KeyType *>(reinterpret_cast<const char *>(this) + TYPED_INTERNAL_PAGE_HEADER_SIZE);
+  }
+
+  page_id_t *Values() { return reinterpret_cast<page_id_t *>(reinterpret_cast<char *>(this) + kValuesOffset); }
+
+  const page_id_t *Values() const {
+    return reinterpret_cast<const page_id_t *>(reinterpret_cast<const char *>(this) + kValuesOffset);
+  }
+
+  void CopyNFrom(const KeyType *keys, const page_id_t *values, int size, BufferPoolManager *buffer_pool_manager);
+
+  void CopyLastFrom(const KeyType &key, page_id_t value, BufferPoolManager *buffer_pool_manager);
+
+  void CopyFirstFrom(const KeyType &key, page_id_t value, BufferPoolManager *buffer_pool_manager);
+
+  void Adopt(page_id_t child_page_id, BufferPoolManager *buffer_pool_manager);
+};
+
+#endif  // MINISQL_B_PLUS_TREE_TYPED_INTERNAL_PAGE_H
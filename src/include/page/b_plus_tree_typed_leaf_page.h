@@ -0,0 +1,108 @@
+#ifndef MINISQL_B_PLUS_TREE_TYPED_LEAF_PAGE_H
+#define MINISQL_B_PLUS_TREE_TYPED_LEAF_PAGE_H
+
+/**
+ * b_plus_tree_typed_leaf_page.h
+ *
+ * Leaf page of the type-specialized B+ tree. Unlike BPlusTreeLeafPage, keys
+ * are stored as packed native values (int32_t/int64_t/float) instead of
+ * GenericKey blobs, so there is no per-entry key padding and comparisons do
+ * not deserialize a Row. Only support unique key.
+ *
+ * Keys and RowIds live in two separate arrays, so that a search only touches
+ * the key array and can compare several keys per SIMD instruction.
+ *
+ * Leaf page format (keys are stored in order):
+ *  ------------------------------------------------------------------------
+ * | HEADER | KEY(1) | KEY(2) | ... | KEY(cap) | RID(1) | RID(2) | ... | RID(cap) |
+ *  ------------------------------------------------------------------------
+ *
+ * Header format is shared with BPlusTreeLeafPage (32 bytes in total), so
+ * IsLeafPage()/GetParentPageId() work on either page kind.
+ */
+#include <utility>
+
+#include "common/rowid.h"
+#include "page/b_plus_tree_page.h"
+
+#define TYPED_INDEX_TEMPLATE_ARGUMENTS template <typename KeyType, typename KeyComparator>
+
+#define TYPED_LEAF_PAGE_TYPE BPlusTreeTypedLeafPage<KeyType, KeyComparator>
+
+#define TYPED_LEAF_PAGE_HEADER_SIZE 32
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+class BPlusTreeTypedLeafPage : public BPlusTreePage {
+ public:
+  using MappingType = std::pair<KeyType, RowId>;
+
+  // After creating a new leaf page from buffer pool, must call initialize
+  // method to set default values
+  void Init(page_id_t page_id, page_id_t parent_id = INVALID_PAGE_ID, int max_size = UNDEFINED_SIZE);
+
+  // number of entries that physically fit into one page
+  static constexpr int Capacity() {
+    return static_cast<int>((PAGE_SIZE - TYPED_LEAF_PAGE_HEADER_SIZE - alignof(RowId)) /
+                            (sizeof(KeyType) + sizeof(RowId)));
+  }
+
+  // helper methods
+  page_id_t GetNextPageId() const;
+
+  void SetNextPageId(page_id_t next_page_id);
+
+  KeyType KeyAt(int index) const;
+
+  RowId ValueAt(int index) const;
+
+  void SetValueAt(int index, const RowId &value);
+
+  int KeyIndex(const KeyType &key, const KeyComparator &comparator) const;
+
+  MappingType GetItem(int index) const;
+
+  // insert and delete methods
+  int Insert(const KeyType &key, const RowId &value, const KeyComparator &comparator);
+
+  bool Lookup(const KeyType &key, RowId &value, const KeyComparator &comparator) const;
+
+  int RemoveAndDeleteRecord(const KeyType &key, const KeyComparator &comparator);
+
+  // append an entry greater than all existing ones, used by bulk loading
+  void Append(const KeyType &key, const RowId &value);
+
+  // Split and Merge utility methods
+  void MoveHalfTo(BPlusTreeTypedLeafPage *recipient);
+
+  void MoveAllTo(BPlusTreeTypedLeafPage *recipient);
+
+  void MoveFirstToEndOf(BPlusTreeTypedLeafPage *recipient);
+
+  void MoveLastToFrontOf(BPlusTreeTypedLeafPage *recipient);
+
+ private:
+  static constexpr size_t kValuesOffset =
+      TYPED_LEAF_PAGE_HEADER_SIZE + (Capacity() * sizeof(KeyType) + alignof(RowId) - 1) / alignof(RowId) * alignof(RowId);
+
+  KeyType *Keys() { return reinterpret_cast<KeyType *>(reinterpret_cast<char *>(this) + TYPED_LEAF_PAGE_HEADER_SIZE); }
+
+  const KeyType *Keys() const {
+    return reinterpret_cast<const KeyType *>(reinterpret_cast<const char *>(this) + TYPED_LEAF_PAGE_HEADER_SIZE);
+  }
+
+  RowId *Values() { return reinterpret_cast<RowId *>(reinterpret_cast<char *>(this) + kValuesOffset); }
+
+  const RowId *Values() const {
+    return reinterpret_cast<const RowId *>(reinterpret_cast<const char *>(this) + kValuesOffset);
+  }
+
+  void CopyNFrom(const KeyType *keys, const RowId *values, int size);
+
+  void CopyLastFrom(const KeyType &key, const RowId &value);
+
+  void CopyFirstFrom(const KeyType &key, const RowId &value);
+
+  page_id_t next_page_id_{INVALID_PAGE_ID};
+};
+
+#endif  // MINISQL_B_PLUS_TREE_TYPED_LEAF_PAGE_H
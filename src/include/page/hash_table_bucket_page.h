@@ -0,0 +1,64 @@
+#ifndef MINISQL_HASH_TABLE_BUCKET_PAGE_H
+#define MINISQL_HASH_TABLE_BUCKET_PAGE_H
+
+#include "common/config.h"
+#include "common/rowid.h"
+
+#define HASH_TABLE_BUCKET_PAGE_HEADER_SIZE 16
+
+/**
+ * Bucket page of an extendible hash index, an unordered array of
+ * (row id, key) entries. Keys are serialized GenericKeys of a fixed size, two
+ * keys are equal iff their bytes are equal. Only support unique key.
+ *
+ * Format (size in byte):
+ *  ------------------------------------------------------------------------------------
+ * | PageId (4) | KeySize (4) | Size (4) | Padding (4) | RID(0) (8) | KEY(0) (KeySize) | ... |
+ *  ------------------------------------------------------------------------------------
+ */
+class HashTableBucketPage {
+ public:
+  void Init(page_id_t page_id, uint32_t key_size);
+
+  // number of entries that fit into one page
+  static uint32_t Capacity(uint32_t key_size) {
+    return (PAGE_SIZE - HASH_TABLE_BUCKET_PAGE_HEADER_SIZE) / (key_size + sizeof(RowId));
+  }
+
+  page_id_t GetPageId() const { return page_id_; }
+
+  uint32_t GetSize() const { return size_; }
+
+  bool IsFull() const { return size_ == Capacity(key_size_); }
+
+  bool IsEmpty() const { return size_ == 0; }
+
+  const char *KeyAt(uint32_t index) const { return EntryAt(index) + sizeof(RowId); }
+
+  RowId ValueAt(uint32_t index) const { return *reinterpret_cast<const RowId *>(EntryAt(index)); }
+
+  bool Lookup(const char *key, RowId &value) const;
+
+  // return false if the page is full or already holds the key
+  bool Insert(const char *key, const RowId &value);
+
+  bool Remove(const char *key);
+
+  // remove the entry at index, the last entry takes its place
+  void RemoveAt(uint32_t index);
+
+ private:
+  int KeyIndex(const char *key) const;
+
+  char *EntryAt(uint32_t index) { return data_ + index * (key_size_ + sizeof(RowId)); }
+
+  const char *EntryAt(uint32_t index) const { return data_ + index * (key_size_ + sizeof(RowId)); }
+
+  page_id_t page_id_;
+  uint32_t key_size_;
+  uint32_t size_;
+  uint32_t padding_;
+  char data_[0];
+};
+
+#endif  // MINISQL_HASH_TABLE_BUCKET_PAGE_H
@@ -0,0 +1,68 @@
+#ifndef MINISQL_HASH_TABLE_DIRECTORY_PAGE_H
+#define MINISQL_HASH_TABLE_DIRECTORY_PAGE_H
+
+#include <cstdint>
+
+#include "common/config.h"
+
+#define HASH_TABLE_DIRECTORY_MAX_DEPTH 9
+#define HASH_TABLE_DIRECTORY_ARRAY_SIZE (1 << HASH_TABLE_DIRECTORY_MAX_DEPTH)
+
+/**
+ * Directory page of an extendible hash index. The low global_depth bits of a
+ * key's hash select a slot, every slot records the bucket page it points to
+ * and the local depth of that bucket. A bucket with local depth d is shared by
+ * the 2^(global_depth - d) slots that agree on the low d bits.
+ *
+ * Format (size in byte):
+ *  -----------------------------------------------------------------------------------
+ * | PageId (4) | GlobalDepth (4) | LocalDepth(0..ARRAY_SIZE-1) (1 each) | BucketPageId(0..) (4 each) |
+ *  -----------------------------------------------------------------------------------
+ */
+class HashTableDirectoryPage {
+ public:
+  void Init(page_id_t page_id, page_id_t bucket_page_id);
+
+  page_id_t GetPageId() const { return page_id_; }
+
+  uint32_t GetGlobalDepth() const { return global_depth_; }
+
+  uint32_t GetGlobalDepthMask() const { return (1U << global_depth_) - 1; }
+
+  // number of slots in use
+  uint32_t Size() const { return 1U << global_depth_; }
+
+  uint32_t HashToBucketIndex(uint32_t hash) const { return hash & GetGlobalDepthMask(); }
+
+  page_id_t GetBucketPageId(uint32_t bucket_idx) const { return bucket_page_ids_[bucket_idx]; }
+
+  void SetBucketPageId(uint32_t bucket_idx, page_id_t bucket_page_id) { bucket_page_ids_[bucket_idx] = bucket_page_id; }
+
+  uint32_t GetLocalDepth(uint32_t bucket_idx) const { return local_depths_[bucket_idx]; }
+
+  void SetLocalDepth(uint32_t bucket_idx, uint32_t local_depth) {
+    local_depths_[bucket_idx] = static_cast<uint8_t>(local_depth);
+  }
+
+  // slot of the bucket that was split off from (or would merge with) the bucket at bucket_idx
+  uint32_t GetSplitImageIndex(uint32_t bucket_idx) const {
+    return bucket_idx ^ (1U << (local_depths_[bucket_idx] - 1));
+  }
+
+  // double the directory, the new upper half mirrors the lower half
+  void IncrGlobalDepth();
+
+  // halve the directory, only allowed when CanShrink()
+  void DecrGlobalDepth() { global_depth_--; }
+
+  // true if every bucket is referenced from the lower half of the directory
+  bool CanShrink() const;
+
+ private:
+  page_id_t page_id_;
+  uint32_t global_depth_;
+  uint8_t local_depths_[HASH_TABLE_DIRECTORY_ARRAY_SIZE];
+  page_id_t bucket_page_ids_[HASH_TABLE_DIRECTORY_ARRAY_SIZE];
+};
+
+#endif  // MINISQL_HASH_TABLE_DIRECTORY_PAGE_H
@@ -0,0 +1,39 @@
+#ifndef MINISQL_HASH_TABLE_HEADER_PAGE_H
+#define MINISQL_HASH_TABLE_HEADER_PAGE_H
+
+#include "common/config.h"
+
+#define HASH_TABLE_HEADER_DEPTH 9
+#define HASH_TABLE_HEADER_ARRAY_SIZE (1 << HASH_TABLE_HEADER_DEPTH)
+
+/**
+ * Root page of an extendible hash index. The top HASH_TABLE_HEADER_DEPTH bits
+ * of a key's hash select one of the directory pages, which are created when
+ * the first key of their hash range is inserted.
+ *
+ * Format (size in byte):
+ *  --------------------------------------------------------------------------
+ * | PageId (4) | DirectoryPageId(0) (4) | ... | DirectoryPageId(ARRAY_SIZE-1) (4) |
+ *  --------------------------------------------------------------------------
+ */
+class HashTableHeaderPage {
+ public:
+  void Init(page_id_t page_id);
+
+  page_id_t GetPageId() const { return page_id_; }
+
+  // directory slot of a hash
+  static uint32_t HashToDirectoryIndex(uint32_t hash) { return hash >> (32 - HASH_TABLE_HEADER_DEPTH); }
+
+  page_id_t GetDirectoryPageId(uint32_t directory_idx) const { return directory_page_ids_[directory_idx]; }
+
+  void SetDirectoryPageId(uint32_t directory_idx, page_id_t directory_page_id) {
+    directory_page_ids_[directory_idx] = directory_page_id;
+  }
+
+ private:
+  page_id_t page_id_;
+  page_id_t directory_page_ids_[HASH_TABLE_HEADER_ARRAY_SIZE];
+};
+
+#endif  // MINISQL_HASH_TABLE_HEADER_PAGE_H
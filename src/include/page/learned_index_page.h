@@ -0,0 +1,128 @@
+#ifndef MINISQL_LEARNED_INDEX_PAGE_H
+#define MINISQL_LEARNED_INDEX_PAGE_H
+
+#include <cstdint>
+
+#include "common/config.h"
+
+#define LEARNED_INDEX_PAGE_HEADER_SIZE 8
+
+/**
+ * Page of the sorted entries of a LearnedKeyArray. The pages are written once
+ * when the array is built, every page but the last one full, so the entry at
+ * position p lives in slot p % CAPACITY of page p / CAPACITY. Keys and values
+ * are kept in two arrays, the last-mile search only reads keys.
+ *
+ * Format (size in byte):
+ *  ---------------------------------------------------------------------------------
+ * | Count (4) | Reserved (4) | KEY(0) | ... | KEY(CAPACITY-1) | VALUE(0) | ... |
+ *  ---------------------------------------------------------------------------------
+ * KEY is 4 bytes, VALUE 8 bytes.
+ */
+class LearnedIndexLeafPage {
+ public:
+  static constexpr int CAPACITY = (PAGE_SIZE - LEARNED_INDEX_PAGE_HEADER_SIZE) / (sizeof(int32_t) + sizeof(int64_t));
+
+  void Init() { count_ = 0; }
+
+  int GetCount() const { return count_; }
+
+  int32_t KeyAt(int index) const { return reinterpret_cast<const int32_t *>(data_)[index]; }
+
+  int64_t ValueAt(int index) const { return reinterpret_cast<const int64_t *>(data_ + VALUES_OFFSET)[index]; }
+
+  // append an entry after the last one, return false if the page is full
+  bool Append(int32_t key, int64_t value);
+
+  // first slot in [begin, end) whose key is not less than key, end if there is none
+  int LowerBound(int32_t key, int begin, int end) const;
+
+ private:
+  static constexpr size_t VALUES_OFFSET = CAPACITY * sizeof(int32_t);
+
+  int32_t count_;
+  int32_t reserved_;
+  char data_[0];
+};
+
+/**
+ * Page of the model of a LearnedKeyArray: the linear segments followed by the
+ * page ids of the leaf pages, serialized as one byte string spread over a
+ * chain of these pages.
+ *
+ * Format (size in byte):
+ *  --------------------------------------------
+ * | NextPageId (4) | Used (4) | BYTES (Used) |
+ *  --------------------------------------------
+ */
+class LearnedIndexModelPage {
+ public:
+  static constexpr size_t CAPACITY = PAGE_SIZE - LEARNED_INDEX_PAGE_HEADER_SIZE;
+
+  void Init() {
+    next_page_id_ = INVALID_PAGE_ID;
+    used_ = 0;
+  }
+
+  page_id_t GetNextPageId() const { return next_page_id_; }
+
+  void SetNextPageId(page_id_t next_page_id) { next_page_id_ = next_page_id; }
+
+  uint32_t GetUsed() const { return used_; }
+
+  const char *GetBytes() const { return data_; }
+
+  // append as many of the size bytes as fit, return how many were taken
+  size_t Append(const char *bytes, size_t size);
+
+ private:
+  page_id_t next_page_id_;
+  uint32_t used_;
+  char data_[0];
+};
+
+/**
+ * First page of a LearnedKeyArray, its page id is the root recorded for the
+ * index in the index roots page.
+ *
+ * Format (size in byte):
+ *  -------------------------------------------------------------------------------------------------
+ * | Magic (4) | ErrorBound (4) | EntryCount (8) | SegmentCount (4) | LeafCount (4) | ModelPageId (4) |
+ *  -------------------------------------------------------------------------------------------------
+ */
+class LearnedIndexHeaderPage {
+ public:
+  static constexpr uint32_t LEARNED_INDEX_MAGIC_NUM = 0x4c524e44;
+
+  void Init(uint32_t error_bound, uint64_t entry_count, uint32_t segment_count, uint32_t leaf_count,
+            page_id_t model_page_id) {
+    magic_ = LEARNED_INDEX_MAGIC_NUM;
+    error_bound_ = error_bound;
+    entry_count_ = entry_count;
+    segment_count_ = segment_count;
+    leaf_count_ = leaf_count;
+    model_page_id_ = model_page_id;
+  }
+
+  bool IsValid() const { return magic_ == LEARNED_INDEX_MAGIC_NUM; }
+
+  uint32_t GetErrorBound() const { return error_bound_; }
+
+  uint64_t GetEntryCount() const { return entry_count_; }
+
+  uint32_t GetSegmentCount() const { return segment_count_; }
+
+  uint32_t GetLeafCount() const { return leaf_count_; }
+
+  page_id_t GetModelPageId() const { return model_page_id_; }
+
+ private:
+  uint32_t magic_;
+  uint32_t error_bound_;
+  uint64_t entry_count_;
+  uint32_t segment_count_;
+  uint32_t leaf_count_;
+  page_id_t model_page_id_;
+};
+
+#endif  // MINISQL_LEARNED_INDEX_PAGE_H
@@ -0,0 +1,96 @@
+#ifndef MINISQL_LSM_RUN_PAGE_H
+#define MINISQL_LSM_RUN_PAGE_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "common/config.h"
+
+#define LSM_RUN_PAGE_HEADER_SIZE 8
+
+/**
+ * Page of a sorted run of an LsmTree. A run is written once, front to back,
+ * as a chain of these pages and never modified afterwards, so entries are
+ * simply packed in key order after the header.
+ *
+ * Format (size in byte):
+ *  ------------------------------------------------------------------------
+ * | NextPageId (4) | Count (2) | Used (2) | ENTRY(0) | ENTRY(1) | ... free |
+ *  ------------------------------------------------------------------------
+ * ENTRY: | KeyLen (2) | Deleted (1) | Value (8) | Key (KeyLen) |
+ */
+class LsmRunPage {
+ public:
+  // a key and its row id, or a tombstone hiding the key in older runs
+  struct Entry {
+    std::string key;
+    int64_t value;
+    bool deleted;
+  };
+
+  static constexpr size_t ENTRY_HEADER_SIZE = 11;
+  static constexpr size_t CAPACITY = PAGE_SIZE - LSM_RUN_PAGE_HEADER_SIZE;
+
+  void Init();
+
+  page_id_t GetNextPageId() const { return next_page_id_; }
+
+  void SetNextPageId(page_id_t next_page_id) { next_page_id_ = next_page_id; }
+
+  int GetCount() const { return count_; }
+
+  // append an entry after the last one, return false if the page is full
+  bool Append(std::string_view key, int64_t value, bool deleted);
+
+  // value and tombstone flag of key, false if the page does not hold key
+  bool Find(std::string_view key, int64_t &value, bool &deleted) const;
+
+  // append every entry of the page to entries
+  void Decode(std::vector<Entry> &entries) const;
+
+  // key of the first entry
+  std::string FirstKey() const;
+
+  static size_t EntrySize(size_t key_size) { return ENTRY_HEADER_SIZE + key_size; }
+
+ private:
+  page_id_t next_page_id_;
+  uint16_t count_;
+  uint16_t used_;
+  char data_[0];
+};
+
+/**
+ * Page listing the sorted runs of an LsmTree, rewritten in place whenever a
+ * flush or a compaction installs a run. Its page id is the root recorded for
+ * the tree in the index roots page.
+ *
+ * Format (size in byte):
+ *  ---------------------------------------------------------------------
+ * | RunCount (4) | Run_1 level (4) | Run_1 first page id (4) | ... |
+ *  ---------------------------------------------------------------------
+ * Level 0 runs are listed newest first.
+ */
+class LsmManifestPage {
+ public:
+  static constexpr int MAX_RUN_COUNT = (PAGE_SIZE - 4) / 8;
+
+  void Init() { count_ = 0; }
+
+  int GetRunCount() const { return count_; }
+
+  uint32_t GetLevel(int index) const { return runs_[index].first; }
+
+  page_id_t GetFirstPageId(int index) const { return runs_[index].second; }
+
+  // return false once MAX_RUN_COUNT runs are listed
+  bool AddRun(uint32_t level, page_id_t first_page_id);
+
+ private:
+  int count_;
+  std::pair<uint32_t, page_id_t> runs_[0];
+};
+
+#endif  // MINISQL_LSM_RUN_PAGE_H
@@ -50,6 +50,9 @@ class Page {
   /** Release the page read latch. */
   inline void RUnlatch() { rwlatch_.RUnlock(); }
 
+  /** @return the version latch used by optimistic lock coupling in index pages. */
+  inline OptimisticLatch *GetVersionLatch() { return &version_latch_; }
+
   /** @return the page LSN. */
   inline lsn_t GetLSN() { return *reinterpret_cast<lsn_t *>(GetData() + OFFSET_LSN); }
 
@@ -78,6 +81,8 @@ class Page {
   bool is_dirty_ = false;
   /** Page latch. */
   ReaderWriterLatch rwlatch_;
+  /** Version latch, reset whenever the frame is given to another page. */
+  OptimisticLatch version_latch_;
 };
 
 #endif  // MINISQL_PAGE_H
@@ -0,0 +1,98 @@
+#ifndef MINISQL_POSTING_LIST_PAGE_H
+#define MINISQL_POSTING_LIST_PAGE_H
+
+#include <cstdint>
+#include <vector>
+
+#include "common/config.h"
+
+/**
+ * One page of the posting list of a key in a non-unique index. The row ids of
+ * a key are kept sorted (by RowId::Get()) across a chain of pages, every page
+ * holding a disjoint, increasing run of them. The first row id of a page is
+ * stored in full in the header, the following ones as the varint encoded
+ * delta to their predecessor, so rows of the same table page take one byte.
+ *
+ * The first page of the chain (the head) is the one referenced from the
+ * B+ tree, its tail page id lets in-order inserts append without walking the
+ * chain. The owner is the key the list belongs to, it lets a reader notice a
+ * head page that was freed and reused after it looked the key up.
+ *
+ * Format (size in byte):
+ *  ------------------------------------------------------------------------------
+ * | Magic (4) | PageId (4) | NextPageId (4) | TailPageId (4) | Count (4) | Used (4) |
+ *  ------------------------------------------------------------------------------
+ * | Owner (8) | First (8) | Last (8) | DELTA(2) | DELTA(3) | ... | DELTA(Count) |
+ *  ------------------------------------------------------------------------------
+ */
+class PostingListPage {
+ public:
+  enum class InsertResult { kInserted, kDuplicate, kFull };
+
+  void Init(page_id_t page_id, uint64_t owner);
+
+  // true if the page is a live posting list page of the given owner
+  bool IsPostingOf(uint64_t owner) const { return magic_ == POSTING_LIST_MAGIC_NUM && owner_ == owner; }
+
+  // invalidate the page before it is deleted
+  void Release() { magic_ = 0; }
+
+  page_id_t GetPageId() const { return page_id_; }
+
+  page_id_t GetNextPageId() const { return next_page_id_; }
+
+  void SetNextPageId(page_id_t next_page_id) { next_page_id_ = next_page_id; }
+
+  page_id_t GetTailPageId() const { return tail_page_id_; }
+
+  void SetTailPageId(page_id_t tail_page_id) { tail_page_id_ = tail_page_id; }
+
+  uint32_t GetCount() const { return count_; }
+
+  int64_t GetFirst() const { return first_; }
+
+  int64_t GetLast() const { return last_; }
+
+  // append the decoded row ids of this page to out
+  void Decode(std::vector<int64_t> &out) const;
+
+  // replace the content with a prefix of the sorted rids, return how many of them fit
+  size_t Fill(const int64_t *rids, size_t size);
+
+  // append a row id greater than all existing ones, return false if it does not fit
+  bool Append(int64_t rid);
+
+  // insert a row id in order, only the bytes after it are moved
+  InsertResult Insert(int64_t rid);
+
+  // remove a row id, return false if it is not in the page
+  bool Remove(int64_t rid);
+
+ private:
+  static constexpr uint32_t POSTING_LIST_MAGIC_NUM = 0x50535431;
+  static constexpr size_t HEADER_SIZE = 48;
+  static constexpr size_t DATA_SIZE = PAGE_SIZE - HEADER_SIZE;
+
+  // bytes needed to encode a delta
+  static size_t VarintSize(uint64_t delta);
+
+  static size_t EncodeVarint(uint64_t delta, unsigned char *p);
+
+  static uint64_t DecodeVarint(const unsigned char *&p);
+
+  // replace old_size bytes at offset with the encoding of the given deltas
+  void ReplaceDeltas(size_t offset, size_t old_size, const uint64_t *deltas, size_t count);
+
+  uint32_t magic_;
+  page_id_t page_id_;
+  page_id_t next_page_id_;
+  page_id_t tail_page_id_;
+  uint32_t count_;
+  uint32_t used_;
+  uint64_t owner_;
+  int64_t first_;
+  int64_t last_;
+  unsigned char data_[0];
+};
+
+#endif  // MINISQL_POSTING_LIST_PAGE_H
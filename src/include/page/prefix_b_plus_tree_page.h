@@ -0,0 +1,150 @@
+#ifndef MINISQL_PREFIX_B_PLUS_TREE_PAGE_H
+#define MINISQL_PREFIX_B_PLUS_TREE_PAGE_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "common/config.h"
+
+#define PREFIX_B_PLUS_TREE_PAGE_HEADER_SIZE 24
+
+/**
+ * Page of a PrefixBPlusTree, a slotted page of variable-length byte string
+ * keys that are ordered by memcmp.
+ *
+ * The common prefix of all keys of the page is stored once, every entry keeps
+ * only the rest of its key (the suffix). The slot array grows from the header
+ * towards the end of the page and holds the (offset, suffix length) of every
+ * entry in key order, the entries themselves are written from the end of the
+ * page backwards: first the prefix, then [suffix][value] per entry. Removed
+ * entries leave garbage in the heap that is reclaimed when the page is rebuilt.
+ * For integer keys, encoded big-endian, the prefix holds the high bytes shared
+ * by the page, so only the offset of a key within the page's range is stored.
+ *
+ * Internal values are child page ids (4 bytes). An internal page with n keys
+ * has n + 1 children: keys below KeyAt(0) are in the first child (kept in the
+ * header), keys from KeyAt(i) on are in ValueAt(i).
+ *
+ * Leaf values are row ids, compressed against the lowest heap page id of the
+ * page (the base page id): the distance of the row's page from the base and
+ * its slot number are stored as two varints. Row ids of one heap page then
+ * take 2 bytes instead of 8, and row ids of a few hundred neighbouring pages
+ * at most 3 or 4. A row id below the base rebuilds the page with a new base.
+ *
+ * Format (size in byte):
+ *  ---------------------------------------------------------------------------------------
+ * | PageType (4) | PageId (4) | NextPageId/FirstChild (4) | Size (2) | PrefixLen (2) |
+ *  ---------------------------------------------------------------------------------------
+ * | HeapBegin (2) | Garbage (2) | BasePageId (4) | SLOT(0) (4) | ... free ... | ENTRY(0) | PREFIX |
+ *  ---------------------------------------------------------------------------------------
+ */
+class PrefixBPlusTreePage {
+ public:
+  struct Entry {
+    std::string key;
+    int64_t value;
+  };
+
+  void Init(page_id_t page_id, bool is_leaf);
+
+  bool IsLeafPage() const { return page_type_ == LEAF_PAGE_TYPE; }
+
+  page_id_t GetPageId() const { return page_id_; }
+
+  int GetSize() const { return size_; }
+
+  uint32_t GetPrefixLength() const { return prefix_len_; }
+
+  // right sibling of a leaf
+  page_id_t GetNextPageId() const { return next_page_id_; }
+
+  void SetNextPageId(page_id_t next_page_id) { next_page_id_ = next_page_id; }
+
+  // child of an internal page holding the keys below KeyAt(0)
+  page_id_t GetFirstChild() const { return next_page_id_; }
+
+  void SetFirstChild(page_id_t child) { next_page_id_ = child; }
+
+  std::string KeyAt(int index) const;
+
+  int64_t ValueAt(int index) const;
+
+  // index of the first key not less than key, GetSize() if there is none
+  int LowerBound(std::string_view key) const;
+
+  // whether the key at index equals key
+  bool KeyEquals(int index, std::string_view key) const;
+
+  // insert an entry at index, false if it does not fit even after rebuilding the page
+  bool Insert(int index, std::string_view key, int64_t value);
+
+  void Remove(int index);
+
+  // append all entries in key order to entries
+  void GetEntries(std::vector<Entry> &entries) const;
+
+  // replace the content with entries [begin, end), false if they do not fit
+  bool Build(const std::vector<Entry> &entries, size_t begin, size_t end);
+
+  // bytes taken by an entry in a page without any prefix, a leaf value is
+  // encoded against base_page_id
+  size_t EntrySize(size_t key_size, int64_t value, page_id_t base_page_id) const {
+    return SLOT_SIZE + key_size + (IsLeafPage() ? RowIdSize(value, base_page_id) : sizeof(page_id_t));
+  }
+
+  // lowest heap page id of the row ids of entries [begin, end), the base of a leaf built from them
+  static page_id_t BasePageId(const std::vector<Entry> &entries, size_t begin, size_t end);
+
+  // bytes of the page taken by entries, their slots and the prefix
+  size_t GetUsedBytes() const { return CAPACITY - FreeSpace() - garbage_; }
+
+  // bytes of the encoded value at index
+  size_t ValueSizeAt(int index) const;
+
+  // bytes available to entries in an empty page
+  static constexpr size_t CAPACITY = PAGE_SIZE - PREFIX_B_PLUS_TREE_PAGE_HEADER_SIZE;
+
+ private:
+  static constexpr uint32_t LEAF_PAGE_TYPE = 1;
+  static constexpr uint32_t INTERNAL_PAGE_TYPE = 2;
+  static constexpr size_t SLOT_SIZE = 4;
+
+  struct Slot {
+    uint16_t offset;
+    uint16_t length;
+  };
+
+  // bytes of a row id encoded against base_page_id
+  static size_t RowIdSize(int64_t value, page_id_t base_page_id);
+
+  // write the value of an entry at dest, return its size
+  size_t WriteValue(char *dest, int64_t value) const;
+
+  const char *PageStart() const { return reinterpret_cast<const char *>(this); }
+
+  char *PageStart() { return reinterpret_cast<char *>(this); }
+
+  const char *Prefix() const { return PageStart() + PAGE_SIZE - prefix_len_; }
+
+  std::string_view SuffixAt(int index) const {
+    return {PageStart() + slots_[index].offset, slots_[index].length};
+  }
+
+  size_t FreeSpace() const {
+    return heap_begin_ - PREFIX_B_PLUS_TREE_PAGE_HEADER_SIZE - size_ * SLOT_SIZE;
+  }
+
+  uint32_t page_type_;
+  page_id_t page_id_;
+  page_id_t next_page_id_;
+  uint16_t size_;
+  uint16_t prefix_len_;
+  uint16_t heap_begin_;
+  uint16_t garbage_;
+  page_id_t base_page_id_;
+  Slot slots_[0];
+};
+
+#endif  // MINISQL_PREFIX_B_PLUS_TREE_PAGE_H
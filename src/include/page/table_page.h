@@ -25,6 +25,7 @@
 #include "concurrency/txn.h"
 #include "page/page.h"
 #include "record/row.h"
+#include "record/row_batch.h"
 #include "recovery/log_manager.h"
 
 class TablePage : public Page {
@@ -58,6 +59,12 @@ class TablePage : public Page {
 
   bool GetTuple(Row *row, Schema *schema, Txn *txn, LockManager *lock_manager);
 
+  /**
+   * Decode the live tuples from slot begin_slot on into batch until it is full.
+   * @return the slot to continue from, GetTupleCount() once the page is read
+   */
+  uint32_t GetTuples(uint32_t begin_slot, RowBatch &batch);
+
   bool GetFirstTupleRid(RowId *first_rid);
 
   bool GetNextTupleRid(const RowId &cur_rid, RowId *next_rid);
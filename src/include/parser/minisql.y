@@ -7,12 +7,15 @@
   int yyerror(char* error);
 %}
 
+// the generated parser is moved to src/parser, it includes its header from src/include
+%define api.header.include {"parser/minisql_yacc.h"}
+
 %union {
 	pSyntaxNode syntax_node;
 }
 
 %token <syntax_node> CREATE DROP SELECT INSERT DELETE UPDATE
-%token <syntax_node> TRXBEGIN TRXCOMMIT TRXROLLBACK QUIT EXECFILE SHOW USE USING
+%token <syntax_node> TRXBEGIN TRXCOMMIT TRXROLLBACK QUIT EXECFILE SHOW USE USING ANALYZE
 %token <syntax_node> DATABASE DATABASES TABLE TABLES INDEX INDEXES
 %token <syntax_node> ON FROM WHERE INTO SET VALUES PRIMARY KEY UNIQUE
 %token <syntax_node> CHAR INT FLOAT AND OR NOT IS FLAGNULL
@@ -27,7 +30,7 @@
 %type <syntax_node> sql_select select_columns column_values column_value operator
 %type <syntax_node> connector where_conditions where_condition
 %type <syntax_node> sql_insert sql_delete sql_update update_values update_value
-%type <syntax_node> sql_quit sql_exec_file
+%type <syntax_node> sql_quit sql_exec_file sql_analyze
 
 %%
 
@@ -58,6 +61,7 @@ sql:
   | sql_trx_rollback { $$ = $1; }
   | sql_quit { $$ = $1; }
   | sql_exec_file { $$ = $1; }
+  | sql_analyze { $$ = $1; }
   ;
 
 sql_create_database:
@@ -180,6 +184,31 @@ sql_create_index:
       SyntaxNodeAddChildren(index_type_node, $10);
       SyntaxNodeAddChildren($$, index_type_node);
   }
+  | CREATE INDEX IDENTIFIER ON IDENTIFIER '(' column_list ')' WHERE where_conditions {
+    $$ = CreateSyntaxNode(kNodeCreateIndex, NULL);
+    SyntaxNodeAddChildren($$, $3);
+    SyntaxNodeAddChildren($$, $5);
+    pSyntaxNode index_keys_node = CreateSyntaxNode(kNodeColumnList, "index keys");
+    SyntaxNodeAddChildren(index_keys_node, $7);
+    SyntaxNodeAddChildren($$, index_keys_node);
+    pSyntaxNode condition_node = CreateSyntaxNode(kNodeConditions, NULL);
+    SyntaxNodeAddChildren(condition_node, $10);
+    SyntaxNodeAddChildren($$, condition_node);
+  }
+  | CREATE INDEX IDENTIFIER ON IDENTIFIER '(' column_list ')' USING IDENTIFIER WHERE where_conditions {
+    $$ = CreateSyntaxNode(kNodeCreateIndex, NULL);
+    SyntaxNodeAddChildren($$, $3);
+    SyntaxNodeAddChildren($$, $5);
+    pSyntaxNode index_keys_node = CreateSyntaxNode(kNodeColumnList, "index keys");
+    SyntaxNodeAddChildren(index_keys_node, $7);
+    SyntaxNodeAddChildren($$, index_keys_node);
+    pSyntaxNode index_type_node = CreateSyntaxNode(kNodeIndexType, "index type");
+    SyntaxNodeAddChildren(index_type_node, $10);
+    SyntaxNodeAddChildren($$, index_type_node);
+    pSyntaxNode condition_node = CreateSyntaxNode(kNodeConditions, NULL);
+    SyntaxNodeAddChildren(condition_node, $12);
+    SyntaxNodeAddChildren($$, condition_node);
+  }
   ;
 
 sql_drop_index:
@@ -209,6 +238,21 @@ sql_select:
     SyntaxNodeAddChildren(condition_node, $6);
     SyntaxNodeAddChildren($$, condition_node);
   }
+  | SELECT select_columns FROM IDENTIFIER ',' IDENTIFIER {
+    $$ = CreateSyntaxNode(kNodeSelect, NULL);
+    SyntaxNodeAddChildren($$, $2);
+    SyntaxNodeAddChildren($$, $4);
+    SyntaxNodeAddChildren($$, $6);
+  }
+  | SELECT select_columns FROM IDENTIFIER ',' IDENTIFIER WHERE where_conditions {
+    $$ = CreateSyntaxNode(kNodeSelect, NULL);
+    SyntaxNodeAddChildren($$, $2);
+    SyntaxNodeAddChildren($$, $4);
+    SyntaxNodeAddChildren($$, $6);
+    pSyntaxNode condition_node = CreateSyntaxNode(kNodeConditions, NULL);
+    SyntaxNodeAddChildren(condition_node, $8);
+    SyntaxNodeAddChildren($$, condition_node);
+  }
   ;
 
 select_columns:
@@ -247,6 +291,11 @@ where_condition:
     SyntaxNodeAddChildren($$, $1);
     SyntaxNodeAddChildren($$, $3);
   }
+  | IDENTIFIER operator IDENTIFIER {
+    $$ = $2;
+    SyntaxNodeAddChildren($$, $1);
+    SyntaxNodeAddChildren($$, $3);
+  }
   ;
 
 column_value:
@@ -393,6 +442,13 @@ sql_exec_file:
   }
   ;
 
+sql_analyze:
+  ANALYZE TABLE IDENTIFIER {
+    $$ = CreateSyntaxNode(kNodeAnalyze, NULL);
+    SyntaxNodeAddChildren($$, $3);
+  }
+  ;
+
 %%
 int yyerror(char* error) {
 	MinisqlParserSetError(error);
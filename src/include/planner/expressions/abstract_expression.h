@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "record/row.h"
+#include "record/row_batch.h"
 #include "record/schema.h"
 
 class AbstractExpression;
@@ -44,6 +45,25 @@ class AbstractExpression {
    */
   virtual Field EvaluateJoin(const Row *left_row, const Row *right_row) const = 0;
 
+  /**
+   * Evaluate this boolean expression over a batch of rows.
+   * @param batch The rows, with the columns of the schema the expression refers to
+   * @param[in/out] selection Positions of the batch to evaluate, only the positions where
+   * the expression is true are kept, in order
+   */
+  virtual void EvaluateBatch(const RowBatch &batch, std::vector<uint32_t> &selection) const {
+    // fall back to materializing the rows one at a time
+    size_t kept = 0;
+    Row row;
+    for (auto i : selection) {
+      batch.GetRow(i, row);
+      if (Evaluate(&row).CompareEquals(Field(kTypeInt, 1)) == CmpBool::kTrue) {
+        selection[kept++] = i;
+      }
+    }
+    selection.resize(kept);
+  }
+
   /** @return the child_idx'th child of this expression */
   const AbstractExpressionRef &GetChildAt(uint32_t child_idx) const { return children_[child_idx]; }
 
@@ -5,20 +5,34 @@
 #ifndef MINISQL_COMPARISON_EXPRESSION_H
 #define MINISQL_COMPARISON_EXPRESSION_H
 
+#include <string>
 #include <utility>
 
 #include "abstract_expression.h"
 #include "record/schema.h"
 
+/** ComparisonType represents the type of comparison that we want to perform. */
+enum class ComparisonType {
+  Equal,
+  NotEqual,
+  LessThan,
+  LessThanOrEqual,
+  GreaterThan,
+  GreaterThanOrEqual,
+  IsNull,
+  IsNotNull
+};
+
 /**
  * ComparisonExpression represents two expressions being compared.
  */
 class ComparisonExpression : public AbstractExpression {
  public:
   /** Creates a new comparison expression representing (left comp_type right). */
-  ComparisonExpression(AbstractExpressionRef left, AbstractExpressionRef right, string comp_type)
+  ComparisonExpression(AbstractExpressionRef left, AbstractExpressionRef right, std::string comp_type)
       : AbstractExpression({std::move(left), std::move(right)}, TypeId::kTypeInt, ExpressionType::ComparisonExpression),
-        comp_type_{std::move(comp_type)} {}
+        comp_type_{std::move(comp_type)},
+        comp_op_{Char2Type(comp_type_)} {}
 
   /** e.g. evaluate the result of id = 1 */
   Field Evaluate(const Row *row) const override {
@@ -35,29 +49,54 @@ class ComparisonExpression : public AbstractExpression {
 
   std::string GetComparisonType() { return comp_type_; }
 
- private:
-  CmpBool PerformComparison(const Field &lhs, const Field &rhs) const {
-    if (comp_type_ == "=")
-      return lhs.CompareEquals(rhs);
-    else if (comp_type_ == "<>")
-      return lhs.CompareNotEquals(rhs);
-    else if (comp_type_ == "<")
-      return lhs.CompareLessThan(rhs);
-    else if (comp_type_ == "<=")
-      return lhs.CompareLessThanEquals(rhs);
-    else if (comp_type_ == ">")
-      return lhs.CompareGreaterThan(rhs);
-    else if (comp_type_ == ">=")
-      return lhs.CompareGreaterThanEquals(rhs);
-    else if (comp_type_ == "is")
-      return GetCmpBool(lhs.IsNull());
-    else if (comp_type_ == "not")
-      return GetCmpBool(!lhs.IsNull());
+  ComparisonType GetComparisonOperator() const { return comp_op_; }
+
+  static ComparisonType Char2Type(const std::string &val) {
+    if (val == "=")
+      return ComparisonType::Equal;
+    else if (val == "<>")
+      return ComparisonType::NotEqual;
+    else if (val == "<")
+      return ComparisonType::LessThan;
+    else if (val == "<=")
+      return ComparisonType::LessThanOrEqual;
+    else if (val == ">")
+      return ComparisonType::GreaterThan;
+    else if (val == ">=")
+      return ComparisonType::GreaterThanOrEqual;
+    else if (val == "is")
+      return ComparisonType::IsNull;
+    else if (val == "not")
+      return ComparisonType::IsNotNull;
     else
       throw std::logic_error("Unsupported comparison type");
   }
 
+ private:
+  CmpBool PerformComparison(const Field &lhs, const Field &rhs) const {
+    switch (comp_op_) {
+      case ComparisonType::Equal:
+        return lhs.CompareEquals(rhs);
+      case ComparisonType::NotEqual:
+        return lhs.CompareNotEquals(rhs);
+      case ComparisonType::LessThan:
+        return lhs.CompareLessThan(rhs);
+      case ComparisonType::LessThanOrEqual:
+        return lhs.CompareLessThanEquals(rhs);
+      case ComparisonType::GreaterThan:
+        return lhs.CompareGreaterThan(rhs);
+      case ComparisonType::GreaterThanOrEqual:
+        return lhs.CompareGreaterThanEquals(rhs);
+      case ComparisonType::IsNull:
+        return GetCmpBool(lhs.IsNull());
+      default:
+        return GetCmpBool(!lhs.IsNull());
+    }
+  }
+
   std::string comp_type_;
+  /** comp_type_ parsed once, so evaluation does not compare strings */
+  ComparisonType comp_op_;
 };
 
 #endif  // MINISQL_COMPARISON_EXPRESSION_H
@@ -0,0 +1,74 @@
+#ifndef MINISQL_COMPILED_PREDICATE_H
+#define MINISQL_COMPILED_PREDICATE_H
+
+#include <vector>
+
+#include "planner/expressions/abstract_expression.h"
+#include "planner/expressions/comparison_expression.h"
+#include "planner/expressions/logic_expression.h"
+
+/**
+ * A filter predicate compiled once at plan time into a flat array of nodes in
+ * pre-order. A comparison of a table column with a constant becomes a node
+ * holding the operator, the column index and the constant of the column type,
+ * evaluated by a kernel specialized on that type; AND and OR nodes evaluate
+ * their right side only when the left side does not decide. Anything else
+ * is kept as an expression node evaluated through the expression tree.
+ *
+ * Predicates only combine comparisons with AND and OR, so an unknown result
+ * can be treated as false: a row is accepted exactly when the predicate is
+ * true under three-valued logic, as in a WHERE clause.
+ */
+class CompiledPredicate {
+ public:
+  CompiledPredicate() = default;
+
+  explicit CompiledPredicate(const AbstractExpressionRef &predicate);
+
+  // an empty predicate accepts every row
+  inline bool IsEmpty() const { return nodes_.empty(); }
+
+  // whether the table row satisfies the predicate
+  bool Evaluate(const Row &row) const;
+
+  /**
+   * Keep the positions of selection whose rows satisfy the predicate.
+   * @param batch Rows with the columns of the table
+   * @param[in/out] selection Increasing positions of the batch
+   */
+  void EvaluateBatch(const RowBatch &batch, std::vector<uint32_t> &selection) const;
+
+ private:
+  enum class NodeType : uint8_t { And, Or, CompareInt, CompareFloat, CompareChar, IsNull, IsNotNull, False, Expression };
+
+  struct Node {
+    NodeType type;
+    ComparisonType op{ComparisonType::Equal};
+    // the column compared
+    uint32_t column{0};
+    // index of the node after the subtree of this node
+    uint32_t end{0};
+    int32_t int_value{0};
+    float float_value{0};
+    // a CHAR constant is chars_[chars_begin, chars_begin + chars_length)
+    uint32_t chars_begin{0};
+    uint32_t chars_length{0};
+    const AbstractExpression *expression{nullptr};
+  };
+
+  void Compile(const AbstractExpressionRef &expression);
+
+  // compile "column op constant", return false if the comparison has another form
+  bool CompileComparison(const ComparisonExpression *comparison, Node &node);
+
+  bool Evaluate(uint32_t index, const Row &row) const;
+
+  void EvaluateBatch(uint32_t index, const RowBatch &batch, std::vector<uint32_t> &selection) const;
+
+  std::vector<Node> nodes_;
+  std::vector<char> chars_;
+  // keeps the expressions of the expression nodes alive
+  AbstractExpressionRef predicate_;
+};
+
+#endif  // MINISQL_COMPILED_PREDICATE_H
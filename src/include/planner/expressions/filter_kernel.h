@@ -0,0 +1,52 @@
+#ifndef MINISQL_FILTER_KERNEL_H
+#define MINISQL_FILTER_KERNEL_H
+
+#include <cstdint>
+#include <vector>
+
+#include "planner/expressions/comparison_expression.h"
+
+/**
+ * Kernels evaluating a comparison with a constant over a whole column vector.
+ * Bit i of the result bitmap is set when value i satisfies the comparison, so
+ * a predicate runs as one tight loop per batch and the selection vector is
+ * refined from the bitmap afterwards. Values at null positions are
+ * placeholders, the caller masks them out.
+ *
+ * The instruction set is detected once at runtime: AVX2 compares 8 INT or
+ * FLOAT values at a time, otherwise a scalar loop is used. CHAR equality
+ * checks the length and then calls memcmp.
+ */
+class FilterKernel {
+ public:
+  enum class Isa { kScalar = 0, kAVX2 };
+
+  // best instruction set supported by the running cpu
+  static Isa DetectIsa();
+
+  // instruction set used by the kernels, can be lowered for tests and benchmarks
+  static Isa GetIsa() { return isa_; }
+
+  // set the instruction set, an unsupported one falls back to the detected one
+  static void SetIsa(Isa isa);
+
+  // number of bitmap words holding one bit for each of n values
+  static constexpr uint32_t BitmapWords(uint32_t n) { return (n + 63) / 64; }
+
+  // set bit i of bitmap to whether "values[i] op value" holds for i in [0, n), op is not a null check
+  static void Compare(const int32_t *values, uint32_t n, ComparisonType op, int32_t value, uint64_t *bitmap);
+
+  static void Compare(const float *values, uint32_t n, ComparisonType op, float value, uint64_t *bitmap);
+
+  // set bit i of bitmap to whether chars[offsets[i], offsets[i + 1]) equals value[0, length)
+  static void EqualChars(const char *chars, const uint32_t *offsets, uint32_t n, const char *value, uint32_t length,
+                         uint64_t *bitmap);
+
+  // keep the non-null positions of selection whose bit is set, or clear if negate is true
+  static void Select(const uint64_t *bitmap, const uint8_t *nulls, bool negate, std::vector<uint32_t> &selection);
+
+ private:
+  static Isa isa_;
+};
+
+#endif  // MINISQL_FILTER_KERNEL_H
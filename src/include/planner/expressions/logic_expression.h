@@ -24,17 +24,23 @@ class LogicExpression : public AbstractExpression {
     }
   }
 
-  /** e.g. evaluate the result of id = 1 and name = "str"*/
+  /** e.g. evaluate the result of id = 1 and name = "str", the right side is skipped when the left side decides */
   Field Evaluate(const Row *row) const override {
-    Field lhs = GetChildAt(0)->Evaluate(row);
-    Field rhs = GetChildAt(1)->Evaluate(row);
-    return Field(kTypeInt, PerformComputation(lhs, rhs));
+    auto l = GetFieldAsCmpBool(GetChildAt(0)->Evaluate(row));
+    if (IsDecidedBy(l)) {
+      return Field(kTypeInt, l);
+    }
+    auto r = GetFieldAsCmpBool(GetChildAt(1)->Evaluate(row));
+    return Field(kTypeInt, PerformComputation(l, r));
   }
 
   Field EvaluateJoin(const Row *left_row, const Row *right_row) const override {
-    Field lhs = GetChildAt(0)->EvaluateJoin(left_row, right_row);
-    Field rhs = GetChildAt(1)->EvaluateJoin(left_row, right_row);
-    return Field(kTypeInt, PerformComputation(lhs, rhs));
+    auto l = GetFieldAsCmpBool(GetChildAt(0)->EvaluateJoin(left_row, right_row));
+    if (IsDecidedBy(l)) {
+      return Field(kTypeInt, l);
+    }
+    auto r = GetFieldAsCmpBool(GetChildAt(1)->EvaluateJoin(left_row, right_row));
+    return Field(kTypeInt, PerformComputation(l, r));
   }
 
   static LogicType Char2Type(char *val) {
@@ -59,9 +65,13 @@ class LogicExpression : public AbstractExpression {
     return CmpBool::kFalse;
   }
 
-  CmpBool PerformComputation(const Field &lhs, const Field &rhs) const {
-    auto l = GetFieldAsCmpBool(lhs);
-    auto r = GetFieldAsCmpBool(rhs);
+  // false decides an AND and true decides an OR whatever the right side is
+  bool IsDecidedBy(CmpBool l) const {
+    return (logic_type_ == LogicType::And && l == CmpBool::kFalse) ||
+           (logic_type_ == LogicType::Or && l == CmpBool::kTrue);
+  }
+
+  CmpBool PerformComputation(CmpBool l, CmpBool r) const {
     switch (logic_type_) {
       case LogicType::And:
         if (l == CmpBool::kFalse || r == CmpBool::kFalse) {
@@ -8,8 +8,11 @@
 #include "common/instance.h"
 #include "executor/plans/abstract_plan.h"
 #include "executor/plans/delete_plan.h"
+#include "executor/plans/hash_join_plan.h"
+#include "executor/plans/index_nested_loop_join_plan.h"
 #include "executor/plans/index_scan_plan.h"
 #include "executor/plans/insert_plan.h"
+#include "executor/plans/merge_join_plan.h"
 #include "executor/plans/seq_scan_plan.h"
 #include "executor/plans/update_plan.h"
 #include "executor/plans/values_plan.h"
@@ -34,6 +37,14 @@ class Planner {
 
   AbstractPlanNodeRef PlanSelect(std::shared_ptr<SelectStatement> statement);
 
+  /** Plan a scan of one table, through its indexes when they pay off. */
+  AbstractPlanNodeRef PlanScan(const Schema *out_schema, const std::string &table_name,
+                               const AbstractExpressionRef &predicate, const std::vector<uint32_t> &column_in_condition,
+                               bool has_or);
+
+  /** Plan the join of the two tables of a SELECT. */
+  AbstractPlanNodeRef PlanJoin(std::shared_ptr<SelectStatement> statement, const Schema *out_schema);
+
   AbstractPlanNodeRef PlanInsert(std::shared_ptr<InsertStatement> statement);
 
   AbstractPlanNodeRef PlanDelete(std::shared_ptr<DeleteStatement> statement);
@@ -45,6 +56,38 @@ class Planner {
 
   Schema *MakeOutputSchema(const std::vector<std::pair<std::string, AbstractExpressionRef>> &exprs);
 
+  /** Columns compared for equality with a constant in a conjunct of the predicate. */
+  std::vector<uint32_t> EqualityColumns(const AbstractExpressionRef &predicate);
+
+  /** Whether the rows satisfying the predicate can be narrowed down through single column indexes. */
+  bool AnsweredByIndexes(const AbstractExpressionRef &predicate, const std::vector<IndexInfo *> &indexes);
+
+  /** Fraction of the entries of an analyzed index that the conjuncts on its leading column keep. */
+  double LeadingSelectivity(const AbstractExpressionRef &predicate, IndexInfo *index);
+
+  /** Whether every row satisfying the predicate satisfies the predicate of a partial index. */
+  bool ImpliesIndexPredicate(const AbstractExpressionRef &predicate, const IndexPredicate &index_predicate);
+
+  /** The sides of a join an expression reads, bit 0 for the first table and bit 1 for the second. */
+  static uint32_t JoinSides(const AbstractExpressionRef &expr);
+
+  /** The expression with every column read from row index 0, to evaluate it on the rows of one table. */
+  static AbstractExpressionRef ToSingleTable(const AbstractExpressionRef &expr);
+
+  /** An index of the table whose key columns are all join keys of the table, nullptr if there is none. */
+  IndexInfo *JoinIndex(const std::string &table_name, const std::vector<AbstractExpressionRef> &keys,
+                       const AbstractExpressionRef &predicate);
+
+  /**
+   * An ordered index of the table whose leading key columns are join keys of the table, nullptr if there is none.
+   * @param[out] positions The positions in keys of the leading key columns, in index order
+   */
+  IndexInfo *OrderedJoinIndex(const std::string &table_name, const std::vector<AbstractExpressionRef> &keys,
+                              const AbstractExpressionRef &predicate, std::vector<size_t> &positions);
+
+  /** Columns compared with a constant in the predicate, and whether it has an OR. */
+  static void ConditionColumns(const AbstractExpressionRef &predicate, std::vector<uint32_t> &columns, bool &has_or);
+
   /** Catalog will be used during the planning process. SHOULD ONLY BE USED IN
    * CODE PATH OF `PlanQuery`.
    */
@@ -34,6 +34,20 @@ class AbstractStatement {
   virtual std::string ToString() const {
     throw std::logic_error("ToString not supported for this type of SQLStatement");
   }
+  /**
+   * Strip the table name from a column name written as "table.column".
+   * @param table_name The name of the table
+   * @param name The column name as written in the statement
+   * @return The name of the column in the table
+   */
+  static std::string ColumnName(const std::string &table_name, const std::string &name) {
+    auto dot = name.find('.');
+    if (dot != std::string::npos && name.compare(0, dot, table_name) == 0 && dot == table_name.length()) {
+      return name.substr(dot + 1);
+    }
+    return name;
+  }
+
   /**
    * Make a column value expression.
    * @param table_name The name of the table
@@ -45,7 +59,7 @@ class AbstractStatement {
     context_->GetCatalog()->GetTable(table_name, info);
     auto schema = info->GetSchema();
     uint32_t index;
-    if (schema->GetColumnIndex(col->val_, index) != DB_SUCCESS) {
+    if (schema->GetColumnIndex(ColumnName(table_name, col->val_), index) != DB_SUCCESS) {
       throw std::logic_error("the column does not exist in table");
     }
     auto col_type = schema->GetColumn(index)->GetType();
@@ -112,6 +126,10 @@ class AbstractStatement {
         pSyntaxNode col = ast->child_;
         pSyntaxNode value = ast->child_->next_;
         auto col_expr = MakeColumnValueExpression(table_name, col);
+        if (value->type_ == kNodeIdentifier) {
+          // column op column, no index answers it
+          return MakeComparisonExpression(col_expr, MakeColumnValueExpression(table_name, value), ast->val_);
+        }
         auto const_expr = MakeConstantValueExpression(col_expr->GetReturnType(), value);
         if (column_in_condition) {
           uint32_t index = dynamic_pointer_cast<ColumnValueExpression>(col_expr)->GetColIdx();
@@ -136,6 +154,14 @@ class AbstractStatement {
    */
   AbstractExpressionRef MakeComparisonExpression(const AbstractExpressionRef &lhs, const AbstractExpressionRef &rhs,
                                                  string comp_type) {
+    if (dynamic_pointer_cast<ColumnValueExpression>(rhs) != nullptr) {
+      if (comp_type == "is" || comp_type == "not") {
+        throw std::logic_error("only null can follow is or not");
+      }
+      if (lhs->GetReturnType() != rhs->GetReturnType()) {
+        throw std::logic_error("the columns compared have different types");
+      }
+    }
     return std::make_shared<ComparisonExpression>(lhs, rhs, comp_type);
   }
 
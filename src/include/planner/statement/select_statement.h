@@ -23,7 +23,12 @@ class SelectStatement : public AbstractStatement {
           error_info << "the table " << ast->val_ << " is not exist.";
           throw std::logic_error(error_info.str());
         }
-        table_name_ = ast->val_;
+        // the second table of FROM a, b is joined with the first
+        if (table_name_.empty()) {
+          table_name_ = ast->val_;
+        } else {
+          join_table_name_ = ast->val_;
+        }
         break;
       }
       case kNodeAllColumns:
@@ -33,7 +38,11 @@ class SelectStatement : public AbstractStatement {
         return;
       }
       case kNodeConditions: {
-        where_ = MakePredicate(ast->child_, table_name_, &column_in_condition_, &has_or);
+        if (IsJoin()) {
+          where_ = MakeJoinPredicate(ast->child_);
+        } else {
+          where_ = MakePredicate(ast->child_, table_name_, &column_in_condition_, &has_or);
+        }
         break;
       }
       default:
@@ -43,6 +52,10 @@ class SelectStatement : public AbstractStatement {
   };
 
   void MakeColumnList(pSyntaxNode ast) {
+    if (IsJoin()) {
+      MakeJoinColumnList(ast);
+      return;
+    }
     TableInfo *info = nullptr;
     context_->GetCatalog()->GetTable(table_name_, info);
     auto schema = info->GetSchema();
@@ -55,7 +68,7 @@ class SelectStatement : public AbstractStatement {
     } else {
       while (ast) {
         uint32_t index;
-        if (schema->GetColumnIndex(ast->val_, index) != DB_SUCCESS) {
+        if (schema->GetColumnIndex(ColumnName(table_name_, ast->val_), index) != DB_SUCCESS) {
           throw std::logic_error("the column does not exist in table");
         }
         auto expr = std::make_shared<ColumnValueExpression>(0, index, schema->GetColumn(index)->GetType());
@@ -65,9 +78,89 @@ class SelectStatement : public AbstractStatement {
     }
   }
 
+  /** Whether the statement joins two tables. */
+  bool IsJoin() const { return !join_table_name_.empty(); }
+
+  /**
+   * Bind a column of a join, written as "table.column" or by a name only one of the tables has.
+   * @param name The column name as written in the statement
+   * @return A column of row index 0 for the first table and 1 for the second
+   */
+  std::shared_ptr<ColumnValueExpression> MakeJoinColumnValueExpression(const std::string &name) {
+    const std::string tables[] = {table_name_, join_table_name_};
+    auto dot = name.find('.');
+    std::shared_ptr<ColumnValueExpression> column;
+    for (uint32_t side = 0; side < 2; side++) {
+      if (dot != std::string::npos && name.compare(0, dot, tables[side]) != 0) {
+        continue;
+      }
+      TableInfo *info = nullptr;
+      context_->GetCatalog()->GetTable(tables[side], info);
+      auto schema = info->GetSchema();
+      uint32_t index;
+      if (schema->GetColumnIndex(ColumnName(tables[side], name), index) != DB_SUCCESS) {
+        continue;
+      }
+      if (column != nullptr) {
+        throw std::logic_error("the column " + name + " is ambiguous");
+      }
+      column = std::make_shared<ColumnValueExpression>(side, index, schema->GetColumn(index)->GetType());
+    }
+    if (column == nullptr) {
+      throw std::logic_error("the column " + name + " does not exist in the joined tables");
+    }
+    return column;
+  }
+
+  /** SELECT * of a join lists the columns of the first table, then those of the second. */
+  void MakeJoinColumnList(pSyntaxNode ast) {
+    if (ast) {
+      for (; ast; ast = ast->next_) {
+        column_list_.emplace_back(make_pair(ast->val_, MakeJoinColumnValueExpression(ast->val_)));
+      }
+      return;
+    }
+    const std::string tables[] = {table_name_, join_table_name_};
+    for (uint32_t side = 0; side < 2; side++) {
+      TableInfo *info = nullptr;
+      context_->GetCatalog()->GetTable(tables[side], info);
+      for (auto column : info->GetSchema()->GetColumns()) {
+        auto expr = std::make_shared<ColumnValueExpression>(side, column->GetTableInd(), column->GetType());
+        column_list_.emplace_back(make_pair(column->GetName(), expr));
+      }
+    }
+  }
+
+  /** Bind the WHERE clause of a join, a comparison may relate a column of each table. */
+  AbstractExpressionRef MakeJoinPredicate(pSyntaxNode ast) {
+    switch (ast->type_) {
+      case kNodeConnector: {
+        auto left = MakeJoinPredicate(ast->child_);
+        auto right = MakeJoinPredicate(ast->child_->next_);
+        if (!strcmp(ast->val_, "or")) {
+          has_or = true;
+        }
+        return MakeLogicExpression(left, right, LogicExpression::Char2Type(ast->val_));
+      }
+      case kNodeCompareOperator: {
+        pSyntaxNode value = ast->child_->next_;
+        AbstractExpressionRef col_expr = MakeJoinColumnValueExpression(ast->child_->val_);
+        AbstractExpressionRef value_expr = value->type_ == kNodeIdentifier
+                                               ? MakeJoinColumnValueExpression(value->val_)
+                                               : MakeConstantValueExpression(col_expr->GetReturnType(), value);
+        return MakeComparisonExpression(col_expr, value_expr, ast->val_);
+      }
+      default:
+        throw std::logic_error("The node kNodeConditions has a child node of the wrong type");
+    }
+  }
+
   /** Bound FROM clause. */
   std::string table_name_;
 
+  /** The second table of FROM, empty unless the statement is a join. */
+  std::string join_table_name_;
+
   /** Bound SELECT list. */
   std::vector<std::pair<std::string, AbstractExpressionRef>> column_list_;
 
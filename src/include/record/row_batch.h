@@ -0,0 +1,130 @@
+#ifndef MINISQL_ROW_BATCH_H
+#define MINISQL_ROW_BATCH_H
+
+#include <vector>
+
+#include "common/config.h"
+#include "common/rowid.h"
+#include "record/row.h"
+#include "record/schema.h"
+
+/**
+ * Values of one column for the rows of a RowBatch. INT and FLOAT values are
+ * kept in plain arrays and CHAR values back to back in one buffer, a null
+ * value holds a placeholder so that position i is the i-th row of the batch.
+ */
+class ColumnVector {
+ public:
+  explicit ColumnVector(TypeId type_id = TypeId::kTypeInvalid) : type_id_(type_id) { offsets_.push_back(0); }
+
+  inline TypeId GetTypeId() const { return type_id_; }
+
+  inline size_t GetSize() const { return nulls_.size(); }
+
+  // drop the values, keeping the type and the memory
+  void Clear();
+
+  void Append(const Field &field);
+
+  // append a value in the serialized format of Field, return the bytes read
+  uint32_t AppendSerialized(const char *buf, bool is_null);
+
+  // append the value at position i of other, which has the same type
+  void AppendFrom(const ColumnVector &other, uint32_t i);
+
+  inline bool IsNull(uint32_t i) const { return nulls_[i] != 0; }
+
+  inline int32_t GetInt(uint32_t i) const { return ints_[i]; }
+
+  inline float GetFloat(uint32_t i) const { return floats_[i]; }
+
+  inline const char *GetChars(uint32_t i) const { return chars_.data() + offsets_[i]; }
+
+  inline uint32_t GetCharLength(uint32_t i) const { return offsets_[i + 1] - offsets_[i]; }
+
+  // the arrays read by the batch predicate kernels
+  inline const uint8_t *GetNulls() const { return nulls_.data(); }
+
+  inline const int32_t *GetInts() const { return ints_.data(); }
+
+  inline const float *GetFloats() const { return floats_.data(); }
+
+  inline const char *GetCharData() const { return chars_.data(); }
+
+  inline const uint32_t *GetOffsets() const { return offsets_.data(); }
+
+  // a new Field holding the value at position i, owned by the caller
+  Field *NewField(uint32_t i) const;
+
+ private:
+  TypeId type_id_;
+  std::vector<uint8_t> nulls_;
+  std::vector<int32_t> ints_;
+  std::vector<float> floats_;
+  std::vector<char> chars_;
+  // value i of a CHAR column is chars_[offsets_[i], offsets_[i + 1])
+  std::vector<uint32_t> offsets_;
+};
+
+/**
+ * Up to EXECUTOR_BATCH_SIZE rows passed between executors by NextBatch, stored
+ * column by column with the row id of every row.
+ *
+ * The selection vector lists the positions of the rows that are part of the
+ * batch in increasing order. Filters shrink it instead of moving values, so a
+ * predicate is evaluated over the columns of the whole batch and the rows it
+ * rejects are never copied. Rows without columns, like the rows reported by
+ * the executors that modify a table, only have a row id.
+ */
+class RowBatch {
+ public:
+  RowBatch() = default;
+
+  // empty the batch and give it one column for each column of the schema, reusing the columns it has
+  void Init(const Schema *schema);
+
+  // empty the batch, keeping its columns
+  void Reset();
+
+  // empty the batch and drop its columns
+  void Clear();
+
+  inline uint32_t GetColumnCount() const { return columns_.size(); }
+
+  inline ColumnVector &GetColumn(uint32_t i) { return columns_[i]; }
+
+  inline const ColumnVector &GetColumn(uint32_t i) const { return columns_[i]; }
+
+  // number of rows stored, selected or not
+  inline size_t GetSize() const { return row_ids_.size(); }
+
+  inline bool IsFull() const { return row_ids_.size() >= EXECUTOR_BATCH_SIZE; }
+
+  inline RowId GetRowId(uint32_t i) const { return row_ids_[i]; }
+
+  inline std::vector<uint32_t> &GetSelection() { return selection_; }
+
+  inline const std::vector<uint32_t> &GetSelection() const { return selection_; }
+
+  // append a selected row, the columns are created from the fields of the first row of an empty batch
+  void AppendRow(const Row &row);
+
+  // append a selected row decoded from the format of Row::SerializeTo, return the bytes read
+  uint32_t AppendSerialized(const char *buf, RowId row_id);
+
+  // append a selected row of a batch without columns, or one whose values were appended to the columns already
+  void AppendRowId(RowId row_id);
+
+  // make this batch the selected rows of source, column i holding column column_map[i] of source
+  void Project(const RowBatch &source, const std::vector<uint32_t> &column_map);
+
+  // materialize the row at position i
+  void GetRow(uint32_t i, Row &row) const;
+
+ private:
+  std::vector<ColumnVector> columns_;
+  std::vector<RowId> row_ids_;
+  std::vector<uint32_t> selection_;
+};
+
+#endif  // MINISQL_ROW_BATCH_H
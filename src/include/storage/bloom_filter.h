@@ -0,0 +1,37 @@
+#ifndef MINISQL_BLOOM_FILTER_H
+#define MINISQL_BLOOM_FILTER_H
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+/**
+ * Bloom filter over byte string keys, built once from the hashes of all its
+ * keys. MayContain never answers false for a key that was added, and answers
+ * true for about 1% of the other keys at 10 bits per key.
+ *
+ * The filter is split into cache-line sized blocks: the upper half of a key's
+ * 64-bit hash picks the block, the lower half derives all probes inside it by
+ * double hashing, so a lookup costs one cache miss. A key is hashed once with
+ * Hash() and the hash reused for every filter it is tested against.
+ */
+class BloomFilter {
+ public:
+  BloomFilter() = default;
+
+  BloomFilter(const std::vector<uint64_t> &hashes, size_t bits_per_key);
+
+  static uint64_t Hash(std::string_view key);
+
+  bool MayContain(uint64_t hash) const;
+
+  size_t GetMemoryBytes() const { return bits_.size() * sizeof(uint64_t); }
+
+ private:
+  static constexpr uint32_t BLOCK_BITS = 512;
+
+  std::vector<uint64_t> bits_;
+  uint32_t probes_{0};
+};
+
+#endif  // MINISQL_BLOOM_FILTER_H
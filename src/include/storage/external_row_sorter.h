@@ -0,0 +1,89 @@
+#ifndef MINISQL_EXTERNAL_ROW_SORTER_H
+#define MINISQL_EXTERNAL_ROW_SORTER_H
+
+#include <cstdio>
+#include <functional>
+#include <queue>
+#include <vector>
+
+#include "common/config.h"
+#include "common/macros.h"
+#include "record/row.h"
+#include "record/schema.h"
+
+/**
+ * External merge sort of table rows, the variable-length counterpart of
+ * ExternalSorter.
+ *
+ * Rows are buffered in memory up to memory_limit bytes. Each full buffer is
+ * sorted and written to an anonymous temporary file as a run of rows in the
+ * format of Row::SerializeTo, each preceded by its size. The runs are read back
+ * sequentially and k-way merged by Next(). When everything fits into memory no
+ * file is created at all, only then the rows keep their row ids.
+ *
+ * Usage: Add() all rows, call Finish() once, then Next() until it returns false.
+ */
+class ExternalRowSorter {
+ public:
+  // strict weak order of the rows
+  using Compare = std::function<bool(const Row &, const Row &)>;
+
+  ExternalRowSorter(const Schema *schema, Compare compare, size_t memory_limit = DEFAULT_SORT_MEMORY_LIMIT);
+
+  ~ExternalRowSorter();
+
+  DISALLOW_COPY(ExternalRowSorter);
+
+  void Add(const Row &row);
+
+  /**
+   * Sort what is left in memory and prepare the merge of all runs.
+   */
+  void Finish();
+
+  /**
+   * Get the next row in sorted order, return false once all rows are consumed.
+   */
+  bool Next(Row &row);
+
+  // number of runs spilled to disk, 0 means the sort was done in memory
+  size_t GetRunCount() const { return runs_.size(); }
+
+ private:
+  struct Run {
+    FILE *file{nullptr};
+    // the smallest row of the run not returned yet
+    Row head;
+  };
+
+  // orders run indexes by their head row, smallest on top
+  struct RunGreater {
+    ExternalRowSorter *sorter;
+    bool operator()(size_t a, size_t b) const {
+      return sorter->compare_(sorter->runs_[b].head, sorter->runs_[a].head);
+    }
+  };
+
+  // sort the buffered rows into order_
+  void SortBuffer();
+
+  void SpillRun();
+
+  // read the next row of a run into its head, return false at the end of the run
+  bool Refill(Run &run);
+
+  Schema *schema_;
+  Compare compare_;
+  size_t memory_limit_;
+  std::vector<Row> buffer_;
+  size_t buffer_bytes_{0};
+  // positions of buffer_ in sorted order and the next one to return
+  std::vector<uint32_t> order_;
+  size_t read_pos_{0};
+  std::vector<Run> runs_;
+  std::priority_queue<size_t, std::vector<size_t>, RunGreater> heap_{RunGreater{this}};
+  std::vector<char> io_buffer_;
+  bool finished_{false};
+};
+
+#endif  // MINISQL_EXTERNAL_ROW_SORTER_H
@@ -0,0 +1,148 @@
+#ifndef MINISQL_EXTERNAL_SORTER_H
+#define MINISQL_EXTERNAL_SORTER_H
+
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "common/config.h"
+#include "common/macros.h"
+
+/**
+ * External merge sort of fixed-size records.
+ *
+ * Records are buffered in memory up to memory_limit bytes. Each full buffer is
+ * sorted and spilled to an anonymous temporary file as a sorted run, and the
+ * runs are k-way merged while the result is read back with Next(). When
+ * everything fits into memory no file is created at all.
+ *
+ * Usage: Add() all records, call Finish() once, then Next() until it returns false.
+ */
+template <typename T, typename Compare = std::less<T>>
+class ExternalSorter {
+  static_assert(std::is_trivially_copyable<T>::value, "ExternalSorter only sorts trivially copyable records");
+
+ public:
+  explicit ExternalSorter(size_t memory_limit = DEFAULT_SORT_MEMORY_LIMIT, const Compare &compare = Compare())
+      : compare_(compare), buffer_capacity_(std::max<size_t>(memory_limit / sizeof(T), 1)) {}
+
+  ~ExternalSorter() {
+    for (auto &run : runs_) {
+      fclose(run.file);
+    }
+  }
+
+  DISALLOW_COPY(ExternalSorter);
+
+  void Add(const T &record) {
+    ASSERT(!finished_, "Add after Finish.");
+    if (buffer_.size() >= buffer_capacity_) {
+      SpillRun();
+    }
+    buffer_.push_back(record);
+  }
+
+  /**
+   * Sort what is left in memory and prepare the merge of all runs.
+   */
+  void Finish() {
+    ASSERT(!finished_, "Finish called twice.");
+    finished_ = true;
+    if (runs_.empty()) {
+      std::sort(buffer_.begin(), buffer_.end(), compare_);
+      return;
+    }
+    if (!buffer_.empty()) {
+      SpillRun();
+    }
+    std::vector<T>().swap(buffer_);
+    for (size_t i = 0; i < runs_.size(); i++) {
+      rewind(runs_[i].file);
+      if (Refill(runs_[i])) {
+        heap_.push(i);
+      }
+    }
+  }
+
+  /**
+   * Get the next record in sorted order, return false once all records are consumed.
+   */
+  bool Next(T &record) {
+    ASSERT(finished_, "Next called before Finish.");
+    if (runs_.empty()) {
+      if (read_pos_ >= buffer_.size()) {
+        return false;
+      }
+      record = buffer_[read_pos_++];
+      return true;
+    }
+    if (heap_.empty()) {
+      return false;
+    }
+    size_t i = heap_.top();
+    heap_.pop();
+    Run &run = runs_[i];
+    record = run.block[run.pos++];
+    if (run.pos < run.block.size() || Refill(run)) {
+      heap_.push(i);
+    }
+    return true;
+  }
+
+  // number of runs spilled to disk, 0 means the sort was done in memory
+  size_t GetRunCount() const { return runs_.size(); }
+
+ private:
+  struct Run {
+    FILE *file{nullptr};
+    std::vector<T> block;
+    size_t pos{0};
+  };
+
+  // orders run indexes by their current record, smallest on top
+  struct RunGreater {
+    ExternalSorter *sorter;
+    bool operator()(size_t a, size_t b) const {
+      const Run &run_a = sorter->runs_[a];
+      const Run &run_b = sorter->runs_[b];
+      return sorter->compare_(run_b.block[run_b.pos], run_a.block[run_a.pos]);
+    }
+  };
+
+  void SpillRun() {
+    std::sort(buffer_.begin(), buffer_.end(), compare_);
+    FILE *file = tmpfile();
+    if (file == nullptr) {
+      throw std::runtime_error("failed to create sort run file");
+    }
+    if (fwrite(buffer_.data(), sizeof(T), buffer_.size(), file) != buffer_.size()) {
+      fclose(file);
+      throw std::runtime_error("failed to write sort run file");
+    }
+    runs_.push_back(Run{file, {}, 0});
+    buffer_.clear();
+  }
+
+  // read the next block of a run, return false at the end of the run
+  bool Refill(Run &run) {
+    size_t block_size = std::max<size_t>(buffer_capacity_ / runs_.size(), PAGE_SIZE / sizeof(T) + 1);
+    run.block.resize(block_size);
+    run.block.resize(fread(run.block.data(), sizeof(T), block_size, run.file));
+    run.pos = 0;
+    return !run.block.empty();
+  }
+
+  Compare compare_;
+  size_t buffer_capacity_;
+  std::vector<T> buffer_;
+  size_t read_pos_{0};
+  std::vector<Run> runs_;
+  std::priority_queue<size_t, std::vector<size_t>, RunGreater> heap_{RunGreater{this}};
+  bool finished_{false};
+};
+
+#endif  // MINISQL_EXTERNAL_SORTER_H
@@ -0,0 +1,111 @@
+#ifndef MINISQL_LSM_MEMTABLE_H
+#define MINISQL_LSM_MEMTABLE_H
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/macros.h"
+#include "page/lsm_run_page.h"
+
+/**
+ * In-memory write buffer of an LsmTree: a skip list of entries ordered by
+ * key, a later Put of the same key overwrites the entry in place. Removes are
+ * kept as tombstones so that they hide the key in the runs on disk.
+ *
+ * Not synchronized, the LsmTree serializes writers against readers.
+ */
+class LsmMemTable {
+ public:
+  using Entry = LsmRunPage::Entry;
+
+ private:
+  static constexpr int MAX_HEIGHT = 12;
+  static constexpr size_t ARENA_BLOCK_SIZE = 256 << 10;
+
+  // the key prefix and the next pointers share the first cache line, a search step reads the entry only when
+  // the prefixes tie; the entry is allocated right after the node
+  struct Node {
+    uint64_t prefix;  // first 8 key bytes big-endian, zero padded, ordered like the keys
+    Entry *entry;
+    Node *next[1];
+  };
+
+ public:
+  // forward iterator over the entries in key order
+  class Iterator {
+   public:
+    explicit Iterator(const Node *node) : node_(node) {}
+
+    bool Valid() const { return node_ != nullptr; }
+
+    const Entry &operator*() const { return *node_->entry; }
+
+    const Entry *operator->() const { return node_->entry; }
+
+    void Next() { node_ = node_->next[0]; }
+
+   private:
+    const Node *node_;
+  };
+
+  // where a new entry goes, remembered by Find for a following Insert
+  class Splice {
+    friend class LsmMemTable;
+    Node *prev_[MAX_HEIGHT];
+  };
+
+  LsmMemTable();
+
+  ~LsmMemTable();
+
+  DISALLOW_COPY(LsmMemTable);
+
+  // insert the entry, or overwrite the entry of the same key
+  void Put(const std::string &key, int64_t value, bool deleted);
+
+  // entry of key (possibly a tombstone), nullptr if the key was never written
+  const Entry *Get(const std::string &key) const;
+
+  // same as Get, also filling splice so that an absent key can be inserted without searching again
+  Entry *Find(const std::string &key, Splice &splice);
+
+  // add an entry for the key Find did not find, with the memtable unchanged since
+  void Insert(const Splice &splice, const std::string &key, int64_t value, bool deleted);
+
+  Iterator Begin() const { return Iterator(head_->next[0]); }
+
+  // first entry not less than key (greater than key unless inclusive)
+  Iterator Seek(const std::string &key, bool inclusive) const;
+
+  size_t GetSize() const { return size_; }
+
+  // memory taken by the entries, the flush threshold of the tree
+  size_t GetApproximateBytes() const { return bytes_; }
+
+ private:
+  // node of the given height with its entry, carved from the arena
+  Node *NewNode(int height, const std::string &key);
+
+  static uint64_t KeyPrefix(const std::string &key);
+
+  // compare the key of node with key, whose prefix is given
+  static int Compare(const Node *node, const std::string &key, uint64_t prefix);
+
+  // last node of every level whose key is less than key (not greater than key if !inclusive)
+  Node *FindPredecessors(const std::string &key, bool inclusive, Node **prev) const;
+
+  int RandomHeight();
+
+  // nodes live in large blocks, freed together with the memtable
+  std::vector<std::unique_ptr<char[]>> arena_;
+  size_t arena_used_{ARENA_BLOCK_SIZE};
+  Node *head_;
+  int height_{1};
+  size_t size_{0};
+  size_t bytes_{0};
+  std::minstd_rand rng_;
+};
+
+#endif  // MINISQL_LSM_MEMTABLE_H
@@ -0,0 +1,221 @@
+#ifndef MINISQL_LSM_TREE_H
+#define MINISQL_LSM_TREE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "buffer/buffer_pool_manager.h"
+#include "common/rowid.h"
+#include "storage/bloom_filter.h"
+#include "storage/lsm_memtable.h"
+
+/**
+ * Log-structured merge tree over byte string keys (compared with memcmp),
+ * mapping every key to one row id. Writes never touch pages in place:
+ * - Inserts and removes go to an in-memory skip list (LsmMemTable). Once it
+ *   holds LSM_MEMTABLE_SIZE bytes it becomes immutable and a background
+ *   thread writes it out, front to back, as a sorted run of new pages.
+ * - Runs live in levels. Level 0 collects the flushed runs, which may
+ *   overlap. Every other level is a single run LSM_LEVEL_SIZE_RATIO times as
+ *   large as the level above. The background thread merges level 0 into
+ *   level 1 once it has LSM_L0_COMPACTION_TRIGGER runs, and a level that
+ *   grew past its size into the next one (leveled compaction).
+ * - Every run keeps a Bloom filter and the first key of each of its pages in
+ *   memory, so a lookup reads at most one page of each run that may hold the
+ *   key, and usually none of the runs that do not.
+ * Newer components hide older ones: memtable, immutable memtable, level 0
+ * newest first, then levels 1, 2, ... Removes are tombstones until they are
+ * merged into the last level.
+ *
+ * The runs are listed in a manifest page (LsmManifestPage) recorded in the
+ * index roots page. The memtable is flushed when the tree is closed, it is
+ * not logged.
+ *
+ * Concurrency: lookups and scans hold latch_ shared, writers hold it
+ * exclusively. Flushes and compactions run on two background threads, they
+ * read their inputs without the latch (runs and the immutable memtable never
+ * change) and hold it only to install their output. A writer that fills the
+ * memtable while the previous one is still being flushed, or while level 0
+ * has LSM_L0_STOP_WRITES_TRIGGER runs, waits.
+ */
+class LsmTree {
+ public:
+  using Entry = LsmRunPage::Entry;
+
+  struct Stats {
+    size_t memtable_entries{0};
+    // runs and entries of each level, tombstones included
+    std::vector<size_t> level_runs;
+    std::vector<uint64_t> level_entries;
+    std::vector<uint64_t> level_pages;
+    uint64_t flushes{0};
+    uint64_t compactions{0};
+    // run lookups answered by a Bloom filter without reading a page
+    uint64_t bloom_skips{0};
+    size_t bloom_bytes{0};
+  };
+
+  // longest key accepted
+  static constexpr size_t MAX_KEY_SIZE = LsmRunPage::CAPACITY / 4;
+
+  LsmTree(index_id_t index_id, BufferPoolManager *buffer_pool_manager);
+
+  // flushes the memtable so that the tree can be reopened
+  ~LsmTree();
+
+  // Insert a key-value pair, return false on a duplicate key or a key longer than MAX_KEY_SIZE.
+  bool Insert(const std::string &key, const RowId &value);
+
+  // Remove a key and its value, return false if the key does not exist.
+  bool Remove(const std::string &key);
+
+  // return the value associated with a given key
+  bool GetValue(const std::string &key, RowId &value);
+
+  // append up to max_count live entries in key order, starting at the first key not less than
+  // from (greater than from unless inclusive)
+  void Scan(const std::string &from, bool inclusive, size_t max_count, std::vector<Entry> &entries);
+
+  // write the memtable out and wait until no flush or compaction is pending
+  void Flush();
+
+  Stats GetStats();
+
+  // release every page of the tree, including its record in the index roots page
+  void Destroy();
+
+ private:
+  // immutable sorted run stored as a chain of LsmRunPage
+  struct Run {
+    std::vector<page_id_t> pages;
+    // first key of every page
+    std::vector<std::string> fences;
+    std::string max_key;
+    uint64_t entries{0};
+    BloomFilter bloom;
+  };
+
+  // reads a run in key order, one page at a time
+  class RunIterator {
+   public:
+    RunIterator(BufferPoolManager *buffer_pool_manager, const Run *run)
+        : buffer_pool_manager_(buffer_pool_manager), run_(run) {}
+
+    // position at the first entry not less than key (greater than key unless inclusive)
+    void Seek(const std::string &key, bool inclusive);
+
+    void SeekToFirst();
+
+    bool Valid() const { return pos_ < entries_.size(); }
+
+    const Entry &Get() const { return entries_[pos_]; }
+
+    void Next();
+
+   private:
+    void LoadPage(size_t page_index);
+
+    BufferPoolManager *buffer_pool_manager_;
+    const Run *run_;
+    size_t page_index_{0};
+    std::vector<Entry> entries_;
+    size_t pos_{0};
+  };
+
+  // builds a run from entries appended in key order
+  class RunWriter {
+   public:
+    explicit RunWriter(BufferPoolManager *buffer_pool_manager) : buffer_pool_manager_(buffer_pool_manager) {}
+
+    void Append(const Entry &entry);
+
+    // finish the last page, nullptr if nothing was appended
+    std::shared_ptr<Run> Finish();
+
+   private:
+    BufferPoolManager *buffer_pool_manager_;
+    std::shared_ptr<Run> run_{std::make_shared<Run>()};
+    LsmRunPage *page_{nullptr};
+    std::vector<uint64_t> hashes_;
+  };
+
+  // one input of a merge, a memtable or a run
+  struct Source {
+    LsmMemTable::Iterator mem{nullptr};
+    std::unique_ptr<RunIterator> run;
+
+    bool Valid() const { return run != nullptr ? run->Valid() : mem.Valid(); }
+
+    const Entry &Get() const { return run != nullptr ? run->Get() : *mem; }
+
+    void Next() { run != nullptr ? run->Next() : mem.Next(); }
+  };
+
+  // take the smallest key of the sources (given newest first) and move them all past it,
+  // entry receives its newest version, false once every source is exhausted
+  static bool NextMerged(std::vector<Source> &sources, Entry &entry);
+
+  // entry of key in the memtables and runs, tombstones included, false if none has it
+  bool Find(const std::string &key, Entry &entry, bool skip_memtable = false);
+
+  // look key up in one run
+  bool FindInRun(const Run &run, const std::string &key, uint64_t hash, Entry &entry);
+
+  // with latch_ held exclusively, turn a full memtable immutable, waiting for the previous one to be flushed
+  void RotateMemTable(std::unique_lock<std::shared_mutex> &guard);
+
+  // rebuild a run from its pages when the tree is opened
+  std::shared_ptr<Run> LoadRun(page_id_t first_page_id);
+
+  // background thread writing out the immutable memtable
+  void FlushWork();
+
+  // background thread merging levels that grew too large, so that flushes never wait for a compaction
+  void CompactionWork();
+
+  // with latch_ held, the level that should be merged into the next one, -1 if none
+  int PickCompaction() const;
+
+  void FlushImmutable();
+
+  // merge level into the next one, called and returning with guard locked
+  void Compact(int level, std::unique_lock<std::shared_mutex> &guard);
+
+  // rewrite the manifest page with the current runs, with latch_ held
+  void SaveManifest();
+
+  void DeleteRun(const Run &run);
+
+  void UpdateRootPageId(bool insert_record);
+
+  void StartBackground();
+
+  void StopBackground();
+
+  index_id_t index_id_;
+  BufferPoolManager *buffer_pool_manager_;
+  page_id_t manifest_page_id_{INVALID_PAGE_ID};
+  // shared by lookups and scans, exclusive for writers and for installing flushes and compactions
+  std::shared_mutex latch_;
+  // signalled when there is work for the background threads, and when they finished some
+  std::condition_variable_any work_cv_;
+  std::condition_variable_any done_cv_;
+  std::unique_ptr<LsmMemTable> memtable_;
+  std::unique_ptr<LsmMemTable> immutable_;
+  // levels_[0] newest run first, every other level holds at most one run
+  std::vector<std::vector<std::shared_ptr<Run>>> levels_;
+  bool compacting_{false};
+  bool stop_{false};
+  uint64_t flushes_{0};
+  uint64_t compactions_{0};
+  std::atomic<uint64_t> bloom_skips_{0};
+  std::thread flush_thread_;
+  std::thread compaction_thread_;
+};
+
+#endif  // MINISQL_LSM_TREE_H
@@ -0,0 +1,56 @@
+#ifndef MINISQL_ROW_ID_BITMAP_H
+#define MINISQL_ROW_ID_BITMAP_H
+
+#include <map>
+#include <vector>
+
+#include "common/rowid.h"
+
+/**
+ * Set of row ids grouped by heap page. Every page with a member row keeps a
+ * bitmap of its slot numbers, pages are visited in ascending page id order.
+ *
+ * Index scans collect row ids into it so the heap can be read one page at a
+ * time, and the row ids of several predicates are combined by intersecting or
+ * uniting the bitmaps page by page instead of sorting row id vectors.
+ */
+class RowIdBitmap {
+ public:
+  using PageMap = std::map<page_id_t, std::vector<uint64_t>>;
+  using ConstIterator = PageMap::const_iterator;
+
+  void Add(const RowId &rid);
+
+  bool Contains(const RowId &rid) const;
+
+  // keep only the row ids that are also in other
+  void Intersect(const RowIdBitmap &other);
+
+  // add all row ids of other
+  void Union(const RowIdBitmap &other);
+
+  void Clear() { pages_.clear(); }
+
+  bool Empty() const { return pages_.empty(); }
+
+  // number of row ids
+  size_t Size() const;
+
+  size_t PageCount() const { return pages_.size(); }
+
+  ConstIterator Begin() const { return pages_.begin(); }
+
+  ConstIterator End() const { return pages_.end(); }
+
+  // append the slot numbers set in the bitmap of a page to slots, in ascending order
+  static void DecodeSlots(const std::vector<uint64_t> &words, std::vector<uint32_t> &slots);
+
+  // all row ids in page order
+  std::vector<RowId> ToRowIds() const;
+
+ private:
+  // pages without any slot set are never kept
+  PageMap pages_;
+};
+
+#endif  // MINISQL_ROW_ID_BITMAP_H
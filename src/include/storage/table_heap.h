@@ -70,6 +70,24 @@ class TableHeap {
    */
   bool GetTuple(Row *row, Txn *txn);
 
+  /**
+   * Read several tuples of one page, the page is fetched and latched once.
+   * @param[in] page_id Page holding the tuples
+   * @param[in] slots Slot numbers of the tuples
+   * @param[out] rows The tuples that exist are appended in slot order
+   * @param[in] txn recovery performing the read
+   */
+  void GetTuples(page_id_t page_id, const std::vector<uint32_t> &slots, std::vector<Row> &rows, Txn *txn);
+
+  /**
+   * Scan the table into a batch, a page is fetched and latched once for all the tuples read from it.
+   * @param[in/out] position Page and slot of the next tuple to read, RowId(GetFirstPageId(), 0) to start a scan
+   * @param[out] batch Columns of the table schema, the live tuples are appended until it is full
+   * @param[in] txn recovery performing the read
+   * @return false if the scan was already at the end of the table
+   */
+  bool ScanBatch(RowId &position, RowBatch &batch, Txn *txn);
+
   void FreeTableHeap() { //�ͷű��ѵ�����ҳ��
     auto next_page_id = first_page_id_;
     while (next_page_id != INVALID_PAGE_ID) {
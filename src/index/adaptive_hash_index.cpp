@@ -0,0 +1,120 @@
+#include "index/adaptive_hash_index.h"
+
+#include <mutex>
+
+template <typename KeyType>
+void AdaptiveHashIndex<KeyType>::SetEnabled(bool enabled) {
+  enabled_ = enabled;
+  if (!enabled) {
+    Clear();
+  }
+}
+
+template <typename KeyType>
+bool AdaptiveHashIndex<KeyType>::Lookup(const KeyType &key, Location &location) {
+  std::shared_lock<std::shared_mutex> guard(latch_);
+  auto entry = entries_.find(key);
+  if (entry == entries_.end()) {
+    return false;
+  }
+  auto page = pages_.find(entry->second.location.page_id);
+  if (page == pages_.end() || !page->second.hashed || page->second.generation != entry->second.generation) {
+    return false;
+  }
+  location = entry->second.location;
+  return true;
+}
+
+template <typename KeyType>
+typename AdaptiveHashIndex<KeyType>::LeafState AdaptiveHashIndex<KeyType>::RecordDescent(page_id_t page_id) {
+  misses_++;
+  std::unique_lock<std::shared_mutex> guard(latch_);
+  PageState &page = pages_[page_id];
+  if (page.hashed) {
+    return LeafState::kHashed;
+  }
+  return ++page.accesses >= ADAPTIVE_HASH_BUILD_THRESHOLD ? LeafState::kBuild : LeafState::kCold;
+}
+
+template <typename KeyType>
+void AdaptiveHashIndex<KeyType>::AddPage(page_id_t page_id, const std::vector<KeyType> &keys) {
+  std::unique_lock<std::shared_mutex> guard(latch_);
+  if (entries_.size() + keys.size() > ADAPTIVE_HASH_MAX_ENTRIES) {
+    Reset();
+  }
+  PageState &page = pages_[page_id];
+  page.hashed = true;
+  for (size_t i = 0; i < keys.size(); i++) {
+    entries_[keys[i]] = {{page_id, static_cast<int>(i)}, page.generation};
+  }
+}
+
+template <typename KeyType>
+void AdaptiveHashIndex<KeyType>::Add(const KeyType &key, page_id_t page_id, int slot) {
+  std::unique_lock<std::shared_mutex> guard(latch_);
+  auto page = pages_.find(page_id);
+  if (page == pages_.end() || !page->second.hashed) {
+    return;
+  }
+  entries_[key] = {{page_id, slot}, page->second.generation};
+}
+
+template <typename KeyType>
+void AdaptiveHashIndex<KeyType>::Remove(const KeyType &key) {
+  std::unique_lock<std::shared_mutex> guard(latch_);
+  entries_.erase(key);
+}
+
+template <typename KeyType>
+void AdaptiveHashIndex<KeyType>::InvalidatePage(page_id_t page_id) {
+  std::unique_lock<std::shared_mutex> guard(latch_);
+  auto page = pages_.find(page_id);
+  if (page == pages_.end()) {
+    return;
+  }
+  // entries of the page are left behind, Lookup ignores them and lookups overwrite them
+  page->second.generation++;
+  page->second.hashed = false;
+  page->second.accesses = 0;
+}
+
+template <typename KeyType>
+void AdaptiveHashIndex<KeyType>::Clear() {
+  std::unique_lock<std::shared_mutex> guard(latch_);
+  Reset();
+}
+
+template <typename KeyType>
+void AdaptiveHashIndex<KeyType>::Reset() {
+  entries_.clear();
+  // keep the generations, a location read before the reset must not become valid again
+  for (auto &page : pages_) {
+    page.second.generation++;
+    page.second.hashed = false;
+    page.second.accesses = 0;
+  }
+}
+
+template <typename KeyType>
+typename AdaptiveHashIndex<KeyType>::Stats AdaptiveHashIndex<KeyType>::GetStats() {
+  std::shared_lock<std::shared_mutex> guard(latch_);
+  Stats stats;
+  stats.hits = hits_;
+  stats.misses = misses_;
+  stats.entries = entries_.size();
+  for (const auto &page : pages_) {
+    stats.hashed_pages += page.second.hashed ? 1 : 0;
+  }
+  // nodes hold the value and the next pointer, each bucket one more pointer
+  stats.memory_bytes = entries_.size() * (sizeof(typename decltype(entries_)::value_type) + sizeof(void *)) +
+                       entries_.bucket_count() * sizeof(void *) +
+                       pages_.size() * (sizeof(typename decltype(pages_)::value_type) + sizeof(void *)) +
+                       pages_.bucket_count() * sizeof(void *);
+  return stats;
+}
+
+template class AdaptiveHashIndex<int32_t>;
+
+template class AdaptiveHashIndex<int64_t>;
+
+template class AdaptiveHashIndex<float>;
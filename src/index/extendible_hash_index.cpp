@@ -0,0 +1,81 @@
+#include "index/extendible_hash_index.h"
+
+#include <cstring>
+
+ExtendibleHashIndex::ExtendibleHashIndex(index_id_t index_id, IndexSchema *key_schema, size_t key_size,
+                                         BufferPoolManager *buffer_pool_manager)
+    : Index(index_id, key_schema),
+      processor_(key_schema_, key_size),
+      container_(index_id, buffer_pool_manager, key_size) {}
+
+GenericKey *ExtendibleHashIndex::MakeKey(const Row &key) const {
+  for (uint32_t i = 0; i < key.GetFieldCount(); i++) {
+    if (key.GetField(i)->IsNull()) {
+      return nullptr;
+    }
+  }
+  GenericKey *index_key = processor_.InitKey();
+  processor_.SerializeFromKey(index_key, key, key_schema_);
+  return index_key;
+}
+
+dberr_t ExtendibleHashIndex::InsertEntry(const Row &key, RowId row_id, [[maybe_unused]] Txn *txn) {
+  GenericKey *index_key = MakeKey(key);
+  if (index_key == nullptr) {
+    return DB_FAILED;
+  }
+  dberr_t status = container_.Insert(index_key, row_id);
+  free(index_key);
+  return status == DB_SUCCESS ? DB_SUCCESS : DB_FAILED;
+}
+
+/*
+ * Removing a key the index does not hold succeeds, only a page that cannot
+ * be fetched fails.
+ */
+dberr_t ExtendibleHashIndex::RemoveEntry(const Row &key, [[maybe_unused]] RowId row_id, [[maybe_unused]] Txn *txn) {
+  GenericKey *index_key = MakeKey(key);
+  if (index_key == nullptr) {
+    return DB_SUCCESS;
+  }
+  dberr_t status = container_.Remove(index_key);
+  free(index_key);
+  return status == DB_FAILED ? DB_FAILED : DB_SUCCESS;
+}
+
+dberr_t ExtendibleHashIndex::ScanKey(const Row &key, vector<RowId> &result, [[maybe_unused]] Txn *txn,
+                                     string compare_operator) {
+  if (compare_operator != "=") {
+    return DB_FAILED;
+  }
+  GenericKey *index_key = MakeKey(key);
+  if (index_key == nullptr) {
+    return DB_KEY_NOT_FOUND;
+  }
+  dberr_t status = container_.GetValue(index_key, result);
+  free(index_key);
+  return status;
+}
+
+/*
+ * The planner only hands equality predicates to a hash index, which reach
+ * here as a range whose bounds are the same key.
+ */
+std::unique_ptr<IndexCursor> ExtendibleHashIndex::ScanRange(const IndexRange &range, [[maybe_unused]] Txn *txn) {
+  std::vector<RowId> result;
+  if (range.lower != nullptr && range.upper != nullptr && range.lower_inclusive && range.upper_inclusive) {
+    bool same = range.upper == range.lower;
+    GenericKey *lower = MakeKey(*range.lower);
+    GenericKey *upper = same ? nullptr : MakeKey(*range.upper);
+    if (lower != nullptr && (same || (upper != nullptr && memcmp(lower, upper, processor_.GetKeySize()) == 0))) {
+      container_.GetValue(lower, result);
+    }
+    free(lower);
+    free(upper);
+  }
+  return std::make_unique<VectorIndexCursor>(std::move(result));
+}
+
+dberr_t ExtendibleHashIndex::Destroy() {
+  return container_.Destroy();
+}
@@ -0,0 +1,389 @@
+#include "index/extendible_hash_table.h"
+
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string_view>
+
+#include "glog/logging.h"
+#include "page/index_roots_page.h"
+
+ExtendibleHashTable::ExtendibleHashTable(index_id_t index_id, BufferPoolManager *buffer_pool_manager,
+                                         uint32_t key_size)
+    : index_id_(index_id), buffer_pool_manager_(buffer_pool_manager), key_size_(key_size) {
+  Page *roots_page = buffer_pool_manager_->FetchPage(INDEX_ROOTS_PAGE_ID);
+  if (roots_page == nullptr) {
+    throw std::runtime_error("out of memory");
+  }
+  auto *roots = reinterpret_cast<IndexRootsPage *>(roots_page->GetData());
+  roots_page->WLatch();
+  if (!roots->GetRootId(index_id_, &header_page_id_)) {
+    // a new table starts with an empty header page, directories come with the first keys
+    Page *page = buffer_pool_manager_->NewPage(header_page_id_);
+    if (page == nullptr) {
+      roots_page->WUnlatch();
+      buffer_pool_manager_->UnpinPage(INDEX_ROOTS_PAGE_ID, false);
+      throw std::runtime_error("out of memory");
+    }
+    reinterpret_cast<HashTableHeaderPage *>(page->GetData())->Init(header_page_id_);
+    buffer_pool_manager_->UnpinPage(header_page_id_, true);
+    roots->Insert(index_id_, header_page_id_);
+  }
+  roots_page->WUnlatch();
+  buffer_pool_manager_->UnpinPage(INDEX_ROOTS_PAGE_ID, true);
+}
+
+uint32_t ExtendibleHashTable::Hash(const GenericKey *key) const {
+  uint64_t hash = std::hash<std::string_view>()(std::string_view(KeyData(key), key_size_));
+  return static_cast<uint32_t>(hash ^ (hash >> 32));
+}
+
+/*
+ * Throw an "out of memory" exception if the buffer pool cannot provide a page.
+ */
+HashTableBucketPage *ExtendibleHashTable::NewBucketPage(page_id_t &page_id) {
+  Page *page = buffer_pool_manager_->NewPage(page_id);
+  if (page == nullptr) {
+    throw std::runtime_error("out of memory");
+  }
+  auto *bucket = reinterpret_cast<HashTableBucketPage *>(page->GetData());
+  bucket->Init(page_id, key_size_);
+  return bucket;
+}
+
+/*
+ * Creating a directory writes the header page, so create must only be set
+ * while table_latch_ is held exclusively.
+ */
+dberr_t ExtendibleHashTable::FetchDirectory(uint32_t hash, bool create, HashTableDirectoryPage *&directory) {
+  directory = nullptr;
+  Page *header_page = buffer_pool_manager_->FetchPage(header_page_id_);
+  if (header_page == nullptr) {
+    return DB_FAILED;
+  }
+  auto *header = reinterpret_cast<HashTableHeaderPage *>(header_page->GetData());
+  uint32_t directory_idx = HashTableHeaderPage::HashToDirectoryIndex(hash);
+  page_id_t directory_page_id = header->GetDirectoryPageId(directory_idx);
+  if (directory_page_id != INVALID_PAGE_ID) {
+    Page *page = buffer_pool_manager_->FetchPage(directory_page_id);
+    if (page == nullptr) {
+      buffer_pool_manager_->UnpinPage(header_page_id_, false);
+      return DB_FAILED;
+    }
+    directory = reinterpret_cast<HashTableDirectoryPage *>(page->GetData());
+  } else if (create) {
+    page_id_t bucket_page_id;
+    NewBucketPage(bucket_page_id);
+    buffer_pool_manager_->UnpinPage(bucket_page_id, true);
+    Page *page = buffer_pool_manager_->NewPage(directory_page_id);
+    if (page == nullptr) {
+      throw std::runtime_error("out of memory");
+    }
+    directory = reinterpret_cast<HashTableDirectoryPage *>(page->GetData());
+    directory->Init(directory_page_id, bucket_page_id);
+    header->SetDirectoryPageId(directory_idx, directory_page_id);
+  }
+  buffer_pool_manager_->UnpinPage(header_page_id_, create);
+  return DB_SUCCESS;
+}
+
+/*****************************************************************************
+ * SEARCH
+ *****************************************************************************/
+dberr_t ExtendibleHashTable::GetValue(const GenericKey *key, std::vector<RowId> &result) {
+  std::shared_lock<std::shared_mutex> table_guard(table_latch_);
+  uint32_t hash = Hash(key);
+  HashTableDirectoryPage *directory;
+  if (FetchDirectory(hash, false, directory) != DB_SUCCESS) {
+    return DB_FAILED;
+  }
+  if (directory == nullptr) {
+    return DB_KEY_NOT_FOUND;
+  }
+  page_id_t bucket_page_id = directory->GetBucketPageId(directory->HashToBucketIndex(hash));
+  buffer_pool_manager_->UnpinPage(directory->GetPageId(), false);
+  Page *bucket_page = buffer_pool_manager_->FetchPage(bucket_page_id);
+  if (bucket_page == nullptr) {
+    return DB_FAILED;
+  }
+  bucket_page->RLatch();
+  RowId value;
+  bool found = reinterpret_cast<HashTableBucketPage *>(bucket_page->GetData())->Lookup(KeyData(key), value);
+  bucket_page->RUnlatch();
+  buffer_pool_manager_->UnpinPage(bucket_page_id, false);
+  if (!found) {
+    return DB_KEY_NOT_FOUND;
+  }
+  result.emplace_back(value);
+  return DB_SUCCESS;
+}
+
+uint32_t ExtendibleHashTable::GetGlobalDepth(const GenericKey *key) {
+  std::shared_lock<std::shared_mutex> table_guard(table_latch_);
+  HashTableDirectoryPage *directory;
+  if (FetchDirectory(Hash(key), false, directory) != DB_SUCCESS || directory == nullptr) {
+    return 0;
+  }
+  uint32_t global_depth = directory->GetGlobalDepth();
+  buffer_pool_manager_->UnpinPage(directory->GetPageId(), false);
+  return global_depth;
+}
+
+/*****************************************************************************
+ * INSERTION
+ *****************************************************************************/
+/*
+ * Insert into the bucket under the shared table latch, fall back to
+ * SplitInsert when the bucket (or its directory) has to be created or split.
+ */
+dberr_t ExtendibleHashTable::Insert(const GenericKey *key, const RowId &value) {
+  {
+    std::shared_lock<std::shared_mutex> table_guard(table_latch_);
+    uint32_t hash = Hash(key);
+    HashTableDirectoryPage *directory;
+    if (FetchDirectory(hash, false, directory) != DB_SUCCESS) {
+      return DB_FAILED;
+    }
+    if (directory != nullptr) {
+      page_id_t bucket_page_id = directory->GetBucketPageId(directory->HashToBucketIndex(hash));
+      buffer_pool_manager_->UnpinPage(directory->GetPageId(), false);
+      Page *bucket_page = buffer_pool_manager_->FetchPage(bucket_page_id);
+      if (bucket_page == nullptr) {
+        return DB_FAILED;
+      }
+      bucket_page->WLatch();
+      auto *bucket = reinterpret_cast<HashTableBucketPage *>(bucket_page->GetData());
+      RowId exist;
+      bool duplicate = bucket->Lookup(KeyData(key), exist);
+      bool inserted = !duplicate && bucket->Insert(KeyData(key), value);
+      bucket_page->WUnlatch();
+      buffer_pool_manager_->UnpinPage(bucket_page_id, inserted);
+      if (duplicate) {
+        return DB_ALREADY_EXIST;
+      }
+      if (inserted) {
+        return DB_SUCCESS;
+      }
+    }
+  }
+  return SplitInsert(key, value);
+}
+
+/*
+ * Split the bucket of key until it has room, doubling the directory whenever
+ * the bucket is already at the global depth.
+ */
+dberr_t ExtendibleHashTable::SplitInsert(const GenericKey *key, const RowId &value) {
+  std::unique_lock<std::shared_mutex> table_guard(table_latch_);
+  uint32_t hash = Hash(key);
+  HashTableDirectoryPage *directory;
+  if (FetchDirectory(hash, true, directory) != DB_SUCCESS) {
+    return DB_FAILED;
+  }
+  dberr_t status = DB_FAILED;
+  while (true) {
+    uint32_t bucket_idx = directory->HashToBucketIndex(hash);
+    page_id_t bucket_page_id = directory->GetBucketPageId(bucket_idx);
+    Page *bucket_page = buffer_pool_manager_->FetchPage(bucket_page_id);
+    if (bucket_page == nullptr) {
+      break;
+    }
+    auto *bucket = reinterpret_cast<HashTableBucketPage *>(bucket_page->GetData());
+    RowId exist;
+    if (bucket->Lookup(KeyData(key), exist)) {
+      buffer_pool_manager_->UnpinPage(bucket_page_id, false);
+      status = DB_ALREADY_EXIST;
+      break;
+    }
+    if (!bucket->IsFull()) {
+      status = bucket->Insert(KeyData(key), value) ? DB_SUCCESS : DB_FAILED;
+      buffer_pool_manager_->UnpinPage(bucket_page_id, true);
+      break;
+    }
+    buffer_pool_manager_->UnpinPage(bucket_page_id, false);
+    if (directory->GetLocalDepth(bucket_idx) == directory->GetGlobalDepth()) {
+      if (directory->GetGlobalDepth() == HASH_TABLE_DIRECTORY_MAX_DEPTH) {
+        LOG(ERROR) << "Hash index directory is full, too many keys share a hash prefix";
+        break;
+      }
+      directory->IncrGlobalDepth();
+    }
+    if (!SplitBucket(directory, bucket_idx)) {
+      break;
+    }
+  }
+  buffer_pool_manager_->UnpinPage(directory->GetPageId(), true);
+  return status;
+}
+
+/*
+ * Move the entries of the bucket whose new local depth bit is set into a new
+ * bucket, and point the directory slots with that bit at it.
+ * @return: false if the bucket page cannot be fetched, the directory is then unchanged
+ */
+bool ExtendibleHashTable::SplitBucket(HashTableDirectoryPage *directory, uint32_t bucket_idx) {
+  page_id_t bucket_page_id = directory->GetBucketPageId(bucket_idx);
+  Page *bucket_page = buffer_pool_manager_->FetchPage(bucket_page_id);
+  if (bucket_page == nullptr) {
+    return false;
+  }
+  uint32_t local_depth = directory->GetLocalDepth(bucket_idx);
+  uint32_t high_bit = 1U << local_depth;
+  page_id_t image_page_id;
+  HashTableBucketPage *image = NewBucketPage(image_page_id);
+  for (uint32_t i = 0; i < directory->Size(); i++) {
+    if (directory->GetBucketPageId(i) == bucket_page_id) {
+      directory->SetLocalDepth(i, local_depth + 1);
+      if (i & high_bit) {
+        directory->SetBucketPageId(i, image_page_id);
+      }
+    }
+  }
+  bucket_page->WLatch();
+  auto *bucket = reinterpret_cast<HashTableBucketPage *>(bucket_page->GetData());
+  for (uint32_t i = 0; i < bucket->GetSize();) {
+    auto *entry_key = reinterpret_cast<const GenericKey *>(bucket->KeyAt(i));
+    if (Hash(entry_key) & high_bit) {
+      image->Insert(bucket->KeyAt(i), bucket->ValueAt(i));
+      bucket->RemoveAt(i);
+    } else {
+      i++;
+    }
+  }
+  bucket_page->WUnlatch();
+  buffer_pool_manager_->UnpinPage(bucket_page_id, true);
+  buffer_pool_manager_->UnpinPage(image_page_id, true);
+  return true;
+}
+
+/*****************************************************************************
+ * REMOVE
+ *****************************************************************************/
+dberr_t ExtendibleHashTable::Remove(const GenericKey *key) {
+  bool removed = false;
+  bool empty = false;
+  {
+    std::shared_lock<std::shared_mutex> table_guard(table_latch_);
+    uint32_t hash = Hash(key);
+    HashTableDirectoryPage *directory;
+    if (FetchDirectory(hash, false, directory) != DB_SUCCESS) {
+      return DB_FAILED;
+    }
+    if (directory == nullptr) {
+      return DB_KEY_NOT_FOUND;
+    }
+    page_id_t bucket_page_id = directory->GetBucketPageId(directory->HashToBucketIndex(hash));
+    buffer_pool_manager_->UnpinPage(directory->GetPageId(), false);
+    Page *bucket_page = buffer_pool_manager_->FetchPage(bucket_page_id);
+    if (bucket_page == nullptr) {
+      return DB_FAILED;
+    }
+    bucket_page->WLatch();
+    auto *bucket = reinterpret_cast<HashTableBucketPage *>(bucket_page->GetData());
+    removed = bucket->Remove(KeyData(key));
+    empty = bucket->IsEmpty();
+    bucket_page->WUnlatch();
+    buffer_pool_manager_->UnpinPage(bucket_page_id, removed);
+  }
+  if (!removed) {
+    return DB_KEY_NOT_FOUND;
+  }
+  // the key is gone either way, a bucket that could not be merged stays empty
+  if (empty) {
+    Merge(key);
+  }
+  return DB_SUCCESS;
+}
+
+/*
+ * Fold an empty bucket into its split image when both have the same local
+ * depth, then shrink the directory as far as possible.
+ */
+void ExtendibleHashTable::Merge(const GenericKey *key) {
+  std::unique_lock<std::shared_mutex> table_guard(table_latch_);
+  uint32_t hash = Hash(key);
+  HashTableDirectoryPage *directory;
+  if (FetchDirectory(hash, false, directory) != DB_SUCCESS || directory == nullptr) {
+    return;
+  }
+  uint32_t bucket_idx = directory->HashToBucketIndex(hash);
+  uint32_t local_depth = directory->GetLocalDepth(bucket_idx);
+  page_id_t bucket_page_id = directory->GetBucketPageId(bucket_idx);
+  Page *bucket_page = buffer_pool_manager_->FetchPage(bucket_page_id);
+  bool empty = false;
+  if (bucket_page != nullptr) {
+    empty = reinterpret_cast<HashTableBucketPage *>(bucket_page->GetData())->IsEmpty();
+    buffer_pool_manager_->UnpinPage(bucket_page_id, false);
+  }
+  uint32_t image_idx = local_depth > 0 ? directory->GetSplitImageIndex(bucket_idx) : bucket_idx;
+  if (!empty || local_depth == 0 || directory->GetLocalDepth(image_idx) != local_depth) {
+    // refilled by a concurrent insert, unreadable, or the image is split further
+    buffer_pool_manager_->UnpinPage(directory->GetPageId(), false);
+    return;
+  }
+  page_id_t image_page_id = directory->GetBucketPageId(image_idx);
+  for (uint32_t i = 0; i < directory->Size(); i++) {
+    page_id_t page_id = directory->GetBucketPageId(i);
+    if (page_id == bucket_page_id || page_id == image_page_id) {
+      directory->SetBucketPageId(i, image_page_id);
+      directory->SetLocalDepth(i, local_depth - 1);
+    }
+  }
+  while (directory->CanShrink()) {
+    directory->DecrGlobalDepth();
+  }
+  buffer_pool_manager_->UnpinPage(directory->GetPageId(), true);
+  buffer_pool_manager_->DeletePage(bucket_page_id);
+}
+
+/*
+ * Must not run concurrently with other operations on this table. A directory
+ * that cannot be fetched fails the call with the directories before it
+ * released and cleared from the header, so calling it again resumes there.
+ */
+dberr_t ExtendibleHashTable::Destroy() {
+  std::unique_lock<std::shared_mutex> table_guard(table_latch_);
+  if (header_page_id_ == INVALID_PAGE_ID) {
+    return DB_SUCCESS;
+  }
+  Page *header_page = buffer_pool_manager_->FetchPage(header_page_id_);
+  if (header_page == nullptr) {
+    return DB_FAILED;
+  }
+  auto *header = reinterpret_cast<HashTableHeaderPage *>(header_page->GetData());
+  for (uint32_t directory_idx = 0; directory_idx < HASH_TABLE_HEADER_ARRAY_SIZE; directory_idx++) {
+    page_id_t directory_page_id = header->GetDirectoryPageId(directory_idx);
+    if (directory_page_id == INVALID_PAGE_ID) {
+      continue;
+    }
+    Page *directory_page = buffer_pool_manager_->FetchPage(directory_page_id);
+    if (directory_page == nullptr) {
+      buffer_pool_manager_->UnpinPage(header_page_id_, true);
+      return DB_FAILED;
+    }
+    auto *directory = reinterpret_cast<HashTableDirectoryPage *>(directory_page->GetData());
+    std::set<page_id_t> bucket_page_ids;
+    for (uint32_t i = 0; i < directory->Size(); i++) {
+      bucket_page_ids.insert(directory->GetBucketPageId(i));
+    }
+    buffer_pool_manager_->UnpinPage(directory_page_id, false);
+    for (auto bucket_page_id : bucket_page_ids) {
+      buffer_pool_manager_->DeletePage(bucket_page_id);
+    }
+    buffer_pool_manager_->DeletePage(directory_page_id);
+    header->SetDirectoryPageId(directory_idx, INVALID_PAGE_ID);
+  }
+  Page *roots_page = buffer_pool_manager_->FetchPage(INDEX_ROOTS_PAGE_ID);
+  if (roots_page == nullptr) {
+    buffer_pool_manager_->UnpinPage(header_page_id_, true);
+    return DB_FAILED;
+  }
+  roots_page->WLatch();
+  reinterpret_cast<IndexRootsPage *>(roots_page->GetData())->Delete(index_id_);
+  roots_page->WUnlatch();
+  buffer_pool_manager_->UnpinPage(INDEX_ROOTS_PAGE_ID, true);
+  buffer_pool_manager_->UnpinPage(header_page_id_, false);
+  buffer_pool_manager_->DeletePage(header_page_id_);
+  header_page_id_ = INVALID_PAGE_ID;
+  return DB_SUCCESS;
+}
@@ -0,0 +1,220 @@
+#include "index/key_search.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define KEY_SEARCH_X86
+#endif
+
+/*****************************************************************************
+ * SCALAR
+ *****************************************************************************/
+template <typename T>
+static int ScalarCountLess(const T *keys, int n, T key) {
+  int count = 0;
+  for (int i = 0; i < n; i++) {
+    count += keys[i] < key;
+  }
+  return count;
+}
+
+template <typename T>
+static int ScalarCountLessEqual(const T *keys, int n, T key) {
+  int count = 0;
+  for (int i = 0; i < n; i++) {
+    count += keys[i] <= key;
+  }
+  return count;
+}
+
+#ifdef KEY_SEARCH_X86
+/*****************************************************************************
+ * AVX2
+ *****************************************************************************/
+__attribute__((target("avx2"))) static int Avx2CountLess(const int32_t *keys, int n, int32_t key) {
+  const __m256i target = _mm256_set1_epi32(key);
+  int i = 0;
+  int count = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(keys + i));
+    count += __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(target, v))));
+  }
+  return count + ScalarCountLess(keys + i, n - i, key);
+}
+
+__attribute__((target("avx2"))) static int Avx2CountLessEqual(const int32_t *keys, int n, int32_t key) {
+  const __m256i target = _mm256_set1_epi32(key);
+  int i = 0;
+  int count = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(keys + i));
+    count += 8 - __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, target))));
+  }
+  return count + ScalarCountLessEqual(keys + i, n - i, key);
+}
+
+__attribute__((target("avx2"))) static int Avx2CountLess(const int64_t *keys, int n, int64_t key) {
+  const __m256i target = _mm256_set1_epi64x(key);
+  int i = 0;
+  int count = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(keys + i));
+    count += __builtin_popcount(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(target, v))));
+  }
+  return count + ScalarCountLess(keys + i, n - i, key);
+}
+
+__attribute__((target("avx2"))) static int Avx2CountLessEqual(const int64_t *keys, int n, int64_t key) {
+  const __m256i target = _mm256_set1_epi64x(key);
+  int i = 0;
+  int count = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(keys + i));
+    count += 4 - __builtin_popcount(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(v, target))));
+  }
+  return count + ScalarCountLessEqual(keys + i, n - i, key);
+}
+
+__attribute__((target("avx2"))) static int Avx2CountLess(const float *keys, int n, float key) {
+  const __m256 target = _mm256_set1_ps(key);
+  int i = 0;
+  int count = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256 v = _mm256_loadu_ps(keys + i);
+    count += __builtin_popcount(_mm256_movemask_ps(_mm256_cmp_ps(v, target, _CMP_LT_OQ)));
+  }
+  return count + ScalarCountLess(keys + i, n - i, key);
+}
+
+__attribute__((target("avx2"))) static int Avx2CountLessEqual(const float *keys, int n, float key) {
+  const __m256 target = _mm256_set1_ps(key);
+  int i = 0;
+  int count = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256 v = _mm256_loadu_ps(keys + i);
+    count += __builtin_popcount(_mm256_movemask_ps(_mm256_cmp_ps(v, target, _CMP_LE_OQ)));
+  }
+  return count + ScalarCountLessEqual(keys + i, n - i, key);
+}
+
+/*****************************************************************************
+ * SSE4.2
+ *****************************************************************************/
+__attribute__((target("sse4.2"))) static int Sse42CountLess(const int32_t *keys, int n, int32_t key) {
+  const __m128i target = _mm_set1_epi32(key);
+  int i = 0;
+  int count = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i));
+    count += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(v, target))));
+  }
+  return count + ScalarCountLess(keys + i, n - i, key);
+}
+
+__attribute__((target("sse4.2"))) static int Sse42CountLessEqual(const int32_t *keys, int n, int32_t key) {
+  const __m128i target = _mm_set1_epi32(key);
+  int i = 0;
+  int count = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i));
+    count += 4 - __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(v, target))));
+  }
+  return count + ScalarCountLessEqual(keys + i, n - i, key);
+}
+
+__attribute__((target("sse4.2"))) static int Sse42CountLess(const int64_t *keys, int n, int64_t key) {
+  const __m128i target = _mm_set1_epi64x(key);
+  int i = 0;
+  int count = 0;
+  for (; i + 2 <= n; i += 2) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i));
+    count += __builtin_popcount(_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(target, v))));
+  }
+  return count + ScalarCountLess(keys + i, n - i, key);
+}
+
+__attribute__((target("sse4.2"))) static int Sse42CountLessEqual(const int64_t *keys, int n, int64_t key) {
+  const __m128i target = _mm_set1_epi64x(key);
+  int i = 0;
+  int count = 0;
+  for (; i + 2 <= n; i += 2) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i));
+    count += 2 - __builtin_popcount(_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(v, target))));
+  }
+  return count + ScalarCountLessEqual(keys + i, n - i, key);
+}
+
+__attribute__((target("sse4.2"))) static int Sse42CountLess(const float *keys, int n, float key) {
+  const __m128 target = _mm_set1_ps(key);
+  int i = 0;
+  int count = 0;
+  for (; i + 4 <= n; i += 4) {
+    count += __builtin_popcount(_mm_movemask_ps(_mm_cmplt_ps(_mm_loadu_ps(keys + i), target)));
+  }
+  return count + ScalarCountLess(keys + i, n - i, key);
+}
+
+__attribute__((target("sse4.2"))) static int Sse42CountLessEqual(const float *keys, int n, float key) {
+  const __m128 target = _mm_set1_ps(key);
+  int i = 0;
+  int count = 0;
+  for (; i + 4 <= n; i += 4) {
+    count += __builtin_popcount(_mm_movemask_ps(_mm_cmple_ps(_mm_loadu_ps(keys + i), target)));
+  }
+  return count + ScalarCountLessEqual(keys + i, n - i, key);
+}
+#endif  // KEY_SEARCH_X86
+
+/*****************************************************************************
+ * DISPATCH
+ *****************************************************************************/
+KeySearch::Isa KeySearch::isa_ = KeySearch::DetectIsa();
+
+KeySearch::Isa KeySearch::DetectIsa() {
+#ifdef KEY_SEARCH_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return Isa::kAVX2;
+  }
+  if (__builtin_cpu_supports("sse4.2")) {
+    return Isa::kSSE42;
+  }
+#endif
+  return Isa::kScalar;
+}
+
+void KeySearch::SetIsa(Isa isa) {
+  Isa detected = DetectIsa();
+  isa_ = static_cast<int>(isa) <= static_cast<int>(detected) ? isa : detected;
+}
+
+#ifdef KEY_SEARCH_X86
+#define KEY_SEARCH_DISPATCH(Kernel, keys, n, key) \
+  switch (isa_) {                                 \
+    case Isa::kAVX2:                              \
+      return Avx2##Kernel(keys, n, key);          \
+    case Isa::kSSE42:                             \
+      return Sse42##Kernel(keys, n, key);         \
+    default:                                      \
+      return Scalar##Kernel(keys, n, key);        \
+  }
+#else
+#define KEY_SEARCH_DISPATCH(Kernel, keys, n, key) return Scalar##Kernel(keys, n, key);
+#endif
+
+int KeySearch::CountLess(const int32_t *keys, int n, int32_t key) { KEY_SEARCH_DISPATCH(CountLess, keys, n, key) }
+
+int KeySearch::CountLess(const int64_t *keys, int n, int64_t key) { KEY_SEARCH_DISPATCH(CountLess, keys, n, key) }
+
+int KeySearch::CountLess(const float *keys, int n, float key) { KEY_SEARCH_DISPATCH(CountLess, keys, n, key) }
+
+int KeySearch::CountLessEqual(const int32_t *keys, int n, int32_t key) {
+  KEY_SEARCH_DISPATCH(CountLessEqual, keys, n, key)
+}
+
+int KeySearch::CountLessEqual(const int64_t *keys, int n, int64_t key) {
+  KEY_SEARCH_DISPATCH(CountLessEqual, keys, n, key)
+}
+
+int KeySearch::CountLessEqual(const float *keys, int n, float key) {
+  KEY_SEARCH_DISPATCH(CountLessEqual, keys, n, key)
+}
@@ -0,0 +1,157 @@
+#include "index/learned_index.h"
+
+#include "storage/external_sorter.h"
+
+LearnedIndex::LearnedIndex(index_id_t index_id, IndexSchema *key_schema, BufferPoolManager *buffer_pool_manager)
+    : Index(index_id, key_schema), container_(index_id, buffer_pool_manager) {}
+
+bool LearnedIndex::ToNativeKey(const Row &key, int32_t &native_key) {
+  Field *field = key.GetField(0);
+  if (field->IsNull()) {
+    return false;
+  }
+  char buf[sizeof(int64_t)];
+  field->SerializeTo(buf);
+  if (field->GetTypeId() == TypeId::kTypeFloat) {
+    native_key = static_cast<int32_t>(MACH_READ_FROM(float, buf));
+  } else {
+    native_key = MACH_READ_INT32(buf);
+  }
+  return true;
+}
+
+/*
+ * The entries are sorted by key, spilling to disk when they exceed the sort
+ * memory budget, and streamed into the array which fits its model on the way.
+ * A duplicate key fails the build.
+ */
+dberr_t LearnedIndex::BulkLoad(const std::function<bool(Row &, RowId &)> &next, Txn * /*txn*/, double /*fill_factor*/) {
+  struct EntryLess {
+    bool operator()(const LearnedKeyArray::Entry &a, const LearnedKeyArray::Entry &b) const { return a.key < b.key; }
+  };
+  ExternalSorter<LearnedKeyArray::Entry, EntryLess> sorter(DEFAULT_SORT_MEMORY_LIMIT);
+  Row key;
+  RowId row_id;
+  while (next(key, row_id)) {
+    int32_t native_key;
+    if (!ToNativeKey(key, native_key)) {
+      return DB_FAILED;
+    }
+    sorter.Add(LearnedKeyArray::Entry{native_key, row_id.Get()});
+  }
+  sorter.Finish();
+  auto next_sorted = [&sorter](LearnedKeyArray::Entry &entry) { return sorter.Next(entry); };
+  if (!container_.Build(next_sorted)) {
+    return DB_FAILED;
+  }
+  return DB_SUCCESS;
+}
+
+/*
+ * Equality is answered by the model directly, the other predicates drain the
+ * range cursor, "<>" is the range below the key followed by the range above it.
+ */
+dberr_t LearnedIndex::ScanKey(const Row &key, vector<RowId> &result, Txn *txn, string compare_operator) {
+  int32_t native_key;
+  if (!ToNativeKey(key, native_key)) {
+    return DB_KEY_NOT_FOUND;
+  }
+  std::vector<IndexRange> ranges;
+  if (compare_operator == "=") {
+    int64_t value;
+    if (container_.GetValue(native_key, value)) {
+      result.emplace_back(value);
+    }
+  } else if (compare_operator == ">" || compare_operator == ">=") {
+    ranges.push_back({&key, compare_operator == ">=", nullptr, true});
+  } else if (compare_operator == "<" || compare_operator == "<=") {
+    ranges.push_back({nullptr, true, &key, compare_operator == "<="});
+  } else if (compare_operator == "<>") {
+    ranges.push_back({nullptr, true, &key, false});
+    ranges.push_back({&key, false, nullptr, true});
+  }
+  for (auto &range : ranges) {
+    auto cursor = ScanRange(range, txn);
+    RowId row_id;
+    while (cursor->Next(row_id)) {
+      result.emplace_back(row_id);
+    }
+  }
+  if (!result.empty())
+    return DB_SUCCESS;
+  else
+    return DB_KEY_NOT_FOUND;
+}
+
+/*
+ * Both bounds are turned into positions of the array by the model, the cursor
+ * then only reads the leaf pages between them.
+ */
+std::unique_ptr<IndexCursor> LearnedIndex::ScanRange(const IndexRange &range, Txn * /*txn*/) {
+  int32_t lower;
+  int32_t upper;
+  if ((range.lower != nullptr && !ToNativeKey(*range.lower, lower)) ||
+      (range.upper != nullptr && !ToNativeKey(*range.upper, upper))) {
+    // comparing with null matches nothing
+    return std::make_unique<VectorIndexCursor>(std::vector<RowId>());
+  }
+  uint64_t begin = 0;
+  uint64_t end = container_.GetSize();
+  if (range.lower != nullptr) {
+    begin = range.lower_inclusive ? container_.LowerBound(lower) : container_.UpperBound(lower);
+  }
+  if (range.upper != nullptr) {
+    end = range.upper_inclusive ? container_.UpperBound(upper) : container_.LowerBound(upper);
+  }
+  return std::make_unique<LearnedIndexCursor>(&container_, begin, std::max(begin, end), range.descending);
+}
+
+dberr_t LearnedIndex::Destroy() {
+  container_.Destroy();
+  return DB_SUCCESS;
+}
+
+bool LearnedIndexCursor::NextItem(LearnedKeyArray::Entry &entry) {
+  if (pos_ >= batch_.size()) {
+    if (begin_ >= end_) {
+      return false;
+    }
+    // read up to the next page boundary in the direction of the scan
+    const uint64_t capacity = LearnedIndexLeafPage::CAPACITY;
+    batch_.clear();
+    pos_ = 0;
+    if (descending_) {
+      uint64_t page_begin = std::max(begin_, (end_ - 1) / capacity * capacity);
+      container_->Read(page_begin, end_, batch_);
+      std::reverse(batch_.begin(), batch_.end());
+      end_ = page_begin;
+    } else {
+      uint64_t page_end = std::min(end_, (begin_ / capacity + 1) * capacity);
+      container_->Read(begin_, page_end, batch_);
+      begin_ = page_end;
+    }
+  }
+  entry = batch_[pos_++];
+  return true;
+}
+
+bool LearnedIndexCursor::Next(RowId &row_id) {
+  LearnedKeyArray::Entry entry;
+  if (!NextItem(entry)) {
+    return false;
+  }
+  row_id = RowId(entry.value);
+  return true;
+}
+
+bool LearnedIndexCursor::NextEntry(RowId &row_id, Row &key) {
+  LearnedKeyArray::Entry entry;
+  if (!NextItem(entry)) {
+    return false;
+  }
+  row_id = RowId(entry.value);
+  std::vector<Field> fields;
+  fields.emplace_back(TypeId::kTypeInt, entry.key);
+  key = Row(fields);
+  return true;
+}
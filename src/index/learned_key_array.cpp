@@ -0,0 +1,320 @@
+#include "index/learned_key_array.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "page/index_roots_page.h"
+
+LearnedKeyArray::LearnedKeyArray(index_id_t index_id, BufferPoolManager *buffer_pool_manager, uint32_t error_bound)
+    : index_id_(index_id), buffer_pool_manager_(buffer_pool_manager), error_bound_(error_bound) {
+  Page *roots_page = buffer_pool_manager_->FetchPage(INDEX_ROOTS_PAGE_ID);
+  roots_page->RLatch();
+  if (!reinterpret_cast<IndexRootsPage *>(roots_page->GetData())->GetRootId(index_id_, &root_page_id_)) {
+    root_page_id_ = INVALID_PAGE_ID;
+  }
+  roots_page->RUnlatch();
+  buffer_pool_manager_->UnpinPage(INDEX_ROOTS_PAGE_ID, false);
+  if (root_page_id_ == INVALID_PAGE_ID) {
+    return;
+  }
+  auto *header = reinterpret_cast<LearnedIndexHeaderPage *>(buffer_pool_manager_->FetchPage(root_page_id_)->GetData());
+  if (!header->IsValid()) {
+    buffer_pool_manager_->UnpinPage(root_page_id_, false);
+    root_page_id_ = INVALID_PAGE_ID;
+    return;
+  }
+  error_bound_ = header->GetErrorBound();
+  entry_count_ = header->GetEntryCount();
+  page_id_t model_page_id = header->GetModelPageId();
+  uint32_t segment_count = header->GetSegmentCount();
+  uint32_t leaf_count = header->GetLeafCount();
+  buffer_pool_manager_->UnpinPage(root_page_id_, false);
+  LoadModel(model_page_id, segment_count, leaf_count);
+}
+
+void LearnedKeyArray::UpdateRootPageId(bool insert_record) {
+  Page *roots_page = buffer_pool_manager_->FetchPage(INDEX_ROOTS_PAGE_ID);
+  auto *roots = reinterpret_cast<IndexRootsPage *>(roots_page->GetData());
+  roots_page->WLatch();
+  if (insert_record) {
+    roots->Insert(index_id_, root_page_id_);
+  } else {
+    roots->Delete(index_id_);
+  }
+  roots_page->WUnlatch();
+  buffer_pool_manager_->UnpinPage(INDEX_ROOTS_PAGE_ID, true);
+}
+
+/*****************************************************************************
+ * BUILD
+ *****************************************************************************/
+/*
+ * Entries fill the leaf pages front to back while the segments are fitted.
+ * A segment starting at (k0, p0) keeps the range [slope_low, slope_high] of
+ * slopes that predict each of its keys within error_bound_ positions, every
+ * new key (k, p) narrows it to the slopes through (k, p +- error_bound_). The
+ * segment is closed with the middle slope once the range would become empty.
+ */
+bool LearnedKeyArray::Build(const std::function<bool(Entry &)> &next) {
+  if (IsBuilt()) {
+    return false;
+  }
+  page_id_t leaf_page_id = INVALID_PAGE_ID;
+  LearnedIndexLeafPage *leaf = nullptr;
+  Segment segment{0, 0, 0};
+  double slope_low = 0;
+  double slope_high = std::numeric_limits<double>::infinity();
+  auto close_segment = [&]() {
+    segment.slope = std::isinf(slope_high) ? slope_low : (slope_low + slope_high) / 2;
+    segments_.push_back(segment);
+  };
+  Entry entry;
+  int32_t last_key = 0;
+  while (next(entry)) {
+    if (entry_count_ > 0 && entry.key <= last_key) {
+      // keys must be unique and increasing, drop what was written
+      buffer_pool_manager_->UnpinPage(leaf_page_id, false);
+      for (auto page_id : leaf_pages_) {
+        buffer_pool_manager_->DeletePage(page_id);
+      }
+      leaf_pages_.clear();
+      segments_.clear();
+      entry_count_ = 0;
+      return false;
+    }
+    if (leaf == nullptr || !leaf->Append(entry.key, entry.value)) {
+      if (leaf != nullptr) {
+        buffer_pool_manager_->UnpinPage(leaf_page_id, true);
+      }
+      Page *page = buffer_pool_manager_->NewPage(leaf_page_id);
+      if (page == nullptr) {
+        throw std::runtime_error("out of memory");
+      }
+      leaf = reinterpret_cast<LearnedIndexLeafPage *>(page->GetData());
+      leaf->Init();
+      leaf->Append(entry.key, entry.value);
+      leaf_pages_.push_back(leaf_page_id);
+    }
+    last_key = entry.key;
+    auto pos = static_cast<uint32_t>(entry_count_++);
+    if (pos == 0) {
+      segment = {entry.key, pos, 0};
+      continue;
+    }
+    double dx = static_cast<double>(entry.key) - segment.first_key;
+    double dy = static_cast<double>(pos) - segment.first_pos;
+    double low = std::max(slope_low, (dy - error_bound_) / dx);
+    double high = std::min(slope_high, (dy + error_bound_) / dx);
+    if (low > high) {
+      close_segment();
+      segment = {entry.key, pos, 0};
+      slope_low = 0;
+      slope_high = std::numeric_limits<double>::infinity();
+    } else {
+      slope_low = low;
+      slope_high = high;
+    }
+  }
+  if (leaf != nullptr) {
+    buffer_pool_manager_->UnpinPage(leaf_page_id, true);
+    close_segment();
+  }
+  page_id_t model_page_id = WriteModel();
+  Page *page = buffer_pool_manager_->NewPage(root_page_id_);
+  if (page == nullptr) {
+    throw std::runtime_error("out of memory");
+  }
+  reinterpret_cast<LearnedIndexHeaderPage *>(page->GetData())
+      ->Init(error_bound_, entry_count_, segments_.size(), leaf_pages_.size(), model_page_id);
+  buffer_pool_manager_->UnpinPage(root_page_id_, true);
+  UpdateRootPageId(true);
+  return true;
+}
+
+page_id_t LearnedKeyArray::WriteModel() {
+  std::string bytes(segments_.size() * sizeof(Segment) + leaf_pages_.size() * sizeof(page_id_t), '\0');
+  memcpy(bytes.data(), segments_.data(), segments_.size() * sizeof(Segment));
+  memcpy(bytes.data() + segments_.size() * sizeof(Segment), leaf_pages_.data(), leaf_pages_.size() * sizeof(page_id_t));
+  page_id_t first_page_id = INVALID_PAGE_ID;
+  page_id_t prev_page_id = INVALID_PAGE_ID;
+  LearnedIndexModelPage *prev = nullptr;
+  size_t written = 0;
+  do {
+    page_id_t page_id;
+    Page *page = buffer_pool_manager_->NewPage(page_id);
+    if (page == nullptr) {
+      throw std::runtime_error("out of memory");
+    }
+    auto *model_page = reinterpret_cast<LearnedIndexModelPage *>(page->GetData());
+    model_page->Init();
+    written += model_page->Append(bytes.data() + written, bytes.size() - written);
+    model_pages_.push_back(page_id);
+    if (prev == nullptr) {
+      first_page_id = page_id;
+    } else {
+      prev->SetNextPageId(page_id);
+      buffer_pool_manager_->UnpinPage(prev_page_id, true);
+    }
+    prev = model_page;
+    prev_page_id = page_id;
+  } while (written < bytes.size());
+  buffer_pool_manager_->UnpinPage(prev_page_id, true);
+  return first_page_id;
+}
+
+void LearnedKeyArray::LoadModel(page_id_t model_page_id, uint32_t segment_count, uint32_t leaf_count) {
+  std::string bytes;
+  for (page_id_t page_id = model_page_id; page_id != INVALID_PAGE_ID;) {
+    auto *model_page = reinterpret_cast<LearnedIndexModelPage *>(buffer_pool_manager_->FetchPage(page_id)->GetData());
+    bytes.append(model_page->GetBytes(), model_page->GetUsed());
+    model_pages_.push_back(page_id);
+    page_id_t next_page_id = model_page->GetNextPageId();
+    buffer_pool_manager_->UnpinPage(page_id, false);
+    page_id = next_page_id;
+  }
+  segments_.resize(segment_count);
+  leaf_pages_.resize(leaf_count);
+  memcpy(segments_.data(), bytes.data(), segment_count * sizeof(Segment));
+  memcpy(leaf_pages_.data(), bytes.data() + segment_count * sizeof(Segment), leaf_count * sizeof(page_id_t));
+}
+
+/*****************************************************************************
+ * LOOKUP
+ *****************************************************************************/
+/*
+ * The leaf pages of the range are binary searched on their last key first,
+ * the page the search narrows down to stays pinned for the search within it,
+ * so a range of at most one page is done with a single fetch.
+ */
+uint64_t LearnedKeyArray::SearchRange(int32_t key, uint64_t begin, uint64_t end, Entry *entry) {
+  if (begin >= end) {
+    return begin;
+  }
+  const uint64_t capacity = LearnedIndexLeafPage::CAPACITY;
+  uint64_t first_page = begin / capacity;
+  uint64_t last_page = (end - 1) / capacity;
+  while (true) {
+    uint64_t mid = (first_page + last_page) / 2;
+    auto *leaf = reinterpret_cast<LearnedIndexLeafPage *>(buffer_pool_manager_->FetchPage(leaf_pages_[mid])->GetData());
+    if (first_page < last_page) {
+      // pages before the last one of the array are full
+      if (leaf->KeyAt(capacity - 1) < key) {
+        first_page = mid + 1;
+      } else {
+        last_page = mid;
+      }
+      if (first_page < last_page || first_page != mid) {
+        buffer_pool_manager_->UnpinPage(leaf_pages_[mid], false);
+        continue;
+      }
+    }
+    int slot_begin = mid == begin / capacity ? static_cast<int>(begin % capacity) : 0;
+    int slot_end =
+        mid == (end - 1) / capacity ? static_cast<int>((end - 1) % capacity + 1) : LearnedIndexLeafPage::CAPACITY;
+    int slot = leaf->LowerBound(key, slot_begin, slot_end);
+    if (entry != nullptr && slot < leaf->GetCount()) {
+      *entry = {leaf->KeyAt(slot), leaf->ValueAt(slot)};
+    }
+    buffer_pool_manager_->UnpinPage(leaf_pages_[mid], false);
+    return mid * capacity + slot;
+  }
+}
+
+/*
+ * Every key of a segment lies within error_bound_ positions of its
+ * prediction. The prediction is monotonic, so the position of an absent key,
+ * between two keys of the segment, is off by at most one more. The window is
+ * widened by one further position on each side against rounding, a result on
+ * its edge is confirmed over the whole segment.
+ */
+uint64_t LearnedKeyArray::Locate(int32_t key, Entry *entry) {
+  if (entry_count_ == 0) {
+    return 0;
+  }
+  auto segment = std::upper_bound(segments_.begin(), segments_.end(), key,
+                                  [](int32_t k, const Segment &s) { return k < s.first_key; });
+  if (segment == segments_.begin()) {
+    return SearchRange(key, 0, 1, entry);
+  }
+  --segment;
+  auto seg_begin = static_cast<int64_t>(segment->first_pos);
+  auto seg_end = static_cast<int64_t>(segment + 1 == segments_.end() ? entry_count_ : (segment + 1)->first_pos);
+  double predicted = segment->first_pos + segment->slope * (static_cast<double>(key) - segment->first_key);
+  auto pos = static_cast<int64_t>(predicted);
+  int64_t low = std::clamp<int64_t>(pos - error_bound_ - 2, seg_begin, seg_end);
+  int64_t high = std::clamp<int64_t>(pos + error_bound_ + 3, seg_begin, seg_end);
+  uint64_t result = SearchRange(key, low, high, entry);
+  if ((result == static_cast<uint64_t>(low) && low > seg_begin) ||
+      (result == static_cast<uint64_t>(high) && high < seg_end)) {
+    result = SearchRange(key, seg_begin, seg_end, entry);
+  }
+  if (entry != nullptr && result == static_cast<uint64_t>(seg_end) && result < entry_count_ &&
+      result % LearnedIndexLeafPage::CAPACITY == 0) {
+    // past the last key of the segment, the entry is the first one of the next page
+    result = SearchRange(key, result, result + 1, entry);
+  }
+  return result;
+}
+
+bool LearnedKeyArray::GetValue(int32_t key, int64_t &value) {
+  Entry entry;
+  if (Locate(key, &entry) >= entry_count_ || entry.key != key) {
+    return false;
+  }
+  value = entry.value;
+  return true;
+}
+
+void LearnedKeyArray::Read(uint64_t begin, uint64_t end, std::vector<Entry> &entries) {
+  const uint64_t capacity = LearnedIndexLeafPage::CAPACITY;
+  end = std::min(end, entry_count_);
+  while (begin < end) {
+    uint64_t page_index = begin / capacity;
+    uint64_t page_end = std::min(end, (page_index + 1) * capacity);
+    page_id_t page_id = leaf_pages_[page_index];
+    auto *leaf = reinterpret_cast<LearnedIndexLeafPage *>(buffer_pool_manager_->FetchPage(page_id)->GetData());
+    for (uint64_t pos = begin; pos < page_end; pos++) {
+      entries.push_back({leaf->KeyAt(pos % capacity), leaf->ValueAt(pos % capacity)});
+    }
+    buffer_pool_manager_->UnpinPage(page_id, false);
+    begin = page_end;
+  }
+}
+
+LearnedKeyArray::Stats LearnedKeyArray::GetStats() const {
+  Stats stats;
+  stats.entries = entry_count_;
+  stats.leaf_pages = leaf_pages_.size();
+  stats.model_pages = model_pages_.size();
+  stats.segments = segments_.size();
+  stats.model_bytes = segments_.size() * sizeof(Segment) + leaf_pages_.size() * sizeof(page_id_t);
+  return stats;
+}
+
+void LearnedKeyArray::GetShape(uint32_t &height, uint32_t &leaf_pages) const {
+  height = IsBuilt() ? 1 : 0;
+  leaf_pages = leaf_pages_.size();
+}
+
+void LearnedKeyArray::Destroy() {
+  if (!IsBuilt()) {
+    return;
+  }
+  for (auto page_id : leaf_pages_) {
+    buffer_pool_manager_->DeletePage(page_id);
+  }
+  for (auto page_id : model_pages_) {
+    buffer_pool_manager_->DeletePage(page_id);
+  }
+  buffer_pool_manager_->DeletePage(root_page_id_);
+  UpdateRootPageId(false);
+  root_page_id_ = INVALID_PAGE_ID;
+  entry_count_ = 0;
+  segments_.clear();
+  leaf_pages_.clear();
+  model_pages_.clear();
+}
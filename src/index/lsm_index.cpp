@@ -0,0 +1,138 @@
+#include "index/lsm_index.h"
+
+#include "index/prefix_b_plus_tree_index.h"
+
+// number of entries read from the tree by one cursor refill
+static const size_t CURSOR_BATCH_SIZE = 64;
+
+LsmIndex::LsmIndex(index_id_t index_id, IndexSchema *key_schema, BufferPoolManager *buffer_pool_manager)
+    : Index(index_id, key_schema), container_(index_id, buffer_pool_manager) {}
+
+dberr_t LsmIndex::InsertEntry(const Row &key, RowId row_id, Txn * /*txn*/) {
+  std::string encoded;
+  if (!PrefixBPlusTreeIndex::EncodeKey(key, key_schema_, encoded) || !container_.Insert(encoded, row_id)) {
+    return DB_FAILED;
+  }
+  return DB_SUCCESS;
+}
+
+dberr_t LsmIndex::RemoveEntry(const Row &key, RowId /*row_id*/, Txn * /*txn*/) {
+  std::string encoded;
+  if (PrefixBPlusTreeIndex::EncodeKey(key, key_schema_, encoded)) {
+    container_.Remove(encoded);
+  }
+  return DB_SUCCESS;
+}
+
+dberr_t LsmIndex::ScanKey(const Row &key, vector<RowId> &result, Txn *txn, string compare_operator) {
+  std::string encoded;
+  if (!PrefixBPlusTreeIndex::EncodeKey(key, key_schema_, encoded)) {
+    return DB_KEY_NOT_FOUND;
+  }
+  std::vector<IndexRange> ranges;
+  if (compare_operator == "=" && key.GetFieldCount() < key_schema_->GetColumnCount()) {
+    // equality on a prefix of the key columns is a range
+    ranges.push_back({&key, true, &key, true});
+  } else if (compare_operator == "=") {
+    RowId row_id;
+    if (container_.GetValue(encoded, row_id)) {
+      result.push_back(row_id);
+    }
+  } else if (compare_operator == ">" || compare_operator == ">=") {
+    ranges.push_back({&key, compare_operator == ">=", nullptr, true});
+  } else if (compare_operator == "<" || compare_operator == "<=") {
+    ranges.push_back({nullptr, true, &key, compare_operator == "<="});
+  } else if (compare_operator == "<>") {
+    ranges.push_back({nullptr, true, &key, false});
+    ranges.push_back({&key, false, nullptr, true});
+  }
+  for (auto &range : ranges) {
+    auto cursor = ScanRange(range, txn);
+    RowId row_id;
+    while (cursor->Next(row_id)) {
+      result.emplace_back(row_id);
+    }
+  }
+  if (!result.empty())
+    return DB_SUCCESS;
+  else
+    return DB_KEY_NOT_FOUND;
+}
+
+std::unique_ptr<IndexCursor> LsmIndex::ScanRange(const IndexRange &range, Txn * /*txn*/) {
+  std::string lower;
+  std::string upper;
+  bool lower_inclusive;
+  bool upper_inclusive;
+  bool has_upper;
+  if (!PrefixBPlusTreeIndex::EncodeRange(range, key_schema_, lower, lower_inclusive, has_upper, upper,
+                                         upper_inclusive)) {
+    return std::make_unique<VectorIndexCursor>(std::vector<RowId>());
+  }
+  return std::make_unique<LsmIndexCursor>(&container_, key_schema_, std::move(lower), lower_inclusive, has_upper,
+                                          std::move(upper), upper_inclusive);
+}
+
+dberr_t LsmIndex::Destroy() {
+  container_.Destroy();
+  return DB_SUCCESS;
+}
+
+void LsmIndex::GetShape(uint32_t &height, uint32_t &leaf_pages) {
+  auto stats = container_.GetStats();
+  height = 0;
+  leaf_pages = 0;
+  for (size_t level = 0; level < stats.level_runs.size(); level++) {
+    height += stats.level_runs[level];
+    leaf_pages += stats.level_pages[level];
+  }
+}
+
+const LsmTree::Entry *LsmIndexCursor::NextItem() {
+  if (pos_ >= batch_.size()) {
+    if (exhausted_) {
+      return nullptr;
+    }
+    batch_.clear();
+    pos_ = 0;
+    container_->Scan(last_key_, last_inclusive_, CURSOR_BATCH_SIZE, batch_);
+    if (batch_.size() < CURSOR_BATCH_SIZE) {
+      exhausted_ = true;
+    }
+    if (batch_.empty()) {
+      return nullptr;
+    }
+    last_key_ = batch_.back().key;
+    last_inclusive_ = false;
+  }
+  const auto *entry = &batch_[pos_];
+  if (has_upper_) {
+    int cmp = entry->key.compare(upper_);
+    if (cmp > 0 || (cmp == 0 && !upper_inclusive_)) {
+      exhausted_ = true;
+      pos_ = batch_.size();
+      return nullptr;
+    }
+  }
+  pos_++;
+  return entry;
+}
+
+bool LsmIndexCursor::Next(RowId &row_id) {
+  const auto *entry = NextItem();
+  if (entry == nullptr) {
+    return false;
+  }
+  row_id = RowId(entry->value);
+  return true;
+}
+
+bool LsmIndexCursor::NextEntry(RowId &row_id, Row &key) {
+  const auto *entry = NextItem();
+  if (entry == nullptr) {
+    return false;
+  }
+  row_id = RowId(entry->value);
+  PrefixBPlusTreeIndex::DecodeKey(entry->key, key_schema_, key);
+  return true;
+}
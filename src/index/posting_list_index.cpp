@@ -0,0 +1,499 @@
+#include "index/posting_list_index.h"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+#include "index/basic_comparator.h"
+#include "storage/external_sorter.h"
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+PostingListIndex<KeyType, KeyComparator>::PostingListIndex(index_id_t index_id, IndexSchema *key_schema,
+                                                           BufferPoolManager *buffer_pool_manager)
+    : TypedBPlusTreeIndex<KeyType, KeyComparator>(index_id, key_schema, buffer_pool_manager),
+      buffer_pool_manager_(buffer_pool_manager) {}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+uint64_t PostingListIndex<KeyType, KeyComparator>::OwnerOf(const KeyType &key) {
+  uint64_t owner = 0;
+  memcpy(&owner, &key, sizeof(KeyType));
+  return owner;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+std::mutex &PostingListIndex<KeyType, KeyComparator>::KeyLatch(const KeyType &key) {
+  return key_latches_[std::hash<KeyType>()(key) % KEY_LATCH_COUNT];
+}
+
+/*
+ * Allocate and initialize a posting page of key, the page is returned pinned.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+PostingListPage *PostingListIndex<KeyType, KeyComparator>::NewPostingPage(const KeyType &key, page_id_t &page_id) {
+  Page *page = buffer_pool_manager_->NewPage(page_id);
+  if (page == nullptr) {
+    throw std::runtime_error("out of memory");
+  }
+  auto *posting = reinterpret_cast<PostingListPage *>(page->GetData());
+  posting->Init(page_id, OwnerOf(key));
+  return posting;
+}
+
+/*
+ * Write the sorted rids into a new chain of posting pages and return its head.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+page_id_t PostingListIndex<KeyType, KeyComparator>::BuildPostingList(const KeyType &key, const int64_t *rids,
+                                                                     size_t size) {
+  page_id_t head_id;
+  PostingListPage *head = NewPostingPage(key, head_id);
+  size_t filled = head->Fill(rids, size);
+  PostingListPage *tail = head;
+  while (filled < size) {
+    page_id_t page_id;
+    PostingListPage *page = NewPostingPage(key, page_id);
+    filled += page->Fill(rids + filled, size - filled);
+    tail->SetNextPageId(page_id);
+    if (tail != head) {
+      buffer_pool_manager_->UnpinPage(tail->GetPageId(), true);
+    }
+    tail = page;
+  }
+  head->SetTailPageId(tail->GetPageId());
+  if (tail != head) {
+    buffer_pool_manager_->UnpinPage(tail->GetPageId(), true);
+  }
+  buffer_pool_manager_->UnpinPage(head_id, true);
+  return head_id;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void PostingListIndex<KeyType, KeyComparator>::ReadPostings(const KeyType &key, const RowId &value,
+                                                            std::vector<RowId> &result) {
+  if (!IsPostingRef(value)) {
+    result.emplace_back(value);
+    return;
+  }
+  Page *head_page = buffer_pool_manager_->FetchPage(value.GetPageId());
+  if (head_page == nullptr) {
+    // the list was emptied and freed after the key was looked up
+    return;
+  }
+  head_page->RLatch();
+  auto *head = reinterpret_cast<PostingListPage *>(head_page->GetData());
+  if (head->IsPostingOf(OwnerOf(key))) {
+    std::vector<int64_t> rids;
+    head->Decode(rids);
+    page_id_t next_page_id = head->GetNextPageId();
+    while (next_page_id != INVALID_PAGE_ID) {
+      // overflow pages are only modified under the head page write latch
+      auto *page = reinterpret_cast<PostingListPage *>(buffer_pool_manager_->FetchPage(next_page_id)->GetData());
+      page->Decode(rids);
+      buffer_pool_manager_->UnpinPage(next_page_id, false);
+      next_page_id = page->GetNextPageId();
+    }
+    for (auto rid : rids) {
+      result.emplace_back(rid);
+    }
+  }
+  head_page->RUnlatch();
+  buffer_pool_manager_->UnpinPage(value.GetPageId(), false);
+}
+
+/*
+ * A key seen for the first time stores its row id inline, the second row
+ * turns the value into a posting list.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+dberr_t PostingListIndex<KeyType, KeyComparator>::InsertEntry(const Row &key, RowId row_id, Txn *txn) {
+  KeyType native_key;
+  if (!this->ToNativeKey(key, native_key)) {
+    return DB_FAILED;
+  }
+  std::lock_guard<std::mutex> key_guard(KeyLatch(native_key));
+  std::vector<RowId> values;
+  if (!this->container_.GetValue(native_key, values, txn)) {
+    return this->container_.Insert(native_key, row_id, txn) ? DB_SUCCESS : DB_FAILED;
+  }
+  RowId value = values[0];
+  if (IsPostingRef(value)) {
+    return InsertPosting(native_key, value.GetPageId(), row_id.Get()) ? DB_SUCCESS : DB_FAILED;
+  }
+  if (value == row_id) {
+    return DB_FAILED;
+  }
+  int64_t rids[2] = {std::min(value.Get(), row_id.Get()), std::max(value.Get(), row_id.Get())};
+  page_id_t head_id = BuildPostingList(native_key, rids, 2);
+  this->container_.Update(native_key, RowId(head_id, POSTING_LIST_SLOT), txn);
+  return DB_SUCCESS;
+}
+
+/*
+ * Row ids past the end of the list are appended to the tail page. Any other
+ * row id is inserted into the page covering it, a page that is full is split
+ * in half with the upper half moved to a new page linked right after it.
+ * @return: false if the row id is already in the list
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool PostingListIndex<KeyType, KeyComparator>::InsertPosting(const KeyType &key, page_id_t head_id, int64_t rid) {
+  Page *head_page = buffer_pool_manager_->FetchPage(head_id);
+  head_page->WLatch();
+  auto *head = reinterpret_cast<PostingListPage *>(head_page->GetData());
+  bool inserted = true;
+  page_id_t tail_id = head->GetTailPageId();
+  auto *tail = tail_id == head_id
+                   ? head
+                   : reinterpret_cast<PostingListPage *>(buffer_pool_manager_->FetchPage(tail_id)->GetData());
+  if (rid > tail->GetLast()) {
+    if (!tail->Append(rid)) {
+      page_id_t page_id;
+      PostingListPage *page = NewPostingPage(key, page_id);
+      page->Append(rid);
+      tail->SetNextPageId(page_id);
+      head->SetTailPageId(page_id);
+      buffer_pool_manager_->UnpinPage(page_id, true);
+    }
+    if (tail != head) {
+      buffer_pool_manager_->UnpinPage(tail_id, true);
+    }
+  } else {
+    if (tail != head) {
+      buffer_pool_manager_->UnpinPage(tail_id, false);
+    }
+    // find the last page whose first row id is not greater than rid
+    PostingListPage *cur = head;
+    while (cur->GetNextPageId() != INVALID_PAGE_ID) {
+      page_id_t next_id = cur->GetNextPageId();
+      auto *next = reinterpret_cast<PostingListPage *>(buffer_pool_manager_->FetchPage(next_id)->GetData());
+      if (next->GetFirst() > rid) {
+        buffer_pool_manager_->UnpinPage(next_id, false);
+        break;
+      }
+      if (cur != head) {
+        buffer_pool_manager_->UnpinPage(cur->GetPageId(), false);
+      }
+      cur = next;
+    }
+    auto result = cur->Insert(rid);
+    if (result == PostingListPage::InsertResult::kDuplicate) {
+      inserted = false;
+    } else if (result == PostingListPage::InsertResult::kFull) {
+      std::vector<int64_t> rids;
+      cur->Decode(rids);
+      rids.insert(std::upper_bound(rids.begin(), rids.end(), rid), rid);
+      size_t filled = cur->Fill(rids.data(), rids.size() / 2);
+      while (filled < rids.size()) {
+        page_id_t page_id;
+        PostingListPage *page = NewPostingPage(key, page_id);
+        filled += page->Fill(rids.data() + filled, rids.size() - filled);
+        page->SetNextPageId(cur->GetNextPageId());
+        cur->SetNextPageId(page_id);
+        if (head->GetTailPageId() == cur->GetPageId()) {
+          head->SetTailPageId(page_id);
+        }
+        if (cur != head) {
+          buffer_pool_manager_->UnpinPage(cur->GetPageId(), true);
+        }
+        cur = page;
+      }
+    }
+    if (cur != head) {
+      buffer_pool_manager_->UnpinPage(cur->GetPageId(), inserted);
+    }
+  }
+  head_page->WUnlatch();
+  buffer_pool_manager_->UnpinPage(head_id, inserted);
+  return inserted;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+dberr_t PostingListIndex<KeyType, KeyComparator>::RemoveEntry(const Row &key, RowId row_id, Txn *txn) {
+  KeyType native_key;
+  if (!this->ToNativeKey(key, native_key)) {
+    return DB_SUCCESS;
+  }
+  std::lock_guard<std::mutex> key_guard(KeyLatch(native_key));
+  std::vector<RowId> values;
+  if (!this->container_.GetValue(native_key, values, txn)) {
+    return DB_SUCCESS;
+  }
+  if (IsPostingRef(values[0])) {
+    RemovePosting(native_key, values[0].GetPageId(), row_id.Get(), txn);
+  } else if (values[0] == row_id) {
+    this->container_.Remove(native_key, txn);
+  }
+  return DB_SUCCESS;
+}
+
+/*
+ * Drop rid from the page holding it. An emptied overflow page is unlinked,
+ * an emptied head takes over the content of the next page, and once the
+ * whole list is empty the key leaves the tree and the head is freed.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void PostingListIndex<KeyType, KeyComparator>::RemovePosting(const KeyType &key, page_id_t head_id, int64_t rid,
+                                                             Txn *txn) {
+  Page *head_page = buffer_pool_manager_->FetchPage(head_id);
+  head_page->WLatch();
+  auto *head = reinterpret_cast<PostingListPage *>(head_page->GetData());
+  PostingListPage *prev = nullptr;
+  PostingListPage *cur = head;
+  while (cur->GetNextPageId() != INVALID_PAGE_ID) {
+    page_id_t next_id = cur->GetNextPageId();
+    auto *next = reinterpret_cast<PostingListPage *>(buffer_pool_manager_->FetchPage(next_id)->GetData());
+    if (next->GetFirst() > rid) {
+      buffer_pool_manager_->UnpinPage(next_id, false);
+      break;
+    }
+    if (prev != nullptr && prev != head) {
+      buffer_pool_manager_->UnpinPage(prev->GetPageId(), false);
+    }
+    prev = cur;
+    cur = next;
+  }
+  bool removed = cur->Remove(rid);
+  bool list_freed = false;
+  page_id_t freed_page_id = INVALID_PAGE_ID;
+  if (removed && cur->GetCount() == 0) {
+    if (cur != head) {
+      prev->SetNextPageId(cur->GetNextPageId());
+      if (head->GetTailPageId() == cur->GetPageId()) {
+        head->SetTailPageId(prev->GetPageId());
+      }
+      cur->Release();
+      freed_page_id = cur->GetPageId();
+    } else if (head->GetNextPageId() != INVALID_PAGE_ID) {
+      page_id_t next_id = head->GetNextPageId();
+      auto *next = reinterpret_cast<PostingListPage *>(buffer_pool_manager_->FetchPage(next_id)->GetData());
+      std::vector<int64_t> rids;
+      next->Decode(rids);
+      head->Fill(rids.data(), rids.size());
+      head->SetNextPageId(next->GetNextPageId());
+      if (head->GetTailPageId() == next_id) {
+        head->SetTailPageId(head_id);
+      }
+      next->Release();
+      buffer_pool_manager_->UnpinPage(next_id, true);
+      freed_page_id = next_id;
+    } else {
+      // the last row is gone, readers that still hold the reference see a released page
+      this->container_.Remove(key, txn);
+      head->Release();
+      list_freed = true;
+    }
+  }
+  if (prev != nullptr && prev != head) {
+    buffer_pool_manager_->UnpinPage(prev->GetPageId(), removed);
+  }
+  if (cur != head) {
+    buffer_pool_manager_->UnpinPage(cur->GetPageId(), removed);
+  }
+  if (freed_page_id != INVALID_PAGE_ID) {
+    DeletePostingPage(freed_page_id);
+  }
+  head_page->WUnlatch();
+  buffer_pool_manager_->UnpinPage(head_id, removed);
+  if (list_freed) {
+    DeletePostingPage(head_id);
+  }
+}
+
+/*
+ * A reader may still pin a released head page for a moment, wait it out.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void PostingListIndex<KeyType, KeyComparator>::DeletePostingPage(page_id_t page_id) {
+  while (!buffer_pool_manager_->DeletePage(page_id)) {
+    std::this_thread::yield();
+  }
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void PostingListIndex<KeyType, KeyComparator>::FreePostingList(page_id_t head_id) {
+  page_id_t page_id = head_id;
+  while (page_id != INVALID_PAGE_ID) {
+    auto *page = reinterpret_cast<PostingListPage *>(buffer_pool_manager_->FetchPage(page_id)->GetData());
+    page_id_t next_page_id = page->GetNextPageId();
+    page->Release();
+    buffer_pool_manager_->UnpinPage(page_id, true);
+    DeletePostingPage(page_id);
+    page_id = next_page_id;
+  }
+}
+
+/*
+ * Range predicates are answered by the range cursor, which expands posting
+ * lists as it goes.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+dberr_t PostingListIndex<KeyType, KeyComparator>::ScanKey(const Row &key, vector<RowId> &result, Txn *txn,
+                                                          string compare_operator) {
+  if (compare_operator != "=") {
+    return TypedBPlusTreeIndex<KeyType, KeyComparator>::ScanKey(key, result, txn, compare_operator);
+  }
+  KeyType native_key;
+  std::vector<RowId> values;
+  if (!this->ToNativeKey(key, native_key) || !this->container_.GetValue(native_key, values, txn)) {
+    return DB_KEY_NOT_FOUND;
+  }
+  ReadPostings(native_key, values[0], result);
+  return result.empty() ? DB_KEY_NOT_FOUND : DB_SUCCESS;
+}
+
+/*
+ * The tree values of all keys are looked up in one sorted pass, the posting
+ * lists are read afterwards.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+dberr_t PostingListIndex<KeyType, KeyComparator>::ScanKeys(const std::vector<Row> &keys,
+                                                           std::vector<std::vector<RowId>> &result, Txn * /*txn*/) {
+  result.assign(keys.size(), std::vector<RowId>());
+  std::vector<std::pair<KeyType, size_t>> probes;
+  probes.reserve(keys.size());
+  for (size_t i = 0; i < keys.size(); i++) {
+    KeyType native_key;
+    if (this->ToNativeKey(keys[i], native_key)) {
+      probes.emplace_back(native_key, i);
+    }
+  }
+  std::sort(probes.begin(), probes.end(),
+            [this](const auto &a, const auto &b) { return this->comparator_(a.first, b.first) < 0; });
+  std::vector<KeyType> sorted_keys;
+  sorted_keys.reserve(probes.size());
+  for (auto &probe : probes) {
+    sorted_keys.push_back(probe.first);
+  }
+  std::vector<RowId> values;
+  std::vector<bool> found;
+  this->container_.GetValues(sorted_keys, values, found);
+  bool any_found = false;
+  for (size_t i = 0; i < probes.size(); i++) {
+    if (found[i]) {
+      auto &rows = result[probes[i].second];
+      ReadPostings(probes[i].first, values[i], rows);
+      any_found = any_found || !rows.empty();
+    }
+  }
+  return any_found ? DB_SUCCESS : DB_KEY_NOT_FOUND;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+std::unique_ptr<IndexCursor> PostingListIndex<KeyType, KeyComparator>::MakeCursor(Iterator begin, Iterator end,
+                                                                                   bool has_stop, const KeyType &stop,
+                                                                                   bool stop_inclusive,
+                                                                                   bool descending) {
+  return std::make_unique<PostingListIndexCursor<KeyType, KeyComparator>>(this, this->key_schema_, std::move(begin),
+                                                                          std::move(end), this->comparator_, has_stop,
+                                                                          stop, stop_inclusive, descending);
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool PostingListIndexCursor<KeyType, KeyComparator>::Next(RowId &row_id) {
+  while (pos_ >= postings_.size()) {
+    typename TypedBPlusTreeIndexCursor<KeyType, KeyComparator>::MappingType item;
+    if (!this->NextItem(item)) {
+      return false;
+    }
+    postings_.clear();
+    pos_ = 0;
+    key_ = item.first;
+    index_->ReadPostings(item.first, item.second, postings_);
+  }
+  row_id = postings_[pos_++];
+  return true;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool PostingListIndexCursor<KeyType, KeyComparator>::NextEntry(RowId &row_id, Row &key) {
+  if (!Next(row_id)) {
+    return false;
+  }
+  TypedBPlusTreeIndex<KeyType, KeyComparator>::FromNativeKey(key_, this->key_schema_, key);
+  return true;
+}
+
+/*
+ * Sort the (key, row id) pairs by key and then row id, write the row ids of
+ * every key with more than one row into a posting list, and build the tree
+ * bottom-up from one entry per key.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+dberr_t PostingListIndex<KeyType, KeyComparator>::BulkLoad(const std::function<bool(Row &, RowId &)> &next,
+                                                           Txn * /*txn*/, double fill_factor) {
+  struct Entry {
+    KeyType key;
+    int64_t rid;
+  };
+  struct EntryLess {
+    KeyComparator comparator;
+    bool operator()(const Entry &a, const Entry &b) const {
+      int cmp = comparator(a.key, b.key);
+      return cmp < 0 || (cmp == 0 && a.rid < b.rid);
+    }
+  };
+  ExternalSorter<Entry, EntryLess> sorter(DEFAULT_SORT_MEMORY_LIMIT, EntryLess{this->comparator_});
+  Row key;
+  RowId row_id;
+  while (next(key, row_id)) {
+    KeyType native_key;
+    if (!this->ToNativeKey(key, native_key)) {
+      return DB_FAILED;
+    }
+    sorter.Add(Entry{native_key, row_id.Get()});
+  }
+  sorter.Finish();
+  Entry pending;
+  bool has_pending = sorter.Next(pending);
+  std::vector<int64_t> rids;
+  auto next_key = [&](typename Container::MappingType &item) {
+    if (!has_pending) {
+      return false;
+    }
+    KeyType current = pending.key;
+    rids.clear();
+    do {
+      if (rids.empty() || rids.back() != pending.rid) {
+        rids.push_back(pending.rid);
+      }
+      has_pending = sorter.Next(pending);
+    } while (has_pending && this->comparator_(pending.key, current) == 0);
+    if (rids.size() == 1) {
+      item = {current, RowId(rids[0])};
+    } else {
+      item = {current, RowId(BuildPostingList(current, rids.data(), rids.size()), POSTING_LIST_SLOT)};
+    }
+    return true;
+  };
+  if (!this->container_.BulkLoad(next_key, fill_factor)) {
+    return DB_FAILED;
+  }
+  return DB_SUCCESS;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+dberr_t PostingListIndex<KeyType, KeyComparator>::Destroy() {
+  std::vector<page_id_t> heads;
+  for (auto iter = this->container_.Begin(); iter != this->container_.End(); ++iter) {
+    auto item = *iter;
+    if (IsPostingRef(item.second)) {
+      heads.push_back(item.second.GetPageId());
+    }
+  }
+  for (auto head_id : heads) {
+    FreePostingList(head_id);
+  }
+  this->container_.Destroy();
+  return DB_SUCCESS;
+}
+
+template class PostingListIndexCursor<int32_t, BasicComparator<int32_t>>;
+
+template class PostingListIndexCursor<int64_t, BasicComparator<int64_t>>;
+
+template class PostingListIndexCursor<float, BasicComparator<float>>;
+
+template class PostingListIndex<int32_t, BasicComparator<int32_t>>;
+
+template class PostingListIndex<int64_t, BasicComparator<int64_t>>;
+
+template class PostingListIndex<float, BasicComparator<float>>;
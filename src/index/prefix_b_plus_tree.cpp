@@ -0,0 +1,399 @@
+#include "index/prefix_b_plus_tree.h"
+
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+
+#include "page/index_roots_page.h"
+
+PrefixBPlusTree::PrefixBPlusTree(index_id_t index_id, BufferPoolManager *buffer_pool_manager)
+    : index_id_(index_id), buffer_pool_manager_(buffer_pool_manager) {
+  Page *roots_page = buffer_pool_manager_->FetchPage(INDEX_ROOTS_PAGE_ID);
+  roots_page->RLatch();
+  if (!reinterpret_cast<IndexRootsPage *>(roots_page->GetData())->GetRootId(index_id_, &root_page_id_)) {
+    root_page_id_ = INVALID_PAGE_ID;
+  }
+  roots_page->RUnlatch();
+  buffer_pool_manager_->UnpinPage(INDEX_ROOTS_PAGE_ID, false);
+}
+
+PrefixBPlusTreePage *PrefixBPlusTree::FetchTreePage(page_id_t page_id) {
+  return reinterpret_cast<PrefixBPlusTreePage *>(buffer_pool_manager_->FetchPage(page_id)->GetData());
+}
+
+/*
+ * Throw an "out of memory" exception if the buffer pool cannot provide a page.
+ */
+PrefixBPlusTreePage *PrefixBPlusTree::NewTreePage(page_id_t &page_id, bool is_leaf) {
+  Page *page = buffer_pool_manager_->NewPage(page_id);
+  if (page == nullptr) {
+    throw std::runtime_error("out of memory");
+  }
+  auto *tree_page = reinterpret_cast<PrefixBPlusTreePage *>(page->GetData());
+  tree_page->Init(page_id, is_leaf);
+  return tree_page;
+}
+
+int PrefixBPlusTree::ChildIndex(const PrefixBPlusTreePage *page, const std::string &key) {
+  int index = page->LowerBound(key);
+  if (index < page->GetSize() && page->KeyEquals(index, key)) {
+    index++;
+  }
+  return index;
+}
+
+/*
+ * The separator right after the child taken on the lowest level that has one
+ * is the exclusive upper bound of the keys of the leaf.
+ */
+page_id_t PrefixBPlusTree::FindLeaf(const std::string &key, std::vector<page_id_t> *path, std::string *fence) {
+  if (fence != nullptr) {
+    fence->clear();
+  }
+  page_id_t page_id = root_page_id_;
+  while (true) {
+    auto *page = FetchTreePage(page_id);
+    if (page->IsLeafPage()) {
+      buffer_pool_manager_->UnpinPage(page_id, false);
+      return page_id;
+    }
+    if (path != nullptr) {
+      path->push_back(page_id);
+    }
+    int index = ChildIndex(page, key);
+    if (fence != nullptr && index < page->GetSize()) {
+      *fence = page->KeyAt(index);
+    }
+    page_id_t child = index == 0 ? page->GetFirstChild() : static_cast<page_id_t>(page->ValueAt(index - 1));
+    buffer_pool_manager_->UnpinPage(page_id, false);
+    page_id = child;
+  }
+}
+
+/*****************************************************************************
+ * SEARCH
+ *****************************************************************************/
+bool PrefixBPlusTree::GetValue(const std::string &key, RowId &value) {
+  std::shared_lock<std::shared_mutex> tree_guard(tree_latch_);
+  if (root_page_id_ == INVALID_PAGE_ID) {
+    return false;
+  }
+  page_id_t leaf_page_id = FindLeaf(key, nullptr);
+  auto *leaf = FetchTreePage(leaf_page_id);
+  int index = leaf->LowerBound(key);
+  bool found = index < leaf->GetSize() && leaf->KeyEquals(index, key);
+  if (found) {
+    value = RowId(leaf->ValueAt(index));
+  }
+  buffer_pool_manager_->UnpinPage(leaf_page_id, false);
+  return found;
+}
+
+/*
+ * Batched point lookups, one descent serves every following key below the
+ * fence of the leaf it reaches.
+ */
+void PrefixBPlusTree::GetValues(const std::vector<std::string> &keys, std::vector<RowId> &values,
+                                std::vector<bool> &found) {
+  std::shared_lock<std::shared_mutex> tree_guard(tree_latch_);
+  values.assign(keys.size(), RowId());
+  found.assign(keys.size(), false);
+  if (root_page_id_ == INVALID_PAGE_ID) {
+    return;
+  }
+  std::string fence;
+  size_t i = 0;
+  while (i < keys.size()) {
+    page_id_t leaf_page_id = FindLeaf(keys[i], nullptr, &fence);
+    auto *leaf = FetchTreePage(leaf_page_id);
+    do {
+      int index = leaf->LowerBound(keys[i]);
+      if (index < leaf->GetSize() && leaf->KeyEquals(index, keys[i])) {
+        found[i] = true;
+        values[i] = RowId(leaf->ValueAt(index));
+      }
+      i++;
+    } while (i < keys.size() && (fence.empty() || keys[i] < fence));
+    buffer_pool_manager_->UnpinPage(leaf_page_id, false);
+  }
+}
+
+/*
+ * Emptied leaves are skipped by following the leaf chain.
+ */
+void PrefixBPlusTree::Scan(const std::string &from, bool inclusive, size_t max_count, std::vector<Entry> &entries) {
+  std::shared_lock<std::shared_mutex> tree_guard(tree_latch_);
+  if (root_page_id_ == INVALID_PAGE_ID) {
+    return;
+  }
+  page_id_t page_id = FindLeaf(from, nullptr);
+  auto *leaf = FetchTreePage(page_id);
+  int index = leaf->LowerBound(from);
+  if (!inclusive && index < leaf->GetSize() && leaf->KeyEquals(index, from)) {
+    index++;
+  }
+  size_t count = 0;
+  while (count < max_count) {
+    if (index >= leaf->GetSize()) {
+      page_id_t next_page_id = leaf->GetNextPageId();
+      buffer_pool_manager_->UnpinPage(page_id, false);
+      if (next_page_id == INVALID_PAGE_ID) {
+        return;
+      }
+      page_id = next_page_id;
+      leaf = FetchTreePage(page_id);
+      index = 0;
+      continue;
+    }
+    entries.push_back({leaf->KeyAt(index), leaf->ValueAt(index)});
+    index++;
+    count++;
+  }
+  buffer_pool_manager_->UnpinPage(page_id, false);
+}
+
+/*****************************************************************************
+ * INSERTION
+ *****************************************************************************/
+/*
+ * Split by bytes, not by entries: with variable-length keys an even entry
+ * count can leave one half too large for its page.
+ */
+size_t PrefixBPlusTree::SplitPoint(const PrefixBPlusTreePage *page, const std::vector<Entry> &entries) {
+  page_id_t base_page_id = PrefixBPlusTreePage::BasePageId(entries, 0, entries.size());
+  size_t total = 0;
+  for (const auto &entry : entries) {
+    total += page->EntrySize(entry.key.size(), entry.value, base_page_id);
+  }
+  size_t left = 0;
+  size_t split = 0;
+  while (split < entries.size() && left * 2 < total) {
+    left += page->EntrySize(entries[split].key.size(), entries[split].value, base_page_id);
+    split++;
+  }
+  return std::min(std::max<size_t>(split, 1), entries.size() - 1);
+}
+
+bool PrefixBPlusTree::Insert(const std::string &key, const RowId &value) {
+  std::unique_lock<std::shared_mutex> tree_guard(tree_latch_);
+  return InsertLocked(key, value);
+}
+
+/*
+ * Batched inserts. The leaf reached for the first pending entry takes every
+ * following entry below its fence while it has room, an entry that would
+ * split it goes through InsertLocked.
+ */
+void PrefixBPlusTree::InsertBatch(const std::vector<Entry> &entries, std::vector<bool> &inserted) {
+  std::unique_lock<std::shared_mutex> tree_guard(tree_latch_);
+  inserted.assign(entries.size(), false);
+  std::string fence;
+  size_t i = 0;
+  while (i < entries.size()) {
+    if (root_page_id_ == INVALID_PAGE_ID || entries[i].key.size() > MAX_KEY_SIZE) {
+      inserted[i] = InsertLocked(entries[i].key, RowId(entries[i].value));
+      i++;
+      continue;
+    }
+    page_id_t leaf_page_id = FindLeaf(entries[i].key, nullptr, &fence);
+    auto *leaf = FetchTreePage(leaf_page_id);
+    bool is_dirty = false;
+    size_t first = i;
+    while (i < entries.size() && (i == first || fence.empty() || entries[i].key < fence) &&
+           entries[i].key.size() <= MAX_KEY_SIZE) {
+      int index = leaf->LowerBound(entries[i].key);
+      if (index < leaf->GetSize() && leaf->KeyEquals(index, entries[i].key)) {
+        i++;
+        continue;
+      }
+      if (!leaf->Insert(index, entries[i].key, entries[i].value)) {
+        break;
+      }
+      inserted[i] = true;
+      is_dirty = true;
+      i++;
+    }
+    buffer_pool_manager_->UnpinPage(leaf_page_id, is_dirty);
+    if (i == first) {
+      // the leaf is full
+      inserted[i] = InsertLocked(entries[i].key, RowId(entries[i].value));
+      i++;
+    }
+  }
+}
+
+bool PrefixBPlusTree::InsertLocked(const std::string &key, const RowId &value) {
+  if (key.size() > MAX_KEY_SIZE) {
+    return false;
+  }
+  if (root_page_id_ == INVALID_PAGE_ID) {
+    auto *root = NewTreePage(root_page_id_, true);
+    root->Insert(0, key, value.Get());
+    buffer_pool_manager_->UnpinPage(root_page_id_, true);
+    UpdateRootPageId(true);
+    return true;
+  }
+  std::vector<page_id_t> path;
+  page_id_t leaf_page_id = FindLeaf(key, &path);
+  auto *leaf = FetchTreePage(leaf_page_id);
+  int index = leaf->LowerBound(key);
+  if (index < leaf->GetSize() && leaf->KeyEquals(index, key)) {
+    buffer_pool_manager_->UnpinPage(leaf_page_id, false);
+    return false;
+  }
+  if (leaf->Insert(index, key, value.Get())) {
+    buffer_pool_manager_->UnpinPage(leaf_page_id, true);
+    return true;
+  }
+  // split the leaf, the new page takes the upper half and goes right of it in the leaf chain
+  std::vector<Entry> entries;
+  leaf->GetEntries(entries);
+  entries.insert(entries.begin() + index, Entry{key, value.Get()});
+  size_t split = SplitPoint(leaf, entries);
+  page_id_t right_page_id;
+  auto *right = NewTreePage(right_page_id, true);
+  right->Build(entries, split, entries.size());
+  right->SetNextPageId(leaf->GetNextPageId());
+  leaf->Build(entries, 0, split);
+  leaf->SetNextPageId(right_page_id);
+  buffer_pool_manager_->UnpinPage(right_page_id, true);
+  buffer_pool_manager_->UnpinPage(leaf_page_id, true);
+  // shortest separator: the first right key cut one byte past its common prefix with the last left key
+  const std::string &last_left = entries[split - 1].key;
+  const std::string &first_right = entries[split].key;
+  size_t common = 0;
+  while (common < last_left.size() && last_left[common] == first_right[common]) {
+    common++;
+  }
+  InsertIntoParent(path, leaf_page_id, first_right.substr(0, common + 1), right_page_id);
+  return true;
+}
+
+void PrefixBPlusTree::InsertIntoParent(std::vector<page_id_t> &path, page_id_t left_page_id, std::string key,
+                                       page_id_t right_page_id) {
+  if (path.empty()) {
+    // the root was split
+    page_id_t root_page_id;
+    auto *root = NewTreePage(root_page_id, false);
+    root->SetFirstChild(left_page_id);
+    root->Insert(0, key, right_page_id);
+    buffer_pool_manager_->UnpinPage(root_page_id, true);
+    root_page_id_ = root_page_id;
+    UpdateRootPageId(false);
+    return;
+  }
+  page_id_t parent_page_id = path.back();
+  path.pop_back();
+  auto *parent = FetchTreePage(parent_page_id);
+  int index = parent->LowerBound(key);
+  if (parent->Insert(index, key, right_page_id)) {
+    buffer_pool_manager_->UnpinPage(parent_page_id, true);
+    return;
+  }
+  // split the internal page, the middle key moves up and its child becomes the first child of the new page
+  std::vector<Entry> entries;
+  parent->GetEntries(entries);
+  entries.insert(entries.begin() + index, Entry{std::move(key), right_page_id});
+  size_t middle = std::min(SplitPoint(parent, entries), entries.size() - 2);
+  page_id_t new_page_id;
+  auto *new_page = NewTreePage(new_page_id, false);
+  new_page->SetFirstChild(static_cast<page_id_t>(entries[middle].value));
+  new_page->Build(entries, middle + 1, entries.size());
+  parent->Build(entries, 0, middle);
+  buffer_pool_manager_->UnpinPage(new_page_id, true);
+  buffer_pool_manager_->UnpinPage(parent_page_id, true);
+  InsertIntoParent(path, parent_page_id, std::move(entries[middle].key), new_page_id);
+}
+
+void PrefixBPlusTree::UpdateRootPageId(bool insert_record) {
+  Page *roots_page = buffer_pool_manager_->FetchPage(INDEX_ROOTS_PAGE_ID);
+  auto *roots = reinterpret_cast<IndexRootsPage *>(roots_page->GetData());
+  roots_page->WLatch();
+  if (insert_record) {
+    roots->Insert(index_id_, root_page_id_);
+  } else if (root_page_id_ == INVALID_PAGE_ID) {
+    roots->Delete(index_id_);
+  } else {
+    roots->Update(index_id_, root_page_id_);
+  }
+  roots_page->WUnlatch();
+  buffer_pool_manager_->UnpinPage(INDEX_ROOTS_PAGE_ID, true);
+}
+
+/*****************************************************************************
+ * REMOVE
+ *****************************************************************************/
+bool PrefixBPlusTree::Remove(const std::string &key) {
+  std::unique_lock<std::shared_mutex> tree_guard(tree_latch_);
+  if (root_page_id_ == INVALID_PAGE_ID) {
+    return false;
+  }
+  page_id_t leaf_page_id = FindLeaf(key, nullptr);
+  auto *leaf = FetchTreePage(leaf_page_id);
+  int index = leaf->LowerBound(key);
+  bool found = index < leaf->GetSize() && leaf->KeyEquals(index, key);
+  if (found) {
+    leaf->Remove(index);
+  }
+  buffer_pool_manager_->UnpinPage(leaf_page_id, found);
+  return found;
+}
+
+/*****************************************************************************
+ * UTILITIES
+ *****************************************************************************/
+PrefixBPlusTree::Stats PrefixBPlusTree::GetStats() {
+  std::shared_lock<std::shared_mutex> tree_guard(tree_latch_);
+  Stats stats;
+  if (root_page_id_ != INVALID_PAGE_ID) {
+    CollectStats(root_page_id_, 1, stats);
+  }
+  return stats;
+}
+
+void PrefixBPlusTree::CollectStats(page_id_t page_id, uint32_t depth, Stats &stats) {
+  auto *page = FetchTreePage(page_id);
+  std::vector<page_id_t> children;
+  if (page->IsLeafPage()) {
+    stats.height = std::max(stats.height, depth);
+    stats.leaf_pages++;
+    stats.entries += page->GetSize();
+    stats.leaf_bytes += page->GetUsedBytes();
+    for (int i = 0; i < page->GetSize(); i++) {
+      stats.key_bytes += page->KeyAt(i).size();
+      stats.value_bytes += page->ValueSizeAt(i);
+    }
+  } else {
+    stats.internal_pages++;
+    children.push_back(page->GetFirstChild());
+    for (int i = 0; i < page->GetSize(); i++) {
+      children.push_back(static_cast<page_id_t>(page->ValueAt(i)));
+    }
+  }
+  buffer_pool_manager_->UnpinPage(page_id, false);
+  for (auto child : children) {
+    CollectStats(child, depth + 1, stats);
+  }
+}
+
+void PrefixBPlusTree::Destroy() {
+  std::unique_lock<std::shared_mutex> tree_guard(tree_latch_);
+  if (root_page_id_ == INVALID_PAGE_ID) {
+    return;
+  }
+  DestroyPage(root_page_id_);
+  root_page_id_ = INVALID_PAGE_ID;
+  UpdateRootPageId(false);
+}
+
+void PrefixBPlusTree::DestroyPage(page_id_t page_id) {
+  auto *page = FetchTreePage(page_id);
+  if (!page->IsLeafPage()) {
+    DestroyPage(page->GetFirstChild());
+    for (int i = 0; i < page->GetSize(); i++) {
+      DestroyPage(static_cast<page_id_t>(page->ValueAt(i)));
+    }
+  }
+  buffer_pool_manager_->UnpinPage(page_id, false);
+  buffer_pool_manager_->DeletePage(page_id);
+}
@@ -0,0 +1,338 @@
+#include "index/prefix_b_plus_tree_index.h"
+
+#include <algorithm>
+#include <cstring>
+
+// number of entries read from the tree by one cursor refill
+static const size_t CURSOR_BATCH_SIZE = 64;
+
+/*
+ * Bits of an INT or FLOAT field whose unsigned order is the order of the
+ * column values, the field may hold the other numeric type.
+ */
+static uint32_t OrderedKeyBits(const Field *field, TypeId column_type) {
+  char buf[sizeof(int64_t)];
+  field->SerializeTo(buf);
+  bool is_float = field->GetTypeId() == TypeId::kTypeFloat;
+  if (column_type == TypeId::kTypeFloat) {
+    float value = is_float ? MACH_READ_FROM(float, buf) : static_cast<float>(MACH_READ_INT32(buf));
+    if (value == 0) {
+      // -0.0 and 0.0 are the same key
+      value = 0;
+    }
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x80000000U) ? ~bits : bits | 0x80000000U;
+  }
+  int32_t value = is_float ? static_cast<int32_t>(MACH_READ_FROM(float, buf)) : MACH_READ_INT32(buf);
+  return static_cast<uint32_t>(value) ^ 0x80000000U;
+}
+
+static Field FromOrderedKeyBits(uint32_t part, TypeId column_type) {
+  if (column_type == TypeId::kTypeFloat) {
+    uint32_t bits = (part & 0x80000000U) ? part & 0x7fffffffU : ~part;
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return Field(TypeId::kTypeFloat, value);
+  }
+  return Field(TypeId::kTypeInt, static_cast<int32_t>(part ^ 0x80000000U));
+}
+
+/*
+ * Turn key into the smallest string greater than every string starting with
+ * it, return false if there is none (key is all 0xFF bytes).
+ */
+static bool PrefixSuccessor(std::string &key) {
+  while (!key.empty() && static_cast<unsigned char>(key.back()) == 0xFF) {
+    key.pop_back();
+  }
+  if (key.empty()) {
+    return false;
+  }
+  key.back() = static_cast<char>(static_cast<unsigned char>(key.back()) + 1);
+  return true;
+}
+
+PrefixBPlusTreeIndex::PrefixBPlusTreeIndex(index_id_t index_id, IndexSchema *key_schema,
+                                           BufferPoolManager *buffer_pool_manager)
+    : Index(index_id, key_schema), container_(index_id, buffer_pool_manager) {}
+
+bool PrefixBPlusTreeIndex::EncodeKey(const Row &key, const IndexSchema *key_schema, std::string &encoded) {
+  encoded.clear();
+  uint32_t field_count = std::min<uint32_t>(key.GetFieldCount(), key_schema->GetColumnCount());
+  for (uint32_t i = 0; i < field_count; i++) {
+    Field *field = key.GetField(i);
+    if (field->IsNull()) {
+      return false;
+    }
+    TypeId column_type = key_schema->GetColumn(i)->GetType();
+    if (column_type == TypeId::kTypeChar) {
+      const char *data = field->GetData();
+      for (uint32_t j = 0; j < field->GetLength(); j++) {
+        encoded.push_back(data[j]);
+        if (data[j] == '\0') {
+          encoded.push_back(static_cast<char>(0xFF));
+        }
+      }
+      encoded.append(2, '\0');
+    } else {
+      uint32_t bits = OrderedKeyBits(field, column_type);
+      for (int shift = 24; shift >= 0; shift -= 8) {
+        encoded.push_back(static_cast<char>(bits >> shift));
+      }
+    }
+  }
+  return true;
+}
+
+void PrefixBPlusTreeIndex::DecodeKey(const std::string &encoded, const IndexSchema *key_schema, Row &key) {
+  std::vector<Field> fields;
+  size_t pos = 0;
+  for (uint32_t i = 0; i < key_schema->GetColumnCount(); i++) {
+    TypeId column_type = key_schema->GetColumn(i)->GetType();
+    if (column_type == TypeId::kTypeChar) {
+      std::string value;
+      while (encoded[pos] != '\0' || encoded[pos + 1] != '\0') {
+        value.push_back(encoded[pos]);
+        // an escaped 0x00 is followed by 0xFF
+        pos += encoded[pos] == '\0' ? 2 : 1;
+      }
+      pos += 2;
+      fields.emplace_back(TypeId::kTypeChar, const_cast<char *>(value.data()), value.size(), true);
+    } else {
+      uint32_t bits = 0;
+      for (int j = 0; j < 4; j++) {
+        bits = bits << 8 | static_cast<unsigned char>(encoded[pos++]);
+      }
+      fields.push_back(FromOrderedKeyBits(bits, column_type));
+    }
+  }
+  key = Row(fields);
+}
+
+size_t PrefixBPlusTreeIndex::MaxEncodedKeySize(const IndexSchema *key_schema) {
+  size_t size = 0;
+  for (auto col : key_schema->GetColumns()) {
+    size += col->GetType() == TypeId::kTypeChar ? 2 * col->GetLength() + 2 : sizeof(uint32_t);
+  }
+  return size;
+}
+
+dberr_t PrefixBPlusTreeIndex::InsertEntry(const Row &key, RowId row_id, Txn * /*txn*/) {
+  std::string encoded;
+  if (!EncodeKey(key, key_schema_, encoded) || !container_.Insert(encoded, row_id)) {
+    return DB_FAILED;
+  }
+  return DB_SUCCESS;
+}
+
+dberr_t PrefixBPlusTreeIndex::RemoveEntry(const Row &key, RowId /*row_id*/, Txn * /*txn*/) {
+  std::string encoded;
+  if (EncodeKey(key, key_schema_, encoded)) {
+    container_.Remove(encoded);
+  }
+  return DB_SUCCESS;
+}
+
+dberr_t PrefixBPlusTreeIndex::ScanKey(const Row &key, vector<RowId> &result, Txn *txn, string compare_operator) {
+  std::string encoded;
+  if (!EncodeKey(key, key_schema_, encoded)) {
+    return DB_KEY_NOT_FOUND;
+  }
+  std::vector<IndexRange> ranges;
+  if (compare_operator == "=" && key.GetFieldCount() < key_schema_->GetColumnCount()) {
+    // equality on a prefix of the key columns is a range
+    ranges.push_back({&key, true, &key, true});
+  } else if (compare_operator == "=") {
+    RowId row_id;
+    if (container_.GetValue(encoded, row_id)) {
+      result.push_back(row_id);
+    }
+  } else if (compare_operator == ">" || compare_operator == ">=") {
+    ranges.push_back({&key, compare_operator == ">=", nullptr, true});
+  } else if (compare_operator == "<" || compare_operator == "<=") {
+    ranges.push_back({nullptr, true, &key, compare_operator == "<="});
+  } else if (compare_operator == "<>") {
+    ranges.push_back({nullptr, true, &key, false});
+    ranges.push_back({&key, false, nullptr, true});
+  }
+  for (auto &range : ranges) {
+    auto cursor = ScanRange(range, txn);
+    RowId row_id;
+    while (cursor->Next(row_id)) {
+      result.emplace_back(row_id);
+    }
+  }
+  if (!result.empty())
+    return DB_SUCCESS;
+  else
+    return DB_KEY_NOT_FOUND;
+}
+
+/*
+ * The encoded keys are sorted so the tree answers them in one left to right
+ * pass, prefix rows are ranges and go through ScanKey.
+ */
+dberr_t PrefixBPlusTreeIndex::ScanKeys(const std::vector<Row> &keys, std::vector<std::vector<RowId>> &result,
+                                       Txn *txn) {
+  result.assign(keys.size(), std::vector<RowId>());
+  bool any_found = false;
+  std::vector<std::pair<std::string, size_t>> probes;
+  probes.reserve(keys.size());
+  for (size_t i = 0; i < keys.size(); i++) {
+    std::string encoded;
+    if (keys[i].GetFieldCount() < key_schema_->GetColumnCount()) {
+      any_found = ScanKey(keys[i], result[i], txn) == DB_SUCCESS || any_found;
+    } else if (EncodeKey(keys[i], key_schema_, encoded)) {
+      probes.emplace_back(std::move(encoded), i);
+    }
+  }
+  std::sort(probes.begin(), probes.end());
+  std::vector<std::string> sorted_keys;
+  sorted_keys.reserve(probes.size());
+  for (auto &probe : probes) {
+    sorted_keys.push_back(std::move(probe.first));
+  }
+  std::vector<RowId> values;
+  std::vector<bool> found;
+  container_.GetValues(sorted_keys, values, found);
+  for (size_t i = 0; i < probes.size(); i++) {
+    if (found[i]) {
+      result[probes[i].second].push_back(values[i]);
+      any_found = true;
+    }
+  }
+  return any_found ? DB_SUCCESS : DB_KEY_NOT_FOUND;
+}
+
+dberr_t PrefixBPlusTreeIndex::InsertEntries(const std::vector<Row> &keys, const std::vector<RowId> &row_ids,
+                                            Txn * /*txn*/) {
+  dberr_t status = DB_SUCCESS;
+  std::vector<PrefixBPlusTree::Entry> entries;
+  entries.reserve(keys.size());
+  for (size_t i = 0; i < keys.size(); i++) {
+    std::string encoded;
+    if (EncodeKey(keys[i], key_schema_, encoded)) {
+      entries.push_back({std::move(encoded), row_ids[i].Get()});
+    } else {
+      status = DB_FAILED;
+    }
+  }
+  std::stable_sort(entries.begin(), entries.end(),
+                   [](const PrefixBPlusTree::Entry &a, const PrefixBPlusTree::Entry &b) { return a.key < b.key; });
+  std::vector<bool> inserted;
+  container_.InsertBatch(entries, inserted);
+  if (std::find(inserted.begin(), inserted.end(), false) != inserted.end()) {
+    status = DB_FAILED;
+  }
+  return status;
+}
+
+/*
+ * A prefix row stands for all keys starting with its encoding: such keys are
+ * all greater than the prefix itself and all less than its successor.
+ */
+bool PrefixBPlusTreeIndex::EncodeRange(const IndexRange &range, const IndexSchema *key_schema, std::string &lower,
+                                       bool &lower_inclusive, bool &has_upper, std::string &upper,
+                                       bool &upper_inclusive) {
+  lower.clear();
+  upper.clear();
+  lower_inclusive = true;
+  upper_inclusive = true;
+  has_upper = range.upper != nullptr;
+  if ((range.lower != nullptr && !EncodeKey(*range.lower, key_schema, lower)) ||
+      (has_upper && !EncodeKey(*range.upper, key_schema, upper))) {
+    // comparing with null matches nothing
+    return false;
+  }
+  if (range.lower != nullptr) {
+    lower_inclusive = range.lower_inclusive;
+    if (!lower_inclusive && range.lower->GetFieldCount() < key_schema->GetColumnCount()) {
+      if (!PrefixSuccessor(lower)) {
+        return false;
+      }
+      lower_inclusive = true;
+    }
+  }
+  if (has_upper) {
+    upper_inclusive = range.upper_inclusive;
+    if (upper_inclusive && range.upper->GetFieldCount() < key_schema->GetColumnCount()) {
+      has_upper = PrefixSuccessor(upper);
+      upper_inclusive = false;
+    }
+  }
+  return true;
+}
+
+std::unique_ptr<IndexCursor> PrefixBPlusTreeIndex::ScanRange(const IndexRange &range, Txn * /*txn*/) {
+  std::string lower;
+  std::string upper;
+  bool lower_inclusive;
+  bool upper_inclusive;
+  bool has_upper;
+  if (!EncodeRange(range, key_schema_, lower, lower_inclusive, has_upper, upper, upper_inclusive)) {
+    return std::make_unique<VectorIndexCursor>(std::vector<RowId>());
+  }
+  return std::make_unique<PrefixBPlusTreeIndexCursor>(&container_, key_schema_, std::move(lower), lower_inclusive,
+                                                      has_upper, std::move(upper), upper_inclusive);
+}
+
+dberr_t PrefixBPlusTreeIndex::Destroy() {
+  container_.Destroy();
+  return DB_SUCCESS;
+}
+
+void PrefixBPlusTreeIndex::GetShape(uint32_t &height, uint32_t &leaf_pages) {
+  auto stats = container_.GetStats();
+  height = stats.height;
+  leaf_pages = stats.leaf_pages;
+}
+
+const PrefixBPlusTree::Entry *PrefixBPlusTreeIndexCursor::NextItem() {
+  if (pos_ >= batch_.size()) {
+    if (exhausted_) {
+      return nullptr;
+    }
+    batch_.clear();
+    pos_ = 0;
+    container_->Scan(last_key_, last_inclusive_, CURSOR_BATCH_SIZE, batch_);
+    if (batch_.size() < CURSOR_BATCH_SIZE) {
+      exhausted_ = true;
+    }
+    if (batch_.empty()) {
+      return nullptr;
+    }
+    last_key_ = batch_.back().key;
+    last_inclusive_ = false;
+  }
+  const auto *entry = &batch_[pos_];
+  if (has_upper_) {
+    int cmp = entry->key.compare(upper_);
+    if (cmp > 0 || (cmp == 0 && !upper_inclusive_)) {
+      exhausted_ = true;
+      pos_ = batch_.size();
+      return nullptr;
+    }
+  }
+  pos_++;
+  return entry;
+}
+
+bool PrefixBPlusTreeIndexCursor::Next(RowId &row_id) {
+  const auto *entry = NextItem();
+  if (entry == nullptr) {
+    return false;
+  }
+  row_id = RowId(entry->value);
+  return true;
+}
+
+bool PrefixBPlusTreeIndexCursor::NextEntry(RowId &row_id, Row &key) {
+  const auto *entry = NextItem();
+  if (entry == nullptr) {
+    return false;
+  }
+  row_id = RowId(entry->value);
+  PrefixBPlusTreeIndex::DecodeKey(entry->key, key_schema_, key);
+  return true;
+}
@@ -0,0 +1,1428 @@
+#include "index/typed_b_plus_tree.h"
+
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include "glog/logging.h"
+#include "index/basic_comparator.h"
+#include "page/index_roots_page.h"
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+TypedBPlusTree<KeyType, KeyComparator>::TypedBPlusTree(index_id_t index_id, BufferPoolManager *buffer_pool_manager,
+                                                       const KeyComparator &comparator, int leaf_max_size,
+                                                       int internal_max_size)
+    : index_id_(index_id),
+      buffer_pool_manager_(buffer_pool_manager),
+      comparator_(comparator),
+      leaf_max_size_(leaf_max_size == UNDEFINED_SIZE ? LeafPage::Capacity() - 1
+                                                     : std::min(leaf_max_size, LeafPage::Capacity() - 1)),
+      internal_max_size_(internal_max_size == UNDEFINED_SIZE
+                             ? InternalPage::Capacity() - 1
+                             : std::min(internal_max_size, InternalPage::Capacity() - 1)) {
+  Page *roots_page = buffer_pool_manager_->FetchPage(INDEX_ROOTS_PAGE_ID);
+  roots_page->RLatch();
+  page_id_t root_page_id;
+  if (!reinterpret_cast<IndexRootsPage *>(roots_page->GetData())->GetRootId(index_id_, &root_page_id)) {
+    root_page_id = INVALID_PAGE_ID;
+  }
+  roots_page->RUnlatch();
+  root_page_id_ = root_page_id;
+  buffer_pool_manager_->UnpinPage(INDEX_ROOTS_PAGE_ID, false);
+}
+
+/*
+ * Release every page of the tree, including the root record in the index
+ * roots page when called on the whole tree.
+ * Must not run concurrently with readers of this tree.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TypedBPlusTree<KeyType, KeyComparator>::Destroy(page_id_t current_page_id) {
+  bool is_root = current_page_id == INVALID_PAGE_ID;
+  std::unique_lock<std::shared_mutex> smo_guard(smo_latch_, std::defer_lock);
+  if (is_root) {
+    smo_guard.lock();
+    if (IsEmpty()) {
+      return;
+    }
+    current_page_id = root_page_id_;
+  }
+  auto *node = reinterpret_cast<BPlusTreePage *>(buffer_pool_manager_->FetchPage(current_page_id)->GetData());
+  if (!node->IsLeafPage()) {
+    auto *internal = reinterpret_cast<InternalPage *>(node);
+    for (int i = 0; i < internal->GetSize(); i++) {
+      Destroy(internal->ValueAt(i));
+    }
+  }
+  buffer_pool_manager_->UnpinPage(current_page_id, false);
+  buffer_pool_manager_->DeletePage(current_page_id);
+  if (is_root) {
+    adaptive_hash_.Clear();
+    root_latch_.WLock();
+    root_page_id_ = INVALID_PAGE_ID;
+    UpdateRootPageId(0);
+    root_latch_.WUnlock();
+  }
+}
+
+/*
+ * Helper function to decide whether current b+tree is empty
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool TypedBPlusTree<KeyType, KeyComparator>::IsEmpty() const {
+  return root_page_id_ == INVALID_PAGE_ID;
+}
+
+/*****************************************************************************
+ * OPTIMISTIC LOCK COUPLING
+ *****************************************************************************/
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+OptimisticLatch *TypedBPlusTree<KeyType, KeyComparator>::LatchOf(const NodeRef &ref) {
+  return ref.page == nullptr ? &root_latch_ : ref.page->GetVersionLatch();
+}
+
+/*
+ * Unpin the page of a node reference, the root pointer reference holds no pin.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TypedBPlusTree<KeyType, KeyComparator>::Release(NodeRef &ref, bool is_dirty) {
+  if (ref.page != nullptr) {
+    buffer_pool_manager_->UnpinPage(ref.page->GetPageId(), is_dirty);
+    ref.page = nullptr;
+  }
+}
+
+/*
+ * Descend from the root to the leaf covering key (or the left most leaf)
+ * without taking any write latch. Every node is read under its version, which
+ * is validated before the child pointer read from it is followed.
+ * When split_full is set, a full internal node met on the way is split first,
+ * so that a leaf split later only has to touch the leaf and its parent.
+ * @return: false on conflict, the caller restarts and nothing is pinned.
+ * Otherwise leaf and its parent (nullptr page for the root pointer) are pinned
+ * together with the versions read; leaf.page is nullptr for an empty tree.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool TypedBPlusTree<KeyType, KeyComparator>::Descend(const KeyType &key, bool left_most, bool split_full,
+                                                     NodeRef &parent, NodeRef &leaf) {
+  parent = NodeRef();
+  leaf = NodeRef();
+  if (!root_latch_.ReadLock(parent.version)) {
+    return false;
+  }
+  page_id_t root_page_id = root_page_id_;
+  if (root_page_id == INVALID_PAGE_ID) {
+    return root_latch_.Validate(parent.version);
+  }
+  NodeRef node;
+  node.page = buffer_pool_manager_->FetchPage(root_page_id);
+  if (node.page == nullptr) {
+    return false;
+  }
+  if (!LatchOf(node)->ReadLock(node.version) || !root_latch_.Validate(parent.version)) {
+    Release(node);
+    return false;
+  }
+  while (true) {
+    auto *tree_page = reinterpret_cast<BPlusTreePage *>(node.page->GetData());
+    if (tree_page->IsLeafPage()) {
+      if (tree_page->GetSize() < 0 || tree_page->GetSize() > LeafPage::Capacity()) {
+        break;
+      }
+      leaf = node;
+      return true;
+    }
+    auto *internal = reinterpret_cast<InternalPage *>(tree_page);
+    // a torn read of a node under modification, the validation below would fail anyway
+    if (internal->GetSize() < 1 || internal->GetSize() > InternalPage::Capacity()) {
+      break;
+    }
+    if (split_full && internal->GetSize() >= internal_max_size_) {
+      SplitInner(parent, node);
+      return false;
+    }
+    page_id_t child_page_id = left_most ? internal->ValueAt(0) : internal->Lookup(key, comparator_);
+    if (!LatchOf(node)->Validate(node.version)) {
+      break;
+    }
+    Release(parent);
+    NodeRef child;
+    child.page = buffer_pool_manager_->FetchPage(child_page_id);
+    if (child.page == nullptr) {
+      break;
+    }
+    if (!LatchOf(child)->ReadLock(child.version) || !LatchOf(node)->Validate(node.version)) {
+      Release(child);
+      break;
+    }
+    parent = node;
+    node = child;
+  }
+  Release(node);
+  Release(parent);
+  return false;
+}
+
+/*
+ * Descend like Descend, but choosing at every inner node the last child whose
+ * keys may be <= key (< key unless inclusive). The leaf reached may still hold
+ * no such key, the caller then continues from the fence, the lower bound of
+ * the keys under the leaf.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool TypedBPlusTree<KeyType, KeyComparator>::DescendBefore(const KeyType *key, bool inclusive, NodeRef &leaf,
+                                                           bool &has_fence, KeyType &fence) {
+  leaf = NodeRef();
+  has_fence = false;
+  NodeRef parent;
+  if (!root_latch_.ReadLock(parent.version)) {
+    return false;
+  }
+  page_id_t root_page_id = root_page_id_;
+  if (root_page_id == INVALID_PAGE_ID) {
+    return root_latch_.Validate(parent.version);
+  }
+  NodeRef node;
+  node.page = buffer_pool_manager_->FetchPage(root_page_id);
+  if (node.page == nullptr) {
+    return false;
+  }
+  if (!LatchOf(node)->ReadLock(node.version) || !root_latch_.Validate(parent.version)) {
+    Release(node);
+    return false;
+  }
+  while (true) {
+    auto *tree_page = reinterpret_cast<BPlusTreePage *>(node.page->GetData());
+    if (tree_page->IsLeafPage()) {
+      if (tree_page->GetSize() < 0 || tree_page->GetSize() > LeafPage::Capacity()) {
+        break;
+      }
+      leaf = node;
+      return true;
+    }
+    auto *internal = reinterpret_cast<InternalPage *>(tree_page);
+    int size = internal->GetSize();
+    if (size < 1 || size > InternalPage::Capacity()) {
+      break;
+    }
+    // first separator past key, the child before it is the last one that may hold keys before key
+    int index = size;
+    if (key != nullptr) {
+      int left = 1;
+      while (left < index) {
+        int mid = left + (index - left) / 2;
+        int cmp = comparator_(internal->KeyAt(mid), *key);
+        if (cmp < 0 || (cmp == 0 && inclusive)) {
+          left = mid + 1;
+        } else {
+          index = mid;
+        }
+      }
+    }
+    index--;
+    if (index > 0) {
+      has_fence = true;
+      fence = internal->KeyAt(index);
+    }
+    page_id_t child_page_id = internal->ValueAt(index);
+    if (!LatchOf(node)->Validate(node.version)) {
+      break;
+    }
+    NodeRef child;
+    child.page = buffer_pool_manager_->FetchPage(child_page_id);
+    if (child.page == nullptr) {
+      break;
+    }
+    if (!LatchOf(child)->ReadLock(child.version) || !LatchOf(node)->Validate(node.version)) {
+      Release(child);
+      break;
+    }
+    Release(node);
+    node = child;
+  }
+  Release(node);
+  return false;
+}
+
+/*
+ * Split a full internal node met during an optimistic descent, with both the
+ * node and its parent write latched. Releases both references.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TypedBPlusTree<KeyType, KeyComparator>::SplitInner(NodeRef &parent, NodeRef &node) {
+  if (!LatchOf(parent)->TryUpgrade(parent.version)) {
+    Release(node);
+    Release(parent);
+    return;
+  }
+  if (!LatchOf(node)->TryUpgrade(node.version)) {
+    LatchOf(parent)->WUnlock();
+    Release(node);
+    Release(parent);
+    return;
+  }
+  auto *internal = reinterpret_cast<InternalPage *>(node.page->GetData());
+  InternalPage *new_node = Split(internal, nullptr);
+  InsertIntoParent(parent, internal, new_node->KeyAt(0), new_node);
+  buffer_pool_manager_->UnpinPage(new_node->GetPageId(), true);
+  LatchOf(node)->WUnlock();
+  LatchOf(parent)->WUnlock();
+  Release(node, true);
+  Release(parent, true);
+}
+
+/*****************************************************************************
+ * SEARCH
+ *****************************************************************************/
+/*
+ * Return the only value that associated with input key
+ * This method is used for point query
+ * @return : true means key exists
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool TypedBPlusTree<KeyType, KeyComparator>::GetValue(const KeyType &key, std::vector<RowId> &result,
+                                                      Txn * /*transaction*/) {
+  RowId value;
+  if (adaptive_hash_.IsEnabled() && HashLookup(key, value)) {
+    result.emplace_back(value);
+    return true;
+  }
+  while (true) {
+    NodeRef parent, leaf;
+    if (!Descend(key, false, false, parent, leaf)) {
+      continue;
+    }
+    Release(parent);
+    if (leaf.page == nullptr) {
+      return false;
+    }
+    auto *node = reinterpret_cast<LeafPage *>(leaf.page->GetData());
+    int index = node->KeyIndex(key, comparator_);
+    bool found = index < node->GetSize() && comparator_(node->KeyAt(index), key) == 0;
+    if (found) {
+      value = node->ValueAt(index);
+    }
+    page_id_t page_id = leaf.page->GetPageId();
+    auto state = AdaptiveHashIndex<KeyType>::LeafState::kCold;
+    std::vector<KeyType> page_keys;
+    if (adaptive_hash_.IsEnabled()) {
+      state = adaptive_hash_.RecordDescent(page_id);
+      if (state == AdaptiveHashIndex<KeyType>::LeafState::kBuild) {
+        for (int i = 0; i < node->GetSize(); i++) {
+          page_keys.push_back(node->KeyAt(i));
+        }
+      }
+    }
+    bool valid = LatchOf(leaf)->Validate(leaf.version);
+    Release(leaf);
+    if (!valid) {
+      continue;
+    }
+    if (state == AdaptiveHashIndex<KeyType>::LeafState::kBuild) {
+      adaptive_hash_.AddPage(page_id, page_keys);
+    } else if (state == AdaptiveHashIndex<KeyType>::LeafState::kHashed && found) {
+      adaptive_hash_.Add(key, page_id, index);
+    }
+    if (found) {
+      result.emplace_back(value);
+    }
+    return found;
+  }
+}
+
+/*
+ * Read the slot the adaptive hash hints for key. The hint is trusted only if
+ * the page is still a leaf holding key at that slot and its version did not
+ * change while reading, a stale hint is dropped.
+ * No validated node points to the hinted page, it may have been deleted (and
+ * read back from disk, or reused) since the hint was taken. FinishSmo drops
+ * the hints of a page before deleting it, so the hint still being there after
+ * the read shows the page was a leaf of this tree while it was read.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool TypedBPlusTree<KeyType, KeyComparator>::HashLookup(const KeyType &key, RowId &value) {
+  typename AdaptiveHashIndex<KeyType>::Location location;
+  if (!adaptive_hash_.Lookup(key, location)) {
+    return false;
+  }
+  NodeRef leaf;
+  leaf.page = buffer_pool_manager_->FetchPage(location.page_id);
+  if (leaf.page == nullptr) {
+    return false;
+  }
+  bool match = false;
+  if (LatchOf(leaf)->ReadLock(leaf.version)) {
+    auto *node = reinterpret_cast<LeafPage *>(leaf.page->GetData());
+    match = node->IsLeafPage() && location.slot < node->GetSize() && node->GetSize() <= LeafPage::Capacity() &&
+            comparator_(node->KeyAt(location.slot), key) == 0;
+    if (match) {
+      value = node->ValueAt(location.slot);
+    }
+    match = match && LatchOf(leaf)->Validate(leaf.version);
+  }
+  Release(leaf);
+  typename AdaptiveHashIndex<KeyType>::Location current;
+  match = match && adaptive_hash_.Lookup(key, current) && current.page_id == location.page_id &&
+          current.slot == location.slot;
+  if (match) {
+    adaptive_hash_.RecordHit();
+  } else {
+    adaptive_hash_.Remove(key);
+  }
+  return match;
+}
+
+/*
+ * The separator following the leaf in its parent bounds the keys the leaf
+ * covers. A leaf that is the last child of its parent has no such separator,
+ * its own last key (or no bound at all for the right most leaf) is used then.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool TypedBPlusTree<KeyType, KeyComparator>::LeafFence(NodeRef &parent, NodeRef &leaf, bool &has_fence,
+                                                       KeyType &fence) {
+  has_fence = false;
+  if (parent.page == nullptr) {
+    return true;
+  }
+  auto *internal = reinterpret_cast<InternalPage *>(parent.page->GetData());
+  int index = internal->ValueIndex(leaf.page->GetPageId());
+  if (index >= 0 && index + 1 < internal->GetSize()) {
+    has_fence = true;
+    fence = internal->KeyAt(index + 1);
+  }
+  bool valid = LatchOf(parent)->Validate(parent.version);
+  Release(parent);
+  if (!valid) {
+    Release(leaf);
+  }
+  return valid;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool TypedBPlusTree<KeyType, KeyComparator>::LeafCovers(const LeafPage *node, bool has_fence, const KeyType &fence,
+                                                        const KeyType &key) const {
+  if (has_fence) {
+    return comparator_(key, fence) < 0;
+  }
+  return node->GetNextPageId() == INVALID_PAGE_ID ||
+         (node->GetSize() > 0 && comparator_(key, node->KeyAt(node->GetSize() - 1)) <= 0);
+}
+
+/*
+ * Batched point lookups. One descent serves the first key not answered yet
+ * and every following key the leaf covers, the leaf version is validated once
+ * for all of them.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TypedBPlusTree<KeyType, KeyComparator>::GetValues(const std::vector<KeyType> &keys, std::vector<RowId> &values,
+                                                       std::vector<bool> &found) {
+  values.assign(keys.size(), RowId());
+  found.assign(keys.size(), false);
+  size_t i = 0;
+  while (i < keys.size()) {
+    NodeRef parent, leaf;
+    if (!Descend(keys[i], false, false, parent, leaf)) {
+      continue;
+    }
+    if (leaf.page == nullptr) {
+      Release(parent);
+      return;
+    }
+    bool has_fence;
+    KeyType fence;
+    if (!LeafFence(parent, leaf, has_fence, fence)) {
+      continue;
+    }
+    auto *node = reinterpret_cast<LeafPage *>(leaf.page->GetData());
+    size_t j = i;
+    do {
+      found[j] = node->Lookup(keys[j], values[j], comparator_);
+      j++;
+    } while (j < keys.size() && LeafCovers(node, has_fence, fence, keys[j]));
+    bool valid = LatchOf(leaf)->Validate(leaf.version);
+    Release(leaf);
+    if (valid) {
+      i = j;
+    }
+  }
+}
+
+/*
+ * Replace the value stored with an existing key in place. Only the leaf is
+ * write latched, the shared smo_latch_ keeps merges from moving the entry.
+ * @return: false if the key does not exist
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool TypedBPlusTree<KeyType, KeyComparator>::Update(const KeyType &key, const RowId &value, Txn * /*transaction*/) {
+  while (true) {
+    std::shared_lock<std::shared_mutex> smo_guard(smo_latch_);
+    NodeRef parent, leaf;
+    if (!Descend(key, false, false, parent, leaf)) {
+      continue;
+    }
+    Release(parent);
+    if (leaf.page == nullptr) {
+      return false;
+    }
+    auto *node = reinterpret_cast<LeafPage *>(leaf.page->GetData());
+    int index = node->KeyIndex(key, comparator_);
+    bool found = index < node->GetSize() && comparator_(node->KeyAt(index), key) == 0;
+    if (!found) {
+      bool valid = LatchOf(leaf)->Validate(leaf.version);
+      Release(leaf);
+      if (!valid) {
+        continue;
+      }
+      return false;
+    }
+    if (!LatchOf(leaf)->TryUpgrade(leaf.version)) {
+      Release(leaf);
+      std::this_thread::yield();
+      continue;
+    }
+    node->SetValueAt(index, value);
+    LatchOf(leaf)->WUnlock();
+    Release(leaf, true);
+    return true;
+  }
+}
+
+/*****************************************************************************
+ * INSERTION
+ *****************************************************************************/
+/*
+ * Insert constant key & value pair into b+ tree
+ * if current tree is empty, start new tree, update root page id and insert
+ * entry, otherwise insert into leaf page.
+ * @return: since we only support unique key, if user try to insert duplicate
+ * keys return false, otherwise return true.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool TypedBPlusTree<KeyType, KeyComparator>::Insert(const KeyType &key, const RowId &value, Txn * /*transaction*/) {
+  while (true) {
+    OpResult result;
+    {
+      std::shared_lock<std::shared_mutex> smo_guard(smo_latch_);
+      result = OptimisticInsert(key, value);
+    }
+    if (result == OpResult::kDone || result == OpResult::kFailed) {
+      return result == OpResult::kDone;
+    }
+    if (result == OpResult::kEmpty) {
+      std::unique_lock<std::shared_mutex> smo_guard(smo_latch_);
+      if (IsEmpty()) {
+        StartNewTree(key, value);
+        return true;
+      }
+    } else {
+      // back off so that the conflicting writer can finish
+      std::this_thread::yield();
+    }
+  }
+}
+
+/*
+ * Batched inserts. The leaf reached for the first pending entry is write
+ * latched once and takes every following entry it covers while it has room.
+ * An entry that would split the leaf, or the first one of an empty tree, goes
+ * through Insert.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TypedBPlusTree<KeyType, KeyComparator>::InsertBatch(const std::vector<MappingType> &entries,
+                                                         std::vector<bool> &inserted) {
+  inserted.assign(entries.size(), false);
+  size_t i = 0;
+  while (i < entries.size()) {
+    size_t j = i;
+    {
+      std::shared_lock<std::shared_mutex> smo_guard(smo_latch_);
+      NodeRef parent, leaf;
+      if (!Descend(entries[i].first, false, true, parent, leaf)) {
+        continue;
+      }
+      if (leaf.page == nullptr) {
+        Release(parent);
+      } else {
+        bool has_fence;
+        KeyType fence;
+        if (!LeafFence(parent, leaf, has_fence, fence)) {
+          continue;
+        }
+        if (!LatchOf(leaf)->TryUpgrade(leaf.version)) {
+          Release(leaf);
+          std::this_thread::yield();
+          continue;
+        }
+        auto *node = reinterpret_cast<LeafPage *>(leaf.page->GetData());
+        bool is_dirty = false;
+        while (j < entries.size() && node->GetSize() < node->GetMaxSize() &&
+               (j == i || LeafCovers(node, has_fence, fence, entries[j].first))) {
+          RowId exist;
+          if (!node->Lookup(entries[j].first, exist, comparator_)) {
+            node->Insert(entries[j].first, entries[j].second, comparator_);
+            inserted[j] = true;
+            is_dirty = true;
+          }
+          j++;
+        }
+        LatchOf(leaf)->WUnlock();
+        Release(leaf, is_dirty);
+      }
+    }
+    if (j == i) {
+      inserted[i] = Insert(entries[i].first, entries[i].second);
+      j++;
+    }
+    i = j;
+  }
+}
+
+/*
+ * One optimistic insert attempt. Only the leaf is write latched unless it
+ * splits, in which case its parent (never full after Descend) is latched too.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+typename TypedBPlusTree<KeyType, KeyComparator>::OpResult TypedBPlusTree<KeyType, KeyComparator>::OptimisticInsert(
+    const KeyType &key, const RowId &value) {
+  NodeRef parent, leaf;
+  if (!Descend(key, false, true, parent, leaf)) {
+    return OpResult::kRestart;
+  }
+  if (leaf.page == nullptr) {
+    return OpResult::kEmpty;
+  }
+  auto *node = reinterpret_cast<LeafPage *>(leaf.page->GetData());
+  RowId exist;
+  if (node->Lookup(key, exist, comparator_)) {
+    bool valid = LatchOf(leaf)->Validate(leaf.version);
+    Release(leaf);
+    Release(parent);
+    return valid ? OpResult::kFailed : OpResult::kRestart;
+  }
+  if (node->GetSize() < node->GetMaxSize()) {
+    Release(parent);
+    if (!LatchOf(leaf)->TryUpgrade(leaf.version)) {
+      Release(leaf);
+      return OpResult::kRestart;
+    }
+    node->Insert(key, value, comparator_);
+    LatchOf(leaf)->WUnlock();
+    Release(leaf, true);
+    return OpResult::kDone;
+  }
+  if (!LatchOf(parent)->TryUpgrade(parent.version)) {
+    Release(leaf);
+    Release(parent);
+    return OpResult::kRestart;
+  }
+  if (!LatchOf(leaf)->TryUpgrade(leaf.version)) {
+    LatchOf(parent)->WUnlock();
+    Release(leaf);
+    Release(parent);
+    return OpResult::kRestart;
+  }
+  node->Insert(key, value, comparator_);
+  LeafPage *new_leaf = Split(node, nullptr);
+  new_leaf->SetNextPageId(node->GetNextPageId());
+  node->SetNextPageId(new_leaf->GetPageId());
+  InsertIntoParent(parent, node, new_leaf->KeyAt(0), new_leaf);
+  buffer_pool_manager_->UnpinPage(new_leaf->GetPageId(), true);
+  LatchOf(leaf)->WUnlock();
+  LatchOf(parent)->WUnlock();
+  Release(leaf, true);
+  Release(parent, true);
+  return OpResult::kDone;
+}
+
+/*
+ * Insert constant key & value pair into an empty tree
+ * Throw an "out of memory" exception if the buffer pool cannot provide a page.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TypedBPlusTree<KeyType, KeyComparator>::StartNewTree(const KeyType &key, const RowId &value) {
+  page_id_t root_page_id;
+  Page *page = buffer_pool_manager_->NewPage(root_page_id);
+  if (page == nullptr) {
+    throw std::runtime_error("out of memory");
+  }
+  auto *leaf = reinterpret_cast<LeafPage *>(page->GetData());
+  leaf->Init(root_page_id, INVALID_PAGE_ID, leaf_max_size_);
+  leaf->Insert(key, value, comparator_);
+  root_latch_.WLock();
+  root_page_id_ = root_page_id;
+  UpdateRootPageId(1);
+  root_latch_.WUnlock();
+  buffer_pool_manager_->UnpinPage(root_page_id, true);
+}
+
+/*****************************************************************************
+ * BULK LOADING
+ *****************************************************************************/
+/*
+ * Build the tree from scratch out of entries in increasing key order, instead
+ * of descending from the root for every entry. Leaves are filled left to
+ * right up to fill_factor of their max size and linked, then each internal
+ * level is built on top of the one below until a single root is left. The
+ * last page of a level is merged into or balanced with its left neighbor so
+ * that every page stays above its min size.
+ * @param   fill_factor   clamped into [0.5, 1], free room is left for later inserts
+ * @return: false if the tree is not empty or the entries are not strictly
+ * increasing (duplicate keys), the tree is left empty then.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool TypedBPlusTree<KeyType, KeyComparator>::BulkLoad(const std::function<bool(MappingType &)> &next,
+                                                      double fill_factor) {
+  std::unique_lock<std::shared_mutex> smo_guard(smo_latch_);
+  if (!IsEmpty()) {
+    return false;
+  }
+  fill_factor = std::min(std::max(fill_factor, 0.5), 1.0);
+  int leaf_target = std::max(static_cast<int>(leaf_max_size_ * fill_factor), 1);
+  int internal_target =
+      std::max(static_cast<int>(internal_max_size_ * fill_factor), std::max((internal_max_size_ + 1) / 2, 2));
+  // (low key, page id) of every page on the level being built
+  std::vector<std::pair<KeyType, page_id_t>> level;
+  LeafPage *prev = nullptr;
+  LeafPage *cur = nullptr;
+  MappingType item;
+  bool sorted = true;
+  while (next(item)) {
+    if (cur != nullptr && comparator_(cur->KeyAt(cur->GetSize() - 1), item.first) >= 0) {
+      sorted = false;
+      break;
+    }
+    if (cur == nullptr || cur->GetSize() >= leaf_target) {
+      page_id_t page_id;
+      Page *page = buffer_pool_manager_->NewPage(page_id);
+      if (page == nullptr) {
+        throw std::runtime_error("out of memory");
+      }
+      auto *leaf = reinterpret_cast<LeafPage *>(page->GetData());
+      leaf->Init(page_id, INVALID_PAGE_ID, leaf_max_size_);
+      if (cur != nullptr) {
+        cur->SetNextPageId(page_id);
+      }
+      if (prev != nullptr) {
+        buffer_pool_manager_->UnpinPage(prev->GetPageId(), true);
+      }
+      prev = cur;
+      cur = leaf;
+      level.emplace_back(item.first, page_id);
+    }
+    cur->Append(item.first, item.second);
+  }
+  if (sorted && prev != nullptr && cur->GetSize() < cur->GetMinSize()) {
+    if (prev->GetSize() + cur->GetSize() <= leaf_max_size_) {
+      cur->MoveAllTo(prev);
+      buffer_pool_manager_->UnpinPage(cur->GetPageId(), false);
+      buffer_pool_manager_->DeletePage(level.back().second);
+      level.pop_back();
+      cur = nullptr;
+    } else {
+      while (cur->GetSize() < prev->GetSize()) {
+        prev->MoveLastToFrontOf(cur);
+      }
+      level.back().first = cur->KeyAt(0);
+    }
+  }
+  if (prev != nullptr) {
+    buffer_pool_manager_->UnpinPage(prev->GetPageId(), true);
+  }
+  if (cur != nullptr) {
+    buffer_pool_manager_->UnpinPage(cur->GetPageId(), true);
+  }
+  if (!sorted) {
+    for (auto &entry : level) {
+      buffer_pool_manager_->DeletePage(entry.second);
+    }
+    return false;
+  }
+  while (level.size() > 1) {
+    BuildInternalLevel(level, internal_target);
+  }
+  if (!level.empty()) {
+    root_latch_.WLock();
+    root_page_id_ = level[0].second;
+    UpdateRootPageId(1);
+    root_latch_.WUnlock();
+  }
+  return true;
+}
+
+/*
+ * Replace a level of (low key, page id) entries by the level of internal
+ * pages built on top of it.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TypedBPlusTree<KeyType, KeyComparator>::BuildInternalLevel(std::vector<std::pair<KeyType, page_id_t>> &level,
+                                                                int target_size) {
+  std::vector<std::pair<KeyType, page_id_t>> parents;
+  InternalPage *prev = nullptr;
+  InternalPage *cur = nullptr;
+  for (auto &child : level) {
+    if (cur == nullptr || cur->GetSize() >= target_size) {
+      page_id_t page_id;
+      Page *page = buffer_pool_manager_->NewPage(page_id);
+      if (page == nullptr) {
+        throw std::runtime_error("out of memory");
+      }
+      auto *node = reinterpret_cast<InternalPage *>(page->GetData());
+      node->Init(page_id, INVALID_PAGE_ID, internal_max_size_);
+      if (prev != nullptr) {
+        buffer_pool_manager_->UnpinPage(prev->GetPageId(), true);
+      }
+      prev = cur;
+      cur = node;
+      parents.emplace_back(child.first, page_id);
+    }
+    // the first key of each page keeps its low key, it becomes the separator one level up
+    cur->Append(child.first, child.second, buffer_pool_manager_);
+  }
+  if (prev != nullptr && cur->GetSize() < cur->GetMinSize()) {
+    if (prev->GetSize() + cur->GetSize() <= internal_max_size_) {
+      cur->MoveAllTo(prev, cur->KeyAt(0), buffer_pool_manager_);
+      buffer_pool_manager_->UnpinPage(cur->GetPageId(), false);
+      buffer_pool_manager_->DeletePage(parents.back().second);
+      parents.pop_back();
+      cur = nullptr;
+    } else {
+      while (cur->GetSize() < prev->GetSize()) {
+        prev->MoveLastToFrontOf(cur, cur->KeyAt(0), buffer_pool_manager_);
+      }
+      parents.back().first = cur->KeyAt(0);
+    }
+  }
+  if (prev != nullptr) {
+    buffer_pool_manager_->UnpinPage(prev->GetPageId(), true);
+  }
+  if (cur != nullptr) {
+    buffer_pool_manager_->UnpinPage(cur->GetPageId(), true);
+  }
+  level.swap(parents);
+}
+
+/*
+ * Split input page and return newly created page, which is still pinned.
+ * Throw an "out of memory" exception if the buffer pool cannot provide a page.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+BPlusTreeTypedInternalPage<KeyType, KeyComparator> *TypedBPlusTree<KeyType, KeyComparator>::Split(
+    InternalPage *node, Txn * /*transaction*/) {
+  page_id_t page_id;
+  Page *page = buffer_pool_manager_->NewPage(page_id);
+  if (page == nullptr) {
+    throw std::runtime_error("out of memory");
+  }
+  auto *new_node = reinterpret_cast<InternalPage *>(page->GetData());
+  new_node->Init(page_id, node->GetParentPageId(), internal_max_size_);
+  node->MoveHalfTo(new_node, buffer_pool_manager_);
+  return new_node;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+BPlusTreeTypedLeafPage<KeyType, KeyComparator> *TypedBPlusTree<KeyType, KeyComparator>::Split(LeafPage *node,
+                                                                                             Txn * /*transaction*/) {
+  page_id_t page_id;
+  Page *page = buffer_pool_manager_->NewPage(page_id);
+  if (page == nullptr) {
+    throw std::runtime_error("out of memory");
+  }
+  auto *new_node = reinterpret_cast<LeafPage *>(page->GetData());
+  new_node->Init(page_id, node->GetParentPageId(), leaf_max_size_);
+  node->MoveHalfTo(new_node);
+  adaptive_hash_.InvalidatePage(node->GetPageId());
+  return new_node;
+}
+
+/*
+ * Insert key & value pair into internal page after split
+ * @param   parent        write latched parent of old_node, the root pointer
+ *                        when old_node is the root
+ * @param   old_node      input page from split() method
+ * @param   key
+ * @param   new_node      returned page from split() method
+ * A new root is created when old_node is the root. The parent never overflows
+ * since full internal nodes are split on the way down.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TypedBPlusTree<KeyType, KeyComparator>::InsertIntoParent(NodeRef &parent, BPlusTreePage *old_node,
+                                                              const KeyType &key, BPlusTreePage *new_node) {
+  if (parent.page == nullptr) {
+    page_id_t root_page_id;
+    Page *page = buffer_pool_manager_->NewPage(root_page_id);
+    if (page == nullptr) {
+      throw std::runtime_error("out of memory");
+    }
+    auto *root = reinterpret_cast<InternalPage *>(page->GetData());
+    root->Init(root_page_id, INVALID_PAGE_ID, internal_max_size_);
+    root->PopulateNewRoot(old_node->GetPageId(), key, new_node->GetPageId());
+    old_node->SetParentPageId(root_page_id);
+    new_node->SetParentPageId(root_page_id);
+    root_page_id_ = root_page_id;
+    UpdateRootPageId(0);
+    buffer_pool_manager_->UnpinPage(root_page_id, true);
+    return;
+  }
+  auto *parent_node = reinterpret_cast<InternalPage *>(parent.page->GetData());
+  ASSERT(parent_node->GetSize() < parent_node->GetMaxSize(), "Parent of a splitting node must not be full.");
+  parent_node->InsertNodeAfter(old_node->GetPageId(), key, new_node->GetPageId());
+  new_node->SetParentPageId(parent_node->GetPageId());
+}
+
+/*****************************************************************************
+ * REMOVE
+ *****************************************************************************/
+/*
+ * Delete key & value pair associated with input key
+ * If current tree is empty, return immediately.
+ * If not, find the right leaf page as deletion target, then delete entry from
+ * leaf page. Remember to deal with redistribute or merge if necessary.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TypedBPlusTree<KeyType, KeyComparator>::Remove(const KeyType &key, Txn *transaction) {
+  while (true) {
+    OpResult result;
+    {
+      std::shared_lock<std::shared_mutex> smo_guard(smo_latch_);
+      result = OptimisticRemove(key);
+    }
+    if (result == OpResult::kNeedSmo) {
+      std::unique_lock<std::shared_mutex> smo_guard(smo_latch_);
+      RemoveWithSmo(key, transaction);
+      return;
+    }
+    if (result != OpResult::kRestart) {
+      return;
+    }
+    std::this_thread::yield();
+  }
+}
+
+/*
+ * One optimistic remove attempt, which only succeeds when the leaf does not
+ * underflow and no other page has to change.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+typename TypedBPlusTree<KeyType, KeyComparator>::OpResult TypedBPlusTree<KeyType, KeyComparator>::OptimisticRemove(
+    const KeyType &key) {
+  NodeRef parent, leaf;
+  if (!Descend(key, false, false, parent, leaf)) {
+    return OpResult::kRestart;
+  }
+  bool is_root = parent.page == nullptr;
+  Release(parent);
+  if (leaf.page == nullptr) {
+    return OpResult::kEmpty;
+  }
+  auto *node = reinterpret_cast<LeafPage *>(leaf.page->GetData());
+  RowId exist;
+  bool found = node->Lookup(key, exist, comparator_);
+  bool safe = is_root ? node->GetSize() > 1 : node->GetSize() > node->GetMinSize();
+  if (!found || !safe) {
+    bool valid = LatchOf(leaf)->Validate(leaf.version);
+    Release(leaf);
+    if (!valid) {
+      return OpResult::kRestart;
+    }
+    return found ? OpResult::kNeedSmo : OpResult::kFailed;
+  }
+  if (!LatchOf(leaf)->TryUpgrade(leaf.version)) {
+    Release(leaf);
+    return OpResult::kRestart;
+  }
+  node->RemoveAndDeleteRecord(key, comparator_);
+  LatchOf(leaf)->WUnlock();
+  Release(leaf, true);
+  return OpResult::kDone;
+}
+
+/*
+ * Remove that may coalesce or redistribute pages, run with smo_latch_ held
+ * exclusively so no other writer is active. Readers still are, so every page
+ * modified here is write latched (see FetchForSmo) until FinishSmo().
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TypedBPlusTree<KeyType, KeyComparator>::RemoveWithSmo(const KeyType &key, Txn *transaction) {
+  if (IsEmpty()) {
+    return;
+  }
+  Page *found_page = FindLeafPage(key);
+  page_id_t leaf_id = found_page->GetPageId();
+  Page *page = FetchForSmo(leaf_id);
+  buffer_pool_manager_->UnpinPage(leaf_id, false);
+  auto *leaf = reinterpret_cast<LeafPage *>(page->GetData());
+  int old_size = leaf->GetSize();
+  if (leaf->RemoveAndDeleteRecord(key, comparator_) != old_size) {
+    bool underflow = leaf->IsRootPage() ? leaf->GetSize() == 0 : leaf->GetSize() < leaf->GetMinSize();
+    if (underflow && CoalesceOrRedistribute(leaf, transaction)) {
+      smo_deleted_pages_.push_back(leaf_id);
+    }
+  }
+  buffer_pool_manager_->UnpinPage(leaf_id, true);
+  FinishSmo();
+}
+
+/*
+ * Fetch a page modified by the running structure modification. The first
+ * fetch of each page write latches it and keeps one more pin until
+ * FinishSmo(), so the caller unpins the returned page as usual.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+Page *TypedBPlusTree<KeyType, KeyComparator>::FetchForSmo(page_id_t page_id) {
+  Page *page = buffer_pool_manager_->FetchPage(page_id);
+  if (std::find(smo_pages_.begin(), smo_pages_.end(), page) == smo_pages_.end()) {
+    buffer_pool_manager_->FetchPage(page_id);
+    page->GetVersionLatch()->WLock();
+    smo_pages_.push_back(page);
+  }
+  return page;
+}
+
+/*
+ * Release the latches taken by the structure modification, then delete the
+ * pages it emptied once concurrent readers have unpinned them.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TypedBPlusTree<KeyType, KeyComparator>::FinishSmo() {
+  for (Page *page : smo_pages_) {
+    page_id_t page_id = page->GetPageId();
+    if (std::find(smo_deleted_pages_.begin(), smo_deleted_pages_.end(), page_id) != smo_deleted_pages_.end()) {
+      page->GetVersionLatch()->WUnlockObsolete();
+    } else {
+      page->GetVersionLatch()->WUnlock();
+    }
+    buffer_pool_manager_->UnpinPage(page_id, true);
+  }
+  if (smo_root_latched_) {
+    root_latch_.WUnlock();
+    smo_root_latched_ = false;
+  }
+  for (page_id_t page_id : smo_deleted_pages_) {
+    adaptive_hash_.InvalidatePage(page_id);
+    // readers that still pin the page will see it obsolete and restart
+    while (!buffer_pool_manager_->DeletePage(page_id)) {
+      std::this_thread::yield();
+    }
+  }
+  smo_pages_.clear();
+  smo_deleted_pages_.clear();
+}
+
+/*
+ * User needs to first find the sibling of input page. If sibling's size + input
+ * page's size > page's max size, then redistribute. Otherwise, merge.
+ * The left sibling is preferred; the first child borrows from or absorbs its
+ * right sibling instead.
+ * @return: true means target node should be deleted, false means no deletion
+ * happens
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+template <typename N>
+bool TypedBPlusTree<KeyType, KeyComparator>::CoalesceOrRedistribute(N *&node, Txn *transaction) {
+  if (node->IsRootPage()) {
+    return AdjustRoot(node);
+  }
+  page_id_t parent_id = node->GetParentPageId();
+  auto *parent = reinterpret_cast<InternalPage *>(FetchForSmo(parent_id)->GetData());
+  int index = parent->ValueIndex(node->GetPageId());
+  page_id_t neighbor_id = parent->ValueAt(index == 0 ? 1 : index - 1);
+  auto *neighbor = reinterpret_cast<N *>(FetchForSmo(neighbor_id)->GetData());
+
+  if (neighbor->GetSize() + node->GetSize() > node->GetMaxSize()) {
+    Redistribute(neighbor, node, index);
+    buffer_pool_manager_->UnpinPage(neighbor_id, true);
+    buffer_pool_manager_->UnpinPage(parent_id, true);
+    return false;
+  }
+  if (index == 0) {
+    // absorb the right sibling so that the first child pointer stays valid
+    Coalesce(node, neighbor, parent, 1, transaction);
+    buffer_pool_manager_->UnpinPage(neighbor_id, true);
+    smo_deleted_pages_.push_back(neighbor_id);
+    return false;
+  }
+  Coalesce(neighbor, node, parent, index, transaction);
+  buffer_pool_manager_->UnpinPage(neighbor_id, true);
+  return true;
+}
+
+/*
+ * Move all the key & value pairs from one page to its sibling page, and notify
+ * buffer pool manager to delete this page. Parent page must be adjusted to
+ * take info of deletion into account. Remember to deal with coalesce or
+ * redistribute recursively if necessary.
+ * The parent is unpinned (and deleted if it became useless) before returning.
+ * @param   neighbor_node      recipient, the left one of the two pages
+ * @param   node               page that is emptied
+ * @param   parent             parent page of input "node"
+ * @param   index              position of "node" in parent
+ * @return  true means parent node should be deleted, false means no deletion happened
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool TypedBPlusTree<KeyType, KeyComparator>::Coalesce(LeafPage *&neighbor_node, LeafPage *&node,
+                                                      InternalPage *&parent, int index, Txn *transaction) {
+  node->MoveAllTo(neighbor_node);
+  adaptive_hash_.InvalidatePage(node->GetPageId());
+  adaptive_hash_.InvalidatePage(neighbor_node->GetPageId());
+  parent->Remove(index);
+  page_id_t parent_id = parent->GetPageId();
+  bool underflow = parent->IsRootPage() ? parent->GetSize() == 1 : parent->GetSize() < parent->GetMinSize();
+  bool should_delete = underflow && CoalesceOrRedistribute(parent, transaction);
+  buffer_pool_manager_->UnpinPage(parent_id, true);
+  if (should_delete) {
+    smo_deleted_pages_.push_back(parent_id);
+  }
+  return should_delete;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool TypedBPlusTree<KeyType, KeyComparator>::Coalesce(InternalPage *&neighbor_node, InternalPage *&node,
+                                                      InternalPage *&parent, int index, Txn *transaction) {
+  node->MoveAllTo(neighbor_node, parent->KeyAt(index), buffer_pool_manager_);
+  parent->Remove(index);
+  page_id_t parent_id = parent->GetPageId();
+  bool underflow = parent->IsRootPage() ? parent->GetSize() == 1 : parent->GetSize() < parent->GetMinSize();
+  bool should_delete = underflow && CoalesceOrRedistribute(parent, transaction);
+  buffer_pool_manager_->UnpinPage(parent_id, true);
+  if (should_delete) {
+    smo_deleted_pages_.push_back(parent_id);
+  }
+  return should_delete;
+}
+
+/*
+ * Redistribute key & value pairs from one page to its sibling page. If index ==
+ * 0, move sibling page's first key & value pair into end of input "node",
+ * otherwise move sibling page's last key & value pair into head of input
+ * "node". The separation key in the parent is updated accordingly.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TypedBPlusTree<KeyType, KeyComparator>::Redistribute(LeafPage *neighbor_node, LeafPage *node, int index) {
+  page_id_t parent_id = node->GetParentPageId();
+  auto *parent = reinterpret_cast<InternalPage *>(FetchForSmo(parent_id)->GetData());
+  if (index == 0) {
+    neighbor_node->MoveFirstToEndOf(node);
+    parent->SetKeyAt(1, neighbor_node->KeyAt(0));
+  } else {
+    neighbor_node->MoveLastToFrontOf(node);
+    parent->SetKeyAt(index, node->KeyAt(0));
+  }
+  adaptive_hash_.InvalidatePage(node->GetPageId());
+  adaptive_hash_.InvalidatePage(neighbor_node->GetPageId());
+  buffer_pool_manager_->UnpinPage(parent_id, true);
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TypedBPlusTree<KeyType, KeyComparator>::Redistribute(InternalPage *neighbor_node, InternalPage *node,
+                                                          int index) {
+  page_id_t parent_id = node->GetParentPageId();
+  auto *parent = reinterpret_cast<InternalPage *>(FetchForSmo(parent_id)->GetData());
+  if (index == 0) {
+    neighbor_node->MoveFirstToEndOf(node, parent->KeyAt(1), buffer_pool_manager_);
+    parent->SetKeyAt(1, neighbor_node->KeyAt(0));
+  } else {
+    neighbor_node->MoveLastToFrontOf(node, parent->KeyAt(index), buffer_pool_manager_);
+    parent->SetKeyAt(index, node->KeyAt(0));
+  }
+  buffer_pool_manager_->UnpinPage(parent_id, true);
+}
+
+/*
+ * Update root page if necessary
+ * NOTE: size of root page can be less than min size and this method is only
+ * called within coalesceOrRedistribute() method
+ * case 1: when you delete the last element in root page, but root page still
+ * has one last child
+ * case 2: when you delete the last element in whole b+ tree
+ * @return : true means root page should be deleted, false means no deletion
+ * happened
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool TypedBPlusTree<KeyType, KeyComparator>::AdjustRoot(BPlusTreePage *old_root_node) {
+  if (!old_root_node->IsLeafPage() && old_root_node->GetSize() == 1) {
+    root_latch_.WLock();
+    smo_root_latched_ = true;
+    auto *root = reinterpret_cast<InternalPage *>(old_root_node);
+    page_id_t child_page_id = root->RemoveAndReturnOnlyChild();
+    auto *child = reinterpret_cast<BPlusTreePage *>(buffer_pool_manager_->FetchPage(child_page_id)->GetData());
+    child->SetParentPageId(INVALID_PAGE_ID);
+    buffer_pool_manager_->UnpinPage(child_page_id, true);
+    root_page_id_ = child_page_id;
+    UpdateRootPageId(0);
+    return true;
+  }
+  if (old_root_node->IsLeafPage() && old_root_node->GetSize() == 0) {
+    root_latch_.WLock();
+    smo_root_latched_ = true;
+    root_page_id_ = INVALID_PAGE_ID;
+    UpdateRootPageId(0);
+    return true;
+  }
+  return false;
+}
+
+/*****************************************************************************
+ * INDEX ITERATOR
+ *****************************************************************************/
+/*
+ * Input parameter is void, find the left most leaf page first, then construct
+ * index iterator
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+TypedIndexIterator<KeyType, KeyComparator> TypedBPlusTree<KeyType, KeyComparator>::Begin() {
+  return Iterator(this);
+}
+
+/*
+ * Input parameter is low key, find the leaf page that contains the input key
+ * first, then construct index iterator pointing at the first entry >= key
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+TypedIndexIterator<KeyType, KeyComparator> TypedBPlusTree<KeyType, KeyComparator>::Begin(const KeyType &key) {
+  return Iterator(this, &key);
+}
+
+/*
+ * Input parameter is void, construct an index iterator representing the end
+ * of the key/value pair in the leaf node
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+TypedIndexIterator<KeyType, KeyComparator> TypedBPlusTree<KeyType, KeyComparator>::End() {
+  return Iterator();
+}
+
+/*
+ * Reverse iterators share End() with the forward ones
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+TypedIndexIterator<KeyType, KeyComparator> TypedBPlusTree<KeyType, KeyComparator>::RBegin() {
+  return Iterator(this, nullptr, true, true);
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+TypedIndexIterator<KeyType, KeyComparator> TypedBPlusTree<KeyType, KeyComparator>::RBegin(const KeyType &key,
+                                                                                          bool inclusive) {
+  return Iterator(this, &key, inclusive, true);
+}
+
+/*
+ * Copy the entries of the leaf an iterator continues from into batch.
+ * @param   key           first key to return (the left most one if nullptr)
+ * @param   exclusive     whether key itself is skipped
+ * @param   start_index   set to the position of the first returned entry in batch
+ * @param   has_next      set when the copied leaf has a right sibling
+ * Leaves holding no qualifying entry are skipped by moving right with the
+ * same version checks as a descent.
+ * @return: id of the copied leaf, INVALID_PAGE_ID when no entry is left.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+page_id_t TypedBPlusTree<KeyType, KeyComparator>::ReadLeaf(const KeyType *key, bool exclusive,
+                                                           std::vector<MappingType> &batch, int &start_index,
+                                                           bool &has_next) {
+  auto less_than_key = [&](const MappingType &item, const KeyType &k) {
+    return exclusive ? comparator_(item.first, k) <= 0 : comparator_(item.first, k) < 0;
+  };
+  while (true) {
+    NodeRef parent, leaf;
+    if (!Descend(key == nullptr ? KeyType{} : *key, key == nullptr, false, parent, leaf)) {
+      continue;
+    }
+    Release(parent);
+    if (leaf.page == nullptr) {
+      return INVALID_PAGE_ID;
+    }
+    while (true) {
+      auto *node = reinterpret_cast<LeafPage *>(leaf.page->GetData());
+      int size = std::min(std::max(node->GetSize(), 0), LeafPage::Capacity());
+      batch.clear();
+      for (int i = 0; i < size; i++) {
+        batch.emplace_back(node->GetItem(i));
+      }
+      page_id_t next_page_id = node->GetNextPageId();
+      if (!LatchOf(leaf)->Validate(leaf.version)) {
+        break;
+      }
+      start_index = key == nullptr ? 0
+                                   : static_cast<int>(std::lower_bound(batch.begin(), batch.end(), *key, less_than_key) -
+                                                      batch.begin());
+      if (start_index < static_cast<int>(batch.size()) || next_page_id == INVALID_PAGE_ID) {
+        page_id_t page_id = leaf.page->GetPageId();
+        Release(leaf);
+        has_next = next_page_id != INVALID_PAGE_ID;
+        return start_index < static_cast<int>(batch.size()) ? page_id : INVALID_PAGE_ID;
+      }
+      NodeRef next;
+      next.page = buffer_pool_manager_->FetchPage(next_page_id);
+      if (next.page == nullptr) {
+        break;
+      }
+      if (!LatchOf(next)->ReadLock(next.version) || !LatchOf(leaf)->Validate(leaf.version)) {
+        Release(next);
+        break;
+      }
+      Release(leaf);
+      leaf = next;
+    }
+    Release(leaf);
+  }
+}
+
+/*
+ * Copy the entries of the leaf a reverse iterator continues from into batch,
+ * in descending key order.
+ * @param   key           entries <= key are returned (< key unless inclusive),
+ *                        all of them if nullptr
+ * @param   has_prev      set when leaves with smaller keys remain
+ * The leaves hold no link to their left sibling, so a leaf without qualifying
+ * entries is left by descending again below its fence.
+ * @return: id of the copied leaf, INVALID_PAGE_ID when no entry is left.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+page_id_t TypedBPlusTree<KeyType, KeyComparator>::ReadLeafReverse(const KeyType *key, bool inclusive,
+                                                                  std::vector<MappingType> &batch, bool &has_prev) {
+  bool has_bound = key != nullptr;
+  KeyType bound = has_bound ? *key : KeyType{};
+  while (true) {
+    NodeRef leaf;
+    bool has_fence;
+    KeyType fence;
+    if (!DescendBefore(has_bound ? &bound : nullptr, inclusive, leaf, has_fence, fence)) {
+      continue;
+    }
+    if (leaf.page == nullptr) {
+      return INVALID_PAGE_ID;
+    }
+    auto *node = reinterpret_cast<LeafPage *>(leaf.page->GetData());
+    int size = std::min(std::max(node->GetSize(), 0), LeafPage::Capacity());
+    batch.clear();
+    for (int i = size - 1; i >= 0; i--) {
+      MappingType item = node->GetItem(i);
+      int cmp = has_bound ? comparator_(item.first, bound) : -1;
+      if (cmp < 0 || (cmp == 0 && inclusive)) {
+        batch.emplace_back(item);
+      }
+    }
+    page_id_t page_id = leaf.page->GetPageId();
+    bool valid = LatchOf(leaf)->Validate(leaf.version);
+    Release(leaf);
+    if (!valid) {
+      continue;
+    }
+    if (!batch.empty()) {
+      has_prev = has_fence;
+      return page_id;
+    }
+    if (!has_fence) {
+      return INVALID_PAGE_ID;
+    }
+    // every key of the leaf lies past the bound, the entries before it are below the fence
+    has_bound = true;
+    bound = fence;
+    inclusive = false;
+  }
+}
+
+/*****************************************************************************
+ * UTILITIES AND DEBUG
+ *****************************************************************************/
+/*
+ * Find leaf page containing particular key, if leftMost flag == true, find
+ * the left most leaf page
+ * Note: the leaf page is pinned, you need to unpin it after use. No latch is
+ * taken, so the caller must keep writers out.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+Page *TypedBPlusTree<KeyType, KeyComparator>::FindLeafPage(const KeyType &key, page_id_t page_id, bool leftMost) {
+  if (page_id == INVALID_PAGE_ID) {
+    if (IsEmpty()) {
+      return nullptr;
+    }
+    page_id = root_page_id_;
+  }
+  Page *page = buffer_pool_manager_->FetchPage(page_id);
+  auto *node = reinterpret_cast<BPlusTreePage *>(page->GetData());
+  while (!node->IsLeafPage()) {
+    auto *internal = reinterpret_cast<InternalPage *>(node);
+    page_id_t child_id = leftMost ? internal->ValueAt(0) : internal->Lookup(key, comparator_);
+    buffer_pool_manager_->UnpinPage(page_id, false);
+    page_id = child_id;
+    page = buffer_pool_manager_->FetchPage(page_id);
+    node = reinterpret_cast<BPlusTreePage *>(page->GetData());
+  }
+  return page;
+}
+
+/*
+ * Update/Insert root page id in header page(where page_id = INDEX_ROOTS_PAGE_ID,
+ * header_page is defined under include/page/header_page.h)
+ * Call this method everytime root page id is changed.
+ * @parameter: insert_record      default value is false. When set to true,
+ * insert a record <index_name, current_page_id> into header page instead of
+ * updating it. The record is deleted once the tree becomes empty.
+ * The roots page is shared by all indexes, so it is latched while updated.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TypedBPlusTree<KeyType, KeyComparator>::UpdateRootPageId(int insert_record) {
+  Page *roots_page = buffer_pool_manager_->FetchPage(INDEX_ROOTS_PAGE_ID);
+  auto *roots = reinterpret_cast<IndexRootsPage *>(roots_page->GetData());
+  roots_page->WLatch();
+  if (insert_record) {
+    roots->Insert(index_id_, root_page_id_);
+  } else if (root_page_id_ == INVALID_PAGE_ID) {
+    roots->Delete(index_id_);
+  } else {
+    roots->Update(index_id_, root_page_id_);
+  }
+  roots_page->WUnlatch();
+  buffer_pool_manager_->UnpinPage(INDEX_ROOTS_PAGE_ID, true);
+}
+
+/*
+ * Count the levels on the left most path and the leaves along the sibling
+ * chain. Only structure modifications link or unlink pages, they wait for the
+ * exclusive smo_latch_ while the pages are counted.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TypedBPlusTree<KeyType, KeyComparator>::GetShape(uint32_t &height, uint32_t &leaf_pages) {
+  std::unique_lock<std::shared_mutex> smo_guard(smo_latch_);
+  height = 0;
+  leaf_pages = 0;
+  if (IsEmpty()) {
+    return;
+  }
+  page_id_t page_id = root_page_id_;
+  auto *node = reinterpret_cast<BPlusTreePage *>(buffer_pool_manager_->FetchPage(page_id)->GetData());
+  height++;
+  while (!node->IsLeafPage()) {
+    page_id_t child_id = reinterpret_cast<InternalPage *>(node)->ValueAt(0);
+    buffer_pool_manager_->UnpinPage(page_id, false);
+    page_id = child_id;
+    node = reinterpret_cast<BPlusTreePage *>(buffer_pool_manager_->FetchPage(page_id)->GetData());
+    height++;
+  }
+  while (page_id != INVALID_PAGE_ID) {
+    page_id_t next_id = reinterpret_cast<LeafPage *>(node)->GetNextPageId();
+    buffer_pool_manager_->UnpinPage(page_id, false);
+    leaf_pages++;
+    page_id = next_id;
+    if (page_id != INVALID_PAGE_ID) {
+      node = reinterpret_cast<BPlusTreePage *>(buffer_pool_manager_->FetchPage(page_id)->GetData());
+    }
+  }
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool TypedBPlusTree<KeyType, KeyComparator>::Check() {
+  bool all_unpinned = buffer_pool_manager_->CheckAllUnpinned();
+  if (!all_unpinned) {
+    LOG(ERROR) << "problem in page unpin" << endl;
+  }
+  return all_unpinned;
+}
+
+template class TypedBPlusTree<int32_t, BasicComparator<int32_t>>;
+
+template class TypedBPlusTree<int64_t, BasicComparator<int64_t>>;
+
+template class TypedBPlusTree<float, BasicComparator<float>>;
@@ -0,0 +1,424 @@
+#include "index/typed_b_plus_tree_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "index/basic_comparator.h"
+#include "storage/external_sorter.h"
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+TypedBPlusTreeIndex<KeyType, KeyComparator>::TypedBPlusTreeIndex(index_id_t index_id, IndexSchema *key_schema,
+                                                                 BufferPoolManager *buffer_pool_manager)
+    : Index(index_id, key_schema), comparator_(), container_(index_id, buffer_pool_manager, comparator_) {}
+
+/*
+ * The INT key a FLOAT value compares with. A value that is not an integer is
+ * rounded up if rounding > 0 and down if rounding < 0, and has no key if
+ * rounding is 0. A value past the INT range is clamped in the rounding
+ * direction, and has no key if no INT lies that way of it.
+ * @return: false if the value has no key, rounded tells whether key differs from the value
+ */
+static bool IntKeyOf(float value, int rounding, int32_t &key, bool &rounded) {
+  double integral = rounding > 0 ? std::ceil(value) : std::floor(value);
+  rounded = integral != value;
+  if (std::isnan(value) || (rounded && rounding == 0)) {
+    return false;
+  }
+  if (integral > INT32_MAX || integral < INT32_MIN) {
+    // above all keys is an upper bound over all of them, below all keys a lower bound over all of them
+    if (integral > INT32_MAX ? rounding >= 0 : rounding <= 0) {
+      return false;
+    }
+    key = integral > INT32_MAX ? INT32_MAX : INT32_MIN;
+    rounded = true;
+    return true;
+  }
+  key = static_cast<int32_t>(integral);
+  return true;
+}
+
+/*
+ * Map an INT or FLOAT field onto 32 bits whose unsigned order is the order of
+ * the column values, the sign bit of ints is flipped and negative floats have
+ * all their bits inverted. A FLOAT value of an INT column goes through IntKeyOf.
+ */
+static bool OrderedKeyBits(const Field *field, TypeId column_type, int rounding, uint32_t &bits, bool &rounded) {
+  char buf[sizeof(int64_t)];
+  field->SerializeTo(buf);
+  bool is_float = field->GetTypeId() == TypeId::kTypeFloat;
+  rounded = false;
+  if (column_type == TypeId::kTypeFloat) {
+    float value = is_float ? MACH_READ_FROM(float, buf) : static_cast<float>(MACH_READ_INT32(buf));
+    if (value == 0) {
+      // -0.0 and 0.0 are the same key
+      value = 0;
+    }
+    memcpy(&bits, &value, sizeof(bits));
+    bits = (bits & 0x80000000U) ? ~bits : bits | 0x80000000U;
+    return true;
+  }
+  int32_t value = MACH_READ_INT32(buf);
+  if (is_float && !IntKeyOf(MACH_READ_FROM(float, buf), rounding, value, rounded)) {
+    return false;
+  }
+  bits = static_cast<uint32_t>(value) ^ 0x80000000U;
+  return true;
+}
+
+static Field FromOrderedKeyBits(uint32_t part, TypeId column_type) {
+  if (column_type == TypeId::kTypeFloat) {
+    uint32_t bits = (part & 0x80000000U) ? part & 0x7fffffffU : ~part;
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return Field(TypeId::kTypeFloat, value);
+  }
+  return Field(TypeId::kTypeInt, static_cast<int32_t>(part ^ 0x80000000U));
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TypedBPlusTreeIndex<KeyType, KeyComparator>::FromNativeKey(const KeyType &native_key,
+                                                               const IndexSchema *key_schema, Row &key) {
+  std::vector<Field> fields;
+  if (key_schema->GetColumnCount() > 1) {
+    auto packed = static_cast<uint64_t>(static_cast<int64_t>(native_key)) ^ (1ULL << 63);
+    fields.push_back(FromOrderedKeyBits(static_cast<uint32_t>(packed >> 32), key_schema->GetColumn(0)->GetType()));
+    fields.push_back(FromOrderedKeyBits(static_cast<uint32_t>(packed), key_schema->GetColumn(1)->GetType()));
+  } else if (key_schema->GetColumn(0)->GetType() == TypeId::kTypeFloat) {
+    fields.emplace_back(TypeId::kTypeFloat, static_cast<float>(native_key));
+  } else {
+    fields.emplace_back(TypeId::kTypeInt, static_cast<int32_t>(native_key));
+  }
+  key = Row(fields);
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool TypedBPlusTreeIndex<KeyType, KeyComparator>::ToNativeKey(const Row &key, KeyType &native_key, bool fill_high,
+                                                             int rounding, bool *rounded) const {
+  bool key_rounded = false;
+  if (key_schema_->GetColumnCount() > 1) {
+    // two 32-bit columns packed into one key, missing trailing columns are
+    // filled with their lowest or highest value, as are the columns after a rounded one
+    uint64_t packed = 0;
+    for (uint32_t i = 0; i < 2; i++) {
+      uint32_t part = (key_rounded ? rounding < 0 : fill_high) ? UINT32_MAX : 0;
+      if (i < key.GetFieldCount() && !key_rounded) {
+        Field *field = key.GetField(i);
+        if (field->IsNull() ||
+            !OrderedKeyBits(field, key_schema_->GetColumn(i)->GetType(), rounding, part, key_rounded)) {
+          return false;
+        }
+      }
+      packed = packed << 32 | part;
+    }
+    native_key = static_cast<KeyType>(static_cast<int64_t>(packed ^ (1ULL << 63)));
+  } else {
+    Field *field = key.GetField(0);
+    if (field->IsNull()) {
+      return false;
+    }
+    char buf[sizeof(int64_t)];
+    field->SerializeTo(buf);
+    if (field->GetTypeId() == TypeId::kTypeFloat && key_schema_->GetColumn(0)->GetType() != TypeId::kTypeFloat) {
+      int32_t value;
+      if (!IntKeyOf(MACH_READ_FROM(float, buf), rounding, value, key_rounded)) {
+        return false;
+      }
+      native_key = static_cast<KeyType>(value);
+    } else if (field->GetTypeId() == TypeId::kTypeFloat) {
+      native_key = static_cast<KeyType>(MACH_READ_FROM(float, buf));
+    } else {
+      native_key = static_cast<KeyType>(MACH_READ_INT32(buf));
+    }
+  }
+  if (rounded != nullptr) {
+    *rounded = key_rounded;
+  }
+  return true;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+dberr_t TypedBPlusTreeIndex<KeyType, KeyComparator>::InsertEntry(const Row &key, RowId row_id, Txn *txn) {
+  KeyType native_key;
+  if (!ToNativeKey(key, native_key) || !container_.Insert(native_key, row_id, txn)) {
+    return DB_FAILED;
+  }
+  return DB_SUCCESS;
+}
+
+/*
+ * The native keys are sorted so the tree answers them in one left to right
+ * pass, prefix rows are ranges and go through ScanKey.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+dberr_t TypedBPlusTreeIndex<KeyType, KeyComparator>::ScanKeys(const std::vector<Row> &keys,
+                                                              std::vector<std::vector<RowId>> &result, Txn *txn) {
+  result.assign(keys.size(), std::vector<RowId>());
+  bool any_found = false;
+  std::vector<std::pair<KeyType, size_t>> probes;
+  probes.reserve(keys.size());
+  for (size_t i = 0; i < keys.size(); i++) {
+    KeyType native_key;
+    if (keys[i].GetFieldCount() < key_schema_->GetColumnCount()) {
+      any_found = ScanKey(keys[i], result[i], txn) == DB_SUCCESS || any_found;
+    } else if (ToNativeKey(keys[i], native_key)) {
+      probes.emplace_back(native_key, i);
+    }
+  }
+  std::sort(probes.begin(), probes.end(),
+            [this](const auto &a, const auto &b) { return comparator_(a.first, b.first) < 0; });
+  std::vector<KeyType> sorted_keys;
+  sorted_keys.reserve(probes.size());
+  for (auto &probe : probes) {
+    sorted_keys.push_back(probe.first);
+  }
+  std::vector<RowId> values;
+  std::vector<bool> found;
+  container_.GetValues(sorted_keys, values, found);
+  for (size_t i = 0; i < probes.size(); i++) {
+    if (found[i]) {
+      result[probes[i].second].push_back(values[i]);
+      any_found = true;
+    }
+  }
+  return any_found ? DB_SUCCESS : DB_KEY_NOT_FOUND;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+dberr_t TypedBPlusTreeIndex<KeyType, KeyComparator>::InsertEntries(const std::vector<Row> &keys,
+                                                                   const std::vector<RowId> &row_ids, Txn * /*txn*/) {
+  dberr_t status = DB_SUCCESS;
+  std::vector<typename Container::MappingType> entries;
+  entries.reserve(keys.size());
+  for (size_t i = 0; i < keys.size(); i++) {
+    KeyType native_key;
+    if (ToNativeKey(keys[i], native_key)) {
+      entries.emplace_back(native_key, row_ids[i]);
+    } else {
+      status = DB_FAILED;
+    }
+  }
+  std::stable_sort(entries.begin(), entries.end(),
+                   [this](const auto &a, const auto &b) { return comparator_(a.first, b.first) < 0; });
+  std::vector<bool> inserted;
+  container_.InsertBatch(entries, inserted);
+  if (std::find(inserted.begin(), inserted.end(), false) != inserted.end()) {
+    status = DB_FAILED;
+  }
+  return status;
+}
+
+/*
+ * Sort the native (key, row id) pairs, spilling to disk when they exceed the
+ * sort memory budget, and build the tree bottom-up from the sorted stream.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+dberr_t TypedBPlusTreeIndex<KeyType, KeyComparator>::BulkLoad(const std::function<bool(Row &, RowId &)> &next,
+                                                              Txn * /*txn*/, double fill_factor) {
+  // std::pair is not trivially copyable, sort runs hold plain entries instead
+  struct Entry {
+    KeyType key;
+    RowId row_id;
+  };
+  struct EntryLess {
+    KeyComparator comparator;
+    bool operator()(const Entry &a, const Entry &b) const { return comparator(a.key, b.key) < 0; }
+  };
+  ExternalSorter<Entry, EntryLess> sorter(DEFAULT_SORT_MEMORY_LIMIT, EntryLess{comparator_});
+  Row key;
+  RowId row_id;
+  while (next(key, row_id)) {
+    KeyType native_key;
+    if (!ToNativeKey(key, native_key)) {
+      return DB_FAILED;
+    }
+    sorter.Add(Entry{native_key, row_id});
+  }
+  sorter.Finish();
+  auto next_sorted = [&sorter](typename Container::MappingType &item) {
+    Entry entry;
+    if (!sorter.Next(entry)) {
+      return false;
+    }
+    item = {entry.key, entry.row_id};
+    return true;
+  };
+  if (!container_.BulkLoad(next_sorted, fill_factor)) {
+    return DB_FAILED;
+  }
+  return DB_SUCCESS;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+dberr_t TypedBPlusTreeIndex<KeyType, KeyComparator>::RemoveEntry(const Row &key, RowId /*row_id*/, Txn *txn) {
+  KeyType native_key;
+  if (ToNativeKey(key, native_key)) {
+    container_.Remove(native_key, txn);
+  }
+  return DB_SUCCESS;
+}
+
+/*
+ * Range predicates drain the range cursor, "<>" is the range below the key
+ * followed by the range above it.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+dberr_t TypedBPlusTreeIndex<KeyType, KeyComparator>::ScanKey(const Row &key, vector<RowId> &result, Txn *txn,
+                                                             string compare_operator) {
+  std::vector<IndexRange> ranges;
+  if (compare_operator == "=" && key.GetFieldCount() < key_schema_->GetColumnCount()) {
+    // equality on a prefix of the key columns is a range
+    ranges.push_back({&key, true, &key, true});
+  } else if (compare_operator == "=") {
+    // no key equals a null or a FLOAT value that is not an integer of an INT column
+    KeyType native_key;
+    if (ToNativeKey(key, native_key)) {
+      container_.GetValue(native_key, result, txn);
+    }
+  } else if (compare_operator == ">" || compare_operator == ">=") {
+    ranges.push_back({&key, compare_operator == ">=", nullptr, true});
+  } else if (compare_operator == "<" || compare_operator == "<=") {
+    ranges.push_back({nullptr, true, &key, compare_operator == "<="});
+  } else if (compare_operator == "<>") {
+    ranges.push_back({nullptr, true, &key, false});
+    ranges.push_back({&key, false, nullptr, true});
+  }
+  for (auto &range : ranges) {
+    auto cursor = ScanRange(range, txn);
+    RowId row_id;
+    while (cursor->Next(row_id)) {
+      result.emplace_back(row_id);
+    }
+  }
+  if (!result.empty())
+    return DB_SUCCESS;
+  else
+    return DB_KEY_NOT_FOUND;
+}
+
+/*
+ * Position an iterator at the lower bound, the upper bound is checked as the
+ * cursor advances so the scan stops at the first key past it. A descending
+ * scan starts from the upper bound with a reverse iterator and stops at the
+ * lower bound instead, reading only the leaves at the top of the range.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+std::unique_ptr<IndexCursor> TypedBPlusTreeIndex<KeyType, KeyComparator>::ScanRange(const IndexRange &range,
+                                                                                     Txn * /*txn*/) {
+  KeyType lower{};
+  KeyType upper{};
+  bool lower_rounded = false;
+  bool upper_rounded = false;
+  // a bound on a key prefix covers all keys with that prefix when inclusive, none of them otherwise;
+  // a FLOAT bound of an INT column is rounded into the range and then includes the key it was rounded to
+  if ((range.lower != nullptr && !ToNativeKey(*range.lower, lower, !range.lower_inclusive, 1, &lower_rounded)) ||
+      (range.upper != nullptr && !ToNativeKey(*range.upper, upper, range.upper_inclusive, -1, &upper_rounded))) {
+    // comparing with null matches nothing, nor does a bound past all INT keys
+    return std::make_unique<VectorIndexCursor>(std::vector<RowId>());
+  }
+  bool lower_inclusive = range.lower_inclusive || lower_rounded;
+  bool upper_inclusive = range.upper_inclusive || upper_rounded;
+  if (range.descending) {
+    auto iter = range.upper == nullptr ? GetReverseBeginIterator() : GetReverseBeginIterator(upper, upper_inclusive);
+    return MakeCursor(std::move(iter), GetEndIterator(), range.lower != nullptr, lower, lower_inclusive, true);
+  }
+  auto iter = range.lower == nullptr ? GetBeginIterator() : GetBeginIterator(lower);
+  auto end_iter = GetEndIterator();
+  if (range.lower != nullptr && !lower_inclusive && iter != end_iter && comparator_((*iter).first, lower) == 0) {
+    ++iter;
+  }
+  return MakeCursor(std::move(iter), std::move(end_iter), range.upper != nullptr, upper, upper_inclusive, false);
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+std::unique_ptr<IndexCursor> TypedBPlusTreeIndex<KeyType, KeyComparator>::MakeCursor(Iterator begin, Iterator end,
+                                                                                      bool has_stop,
+                                                                                      const KeyType &stop,
+                                                                                      bool stop_inclusive,
+                                                                                      bool descending) {
+  return std::make_unique<TypedBPlusTreeIndexCursor<KeyType, KeyComparator>>(
+      key_schema_, std::move(begin), std::move(end), comparator_, has_stop, stop, stop_inclusive, descending);
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool TypedBPlusTreeIndexCursor<KeyType, KeyComparator>::NextItem(MappingType &item) {
+  if (iter_ == end_) {
+    return false;
+  }
+  item = *iter_;
+  if (has_stop_) {
+    int cmp = descending_ ? comparator_(stop_, item.first) : comparator_(item.first, stop_);
+    if (cmp > 0 || (cmp == 0 && !stop_inclusive_)) {
+      iter_ = end_;
+      return false;
+    }
+  }
+  ++iter_;
+  return true;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool TypedBPlusTreeIndexCursor<KeyType, KeyComparator>::Next(RowId &row_id) {
+  MappingType item;
+  if (!NextItem(item)) {
+    return false;
+  }
+  row_id = item.second;
+  return true;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool TypedBPlusTreeIndexCursor<KeyType, KeyComparator>::NextEntry(RowId &row_id, Row &key) {
+  MappingType item;
+  if (!NextItem(item)) {
+    return false;
+  }
+  row_id = item.second;
+  TypedBPlusTreeIndex<KeyType, KeyComparator>::FromNativeKey(item.first, key_schema_, key);
+  return true;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+dberr_t TypedBPlusTreeIndex<KeyType, KeyComparator>::Destroy() {
+  container_.Destroy();
+  return DB_SUCCESS;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+TypedIndexIterator<KeyType, KeyComparator> TypedBPlusTreeIndex<KeyType, KeyComparator>::GetBeginIterator() {
+  return container_.Begin();
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+TypedIndexIterator<KeyType, KeyComparator> TypedBPlusTreeIndex<KeyType, KeyComparator>::GetReverseBeginIterator() {
+  return container_.RBegin();
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+TypedIndexIterator<KeyType, KeyComparator> TypedBPlusTreeIndex<KeyType, KeyComparator>::GetReverseBeginIterator(
+    const KeyType &key, bool inclusive) {
+  return container_.RBegin(key, inclusive);
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+TypedIndexIterator<KeyType, KeyComparator> TypedBPlusTreeIndex<KeyType, KeyComparator>::GetBeginIterator(
+    const KeyType &key) {
+  return container_.Begin(key);
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+TypedIndexIterator<KeyType, KeyComparator> TypedBPlusTreeIndex<KeyType, KeyComparator>::GetEndIterator() {
+  return container_.End();
+}
+
+template class TypedBPlusTreeIndexCursor<int32_t, BasicComparator<int32_t>>;
+
+template class TypedBPlusTreeIndexCursor<int64_t, BasicComparator<int64_t>>;
+
+template class TypedBPlusTreeIndexCursor<float, BasicComparator<float>>;
+
+template class TypedBPlusTreeIndex<int32_t, BasicComparator<int32_t>>;
+
+template class TypedBPlusTreeIndex<int64_t, BasicComparator<int64_t>>;
+
+template class TypedBPlusTreeIndex<float, BasicComparator<float>>;
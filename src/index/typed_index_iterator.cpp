@@ -0,0 +1,79 @@
+#include "index/typed_index_iterator.h"
+
+#include "common/macros.h"
+#include "index/basic_comparator.h"
+#include "index/typed_b_plus_tree.h"
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+TypedIndexIterator<KeyType, KeyComparator>::TypedIndexIterator() = default;
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+TypedIndexIterator<KeyType, KeyComparator>::TypedIndexIterator(Tree *tree, const KeyType *key) : tree_(tree) {
+  current_page_id = tree_->ReadLeaf(key, false, items_, item_index, has_next_);
+  if (current_page_id == INVALID_PAGE_ID) {
+    item_index = 0;
+  }
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+TypedIndexIterator<KeyType, KeyComparator>::TypedIndexIterator(Tree *tree, const KeyType *key, bool inclusive,
+                                                               bool reverse)
+    : tree_(tree), reverse_(reverse) {
+  if (reverse_) {
+    current_page_id = tree_->ReadLeafReverse(key, inclusive, items_, has_next_);
+  } else {
+    current_page_id = tree_->ReadLeaf(key, !inclusive, items_, item_index, has_next_);
+  }
+  if (current_page_id == INVALID_PAGE_ID) {
+    item_index = 0;
+  }
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+std::pair<KeyType, RowId> TypedIndexIterator<KeyType, KeyComparator>::operator*() {
+  ASSERT(current_page_id != INVALID_PAGE_ID, "Dereference an end iterator.");
+  return items_[item_index];
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+TypedIndexIterator<KeyType, KeyComparator> &TypedIndexIterator<KeyType, KeyComparator>::operator++() {
+  if (current_page_id == INVALID_PAGE_ID) {
+    return *this;
+  }
+  if (++item_index < static_cast<int>(items_.size())) {
+    return *this;
+  }
+  if (has_next_) {
+    // the leaf may have been split or merged meanwhile, so seek past the last key instead of following the link
+    KeyType last_key = items_.back().first;
+    if (reverse_) {
+      current_page_id = tree_->ReadLeafReverse(&last_key, false, items_, has_next_);
+      item_index = 0;
+    } else {
+      current_page_id = tree_->ReadLeaf(&last_key, true, items_, item_index, has_next_);
+    }
+  } else {
+    current_page_id = INVALID_PAGE_ID;
+  }
+  if (current_page_id == INVALID_PAGE_ID) {
+    items_.clear();
+    item_index = 0;
+  }
+  return *this;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool TypedIndexIterator<KeyType, KeyComparator>::operator==(const TypedIndexIterator &itr) const {
+  return current_page_id == itr.current_page_id && item_index == itr.item_index;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool TypedIndexIterator<KeyType, KeyComparator>::operator!=(const TypedIndexIterator &itr) const {
+  return !(*this == itr);
+}
+
+template class TypedIndexIterator<int32_t, BasicComparator<int32_t>>;
+
+template class TypedIndexIterator<int64_t, BasicComparator<int64_t>>;
+
+template class TypedIndexIterator<float, BasicComparator<float>>;
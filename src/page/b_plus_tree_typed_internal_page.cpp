@@ -0,0 +1,260 @@
+#include "page/b_plus_tree_typed_internal_page.h"
+
+#include <algorithm>
+#include <type_traits>
+
+#include "index/basic_comparator.h"
+#include "index/key_search.h"
+
+/*****************************************************************************
+ * HELPER METHODS AND UTILITIES
+ *****************************************************************************/
+/*
+ * Init method after creating a new internal page
+ * Including set page type, set current size, set page id, set parent id and set
+ * max page size
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_INTERNAL_PAGE_TYPE::Init(page_id_t page_id, page_id_t parent_id, int max_size) {
+  SetPageType(IndexPageType::INTERNAL_PAGE);
+  SetKeySize(sizeof(KeyType));
+  SetLSN(INVALID_LSN);
+  SetSize(0);
+  SetMaxSize(max_size == UNDEFINED_SIZE ? Capacity() - 1 : max_size);
+  SetParentPageId(parent_id);
+  SetPageId(page_id);
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+KeyType TYPED_INTERNAL_PAGE_TYPE::KeyAt(int index) const {
+  return Keys()[index];
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_INTERNAL_PAGE_TYPE::SetKeyAt(int index, const KeyType &key) {
+  Keys()[index] = key;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+page_id_t TYPED_INTERNAL_PAGE_TYPE::ValueAt(int index) const {
+  return Values()[index];
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_INTERNAL_PAGE_TYPE::SetValueAt(int index, page_id_t value) {
+  Values()[index] = value;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+int TYPED_INTERNAL_PAGE_TYPE::ValueIndex(const page_id_t &value) const {
+  const page_id_t *end = Values() + GetSize();
+  const page_id_t *pos = std::find(Values(), end, value);
+  return pos == end ? -1 : static_cast<int>(pos - Values());
+}
+
+/*****************************************************************************
+ * LOOKUP
+ *****************************************************************************/
+/*
+ * Find and return the child pointer(page_id) which points to the child page
+ * that contains input "key"
+ * Start the search from the second key(the first key should always be invalid)
+ * 查找最后一个 <= key 的位置, 默认比较器使用SIMD
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+page_id_t TYPED_INTERNAL_PAGE_TYPE::Lookup(const KeyType &key, const KeyComparator &comparator) const {
+  if constexpr (std::is_same<KeyComparator, BasicComparator<KeyType>>::value) {
+    return Values()[KeySearch::UpperBound(Keys() + 1, GetSize() - 1, key)];
+  }
+  int left = 1;
+  int right = GetSize();
+  while (left < right) {
+    int mid = left + (right - left) / 2;
+    if (comparator(Keys()[mid], key) <= 0) {
+      left = mid + 1;
+    } else {
+      right = mid;
+    }
+  }
+  return Values()[left - 1];
+}
+
+/*****************************************************************************
+ * INSERTION
+ *****************************************************************************/
+/*
+ * Populate new root page with old_value + new_key & new_value
+ * NOTE: This method is only called within InsertIntoParent()(typed_b_plus_tree.cpp)
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_INTERNAL_PAGE_TYPE::PopulateNewRoot(const page_id_t &old_value, const KeyType &new_key,
+                                               const page_id_t &new_value) {
+  Values()[0] = old_value;
+  Keys()[1] = new_key;
+  Values()[1] = new_value;
+  SetSize(2);
+}
+
+/*
+ * Insert new_key & new_value pair right after the pair with its value ==
+ * old_value
+ * @return:  new size after insertion
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+int TYPED_INTERNAL_PAGE_TYPE::InsertNodeAfter(const page_id_t &old_value, const KeyType &new_key,
+                                              const page_id_t &new_value) {
+  int index = ValueIndex(old_value) + 1;
+  std::copy_backward(Keys() + index, Keys() + GetSize(), Keys() + GetSize() + 1);
+  std::copy_backward(Values() + index, Values() + GetSize(), Values() + GetSize() + 1);
+  Keys()[index] = new_key;
+  Values()[index] = new_value;
+  IncreaseSize(1);
+  return GetSize();
+}
+
+/*
+ * Append new_key & new_value pair after the last child
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_INTERNAL_PAGE_TYPE::Append(const KeyType &key, const page_id_t &value,
+                                      BufferPoolManager *buffer_pool_manager) {
+  CopyLastFrom(key, value, buffer_pool_manager);
+}
+
+/*****************************************************************************
+ * SPLIT
+ *****************************************************************************/
+/*
+ * Remove half of key & value pairs from this page to "recipient" page
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_INTERNAL_PAGE_TYPE::MoveHalfTo(BPlusTreeTypedInternalPage *recipient,
+                                          BufferPoolManager *buffer_pool_manager) {
+  int keep = (GetSize() + 1) / 2;
+  recipient->CopyNFrom(Keys() + keep, Values() + keep, GetSize() - keep, buffer_pool_manager);
+  SetSize(keep);
+}
+
+/* Copy entries into me, starting from {keys}/{values} and copy {size} entries.
+ * Since it is an internal page, for all entries (pages) moved, their parents page now changes to me.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_INTERNAL_PAGE_TYPE::CopyNFrom(const KeyType *keys, const page_id_t *values, int size,
+                                         BufferPoolManager *buffer_pool_manager) {
+  std::copy(keys, keys + size, Keys() + GetSize());
+  std::copy(values, values + size, Values() + GetSize());
+  for (int i = 0; i < size; i++) {
+    Adopt(values[i], buffer_pool_manager);
+  }
+  IncreaseSize(size);
+}
+
+/*****************************************************************************
+ * REMOVE
+ *****************************************************************************/
+/*
+ * Remove the key & value pair in internal page according to input index(a.k.a
+ * array offset)
+ * NOTE: store key&value pair continuously after deletion
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_INTERNAL_PAGE_TYPE::Remove(int index) {
+  std::copy(Keys() + index + 1, Keys() + GetSize(), Keys() + index);
+  std::copy(Values() + index + 1, Values() + GetSize(), Values() + index);
+  IncreaseSize(-1);
+}
+
+/*
+ * Remove the only key & value pair in internal page and return the value
+ * NOTE: only call this method within AdjustRoot()(in typed_b_plus_tree.cpp)
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+page_id_t TYPED_INTERNAL_PAGE_TYPE::RemoveAndReturnOnlyChild() {
+  page_id_t child = ValueAt(0);
+  SetSize(0);
+  return child;
+}
+
+/*****************************************************************************
+ * MERGE
+ *****************************************************************************/
+/*
+ * Remove all of key & value pairs from this page to "recipient" page.
+ * The middle_key is the separation key from the parent, it replaces the
+ * invalid first key so the recipient keeps its ordering invariant.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_INTERNAL_PAGE_TYPE::MoveAllTo(BPlusTreeTypedInternalPage *recipient, const KeyType &middle_key,
+                                         BufferPoolManager *buffer_pool_manager) {
+  SetKeyAt(0, middle_key);
+  recipient->CopyNFrom(Keys(), Values(), GetSize(), buffer_pool_manager);
+  SetSize(0);
+}
+
+/*****************************************************************************
+ * REDISTRIBUTE
+ *****************************************************************************/
+/*
+ * Remove the first key & value pair from this page to tail of "recipient" page.
+ * After the move KeyAt(0) of this page holds the new separation key.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_INTERNAL_PAGE_TYPE::MoveFirstToEndOf(BPlusTreeTypedInternalPage *recipient, const KeyType &middle_key,
+                                                BufferPoolManager *buffer_pool_manager) {
+  SetKeyAt(0, middle_key);
+  recipient->CopyLastFrom(Keys()[0], Values()[0], buffer_pool_manager);
+  Remove(0);
+}
+
+/* Append an entry at the end, and adopt the moved child.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_INTERNAL_PAGE_TYPE::CopyLastFrom(const KeyType &key, page_id_t value,
+                                            BufferPoolManager *buffer_pool_manager) {
+  Keys()[GetSize()] = key;
+  Values()[GetSize()] = value;
+  IncreaseSize(1);
+  Adopt(value, buffer_pool_manager);
+}
+
+/*
+ * Remove the last key & value pair from this page to head of "recipient" page.
+ * After the move KeyAt(0) of the recipient holds the new separation key.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_INTERNAL_PAGE_TYPE::MoveLastToFrontOf(BPlusTreeTypedInternalPage *recipient, const KeyType &middle_key,
+                                                 BufferPoolManager *buffer_pool_manager) {
+  recipient->SetKeyAt(0, middle_key);
+  recipient->CopyFirstFrom(Keys()[GetSize() - 1], Values()[GetSize() - 1], buffer_pool_manager);
+  IncreaseSize(-1);
+}
+
+/* Append an entry at the beginning, and adopt the moved child.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_INTERNAL_PAGE_TYPE::CopyFirstFrom(const KeyType &key, page_id_t value,
+                                             BufferPoolManager *buffer_pool_manager) {
+  std::copy_backward(Keys(), Keys() + GetSize(), Keys() + GetSize() + 1);
+  std::copy_backward(Values(), Values() + GetSize(), Values() + GetSize() + 1);
+  Keys()[0] = key;
+  Values()[0] = value;
+  IncreaseSize(1);
+  Adopt(value, buffer_pool_manager);
+}
+
+/*
+ * Make this page the parent of the given child page, the change is persisted
+ * through the buffer pool manager.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_INTERNAL_PAGE_TYPE::Adopt(page_id_t child_page_id, BufferPoolManager *buffer_pool_manager) {
+  auto *child = reinterpret_cast<BPlusTreePage *>(buffer_pool_manager->FetchPage(child_page_id)->GetData());
+  child->SetParentPageId(GetPageId());
+  buffer_pool_manager->UnpinPage(child_page_id, true);
+}
+
+template class BPlusTreeTypedInternalPage<int32_t, BasicComparator<int32_t>>;
+
+template class BPlusTreeTypedInternalPage<int64_t, BasicComparator<int64_t>>;
+
+template class BPlusTreeTypedInternalPage<float, BasicComparator<float>>;
@@ -0,0 +1,236 @@
+#include "page/b_plus_tree_typed_leaf_page.h"
+
+#include <algorithm>
+#include <type_traits>
+
+#include "index/basic_comparator.h"
+#include "index/key_search.h"
+
+/*****************************************************************************
+ * HELPER METHODS AND UTILITIES
+ *****************************************************************************/
+/**
+ * Init method after creating a new leaf page
+ * Including set page type, set current size to zero, set page id/parent id, set
+ * next page id and set max size. When max_size is undefined, one slot of the
+ * page is kept free so that an insert can overflow the page before it splits.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_LEAF_PAGE_TYPE::Init(page_id_t page_id, page_id_t parent_id, int max_size) {
+  SetPageType(IndexPageType::LEAF_PAGE);
+  SetKeySize(sizeof(KeyType));
+  SetLSN(INVALID_LSN);
+  SetSize(0);
+  SetMaxSize(max_size == UNDEFINED_SIZE ? Capacity() - 1 : max_size);
+  SetParentPageId(parent_id);
+  SetPageId(page_id);
+  next_page_id_ = INVALID_PAGE_ID;
+}
+
+/**
+ * Helper methods to set/get next page id
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+page_id_t TYPED_LEAF_PAGE_TYPE::GetNextPageId() const {
+  return next_page_id_;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_LEAF_PAGE_TYPE::SetNextPageId(page_id_t next_page_id) {
+  next_page_id_ = next_page_id;
+}
+
+/**
+ * Helper method to find the first index i so that Keys()[i] >= key
+ * The default comparator goes through the SIMD kernels, a custom comparator
+ * falls back to binary search.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+int TYPED_LEAF_PAGE_TYPE::KeyIndex(const KeyType &key, const KeyComparator &comparator) const {
+  if constexpr (std::is_same<KeyComparator, BasicComparator<KeyType>>::value) {
+    return KeySearch::LowerBound(Keys(), GetSize(), key);
+  }
+  int left = 0;
+  int right = GetSize();
+  while (left < right) {
+    int mid = left + (right - left) / 2;
+    if (comparator(Keys()[mid], key) < 0) {
+      left = mid + 1;
+    } else {
+      right = mid;
+    }
+  }
+  return left;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+KeyType TYPED_LEAF_PAGE_TYPE::KeyAt(int index) const {
+  return Keys()[index];
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+RowId TYPED_LEAF_PAGE_TYPE::ValueAt(int index) const {
+  return Values()[index];
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_LEAF_PAGE_TYPE::SetValueAt(int index, const RowId &value) {
+  Values()[index] = value;
+}
+
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+typename TYPED_LEAF_PAGE_TYPE::MappingType TYPED_LEAF_PAGE_TYPE::GetItem(int index) const {
+  return MappingType(Keys()[index], Values()[index]);
+}
+
+/*****************************************************************************
+ * INSERTION
+ *****************************************************************************/
+/*
+ * Insert key & value pair into leaf page ordered by key
+ * @return page size after insertion
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+int TYPED_LEAF_PAGE_TYPE::Insert(const KeyType &key, const RowId &value, const KeyComparator &comparator) {
+  int index = KeyIndex(key, comparator);
+  std::copy_backward(Keys() + index, Keys() + GetSize(), Keys() + GetSize() + 1);
+  std::copy_backward(Values() + index, Values() + GetSize(), Values() + GetSize() + 1);
+  Keys()[index] = key;
+  Values()[index] = value;
+  IncreaseSize(1);
+  return GetSize();
+}
+
+/*
+ * Append key & value pair after the last entry, the caller guarantees the order
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_LEAF_PAGE_TYPE::Append(const KeyType &key, const RowId &value) {
+  CopyLastFrom(key, value);
+}
+
+/*****************************************************************************
+ * SPLIT
+ *****************************************************************************/
+/*
+ * Remove half of key & value pairs from this page to "recipient" page
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_LEAF_PAGE_TYPE::MoveHalfTo(BPlusTreeTypedLeafPage *recipient) {
+  int keep = (GetSize() + 1) / 2;
+  recipient->CopyNFrom(Keys() + keep, Values() + keep, GetSize() - keep);
+  SetSize(keep);
+}
+
+/*
+ * Copy starting from keys/values, and copy {size} number of elements into me.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_LEAF_PAGE_TYPE::CopyNFrom(const KeyType *keys, const RowId *values, int size) {
+  std::copy(keys, keys + size, Keys() + GetSize());
+  std::copy(values, values + size, Values() + GetSize());
+  IncreaseSize(size);
+}
+
+/*****************************************************************************
+ * LOOKUP
+ *****************************************************************************/
+/*
+ * For the given key, check to see whether it exists in the leaf page. If it
+ * does, then store its corresponding value in input "value" and return true.
+ * If the key does not exist, then return false
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+bool TYPED_LEAF_PAGE_TYPE::Lookup(const KeyType &key, RowId &value, const KeyComparator &comparator) const {
+  int index = KeyIndex(key, comparator);
+  if (index < GetSize() && comparator(Keys()[index], key) == 0) {
+    value = Values()[index];
+    return true;
+  }
+  return false;
+}
+
+/*****************************************************************************
+ * REMOVE
+ *****************************************************************************/
+/*
+ * First look through leaf page to see whether delete key exist or not. If
+ * existed, perform deletion, otherwise return immediately.
+ * NOTE: store key&value pair continuously after deletion
+ * @return  page size after deletion
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+int TYPED_LEAF_PAGE_TYPE::RemoveAndDeleteRecord(const KeyType &key, const KeyComparator &comparator) {
+  int index = KeyIndex(key, comparator);
+  if (index < GetSize() && comparator(Keys()[index], key) == 0) {
+    std::copy(Keys() + index + 1, Keys() + GetSize(), Keys() + index);
+    std::copy(Values() + index + 1, Values() + GetSize(), Values() + index);
+    IncreaseSize(-1);
+  }
+  return GetSize();
+}
+
+/*****************************************************************************
+ * MERGE
+ *****************************************************************************/
+/*
+ * Remove all key & value pairs from this page to "recipient" page, and hand
+ * over the next page link so the leaf chain skips this page.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_LEAF_PAGE_TYPE::MoveAllTo(BPlusTreeTypedLeafPage *recipient) {
+  recipient->CopyNFrom(Keys(), Values(), GetSize());
+  recipient->SetNextPageId(next_page_id_);
+  SetSize(0);
+}
+
+/*****************************************************************************
+ * REDISTRIBUTE
+ *****************************************************************************/
+/*
+ * Remove the first key & value pair from this page to "recipient" page.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_LEAF_PAGE_TYPE::MoveFirstToEndOf(BPlusTreeTypedLeafPage *recipient) {
+  recipient->CopyLastFrom(Keys()[0], Values()[0]);
+  std::copy(Keys() + 1, Keys() + GetSize(), Keys());
+  std::copy(Values() + 1, Values() + GetSize(), Values());
+  IncreaseSize(-1);
+}
+
+/*
+ * Copy the item into the end of my item list. (Append item to my array)
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_LEAF_PAGE_TYPE::CopyLastFrom(const KeyType &key, const RowId &value) {
+  Keys()[GetSize()] = key;
+  Values()[GetSize()] = value;
+  IncreaseSize(1);
+}
+
+/*
+ * Remove the last key & value pair from this page to "recipient" page.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_LEAF_PAGE_TYPE::MoveLastToFrontOf(BPlusTreeTypedLeafPage *recipient) {
+  recipient->CopyFirstFrom(Keys()[GetSize() - 1], Values()[GetSize() - 1]);
+  IncreaseSize(-1);
+}
+
+/*
+ * Insert item at the front of my items. Move items accordingly.
+ */
+TYPED_INDEX_TEMPLATE_ARGUMENTS
+void TYPED_LEAF_PAGE_TYPE::CopyFirstFrom(const KeyType &key, const RowId &value) {
+  std::copy_backward(Keys(), Keys() + GetSize(), Keys() + GetSize() + 1);
+  std::copy_backward(Values(), Values() + GetSize(), Values() + GetSize() + 1);
+  Keys()[0] = key;
+  Values()[0] = value;
+  IncreaseSize(1);
+}
+
+template class BPlusTreeTypedLeafPage<int32_t, BasicComparator<int32_t>>;
+
+template class BPlusTreeTypedLeafPage<int64_t, BasicComparator<int64_t>>;
+
+template class BPlusTreeTypedLeafPage<float, BasicComparator<float>>;
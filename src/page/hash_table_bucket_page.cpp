@@ -0,0 +1,55 @@
+#include "page/hash_table_bucket_page.h"
+
+#include <cstring>
+
+void HashTableBucketPage::Init(page_id_t page_id, uint32_t key_size) {
+  page_id_ = page_id;
+  key_size_ = key_size;
+  size_ = 0;
+  padding_ = 0;
+}
+
+int HashTableBucketPage::KeyIndex(const char *key) const {
+  for (uint32_t i = 0; i < size_; i++) {
+    if (memcmp(KeyAt(i), key, key_size_) == 0) {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
+bool HashTableBucketPage::Lookup(const char *key, RowId &value) const {
+  int index = KeyIndex(key);
+  if (index < 0) {
+    return false;
+  }
+  value = ValueAt(index);
+  return true;
+}
+
+bool HashTableBucketPage::Insert(const char *key, const RowId &value) {
+  if (IsFull() || KeyIndex(key) >= 0) {
+    return false;
+  }
+  char *entry = EntryAt(size_);
+  memcpy(entry, &value, sizeof(RowId));
+  memcpy(entry + sizeof(RowId), key, key_size_);
+  size_++;
+  return true;
+}
+
+bool HashTableBucketPage::Remove(const char *key) {
+  int index = KeyIndex(key);
+  if (index < 0) {
+    return false;
+  }
+  RemoveAt(index);
+  return true;
+}
+
+void HashTableBucketPage::RemoveAt(uint32_t index) {
+  size_--;
+  if (index != size_) {
+    memcpy(EntryAt(index), EntryAt(size_), key_size_ + sizeof(RowId));
+  }
+}
@@ -0,0 +1,25 @@
+#include "page/hash_table_directory_page.h"
+
+#include <algorithm>
+
+void HashTableDirectoryPage::Init(page_id_t page_id, page_id_t bucket_page_id) {
+  page_id_ = page_id;
+  global_depth_ = 0;
+  local_depths_[0] = 0;
+  bucket_page_ids_[0] = bucket_page_id;
+}
+
+void HashTableDirectoryPage::IncrGlobalDepth() {
+  uint32_t size = Size();
+  std::copy(local_depths_, local_depths_ + size, local_depths_ + size);
+  std::copy(bucket_page_ids_, bucket_page_ids_ + size, bucket_page_ids_ + size);
+  global_depth_++;
+}
+
+bool HashTableDirectoryPage::CanShrink() const {
+  if (global_depth_ == 0) {
+    return false;
+  }
+  return std::all_of(local_depths_, local_depths_ + Size(),
+                     [this](uint8_t local_depth) { return local_depth < global_depth_; });
+}
@@ -0,0 +1,8 @@
+#include "page/hash_table_header_page.h"
+
+void HashTableHeaderPage::Init(page_id_t page_id) {
+  page_id_ = page_id;
+  for (auto &directory_page_id : directory_page_ids_) {
+    directory_page_id = INVALID_PAGE_ID;
+  }
+}
@@ -0,0 +1,26 @@
+#include "page/learned_index_page.h"
+
+#include <algorithm>
+#include <cstring>
+
+bool LearnedIndexLeafPage::Append(int32_t key, int64_t value) {
+  if (count_ >= CAPACITY) {
+    return false;
+  }
+  reinterpret_cast<int32_t *>(data_)[count_] = key;
+  reinterpret_cast<int64_t *>(data_ + VALUES_OFFSET)[count_] = value;
+  count_++;
+  return true;
+}
+
+int LearnedIndexLeafPage::LowerBound(int32_t key, int begin, int end) const {
+  const auto *keys = reinterpret_cast<const int32_t *>(data_);
+  return static_cast<int>(std::lower_bound(keys + begin, keys + end, key) - keys);
+}
+
+size_t LearnedIndexModelPage::Append(const char *bytes, size_t size) {
+  size_t taken = std::min(size, CAPACITY - used_);
+  memcpy(data_ + used_, bytes, taken);
+  used_ += taken;
+  return taken;
+}
@@ -0,0 +1,72 @@
+#include "page/lsm_run_page.h"
+
+#include <cstring>
+
+void LsmRunPage::Init() {
+  next_page_id_ = INVALID_PAGE_ID;
+  count_ = 0;
+  used_ = 0;
+}
+
+bool LsmRunPage::Append(std::string_view key, int64_t value, bool deleted) {
+  if (used_ + EntrySize(key.size()) > CAPACITY) {
+    return false;
+  }
+  char *buf = data_ + used_;
+  auto key_len = static_cast<uint16_t>(key.size());
+  memcpy(buf, &key_len, sizeof(key_len));
+  buf[2] = deleted ? 1 : 0;
+  memcpy(buf + 3, &value, sizeof(value));
+  memcpy(buf + ENTRY_HEADER_SIZE, key.data(), key.size());
+  used_ += EntrySize(key.size());
+  count_++;
+  return true;
+}
+
+void LsmRunPage::Decode(std::vector<Entry> &entries) const {
+  const char *buf = data_;
+  for (int i = 0; i < count_; i++) {
+    uint16_t key_len;
+    memcpy(&key_len, buf, sizeof(key_len));
+    Entry entry;
+    entry.deleted = buf[2] != 0;
+    memcpy(&entry.value, buf + 3, sizeof(entry.value));
+    entry.key.assign(buf + ENTRY_HEADER_SIZE, key_len);
+    entries.push_back(std::move(entry));
+    buf += EntrySize(key_len);
+  }
+}
+
+bool LsmRunPage::Find(std::string_view key, int64_t &value, bool &deleted) const {
+  const char *buf = data_;
+  for (int i = 0; i < count_; i++) {
+    uint16_t key_len;
+    memcpy(&key_len, buf, sizeof(key_len));
+    int cmp = std::string_view(buf + ENTRY_HEADER_SIZE, key_len).compare(key);
+    if (cmp == 0) {
+      deleted = buf[2] != 0;
+      memcpy(&value, buf + 3, sizeof(value));
+      return true;
+    }
+    if (cmp > 0) {
+      // entries are in key order
+      return false;
+    }
+    buf += EntrySize(key_len);
+  }
+  return false;
+}
+
+std::string LsmRunPage::FirstKey() const {
+  uint16_t key_len;
+  memcpy(&key_len, data_, sizeof(key_len));
+  return std::string(data_ + ENTRY_HEADER_SIZE, key_len);
+}
+
+bool LsmManifestPage::AddRun(uint32_t level, page_id_t first_page_id) {
+  if (count_ >= MAX_RUN_COUNT) {
+    return false;
+  }
+  runs_[count_++] = {level, first_page_id};
+  return true;
+}
@@ -0,0 +1,183 @@
+#include "page/posting_list_page.h"
+
+#include <cstring>
+
+void PostingListPage::Init(page_id_t page_id, uint64_t owner) {
+  magic_ = POSTING_LIST_MAGIC_NUM;
+  page_id_ = page_id;
+  next_page_id_ = INVALID_PAGE_ID;
+  tail_page_id_ = page_id;
+  count_ = 0;
+  used_ = 0;
+  owner_ = owner;
+  first_ = 0;
+  last_ = 0;
+}
+
+size_t PostingListPage::VarintSize(uint64_t delta) {
+  size_t size = 1;
+  while (delta >= 0x80) {
+    delta >>= 7;
+    size++;
+  }
+  return size;
+}
+
+size_t PostingListPage::EncodeVarint(uint64_t delta, unsigned char *p) {
+  unsigned char *start = p;
+  while (delta >= 0x80) {
+    *p++ = static_cast<unsigned char>(delta | 0x80);
+    delta >>= 7;
+  }
+  *p++ = static_cast<unsigned char>(delta);
+  return p - start;
+}
+
+uint64_t PostingListPage::DecodeVarint(const unsigned char *&p) {
+  uint64_t delta = 0;
+  int shift = 0;
+  while (*p & 0x80) {
+    delta |= static_cast<uint64_t>(*p++ & 0x7f) << shift;
+    shift += 7;
+  }
+  delta |= static_cast<uint64_t>(*p++) << shift;
+  return delta;
+}
+
+void PostingListPage::ReplaceDeltas(size_t offset, size_t old_size, const uint64_t *deltas, size_t count) {
+  unsigned char buf[32];
+  size_t new_size = 0;
+  for (size_t i = 0; i < count; i++) {
+    new_size += EncodeVarint(deltas[i], buf + new_size);
+  }
+  memmove(data_ + offset + new_size, data_ + offset + old_size, used_ - offset - old_size);
+  memcpy(data_ + offset, buf, new_size);
+  used_ = static_cast<uint32_t>(used_ - old_size + new_size);
+}
+
+void PostingListPage::Decode(std::vector<int64_t> &out) const {
+  if (count_ == 0) {
+    return;
+  }
+  int64_t rid = first_;
+  out.push_back(rid);
+  const unsigned char *p = data_;
+  for (uint32_t i = 1; i < count_; i++) {
+    rid += static_cast<int64_t>(DecodeVarint(p));
+    out.push_back(rid);
+  }
+}
+
+size_t PostingListPage::Fill(const int64_t *rids, size_t size) {
+  count_ = 0;
+  used_ = 0;
+  size_t filled = 0;
+  while (filled < size && Append(rids[filled])) {
+    filled++;
+  }
+  return filled;
+}
+
+bool PostingListPage::Append(int64_t rid) {
+  if (count_ == 0) {
+    first_ = last_ = rid;
+    count_ = 1;
+    return true;
+  }
+  auto delta = static_cast<uint64_t>(rid - last_);
+  if (used_ + VarintSize(delta) > DATA_SIZE) {
+    return false;
+  }
+  used_ += EncodeVarint(delta, data_ + used_);
+  last_ = rid;
+  count_++;
+  return true;
+}
+
+/*
+ * The delta of the following row id is split in two around the new one.
+ */
+PostingListPage::InsertResult PostingListPage::Insert(int64_t rid) {
+  if (count_ == 0 || rid > last_) {
+    return Append(rid) ? InsertResult::kInserted : InsertResult::kFull;
+  }
+  if (rid == first_ || rid == last_) {
+    return InsertResult::kDuplicate;
+  }
+  if (rid < first_) {
+    auto delta = static_cast<uint64_t>(first_ - rid);
+    if (used_ + VarintSize(delta) > DATA_SIZE) {
+      return InsertResult::kFull;
+    }
+    ReplaceDeltas(0, 0, &delta, 1);
+    first_ = rid;
+    count_++;
+    return InsertResult::kInserted;
+  }
+  // first_ < rid < last_, some row id of the page is greater than it
+  int64_t prev = first_;
+  const unsigned char *p = data_;
+  while (true) {
+    const unsigned char *start = p;
+    int64_t cur = prev + static_cast<int64_t>(DecodeVarint(p));
+    if (cur == rid) {
+      return InsertResult::kDuplicate;
+    }
+    if (cur > rid) {
+      uint64_t deltas[2] = {static_cast<uint64_t>(rid - prev), static_cast<uint64_t>(cur - rid)};
+      size_t old_size = p - start;
+      if (used_ - old_size + VarintSize(deltas[0]) + VarintSize(deltas[1]) > DATA_SIZE) {
+        return InsertResult::kFull;
+      }
+      ReplaceDeltas(start - data_, old_size, deltas, 2);
+      count_++;
+      return InsertResult::kInserted;
+    }
+    prev = cur;
+  }
+}
+
+/*
+ * The deltas around the removed row id are merged, which never takes more
+ * bytes than the two of them did.
+ */
+bool PostingListPage::Remove(int64_t rid) {
+  if (count_ == 0 || rid < first_ || rid > last_) {
+    return false;
+  }
+  if (count_ == 1) {
+    count_ = 0;
+    used_ = 0;
+    return true;
+  }
+  const unsigned char *p = data_;
+  if (rid == first_) {
+    first_ += static_cast<int64_t>(DecodeVarint(p));
+    ReplaceDeltas(0, p - data_, nullptr, 0);
+    count_--;
+    return true;
+  }
+  const unsigned char *end = data_ + used_;
+  int64_t prev = first_;
+  while (p < end) {
+    const unsigned char *start = p;
+    int64_t cur = prev + static_cast<int64_t>(DecodeVarint(p));
+    if (cur > rid) {
+      return false;
+    }
+    if (cur == rid) {
+      if (p == end) {
+        ReplaceDeltas(start - data_, p - start, nullptr, 0);
+        last_ = prev;
+      } else {
+        int64_t next = cur + static_cast<int64_t>(DecodeVarint(p));
+        auto delta = static_cast<uint64_t>(next - prev);
+        ReplaceDeltas(start - data_, p - start, &delta, 1);
+      }
+      count_--;
+      return true;
+    }
+    prev = cur;
+  }
+  return false;
+}
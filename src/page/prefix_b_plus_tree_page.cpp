@@ -0,0 +1,226 @@
+#include "page/prefix_b_plus_tree_page.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/rowid.h"
+
+static size_t VarintSize(uint64_t value) {
+  size_t size = 1;
+  while (value >= 0x80) {
+    value >>= 7;
+    size++;
+  }
+  return size;
+}
+
+static size_t EncodeVarint(uint64_t value, char *p) {
+  char *start = p;
+  while (value >= 0x80) {
+    *p++ = static_cast<char>(value | 0x80);
+    value >>= 7;
+  }
+  *p++ = static_cast<char>(value);
+  return p - start;
+}
+
+static uint64_t DecodeVarint(const char *&p) {
+  uint64_t value = 0;
+  int shift = 0;
+  while (*p & 0x80) {
+    value |= static_cast<uint64_t>(*p++ & 0x7f) << shift;
+    shift += 7;
+  }
+  value |= static_cast<uint64_t>(static_cast<unsigned char>(*p++)) << shift;
+  return value;
+}
+
+void PrefixBPlusTreePage::Init(page_id_t page_id, bool is_leaf) {
+  page_type_ = is_leaf ? LEAF_PAGE_TYPE : INTERNAL_PAGE_TYPE;
+  page_id_ = page_id;
+  next_page_id_ = INVALID_PAGE_ID;
+  size_ = 0;
+  prefix_len_ = 0;
+  heap_begin_ = PAGE_SIZE;
+  garbage_ = 0;
+  base_page_id_ = 0;
+}
+
+std::string PrefixBPlusTreePage::KeyAt(int index) const {
+  std::string key(Prefix(), prefix_len_);
+  key.append(SuffixAt(index));
+  return key;
+}
+
+int64_t PrefixBPlusTreePage::ValueAt(int index) const {
+  const char *value = PageStart() + slots_[index].offset + slots_[index].length;
+  if (IsLeafPage()) {
+    auto page_id = static_cast<page_id_t>(base_page_id_ + DecodeVarint(value));
+    auto slot_num = static_cast<uint32_t>(DecodeVarint(value));
+    return RowId(page_id, slot_num).Get();
+  }
+  page_id_t child;
+  memcpy(&child, value, sizeof(child));
+  return child;
+}
+
+size_t PrefixBPlusTreePage::ValueSizeAt(int index) const {
+  if (!IsLeafPage()) {
+    return sizeof(page_id_t);
+  }
+  const char *start = PageStart() + slots_[index].offset + slots_[index].length;
+  const char *value = start;
+  DecodeVarint(value);
+  DecodeVarint(value);
+  return value - start;
+}
+
+size_t PrefixBPlusTreePage::RowIdSize(int64_t value, page_id_t base_page_id) {
+  RowId row_id(value);
+  return VarintSize(static_cast<uint32_t>(row_id.GetPageId() - base_page_id)) + VarintSize(row_id.GetSlotNum());
+}
+
+size_t PrefixBPlusTreePage::WriteValue(char *dest, int64_t value) const {
+  if (IsLeafPage()) {
+    RowId row_id(value);
+    size_t size = EncodeVarint(static_cast<uint32_t>(row_id.GetPageId() - base_page_id_), dest);
+    return size + EncodeVarint(row_id.GetSlotNum(), dest + size);
+  }
+  auto child = static_cast<page_id_t>(value);
+  memcpy(dest, &child, sizeof(child));
+  return sizeof(child);
+}
+
+page_id_t PrefixBPlusTreePage::BasePageId(const std::vector<Entry> &entries, size_t begin, size_t end) {
+  page_id_t base_page_id = 0;
+  for (size_t i = begin; i < end; i++) {
+    page_id_t page_id = RowId(entries[i].value).GetPageId();
+    if (i == begin || page_id < base_page_id) {
+      base_page_id = page_id;
+    }
+  }
+  return base_page_id;
+}
+
+/*
+ * The key is compared with the page prefix once, then only the suffixes are
+ * compared during the binary search.
+ */
+int PrefixBPlusTreePage::LowerBound(std::string_view key) const {
+  std::string_view prefix(Prefix(), prefix_len_);
+  int cmp = key.compare(0, prefix.size(), prefix);
+  if (cmp != 0) {
+    // all keys of the page start with the prefix
+    return cmp < 0 ? 0 : size_;
+  }
+  std::string_view suffix = key.substr(prefix.size());
+  int low = 0;
+  int high = size_;
+  while (low < high) {
+    int mid = (low + high) / 2;
+    if (SuffixAt(mid) < suffix) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  return low;
+}
+
+bool PrefixBPlusTreePage::KeyEquals(int index, std::string_view key) const {
+  return key.size() == prefix_len_ + slots_[index].length &&
+         key.compare(0, prefix_len_, std::string_view(Prefix(), prefix_len_)) == 0 &&
+         key.substr(prefix_len_) == SuffixAt(index);
+}
+
+/*
+ * A key sharing the page prefix, with a row id not below the base page id, is
+ * written into the free space directly. Otherwise (or when only the garbage
+ * would make room) the page is rebuilt with the new entry, which recomputes
+ * the prefix and the base page id.
+ */
+bool PrefixBPlusTreePage::Insert(int index, std::string_view key, int64_t value) {
+  if (size_ == 0 && IsLeafPage()) {
+    base_page_id_ = RowId(value).GetPageId();
+  }
+  bool has_prefix = key.compare(0, prefix_len_, std::string_view(Prefix(), prefix_len_)) == 0;
+  bool has_base = !IsLeafPage() || RowId(value).GetPageId() >= base_page_id_;
+  size_t suffix_size = key.size() - prefix_len_;
+  size_t entry_size = EntrySize(suffix_size, value, base_page_id_) - SLOT_SIZE;
+  if (has_prefix && has_base && FreeSpace() >= SLOT_SIZE + entry_size) {
+    heap_begin_ -= entry_size;
+    memcpy(PageStart() + heap_begin_, key.data() + prefix_len_, suffix_size);
+    WriteValue(PageStart() + heap_begin_ + suffix_size, value);
+    memmove(slots_ + index + 1, slots_ + index, (size_ - index) * SLOT_SIZE);
+    slots_[index] = {heap_begin_, static_cast<uint16_t>(suffix_size)};
+    size_++;
+    return true;
+  }
+  std::vector<Entry> entries;
+  GetEntries(entries);
+  entries.insert(entries.begin() + index, Entry{std::string(key), value});
+  if (!Build(entries, 0, entries.size())) {
+    // leave the page as it was
+    entries.erase(entries.begin() + index);
+    Build(entries, 0, entries.size());
+    return false;
+  }
+  return true;
+}
+
+void PrefixBPlusTreePage::Remove(int index) {
+  garbage_ += slots_[index].length + ValueSizeAt(index);
+  memmove(slots_ + index, slots_ + index + 1, (size_ - index - 1) * SLOT_SIZE);
+  size_--;
+}
+
+void PrefixBPlusTreePage::GetEntries(std::vector<Entry> &entries) const {
+  entries.reserve(entries.size() + size_);
+  for (int i = 0; i < size_; i++) {
+    entries.push_back({KeyAt(i), ValueAt(i)});
+  }
+}
+
+/*
+ * The entries are sorted, so the common prefix of all of them is the common
+ * prefix of the first and the last one. The row ids of a leaf are encoded
+ * against the lowest heap page id among them, so a subset of the entries of a
+ * page never takes more bytes than in the page, and both halves of a split
+ * page fit.
+ */
+bool PrefixBPlusTreePage::Build(const std::vector<Entry> &entries, size_t begin, size_t end) {
+  size_t prefix_len = 0;
+  if (end - begin > 1) {
+    const std::string &first = entries[begin].key;
+    const std::string &last = entries[end - 1].key;
+    size_t max_len = std::min(first.size(), last.size());
+    while (prefix_len < max_len && first[prefix_len] == last[prefix_len]) {
+      prefix_len++;
+    }
+  }
+  page_id_t base_page_id = IsLeafPage() ? BasePageId(entries, begin, end) : 0;
+  size_t needed = prefix_len;
+  for (size_t i = begin; i < end; i++) {
+    needed += EntrySize(entries[i].key.size() - prefix_len, entries[i].value, base_page_id);
+  }
+  if (needed > CAPACITY) {
+    return false;
+  }
+  size_ = 0;
+  garbage_ = 0;
+  base_page_id_ = base_page_id;
+  prefix_len_ = static_cast<uint16_t>(prefix_len);
+  heap_begin_ = static_cast<uint16_t>(PAGE_SIZE - prefix_len);
+  if (prefix_len > 0) {
+    memcpy(PageStart() + heap_begin_, entries[begin].key.data(), prefix_len);
+  }
+  for (size_t i = begin; i < end; i++) {
+    size_t suffix_size = entries[i].key.size() - prefix_len;
+    heap_begin_ -= EntrySize(suffix_size, entries[i].value, base_page_id) - SLOT_SIZE;
+    memcpy(PageStart() + heap_begin_, entries[i].key.data() + prefix_len, suffix_size);
+    WriteValue(PageStart() + heap_begin_ + suffix_size, entries[i].value);
+    slots_[size_] = {heap_begin_, static_cast<uint16_t>(suffix_size)};
+    size_++;
+  }
+  return true;
+}
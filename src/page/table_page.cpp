@@ -161,6 +161,20 @@ bool TablePage::GetTuple(Row *row, Schema *schema, Txn *txn, LockManager *lock_m
   return true;
 }
 
+uint32_t TablePage::GetTuples(uint32_t begin_slot, RowBatch &batch) {
+  uint32_t tuple_count = GetTupleCount();
+  uint32_t slot_num = begin_slot;
+  for (; slot_num < tuple_count && !batch.IsFull(); slot_num++) {
+    uint32_t tuple_size = GetTupleSize(slot_num);
+    if (!IsDeleted(tuple_size)) {
+      uint32_t __attribute__((unused)) read_bytes =
+          batch.AppendSerialized(GetData() + GetTupleOffsetAtSlot(slot_num), RowId(GetTablePageId(), slot_num));
+      ASSERT(tuple_size == read_bytes, "Unexpected behavior in tuple deserialize.");
+    }
+  }
+  return slot_num;
+}
+
 bool TablePage::GetFirstTupleRid(RowId *first_rid) {
   // Find and return the first valid tuple.
   for (uint32_t i = 0; i < GetTupleCount(); i++) {
@@ -374,8 +374,8 @@ static void yy_fatal_error (yyconst char msg[]  );
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
 
-#define YY_NUM_RULES 56
-#define YY_END_OF_BUFFER 57
+#define YY_NUM_RULES 57
+#define YY_END_OF_BUFFER 58
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -383,182 +383,1923 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[175] =
+static yyconst flex_int16_t yy_accept[186] =
     {   0,
-       41,   41,   57,   55,   54,   54,   55,   49,   52,   53,
-       47,   46,   41,   55,   41,   48,   50,   42,   51,   39,
-       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
-       39,   39,   39,   39,   39,   39,   39,   39,    0,    1,
-        0,    0,   41,   40,   44,   43,   45,   39,   39,   39,
-       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
-       37,   39,   39,   39,   22,   35,   39,   39,   39,   39,
-       39,   39,   39,   39,   39,   39,   39,   34,   39,   39,
-       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
-       32,   29,   36,   39,   39,   39,   39,   39,   26,   39,
-
-       39,   39,   39,   14,   39,   39,   39,   39,   31,   39,
-       39,   39,   39,    3,   39,   39,   23,   39,   39,   25,
-       38,   39,   11,   39,   39,   13,   39,   39,   39,   39,
-       39,   39,    8,   39,   39,   39,   39,   39,   33,   20,
-       39,   39,   39,   39,   18,   39,   39,   15,   39,   24,
-        9,    2,   39,    6,   39,   39,    5,   39,   39,    4,
-       19,   30,    7,   27,   39,   39,   21,   28,   39,   16,
-       12,   10,   17,    0
+      42,   42,   58,   56,   55,   55,   56,   50,   53,   54,
+      48,   47,   42,   56,   42,   49,   51,   43,   52,   40,
+      40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+      40,   40,   40,   40,   40,   40,   40,   40,    0,    1,
+       0,    0,   42,   41,   45,   44,   46,    0,   40,   40,
+      40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+      40,   40,   38,   40,   40,   40,   23,   36,   40,   40,
+      40,   40,   40,   40,   40,   40,   40,   40,   40,    0,
+      40,   40,   35,   40,   40,   40,   40,   40,   40,   40,
+      40,   40,   40,   40,   40,   33,   30,   37,   40,   40,
+
+      40,   40,   40,   27,   40,   40,   40,   40,   15,   40,
+      40,   40,   40,   40,   40,   40,   32,   40,   40,   40,
+      40,    3,   40,   40,   24,   40,   40,   26,   39,   40,
+      11,   40,   40,   14,   40,   40,   40,   40,   40,   40,
+      40,    8,   40,   40,   40,   40,   40,   34,   21,   40,
+      40,   40,   40,   19,   40,   40,   16,   40,   25,   40,
+       9,    2,   40,    6,   40,   40,    5,   40,   40,    4,
+      20,   31,    7,   28,   13,   40,   40,   22,   29,   40,
+      17,   12,   10,   18,    0
     } ;
 
 static yyconst flex_int32_t yy_ec[256] =
     {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    2,    3,
-        2,    2,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    2,    1,    4,    1,    1,    1,    1,    5,    6,
-        7,    8,    1,    9,   10,   11,    1,   12,   12,   12,
-       12,   12,   12,   12,   12,   12,   12,    1,   13,   14,
-       15,   16,    1,    1,   17,   17,   17,   17,   17,   17,
-       17,   17,   17,   17,   17,   17,   17,   17,   17,   17,
-       17,   17,   17,   17,   17,   17,   17,   17,   17,   17,
-        1,   18,    1,    1,   17,    1,   19,   20,   21,   22,
-
-       23,   24,   25,   26,   27,   17,   28,   29,   30,   31,
-       32,   33,   34,   35,   36,   37,   38,   39,   40,   41,
-       42,   17,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1
+       1,    1,    1,    1,    1,    1,    1,    1,    2,    3,
+       2,    2,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    2,    1,    4,    1,    1,    1,    1,    5,    6,
+       7,    8,    1,    9,   10,   11,    1,   12,   12,   12,
+      12,   12,   12,   12,   12,   12,   12,    1,   13,   14,
+      15,   16,    1,    1,   17,   17,   17,   17,   17,   17,
+      17,   17,   17,   17,   17,   17,   17,   17,   17,   17,
+      17,   17,   17,   17,   17,   17,   17,   17,   17,   17,
+       1,   18,    1,    1,   17,    1,   19,   20,   21,   22,
+
+      23,   24,   25,   26,   27,   17,   28,   29,   30,   31,
+      32,   33,   34,   35,   36,   37,   38,   39,   40,   41,
+      42,   43,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_int32_t yy_meta[43] =
+static yyconst flex_int32_t yy_meta[44] =
     {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    2,    1,    1,    1,    1,    2,    1,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1
     } ;
 
-static yyconst flex_int16_t yy_base[177] =
+static yyconst flex_int16_t yy_base[186] =
     {   0,
-        0,    0,  188,  189,  189,  189,   39,  189,  189,  189,
-      189,  189,   33,  175,   35,  189,   33,  189,  171,    0,
-      154,  161,   24,   32,  142,   23,   29,  159,   30,   35,
-      146,  142,  147,   38,  159,   38,  158,  150,   59,  189,
-      172,  162,   42,  161,  189,  189,  189,    0,  150,  146,
-      151,  139,  145,  130,  137,  133,  141,  131,  130,   50,
-        0,  119,  123,  130,    0,    0,  131,  130,  127,   44,
-      123,  134,  126,  130,   52,  122,  127,    0,  122,  113,
-      117,  127,  126,  121,  110,  121,  122,  110,  116,  115,
-      105,    0,    0,  107,  105,   97,  104,  109,    0,   91,
-
-      101,   95,  109,    0,   96,   88,   90,   93,    0,   96,
-       85,  101,   83,    0,   95,   81,    0,   76,   81,    0,
-        0,   96,    0,   94,   92,    0,   89,   73,   73,   84,
-       85,   84,    0,   69,   82,   85,   80,   75,    0,   78,
-       63,   64,   79,   60,   60,   72,   71,    0,   57,    0,
-        0,    0,   56,    0,   62,   54,    0,   43,   63,    0,
-        0,    0,    0,    0,   60,   59,    0,    0,   52,   42,
-        0,    0,    0,  189,   87,   74
+       1,   45,   89,  133,  177,  221,  265,  309,  353,  397,
+     441,  485,  529,  573,  617,  661,  705,  749,  793,  837,
+     881,  925,  969, 1013, 1057, 1101, 1145, 1189, 1233, 1277,
+    1321, 1365, 1409, 1453, 1497, 1541, 1585, 1629, 1673, 1717,
+    1761, 1805, 1849, 1893, 1937, 1981, 2025, 2069, 2113, 2157,
+    2201, 2245, 2289, 2333, 2377, 2421, 2465, 2509, 2553, 2597,
+    2641, 2685, 2729, 2773, 2817, 2861, 2905, 2949, 2993, 3037,
+    3081, 3125, 3169, 3213, 3257, 3301, 3345, 3389, 3433, 3477,
+    3521, 3565, 3609, 3653, 3697, 3741, 3785, 3829, 3873, 3917,
+    3961, 4005, 4049, 4093, 4137, 4181, 4225, 4269, 4313, 4357,
+
+    4401, 4445, 4489, 4533, 4577, 4621, 4665, 4709, 4753, 4797,
+    4841, 4885, 4929, 4973, 5017, 5061, 5105, 5149, 5193, 5237,
+    5281, 5325, 5369, 5413, 5457, 5501, 5545, 5589, 5633, 5677,
+    5721, 5765, 5809, 5853, 5897, 5941, 5985, 6029, 6073, 6117,
+    6161, 6205, 6249, 6293, 6337, 6381, 6425, 6469, 6513, 6557,
+    6601, 6645, 6689, 6733, 6777, 6821, 6865, 6909, 6953, 6997,
+    7041, 7085, 7129, 7173, 7217, 7261, 7305, 7349, 7393, 7437,
+    7481, 7525, 7569, 7613, 7657, 7701, 7745, 7789, 7833, 7877,
+    7921, 7965, 8009, 8053, 8097
     } ;
 
-static yyconst flex_int16_t yy_def[177] =
+static yyconst flex_int16_t yy_def[186] =
     {   0,
-      174,    1,  174,  174,  174,  174,  175,  174,  174,  174,
-      174,  174,  174,  174,  174,  174,  174,  174,  174,  176,
-      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
-      176,  176,  176,  176,  176,  176,  176,  176,  175,  174,
-      175,  174,  174,  174,  174,  174,  174,  176,  176,  176,
-      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
-      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
-      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
-      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
-      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
-
-      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
-      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
-      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
-      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
-      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
-      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
-      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
-      176,  176,  176,    0,  174,  174
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185
     } ;
 
-static yyconst flex_int16_t yy_nxt[232] =
+static yyconst flex_int16_t yy_nxt[8141] =
     {   0,
-        4,    5,    6,    7,    8,    9,   10,   11,   12,   13,
-       14,   15,   16,   17,   18,   19,   20,    4,   21,   22,
-       23,   24,   25,   26,   20,   20,   27,   28,   20,   20,
-       29,   30,   31,   32,   33,   34,   35,   36,   37,   38,
-       20,   20,   40,   42,   43,   42,   43,   45,   46,   51,
-       54,   58,   42,   43,   55,   52,   41,   59,   53,   60,
-       70,   63,   40,   71,   61,   65,   56,   64,   73,   66,
-       74,   89,   98,   75,  104,   48,   41,  173,  105,  172,
-       99,  171,  170,  169,  168,   90,   91,   39,   39,  167,
-      166,  165,  164,  163,  162,  161,  160,  159,  158,  157,
-
-      156,  155,  154,  153,  152,  151,  150,  149,  148,  147,
-      146,  145,  144,  143,  142,  141,  140,  139,  138,  137,
-      136,  135,  134,  133,  132,  131,  130,  129,  128,  127,
-      126,  125,  124,  123,  122,  121,  120,  119,  118,  117,
-      116,  115,  114,  113,  112,  111,  110,  109,  108,  107,
-      106,  103,  102,  101,  100,   97,   96,   95,   94,   93,
-       92,   88,   87,   86,   85,   84,   83,   82,   81,   80,
-       79,   78,   44,   44,  174,   77,   76,   72,   69,   68,
-       67,   62,   57,   50,   49,   47,   44,  174,    3,  174,
-      174,  174,  174,  174,  174,  174,  174,  174,  174,  174,
-
-      174,  174,  174,  174,  174,  174,  174,  174,  174,  174,
-      174,  174,  174,  174,  174,  174,  174,  174,  174,  174,
-      174,  174,  174,  174,  174,  174,  174,  174,  174,  174,
-      174
+       3,    4,    5,    6,    7,    8,    9,   10,   11,   12,
+      13,   14,   15,   16,   17,   18,   19,   20,    4,   21,
+      22,   23,   24,   25,   26,   20,   20,   27,   28,   20,
+      20,   29,   30,   31,   32,   33,   34,   35,   36,   37,
+      38,   20,   20,   20,    3,    4,    5,    6,    7,    8,
+       9,   10,   11,   12,   13,   14,   15,   16,   17,   18,
+      19,   20,    4,   21,   22,   23,   24,   25,   26,   20,
+      20,   27,   28,   20,   20,   29,   30,   31,   32,   33,
+      34,   35,   36,   37,   38,   20,   20,   20,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,    3,   39,   39,   39,   40,   39,
+      39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+      39,   39,   41,   39,   39,   39,   39,   39,   39,   39,
+      39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+
+      39,   39,   39,   39,   39,   39,   39,   39,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,    3,  185,  185,  185,
+
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   42,
+      43,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,   44,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   42,   43,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+
+     185,  185,  185,  185,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   45,
+      46,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,    3,  185,  185,  185,  185,  185,  185,  185,
+
+     185,  185,  185,  185,  185,  185,  185,   47,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   51,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,   50,   50,   50,   52,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,   50,   53,   50,   50,   50,   50,   50,
+
+      54,   50,   50,   55,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   56,   50,   50,   50,   57,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   58,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   59,   50,   50,
+
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   60,
+      50,   50,   50,   50,   50,   61,   50,   50,   50,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   62,   50,   50,   50,   50,
+      63,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   64,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   65,   50,   50,   50,   50,   50,
+      66,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,   50,
+
+      50,   50,   50,   50,   50,   50,   50,   67,   50,   50,
+      50,   68,   50,   50,   50,   50,   50,   50,   50,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   69,   50,   50,   50,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+      50,   50,   70,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      71,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,   72,   50,   50,   73,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   74,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   75,   50,   76,   50,   50,   77,   50,   50,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+
+     185,   50,  185,   78,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,   50,   79,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,   39,   39,   39,   40,   39,   39,   39,
+      39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+      41,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+
+      39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+      39,   39,   39,   39,   39,   39,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+       3,   80,   80,  185,   80,   80,   80,   80,   80,   80,
+      80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+      80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+      80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+
+      80,   80,   80,   80,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,   44,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   42,
+      43,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,    3,  185,  185,  185,  185,  185,  185,  185,
+
+     185,  185,  185,  185,   44,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   81,  185,   81,   81,   81,
+      81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+
+      81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+      81,   81,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   82,
+      50,   50,   83,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,   50,   50,   50,   50,   50,   84,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+
+      49,  185,  185,  185,  185,   50,  185,   85,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   86,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,   87,
+
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   88,   50,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   89,   50,   50,   50,   50,   50,   50,
+
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      90,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,   91,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   92,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   93,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+
+     185,   50,  185,   50,   50,   50,   94,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      95,   96,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   97,   50,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   98,   50,   50,   50,   50,   50,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   99,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,   50,   50,   50,   50,  100,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,   50,
+      50,   50,   50,  101,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+
+      50,   50,   50,   50,   50,   50,   50,   50,   50,  102,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,  103,   50,   50,   50,   50,   50,   50,
+      50,  104,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+     105,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,  106,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,   50,
+      50,   50,   50,  107,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,   50,  108,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,   50,   50,   50,  109,   50,   50,
+      50,  110,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,  111,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,  112,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,   39,   39,   39,
+      40,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+      39,   39,   39,   39,   41,   39,   39,   39,   39,   39,
+
+      39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+      39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  113,  185,  185,  185,  185,  114,  185,  114,
+     114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+     114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+     114,  114,  114,  114,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,  115,   50,   50,   50,   50,   50,   50,
+
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,   50,   50,   50,   50,  116,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,  117,   50,   50,   50,   50,   50,   50,   50,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+     118,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+
+     185,   50,  185,  119,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,  120,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,  121,   50,   50,   50,   50,
+
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,  122,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,  123,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,  124,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,  125,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,  126,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,  127,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,  128,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,  129,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,  130,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,  131,   50,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,  132,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,  133,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,   50,
+
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,  134,   50,   50,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,  135,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,  136,   50,
+
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,  137,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,  138,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,  139,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+
+     185,   50,  185,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,  140,
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     113,  185,  185,  185,  185,  114,  185,  114,  114,  114,
+     114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+     114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+     114,  114,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  113,  185,  185,  185,  185,  114,
+     185,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+
+     114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+     114,  114,  114,  114,  114,  114,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,  141,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,  142,   50,   50,   50,   50,   50,   50,   50,   50,
+
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,   50,   50,  143,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,  144,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,  145,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,  146,   50,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,  147,   50,   50,   50,   50,   50,   50,   50,
+
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,  148,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,  149,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,  150,
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,  151,   50,   50,   50,   50,
+
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,  152,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,   50,   50,  153,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,  154,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,  155,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+
+     185,   50,  185,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,  156,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,  157,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,  158,   50,   50,   50,   50,
+
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,  159,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+      50,   50,   50,  160,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,  161,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,  162,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,  163,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+
+      50,   50,   50,  164,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,   50,   50,   50,   50,   50,   50,
+      50,  165,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,  166,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,  167,   50,   50,   50,   50,   50,   50,
+
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,  168,   50,   50,   50,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,  169,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,  170,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,  171,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,  172,
+
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,   50,   50,  173,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,  174,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,  175,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+
+     185,   50,  185,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,  176,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,  177,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,  178,   50,   50,   50,
+
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+     179,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,  180,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,   50,   50,  181,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,   50,   50,   50,  182,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,    3,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,   48,   49,  185,
+     185,  185,  185,   50,  185,   50,   50,   50,   50,   50,
+
+      50,   50,   50,   50,  183,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       3,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,   48,   49,  185,  185,  185,  185,   50,  185,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,  184,   50,   50,   50,
+      50,   50,   50,   50,    3,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,   48,   49,  185,  185,  185,
+     185,   50,  185,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+      50,   50,   50,   50,   50,   50,   50,   50,    3,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,   48,
+      49,  185,  185,  185,  185,   50,  185,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,    3,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,   48,   49,  185,  185,  185,  185,   50,
+     185,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,  185,  185,  185,  185,
+
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185
     } ;
 
-static yyconst flex_int16_t yy_chk[232] =
+static yyconst flex_int16_t yy_chk[8141] =
     {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    7,   13,   13,   15,   15,   17,   17,   23,
-       24,   26,   43,   43,   24,   23,    7,   26,   23,   27,
-       34,   29,   39,   34,   27,   30,   24,   29,   36,   30,
-       36,   60,   70,   36,   75,  176,   39,  170,   75,  169,
-       70,  166,  165,  159,  158,   60,   60,  175,  175,  156,
-      155,  153,  149,  147,  146,  145,  144,  143,  142,  141,
-
-      140,  138,  137,  136,  135,  134,  132,  131,  130,  129,
-      128,  127,  125,  124,  122,  119,  118,  116,  115,  113,
-      112,  111,  110,  108,  107,  106,  105,  103,  102,  101,
-      100,   98,   97,   96,   95,   94,   91,   90,   89,   88,
-       87,   86,   85,   84,   83,   82,   81,   80,   79,   77,
-       76,   74,   73,   72,   71,   69,   68,   67,   64,   63,
-       62,   59,   58,   57,   56,   55,   54,   53,   52,   51,
-       50,   49,   44,   42,   41,   38,   37,   35,   33,   32,
-       31,   28,   25,   22,   21,   19,   14,    3,  174,  174,
-      174,  174,  174,  174,  174,  174,  174,  174,  174,  174,
-
-      174,  174,  174,  174,  174,  174,  174,  174,  174,  174,
-      174,  174,  174,  174,  174,  174,  174,  174,  174,  174,
-      174,  174,  174,  174,  174,  174,  174,  174,  174,  174,
-      174
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    2,    2,    2,    2,    2,    2,
+       2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+       2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+       2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+       2,    2,    2,    2,    2,    2,    2,    2,    3,    3,
+       3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+       3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+       3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+       3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+       3,    3,    4,    4,    4,    4,    4,    4,    4,    4,
+       4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+       4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+       4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+       4,    4,    4,    4,    4,    4,    5,    5,    5,    5,
+       5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+       5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+
+       5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+       5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+       6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
+       6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
+       6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
+       6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
+       6,    6,    6,    6,    7,    7,    7,    7,    7,    7,
+       7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+       7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+       7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+
+       7,    7,    7,    7,    7,    7,    7,    7,    8,    8,
+       8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+       8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+       8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+       8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+       8,    8,    9,    9,    9,    9,    9,    9,    9,    9,
+       9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+       9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+       9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+       9,    9,    9,    9,    9,    9,   10,   10,   10,   10,
+
+      10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+      10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+      10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+      10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+      11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+      11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+      11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+      11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+      11,   11,   11,   11,   12,   12,   12,   12,   12,   12,
+      12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+
+      12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+      12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+      12,   12,   12,   12,   12,   12,   12,   12,   13,   13,
+      13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+      13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+      13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+      13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+      13,   13,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   15,   15,   15,   15,
+      15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+      15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+      15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+      15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+      16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+      16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+      16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+      16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+
+      16,   16,   16,   16,   17,   17,   17,   17,   17,   17,
+      17,   17,   17,   17,   17,   17,   17,   17,   17,   17,
+      17,   17,   17,   17,   17,   17,   17,   17,   17,   17,
+      17,   17,   17,   17,   17,   17,   17,   17,   17,   17,
+      17,   17,   17,   17,   17,   17,   17,   17,   18,   18,
+      18,   18,   18,   18,   18,   18,   18,   18,   18,   18,
+      18,   18,   18,   18,   18,   18,   18,   18,   18,   18,
+      18,   18,   18,   18,   18,   18,   18,   18,   18,   18,
+      18,   18,   18,   18,   18,   18,   18,   18,   18,   18,
+      18,   18,   19,   19,   19,   19,   19,   19,   19,   19,
+
+      19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+      19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+      19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+      19,   19,   19,   19,   19,   19,   20,   20,   20,   20,
+      20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+      20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+      20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+      20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+      21,   21,   21,   21,   21,   21,   21,   21,   21,   21,
+      21,   21,   21,   21,   21,   21,   21,   21,   21,   21,
+
+      21,   21,   21,   21,   21,   21,   21,   21,   21,   21,
+      21,   21,   21,   21,   21,   21,   21,   21,   21,   21,
+      21,   21,   21,   21,   22,   22,   22,   22,   22,   22,
+      22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+      22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+      22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+      22,   22,   22,   22,   22,   22,   22,   22,   23,   23,
+      23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+      23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+      23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+
+      23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+      23,   23,   24,   24,   24,   24,   24,   24,   24,   24,
+      24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
+      24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
+      24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
+      24,   24,   24,   24,   24,   24,   25,   25,   25,   25,
+      25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+      25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+      25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+      25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+
+      26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
+      26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
+      26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
+      26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
+      26,   26,   26,   26,   27,   27,   27,   27,   27,   27,
+      27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+      27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+      27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+      27,   27,   27,   27,   27,   27,   27,   27,   28,   28,
+      28,   28,   28,   28,   28,   28,   28,   28,   28,   28,
+
+      28,   28,   28,   28,   28,   28,   28,   28,   28,   28,
+      28,   28,   28,   28,   28,   28,   28,   28,   28,   28,
+      28,   28,   28,   28,   28,   28,   28,   28,   28,   28,
+      28,   28,   29,   29,   29,   29,   29,   29,   29,   29,
+      29,   29,   29,   29,   29,   29,   29,   29,   29,   29,
+      29,   29,   29,   29,   29,   29,   29,   29,   29,   29,
+      29,   29,   29,   29,   29,   29,   29,   29,   29,   29,
+      29,   29,   29,   29,   29,   29,   30,   30,   30,   30,
+      30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+      30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+
+      30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+      30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+      31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+      31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+      31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+      31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+      31,   31,   31,   31,   32,   32,   32,   32,   32,   32,
+      32,   32,   32,   32,   32,   32,   32,   32,   32,   32,
+      32,   32,   32,   32,   32,   32,   32,   32,   32,   32,
+      32,   32,   32,   32,   32,   32,   32,   32,   32,   32,
+
+      32,   32,   32,   32,   32,   32,   32,   32,   33,   33,
+      33,   33,   33,   33,   33,   33,   33,   33,   33,   33,
+      33,   33,   33,   33,   33,   33,   33,   33,   33,   33,
+      33,   33,   33,   33,   33,   33,   33,   33,   33,   33,
+      33,   33,   33,   33,   33,   33,   33,   33,   33,   33,
+      33,   33,   34,   34,   34,   34,   34,   34,   34,   34,
+      34,   34,   34,   34,   34,   34,   34,   34,   34,   34,
+      34,   34,   34,   34,   34,   34,   34,   34,   34,   34,
+      34,   34,   34,   34,   34,   34,   34,   34,   34,   34,
+      34,   34,   34,   34,   34,   34,   35,   35,   35,   35,
+
+      35,   35,   35,   35,   35,   35,   35,   35,   35,   35,
+      35,   35,   35,   35,   35,   35,   35,   35,   35,   35,
+      35,   35,   35,   35,   35,   35,   35,   35,   35,   35,
+      35,   35,   35,   35,   35,   35,   35,   35,   35,   35,
+      36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+      36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+      36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+      36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+      36,   36,   36,   36,   37,   37,   37,   37,   37,   37,
+      37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+
+      37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+      37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+      37,   37,   37,   37,   37,   37,   37,   37,   38,   38,
+      38,   38,   38,   38,   38,   38,   38,   38,   38,   38,
+      38,   38,   38,   38,   38,   38,   38,   38,   38,   38,
+      38,   38,   38,   38,   38,   38,   38,   38,   38,   38,
+      38,   38,   38,   38,   38,   38,   38,   38,   38,   38,
+      38,   38,   39,   39,   39,   39,   39,   39,   39,   39,
+      39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+      39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+
+      39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+      39,   39,   39,   39,   39,   39,   40,   40,   40,   40,
+      40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+      40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+      40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+      40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+      41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+      41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+      41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+      41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+
+      41,   41,   41,   41,   42,   42,   42,   42,   42,   42,
+      42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+      42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+      42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+      42,   42,   42,   42,   42,   42,   42,   42,   43,   43,
+      43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+      43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+      43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+      43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+      43,   43,   44,   44,   44,   44,   44,   44,   44,   44,
+
+      44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+      44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+      44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+      44,   44,   44,   44,   44,   44,   45,   45,   45,   45,
+      45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+      45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+      45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+      45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+      46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+      46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+
+      46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+      46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+      46,   46,   46,   46,   47,   47,   47,   47,   47,   47,
+      47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+      47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+      47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+      47,   47,   47,   47,   47,   47,   47,   47,   48,   48,
+      48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+      48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+      48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+
+      48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+      48,   48,   49,   49,   49,   49,   49,   49,   49,   49,
+      49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+      49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+      49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+      49,   49,   49,   49,   49,   49,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+      50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+      51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+      51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+      51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+      51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+      51,   51,   51,   51,   52,   52,   52,   52,   52,   52,
+      52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+      52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+      52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+      52,   52,   52,   52,   52,   52,   52,   52,   53,   53,
+      53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+
+      53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+      53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+      53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+      53,   53,   54,   54,   54,   54,   54,   54,   54,   54,
+      54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+      54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+      54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+      54,   54,   54,   54,   54,   54,   55,   55,   55,   55,
+      55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+      55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+
+      55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+      55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+      56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+      56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+      56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+      56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+      56,   56,   56,   56,   57,   57,   57,   57,   57,   57,
+      57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+      57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+      57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+
+      57,   57,   57,   57,   57,   57,   57,   57,   58,   58,
+      58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+      58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+      58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+      58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+      58,   58,   59,   59,   59,   59,   59,   59,   59,   59,
+      59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+      59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+      59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+      59,   59,   59,   59,   59,   59,   60,   60,   60,   60,
+
+      60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+      60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+      60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+      60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+      61,   61,   61,   61,   61,   61,   61,   61,   61,   61,
+      61,   61,   61,   61,   61,   61,   61,   61,   61,   61,
+      61,   61,   61,   61,   61,   61,   61,   61,   61,   61,
+      61,   61,   61,   61,   61,   61,   61,   61,   61,   61,
+      61,   61,   61,   61,   62,   62,   62,   62,   62,   62,
+      62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+
+      62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+      62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+      62,   62,   62,   62,   62,   62,   62,   62,   63,   63,
+      63,   63,   63,   63,   63,   63,   63,   63,   63,   63,
+      63,   63,   63,   63,   63,   63,   63,   63,   63,   63,
+      63,   63,   63,   63,   63,   63,   63,   63,   63,   63,
+      63,   63,   63,   63,   63,   63,   63,   63,   63,   63,
+      63,   63,   64,   64,   64,   64,   64,   64,   64,   64,
+      64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+      64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+
+      64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+      64,   64,   64,   64,   64,   64,   65,   65,   65,   65,
+      65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+      65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+      65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+      65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+      66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
+      66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
+      66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
+      66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
+
+      66,   66,   66,   66,   67,   67,   67,   67,   67,   67,
+      67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+      67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+      67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+      67,   67,   67,   67,   67,   67,   67,   67,   68,   68,
+      68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+      68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+      68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+      68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+      68,   68,   69,   69,   69,   69,   69,   69,   69,   69,
+
+      69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+      69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+      69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+      69,   69,   69,   69,   69,   69,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+      71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+
+      71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+      71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+      71,   71,   71,   71,   72,   72,   72,   72,   72,   72,
+      72,   72,   72,   72,   72,   72,   72,   72,   72,   72,
+      72,   72,   72,   72,   72,   72,   72,   72,   72,   72,
+      72,   72,   72,   72,   72,   72,   72,   72,   72,   72,
+      72,   72,   72,   72,   72,   72,   72,   72,   73,   73,
+      73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+      73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+      73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+
+      73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+      73,   73,   74,   74,   74,   74,   74,   74,   74,   74,
+      74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+      74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+      74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+      74,   74,   74,   74,   74,   74,   75,   75,   75,   75,
+      75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+      75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+      75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+      75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+
+      76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+      76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+      76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+      76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+      76,   76,   76,   76,   77,   77,   77,   77,   77,   77,
+      77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+      77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+      77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+      77,   77,   77,   77,   77,   77,   77,   77,   78,   78,
+      78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+
+      78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+      78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+      78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+      78,   78,   79,   79,   79,   79,   79,   79,   79,   79,
+      79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+      79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+      79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+      79,   79,   79,   79,   79,   79,   80,   80,   80,   80,
+      80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+      80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+
+      80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+      80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+      81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+      81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+      81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+      81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+      81,   81,   81,   81,   82,   82,   82,   82,   82,   82,
+      82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+      82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+      82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+
+      82,   82,   82,   82,   82,   82,   82,   82,   83,   83,
+      83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+      83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+      83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+      83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+      83,   83,   84,   84,   84,   84,   84,   84,   84,   84,
+      84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+      84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+      84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+      84,   84,   84,   84,   84,   84,   85,   85,   85,   85,
+
+      85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+      85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+      85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+      85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+      86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+      86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+      86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+      86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+      86,   86,   86,   86,   87,   87,   87,   87,   87,   87,
+      87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+
+      87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+      87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+      87,   87,   87,   87,   87,   87,   87,   87,   88,   88,
+      88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+      88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+      88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+      88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+      88,   88,   89,   89,   89,   89,   89,   89,   89,   89,
+      89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+      89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+
+      89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+      89,   89,   89,   89,   89,   89,   90,   90,   90,   90,
+      90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+      90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+      90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+      90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+      91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+      91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+      91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+      91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+
+      91,   91,   91,   91,   92,   92,   92,   92,   92,   92,
+      92,   92,   92,   92,   92,   92,   92,   92,   92,   92,
+      92,   92,   92,   92,   92,   92,   92,   92,   92,   92,
+      92,   92,   92,   92,   92,   92,   92,   92,   92,   92,
+      92,   92,   92,   92,   92,   92,   92,   92,   93,   93,
+      93,   93,   93,   93,   93,   93,   93,   93,   93,   93,
+      93,   93,   93,   93,   93,   93,   93,   93,   93,   93,
+      93,   93,   93,   93,   93,   93,   93,   93,   93,   93,
+      93,   93,   93,   93,   93,   93,   93,   93,   93,   93,
+      93,   93,   94,   94,   94,   94,   94,   94,   94,   94,
+
+      94,   94,   94,   94,   94,   94,   94,   94,   94,   94,
+      94,   94,   94,   94,   94,   94,   94,   94,   94,   94,
+      94,   94,   94,   94,   94,   94,   94,   94,   94,   94,
+      94,   94,   94,   94,   94,   94,   95,   95,   95,   95,
+      95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+      95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+      95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+      95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+      96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+      96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+
+      96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+      96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+      96,   96,   96,   96,   97,   97,   97,   97,   97,   97,
+      97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+      97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+      97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+      97,   97,   97,   97,   97,   97,   97,   97,   98,   98,
+      98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+      98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+      98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+
+      98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+      98,   98,   99,   99,   99,   99,   99,   99,   99,   99,
+      99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+      99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+      99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+      99,   99,   99,   99,   99,   99,  100,  100,  100,  100,
+     100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+     100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+     100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+     100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+
+     101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+     101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+     101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+     101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+     101,  101,  101,  101,  102,  102,  102,  102,  102,  102,
+     102,  102,  102,  102,  102,  102,  102,  102,  102,  102,
+     102,  102,  102,  102,  102,  102,  102,  102,  102,  102,
+     102,  102,  102,  102,  102,  102,  102,  102,  102,  102,
+     102,  102,  102,  102,  102,  102,  102,  102,  103,  103,
+     103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+
+     103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+     103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+     103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+     103,  103,  104,  104,  104,  104,  104,  104,  104,  104,
+     104,  104,  104,  104,  104,  104,  104,  104,  104,  104,
+     104,  104,  104,  104,  104,  104,  104,  104,  104,  104,
+     104,  104,  104,  104,  104,  104,  104,  104,  104,  104,
+     104,  104,  104,  104,  104,  104,  105,  105,  105,  105,
+     105,  105,  105,  105,  105,  105,  105,  105,  105,  105,
+     105,  105,  105,  105,  105,  105,  105,  105,  105,  105,
+
+     105,  105,  105,  105,  105,  105,  105,  105,  105,  105,
+     105,  105,  105,  105,  105,  105,  105,  105,  105,  105,
+     106,  106,  106,  106,  106,  106,  106,  106,  106,  106,
+     106,  106,  106,  106,  106,  106,  106,  106,  106,  106,
+     106,  106,  106,  106,  106,  106,  106,  106,  106,  106,
+     106,  106,  106,  106,  106,  106,  106,  106,  106,  106,
+     106,  106,  106,  106,  107,  107,  107,  107,  107,  107,
+     107,  107,  107,  107,  107,  107,  107,  107,  107,  107,
+     107,  107,  107,  107,  107,  107,  107,  107,  107,  107,
+     107,  107,  107,  107,  107,  107,  107,  107,  107,  107,
+
+     107,  107,  107,  107,  107,  107,  107,  107,  108,  108,
+     108,  108,  108,  108,  108,  108,  108,  108,  108,  108,
+     108,  108,  108,  108,  108,  108,  108,  108,  108,  108,
+     108,  108,  108,  108,  108,  108,  108,  108,  108,  108,
+     108,  108,  108,  108,  108,  108,  108,  108,  108,  108,
+     108,  108,  109,  109,  109,  109,  109,  109,  109,  109,
+     109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+     109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+     109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+     109,  109,  109,  109,  109,  109,  110,  110,  110,  110,
+
+     110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+     110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+     110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+     110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+     111,  111,  111,  111,  111,  111,  111,  111,  111,  111,
+     111,  111,  111,  111,  111,  111,  111,  111,  111,  111,
+     111,  111,  111,  111,  111,  111,  111,  111,  111,  111,
+     111,  111,  111,  111,  111,  111,  111,  111,  111,  111,
+     111,  111,  111,  111,  112,  112,  112,  112,  112,  112,
+     112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+
+     112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+     112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+     112,  112,  112,  112,  112,  112,  112,  112,  113,  113,
+     113,  113,  113,  113,  113,  113,  113,  113,  113,  113,
+     113,  113,  113,  113,  113,  113,  113,  113,  113,  113,
+     113,  113,  113,  113,  113,  113,  113,  113,  113,  113,
+     113,  113,  113,  113,  113,  113,  113,  113,  113,  113,
+     113,  113,  114,  114,  114,  114,  114,  114,  114,  114,
+     114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+     114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+
+     114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+     114,  114,  114,  114,  114,  114,  115,  115,  115,  115,
+     115,  115,  115,  115,  115,  115,  115,  115,  115,  115,
+     115,  115,  115,  115,  115,  115,  115,  115,  115,  115,
+     115,  115,  115,  115,  115,  115,  115,  115,  115,  115,
+     115,  115,  115,  115,  115,  115,  115,  115,  115,  115,
+     116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+     116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+     116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+     116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+
+     116,  116,  116,  116,  117,  117,  117,  117,  117,  117,
+     117,  117,  117,  117,  117,  117,  117,  117,  117,  117,
+     117,  117,  117,  117,  117,  117,  117,  117,  117,  117,
+     117,  117,  117,  117,  117,  117,  117,  117,  117,  117,
+     117,  117,  117,  117,  117,  117,  117,  117,  118,  118,
+     118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+     118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+     118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+     118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+     118,  118,  119,  119,  119,  119,  119,  119,  119,  119,
+
+     119,  119,  119,  119,  119,  119,  119,  119,  119,  119,
+     119,  119,  119,  119,  119,  119,  119,  119,  119,  119,
+     119,  119,  119,  119,  119,  119,  119,  119,  119,  119,
+     119,  119,  119,  119,  119,  119,  120,  120,  120,  120,
+     120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
+     120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
+     120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
+     120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
+     121,  121,  121,  121,  121,  121,  121,  121,  121,  121,
+     121,  121,  121,  121,  121,  121,  121,  121,  121,  121,
+
+     121,  121,  121,  121,  121,  121,  121,  121,  121,  121,
+     121,  121,  121,  121,  121,  121,  121,  121,  121,  121,
+     121,  121,  121,  121,  122,  122,  122,  122,  122,  122,
+     122,  122,  122,  122,  122,  122,  122,  122,  122,  122,
+     122,  122,  122,  122,  122,  122,  122,  122,  122,  122,
+     122,  122,  122,  122,  122,  122,  122,  122,  122,  122,
+     122,  122,  122,  122,  122,  122,  122,  122,  123,  123,
+     123,  123,  123,  123,  123,  123,  123,  123,  123,  123,
+     123,  123,  123,  123,  123,  123,  123,  123,  123,  123,
+     123,  123,  123,  123,  123,  123,  123,  123,  123,  123,
+
+     123,  123,  123,  123,  123,  123,  123,  123,  123,  123,
+     123,  123,  124,  124,  124,  124,  124,  124,  124,  124,
+     124,  124,  124,  124,  124,  124,  124,  124,  124,  124,
+     124,  124,  124,  124,  124,  124,  124,  124,  124,  124,
+     124,  124,  124,  124,  124,  124,  124,  124,  124,  124,
+     124,  124,  124,  124,  124,  124,  125,  125,  125,  125,
+     125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+     125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+     125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+     125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+
+     126,  126,  126,  126,  126,  126,  126,  126,  126,  126,
+     126,  126,  126,  126,  126,  126,  126,  126,  126,  126,
+     126,  126,  126,  126,  126,  126,  126,  126,  126,  126,
+     126,  126,  126,  126,  126,  126,  126,  126,  126,  126,
+     126,  126,  126,  126,  127,  127,  127,  127,  127,  127,
+     127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+     127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+     127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+     127,  127,  127,  127,  127,  127,  127,  127,  128,  128,
+     128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+
+     128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+     128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+     128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+     128,  128,  129,  129,  129,  129,  129,  129,  129,  129,
+     129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+     129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+     129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+     129,  129,  129,  129,  129,  129,  130,  130,  130,  130,
+     130,  130,  130,  130,  130,  130,  130,  130,  130,  130,
+     130,  130,  130,  130,  130,  130,  130,  130,  130,  130,
+
+     130,  130,  130,  130,  130,  130,  130,  130,  130,  130,
+     130,  130,  130,  130,  130,  130,  130,  130,  130,  130,
+     131,  131,  131,  131,  131,  131,  131,  131,  131,  131,
+     131,  131,  131,  131,  131,  131,  131,  131,  131,  131,
+     131,  131,  131,  131,  131,  131,  131,  131,  131,  131,
+     131,  131,  131,  131,  131,  131,  131,  131,  131,  131,
+     131,  131,  131,  131,  132,  132,  132,  132,  132,  132,
+     132,  132,  132,  132,  132,  132,  132,  132,  132,  132,
+     132,  132,  132,  132,  132,  132,  132,  132,  132,  132,
+     132,  132,  132,  132,  132,  132,  132,  132,  132,  132,
+
+     132,  132,  132,  132,  132,  132,  132,  132,  133,  133,
+     133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
+     133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
+     133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
+     133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
+     133,  133,  134,  134,  134,  134,  134,  134,  134,  134,
+     134,  134,  134,  134,  134,  134,  134,  134,  134,  134,
+     134,  134,  134,  134,  134,  134,  134,  134,  134,  134,
+     134,  134,  134,  134,  134,  134,  134,  134,  134,  134,
+     134,  134,  134,  134,  134,  134,  135,  135,  135,  135,
+
+     135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
+     135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
+     135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
+     135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
+     136,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+     136,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+     136,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+     136,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+     136,  136,  136,  136,  137,  137,  137,  137,  137,  137,
+     137,  137,  137,  137,  137,  137,  137,  137,  137,  137,
+
+     137,  137,  137,  137,  137,  137,  137,  137,  137,  137,
+     137,  137,  137,  137,  137,  137,  137,  137,  137,  137,
+     137,  137,  137,  137,  137,  137,  137,  137,  138,  138,
+     138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+     138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+     138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+     138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+     138,  138,  139,  139,  139,  139,  139,  139,  139,  139,
+     139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+     139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+
+     139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+     139,  139,  139,  139,  139,  139,  140,  140,  140,  140,
+     140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
+     140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
+     140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
+     140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
+     141,  141,  141,  141,  141,  141,  141,  141,  141,  141,
+     141,  141,  141,  141,  141,  141,  141,  141,  141,  141,
+     141,  141,  141,  141,  141,  141,  141,  141,  141,  141,
+     141,  141,  141,  141,  141,  141,  141,  141,  141,  141,
+
+     141,  141,  141,  141,  142,  142,  142,  142,  142,  142,
+     142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+     142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+     142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+     142,  142,  142,  142,  142,  142,  142,  142,  143,  143,
+     143,  143,  143,  143,  143,  143,  143,  143,  143,  143,
+     143,  143,  143,  143,  143,  143,  143,  143,  143,  143,
+     143,  143,  143,  143,  143,  143,  143,  143,  143,  143,
+     143,  143,  143,  143,  143,  143,  143,  143,  143,  143,
+     143,  143,  144,  144,  144,  144,  144,  144,  144,  144,
+
+     144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+     144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+     144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+     144,  144,  144,  144,  144,  144,  145,  145,  145,  145,
+     145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+     145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+     145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+     145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+     146,  146,  146,  146,  146,  146,  146,  146,  146,  146,
+     146,  146,  146,  146,  146,  146,  146,  146,  146,  146,
+
+     146,  146,  146,  146,  146,  146,  146,  146,  146,  146,
+     146,  146,  146,  146,  146,  146,  146,  146,  146,  146,
+     146,  146,  146,  146,  147,  147,  147,  147,  147,  147,
+     147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+     147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+     147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+     147,  147,  147,  147,  147,  147,  147,  147,  148,  148,
+     148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+     148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+     148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+
+     148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+     148,  148,  149,  149,  149,  149,  149,  149,  149,  149,
+     149,  149,  149,  149,  149,  149,  149,  149,  149,  149,
+     149,  149,  149,  149,  149,  149,  149,  149,  149,  149,
+     149,  149,  149,  149,  149,  149,  149,  149,  149,  149,
+     149,  149,  149,  149,  149,  149,  150,  150,  150,  150,
+     150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+     150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+     150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+     150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+
+     151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+     151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+     151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+     151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+     151,  151,  151,  151,  152,  152,  152,  152,  152,  152,
+     152,  152,  152,  152,  152,  152,  152,  152,  152,  152,
+     152,  152,  152,  152,  152,  152,  152,  152,  152,  152,
+     152,  152,  152,  152,  152,  152,  152,  152,  152,  152,
+     152,  152,  152,  152,  152,  152,  152,  152,  153,  153,
+     153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
+
+     153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
+     153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
+     153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
+     153,  153,  154,  154,  154,  154,  154,  154,  154,  154,
+     154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+     154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+     154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+     154,  154,  154,  154,  154,  154,  155,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+
+     155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+     156,  156,  156,  156,  156,  156,  156,  156,  156,  156,
+     156,  156,  156,  156,  156,  156,  156,  156,  156,  156,
+     156,  156,  156,  156,  156,  156,  156,  156,  156,  156,
+     156,  156,  156,  156,  156,  156,  156,  156,  156,  156,
+     156,  156,  156,  156,  157,  157,  157,  157,  157,  157,
+     157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
+     157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
+     157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
+
+     157,  157,  157,  157,  157,  157,  157,  157,  158,  158,
+     158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+     158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+     158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+     158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+     158,  158,  159,  159,  159,  159,  159,  159,  159,  159,
+     159,  159,  159,  159,  159,  159,  159,  159,  159,  159,
+     159,  159,  159,  159,  159,  159,  159,  159,  159,  159,
+     159,  159,  159,  159,  159,  159,  159,  159,  159,  159,
+     159,  159,  159,  159,  159,  159,  160,  160,  160,  160,
+
+     160,  160,  160,  160,  160,  160,  160,  160,  160,  160,
+     160,  160,  160,  160,  160,  160,  160,  160,  160,  160,
+     160,  160,  160,  160,  160,  160,  160,  160,  160,  160,
+     160,  160,  160,  160,  160,  160,  160,  160,  160,  160,
+     161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+     161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+     161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+     161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+     161,  161,  161,  161,  162,  162,  162,  162,  162,  162,
+     162,  162,  162,  162,  162,  162,  162,  162,  162,  162,
+
+     162,  162,  162,  162,  162,  162,  162,  162,  162,  162,
+     162,  162,  162,  162,  162,  162,  162,  162,  162,  162,
+     162,  162,  162,  162,  162,  162,  162,  162,  163,  163,
+     163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+     163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+     163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+     163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+     163,  163,  164,  164,  164,  164,  164,  164,  164,  164,
+     164,  164,  164,  164,  164,  164,  164,  164,  164,  164,
+     164,  164,  164,  164,  164,  164,  164,  164,  164,  164,
+
+     164,  164,  164,  164,  164,  164,  164,  164,  164,  164,
+     164,  164,  164,  164,  164,  164,  165,  165,  165,  165,
+     165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
+     165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
+     165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
+     165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
+     166,  166,  166,  166,  166,  166,  166,  166,  166,  166,
+     166,  166,  166,  166,  166,  166,  166,  166,  166,  166,
+     166,  166,  166,  166,  166,  166,  166,  166,  166,  166,
+     166,  166,  166,  166,  166,  166,  166,  166,  166,  166,
+
+     166,  166,  166,  166,  167,  167,  167,  167,  167,  167,
+     167,  167,  167,  167,  167,  167,  167,  167,  167,  167,
+     167,  167,  167,  167,  167,  167,  167,  167,  167,  167,
+     167,  167,  167,  167,  167,  167,  167,  167,  167,  167,
+     167,  167,  167,  167,  167,  167,  167,  167,  168,  168,
+     168,  168,  168,  168,  168,  168,  168,  168,  168,  168,
+     168,  168,  168,  168,  168,  168,  168,  168,  168,  168,
+     168,  168,  168,  168,  168,  168,  168,  168,  168,  168,
+     168,  168,  168,  168,  168,  168,  168,  168,  168,  168,
+     168,  168,  169,  169,  169,  169,  169,  169,  169,  169,
+
+     169,  169,  169,  169,  169,  169,  169,  169,  169,  169,
+     169,  169,  169,  169,  169,  169,  169,  169,  169,  169,
+     169,  169,  169,  169,  169,  169,  169,  169,  169,  169,
+     169,  169,  169,  169,  169,  169,  170,  170,  170,  170,
+     170,  170,  170,  170,  170,  170,  170,  170,  170,  170,
+     170,  170,  170,  170,  170,  170,  170,  170,  170,  170,
+     170,  170,  170,  170,  170,  170,  170,  170,  170,  170,
+     170,  170,  170,  170,  170,  170,  170,  170,  170,  170,
+     171,  171,  171,  171,  171,  171,  171,  171,  171,  171,
+     171,  171,  171,  171,  171,  171,  171,  171,  171,  171,
+
+     171,  171,  171,  171,  171,  171,  171,  171,  171,  171,
+     171,  171,  171,  171,  171,  171,  171,  171,  171,  171,
+     171,  171,  171,  171,  172,  172,  172,  172,  172,  172,
+     172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
+     172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
+     172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
+     172,  172,  172,  172,  172,  172,  172,  172,  173,  173,
+     173,  173,  173,  173,  173,  173,  173,  173,  173,  173,
+     173,  173,  173,  173,  173,  173,  173,  173,  173,  173,
+     173,  173,  173,  173,  173,  173,  173,  173,  173,  173,
+
+     173,  173,  173,  173,  173,  173,  173,  173,  173,  173,
+     173,  173,  174,  174,  174,  174,  174,  174,  174,  174,
+     174,  174,  174,  174,  174,  174,  174,  174,  174,  174,
+     174,  174,  174,  174,  174,  174,  174,  174,  174,  174,
+     174,  174,  174,  174,  174,  174,  174,  174,  174,  174,
+     174,  174,  174,  174,  174,  174,  175,  175,  175,  175,
+     175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
+     175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
+     175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
+     175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
+
+     176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
+     176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
+     176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
+     176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
+     176,  176,  176,  176,  177,  177,  177,  177,  177,  177,
+     177,  177,  177,  177,  177,  177,  177,  177,  177,  177,
+     177,  177,  177,  177,  177,  177,  177,  177,  177,  177,
+     177,  177,  177,  177,  177,  177,  177,  177,  177,  177,
+     177,  177,  177,  177,  177,  177,  177,  177,  178,  178,
+     178,  178,  178,  178,  178,  178,  178,  178,  178,  178,
+
+     178,  178,  178,  178,  178,  178,  178,  178,  178,  178,
+     178,  178,  178,  178,  178,  178,  178,  178,  178,  178,
+     178,  178,  178,  178,  178,  178,  178,  178,  178,  178,
+     178,  178,  179,  179,  179,  179,  179,  179,  179,  179,
+     179,  179,  179,  179,  179,  179,  179,  179,  179,  179,
+     179,  179,  179,  179,  179,  179,  179,  179,  179,  179,
+     179,  179,  179,  179,  179,  179,  179,  179,  179,  179,
+     179,  179,  179,  179,  179,  179,  180,  180,  180,  180,
+     180,  180,  180,  180,  180,  180,  180,  180,  180,  180,
+     180,  180,  180,  180,  180,  180,  180,  180,  180,  180,
+
+     180,  180,  180,  180,  180,  180,  180,  180,  180,  180,
+     180,  180,  180,  180,  180,  180,  180,  180,  180,  180,
+     181,  181,  181,  181,  181,  181,  181,  181,  181,  181,
+     181,  181,  181,  181,  181,  181,  181,  181,  181,  181,
+     181,  181,  181,  181,  181,  181,  181,  181,  181,  181,
+     181,  181,  181,  181,  181,  181,  181,  181,  181,  181,
+     181,  181,  181,  181,  182,  182,  182,  182,  182,  182,
+     182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
+     182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
+     182,  182,  182,  182,  182,  182,  182,  182,  182,  182,
+
+     182,  182,  182,  182,  182,  182,  182,  182,  183,  183,
+     183,  183,  183,  183,  183,  183,  183,  183,  183,  183,
+     183,  183,  183,  183,  183,  183,  183,  183,  183,  183,
+     183,  183,  183,  183,  183,  183,  183,  183,  183,  183,
+     183,  183,  183,  183,  183,  183,  183,  183,  183,  183,
+     183,  183,  184,  184,  184,  184,  184,  184,  184,  184,
+     184,  184,  184,  184,  184,  184,  184,  184,  184,  184,
+     184,  184,  184,  184,  184,  184,  184,  184,  184,  184,
+     184,  184,  184,  184,  184,  184,  184,  184,  184,  184,
+     184,  184,  184,  184,  184,  184,  185,  185,  185,  185,
+
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+     185,  185,  185,  185,  185,  185,  185,  185,  185,  185
     } ;
 
 /* Table of booleans, true if rule could match eol. */
-static yyconst flex_int32_t yy_rule_can_match_eol[57] =
+static yyconst flex_int32_t yy_rule_can_match_eol[58] =
     {   0,
 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,     };
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,     };
 
 static yy_state_type yy_last_accepting_state;
 static char *yy_last_accepting_cpos;
@@ -578,11 +2319,10 @@ char *yytext;
 #line 2 "minisql.l"
     #include <stdio.h>
     #include "parser/parser.h"
-
     #include "parser/minisql_yacc.h"
     int yywrap();
     extern YYSTYPE yylval;
-#line 585 "../../parser/minisql_lex.c"
+#line 2325 "../../parser/minisql_lex.c"
 
 #define INITIAL 0
 
@@ -767,7 +2507,7 @@ YY_DECL
 #line 15 "minisql.l"
 
 
-#line 770 "../../parser/minisql_lex.c"
+#line 2510 "../../parser/minisql_lex.c"
 
 	if ( !(yy_init) )
 		{
@@ -820,13 +2560,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 175 )
+				if ( yy_current_state >= 186 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 189 );
+		while ( yy_base[yy_current_state] != 8097 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -963,7 +2703,7 @@ YY_RULE_SETUP
 #line 78 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return SHOW;
+  return ANALYZE;
 }
 	YY_BREAK
 case 14:
@@ -971,7 +2711,7 @@ YY_RULE_SETUP
 #line 83 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return USE;
+  return SHOW;
 }
 	YY_BREAK
 case 15:
@@ -979,7 +2719,7 @@ YY_RULE_SETUP
 #line 88 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return USING;
+  return USE;
 }
 	YY_BREAK
 case 16:
@@ -987,7 +2727,7 @@ YY_RULE_SETUP
 #line 93 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return DATABASE;
+  return USING;
 }
 	YY_BREAK
 case 17:
@@ -995,7 +2735,7 @@ YY_RULE_SETUP
 #line 98 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return DATABASES;
+  return DATABASE;
 }
 	YY_BREAK
 case 18:
@@ -1003,7 +2743,7 @@ YY_RULE_SETUP
 #line 103 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return TABLE;
+  return DATABASES;
 }
 	YY_BREAK
 case 19:
@@ -1011,7 +2751,7 @@ YY_RULE_SETUP
 #line 108 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return TABLES;
+  return TABLE;
 }
 	YY_BREAK
 case 20:
@@ -1019,7 +2759,7 @@ YY_RULE_SETUP
 #line 113 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return INDEX;
+  return TABLES;
 }
 	YY_BREAK
 case 21:
@@ -1027,7 +2767,7 @@ YY_RULE_SETUP
 #line 118 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return INDEXES;
+  return INDEX;
 }
 	YY_BREAK
 case 22:
@@ -1035,7 +2775,7 @@ YY_RULE_SETUP
 #line 123 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return ON;
+  return INDEXES;
 }
 	YY_BREAK
 case 23:
@@ -1043,7 +2783,7 @@ YY_RULE_SETUP
 #line 128 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return FROM;
+  return ON;
 }
 	YY_BREAK
 case 24:
@@ -1051,7 +2791,7 @@ YY_RULE_SETUP
 #line 133 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return WHERE;
+  return FROM;
 }
 	YY_BREAK
 case 25:
@@ -1059,7 +2799,7 @@ YY_RULE_SETUP
 #line 138 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return INTO;
+  return WHERE;
 }
 	YY_BREAK
 case 26:
@@ -1067,7 +2807,7 @@ YY_RULE_SETUP
 #line 143 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return SET;
+  return INTO;
 }
 	YY_BREAK
 case 27:
@@ -1075,7 +2815,7 @@ YY_RULE_SETUP
 #line 148 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return VALUES;
+  return SET;
 }
 	YY_BREAK
 case 28:
@@ -1083,7 +2823,7 @@ YY_RULE_SETUP
 #line 153 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return PRIMARY;
+  return VALUES;
 }
 	YY_BREAK
 case 29:
@@ -1091,7 +2831,7 @@ YY_RULE_SETUP
 #line 158 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return KEY;
+  return PRIMARY;
 }
 	YY_BREAK
 case 30:
@@ -1099,7 +2839,7 @@ YY_RULE_SETUP
 #line 163 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return UNIQUE;
+  return KEY;
 }
 	YY_BREAK
 case 31:
@@ -1107,7 +2847,7 @@ YY_RULE_SETUP
 #line 168 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return CHAR;
+  return UNIQUE;
 }
 	YY_BREAK
 case 32:
@@ -1115,7 +2855,7 @@ YY_RULE_SETUP
 #line 173 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return INT;
+  return CHAR;
 }
 	YY_BREAK
 case 33:
@@ -1123,7 +2863,7 @@ YY_RULE_SETUP
 #line 178 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return FLOAT;
+  return INT;
 }
 	YY_BREAK
 case 34:
@@ -1131,7 +2871,7 @@ YY_RULE_SETUP
 #line 183 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return AND;
+  return FLOAT;
 }
 	YY_BREAK
 case 35:
@@ -1139,7 +2879,7 @@ YY_RULE_SETUP
 #line 188 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return OR;
+  return AND;
 }
 	YY_BREAK
 case 36:
@@ -1147,7 +2887,7 @@ YY_RULE_SETUP
 #line 193 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return NOT;
+  return OR;
 }
 	YY_BREAK
 case 37:
@@ -1155,7 +2895,7 @@ YY_RULE_SETUP
 #line 198 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return IS;
+  return NOT;
 }
 	YY_BREAK
 case 38:
@@ -1163,7 +2903,7 @@ YY_RULE_SETUP
 #line 203 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return FLAGNULL;
+  return IS;
 }
 	YY_BREAK
 case 39:
@@ -1171,22 +2911,21 @@ YY_RULE_SETUP
 #line 208 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  yylval.syntax_node = CreateSyntaxNode(kNodeIdentifier, yytext);
-  return IDENTIFIER;
+  return FLAGNULL;
 }
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
-#line 214 "minisql.l"
+#line 213 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  yylval.syntax_node = CreateSyntaxNode(kNodeNumber, yytext);
-  return NUMBER;
+  yylval.syntax_node = CreateSyntaxNode(kNodeIdentifier, yytext);
+  return IDENTIFIER;
 }
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
-#line 220 "minisql.l"
+#line 219 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
   yylval.syntax_node = CreateSyntaxNode(kNodeNumber, yytext);
@@ -1195,10 +2934,11 @@ YY_RULE_SETUP
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
-#line 226 "minisql.l"
+#line 225 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return EQ;
+  yylval.syntax_node = CreateSyntaxNode(kNodeNumber, yytext);
+  return NUMBER;
 }
 	YY_BREAK
 case 43:
@@ -1206,7 +2946,7 @@ YY_RULE_SETUP
 #line 231 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return NE;
+  return EQ;
 }
 	YY_BREAK
 case 44:
@@ -1214,7 +2954,7 @@ YY_RULE_SETUP
 #line 236 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return LE;
+  return NE;
 }
 	YY_BREAK
 case 45:
@@ -1222,7 +2962,7 @@ YY_RULE_SETUP
 #line 241 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return GE;
+  return LE;
 }
 	YY_BREAK
 case 46:
@@ -1230,7 +2970,7 @@ YY_RULE_SETUP
 #line 246 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return (',');
+  return GE;
 }
 	YY_BREAK
 case 47:
@@ -1238,7 +2978,7 @@ YY_RULE_SETUP
 #line 251 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return ('*');
+  return (',');
 }
 	YY_BREAK
 case 48:
@@ -1246,7 +2986,7 @@ YY_RULE_SETUP
 #line 256 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return (';');
+  return ('*');
 }
 	YY_BREAK
 case 49:
@@ -1254,7 +2994,7 @@ YY_RULE_SETUP
 #line 261 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return ('\'');
+  return (';');
 }
 	YY_BREAK
 case 50:
@@ -1262,7 +3002,7 @@ YY_RULE_SETUP
 #line 266 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return ('<');
+  return ('\'');
 }
 	YY_BREAK
 case 51:
@@ -1270,7 +3010,7 @@ YY_RULE_SETUP
 #line 271 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return ('>');
+  return ('<');
 }
 	YY_BREAK
 case 52:
@@ -1278,7 +3018,7 @@ YY_RULE_SETUP
 #line 276 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return ('(');
+  return ('>');
 }
 	YY_BREAK
 case 53:
@@ -1286,32 +3026,40 @@ YY_RULE_SETUP
 #line 281 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
-  return (')');
+  return ('(');
 }
 	YY_BREAK
 case 54:
-/* rule 54 can match eol */
 YY_RULE_SETUP
 #line 286 "minisql.l"
 {
   MinisqlParserMovePos(yylineno, yytext);
+  return (')');
 }
 	YY_BREAK
 case 55:
+/* rule 55 can match eol */
 YY_RULE_SETUP
-#line 290 "minisql.l"
+#line 291 "minisql.l"
+{
+  MinisqlParserMovePos(yylineno, yytext);
+}
+	YY_BREAK
+case 56:
+YY_RULE_SETUP
+#line 295 "minisql.l"
 {
   char str[128] = {0};
   sprintf(str, "Unrecognized token [%s] in input sql.", yytext);
   MinisqlParserSetError(str);
 }
 	YY_BREAK
-case 56:
+case 57:
 YY_RULE_SETUP
-#line 296 "minisql.l"
+#line 301 "minisql.l"
 ECHO;
 	YY_BREAK
-#line 1314 "../../parser/minisql_lex.c"
+#line 3062 "../../parser/minisql_lex.c"
 case YY_STATE_EOF(INITIAL):
 	yyterminate();
 
@@ -1603,7 +3351,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 175 )
+			if ( yy_current_state >= 186 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -1631,11 +3379,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 175 )
+		if ( yy_current_state >= 186 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 174);
+	yy_is_jam = (yy_current_state == 185);
 
 	return yy_is_jam ? 0 : yy_current_state;
 }
@@ -2320,7 +4068,7 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 296 "minisql.l"
+#line 301 "minisql.l"
 
 
 int yywrap() {
@@ -171,6 +171,8 @@ const char *GetSyntaxNodeTypeStr(SyntaxNodeType type) {
       return "kNodeTrxCommit";
     case kNodeTrxRollback:
       return "kNodeTrxRollback";
+    case kNodeAnalyze:
+      return "kNodeAnalyze";
     default:
       return "error type";
   }
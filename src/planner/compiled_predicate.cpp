@@ -0,0 +1,280 @@
+#include "planner/expressions/compiled_predicate.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "planner/expressions/column_value_expression.h"
+#include "planner/expressions/constant_value_expression.h"
+#include "planner/expressions/filter_kernel.h"
+
+// sign of value - bound
+template <typename T>
+static inline int Sign(T value, T bound) {
+  return (value > bound) - (value < bound);
+}
+
+static inline int CompareChars(const char *value, uint32_t length, const char *bound, uint32_t bound_length) {
+  int cmp = memcmp(value, bound, std::min(length, bound_length));
+  return cmp != 0 ? cmp : static_cast<int>(length) - static_cast<int>(bound_length);
+}
+
+// whether a comparison with the given sign of value - bound satisfies op
+static inline bool Matches(ComparisonType op, int sign) {
+  switch (op) {
+    case ComparisonType::Equal:
+      return sign == 0;
+    case ComparisonType::NotEqual:
+      return sign != 0;
+    case ComparisonType::LessThan:
+      return sign < 0;
+    case ComparisonType::LessThanOrEqual:
+      return sign <= 0;
+    case ComparisonType::GreaterThan:
+      return sign > 0;
+    default:
+      return sign >= 0;
+  }
+}
+
+// the operator with its operands swapped, a < b is b > a
+static ComparisonType Mirror(ComparisonType op) {
+  switch (op) {
+    case ComparisonType::LessThan:
+      return ComparisonType::GreaterThan;
+    case ComparisonType::LessThanOrEqual:
+      return ComparisonType::GreaterThanOrEqual;
+    case ComparisonType::GreaterThan:
+      return ComparisonType::LessThan;
+    case ComparisonType::GreaterThanOrEqual:
+      return ComparisonType::LessThanOrEqual;
+    default:
+      return op;
+  }
+}
+
+// keep the positions of selection where keep is true
+template <typename Keep>
+static void KeepIf(std::vector<uint32_t> &selection, Keep keep) {
+  size_t kept = 0;
+  for (auto i : selection) {
+    if (keep(i)) {
+      selection[kept++] = i;
+    }
+  }
+  selection.resize(kept);
+}
+
+// keep the non-null positions whose value satisfies op, the loop is specialized
+// on op once per batch; sign returns the sign of value i - constant. Used for
+// the CHAR comparisons without a filter kernel.
+template <typename SignOf>
+static void KeepMatching(ComparisonType op, const uint8_t *nulls, std::vector<uint32_t> &selection, SignOf sign) {
+  switch (op) {
+    case ComparisonType::Equal:
+      KeepIf(selection, [&](uint32_t i) { return !nulls[i] && sign(i) == 0; });
+      break;
+    case ComparisonType::NotEqual:
+      KeepIf(selection, [&](uint32_t i) { return !nulls[i] && sign(i) != 0; });
+      break;
+    case ComparisonType::LessThan:
+      KeepIf(selection, [&](uint32_t i) { return !nulls[i] && sign(i) < 0; });
+      break;
+    case ComparisonType::LessThanOrEqual:
+      KeepIf(selection, [&](uint32_t i) { return !nulls[i] && sign(i) <= 0; });
+      break;
+    case ComparisonType::GreaterThan:
+      KeepIf(selection, [&](uint32_t i) { return !nulls[i] && sign(i) > 0; });
+      break;
+    default:
+      KeepIf(selection, [&](uint32_t i) { return !nulls[i] && sign(i) >= 0; });
+  }
+}
+
+CompiledPredicate::CompiledPredicate(const AbstractExpressionRef &predicate) : predicate_(predicate) {
+  if (predicate != nullptr) {
+    Compile(predicate);
+  }
+}
+
+void CompiledPredicate::Compile(const AbstractExpressionRef &expression) {
+  // nodes_ may grow while the children are compiled, the node is written by index
+  uint32_t index = nodes_.size();
+  nodes_.push_back(Node{NodeType::Expression});
+  Node node{NodeType::Expression};
+  node.expression = expression.get();
+  auto comparison = dynamic_cast<ComparisonExpression *>(expression.get());
+  auto logic = dynamic_cast<LogicExpression *>(expression.get());
+  if (logic != nullptr) {
+    node.type = logic->logic_type_ == LogicType::And ? NodeType::And : NodeType::Or;
+    Compile(logic->GetChildAt(0));
+    Compile(logic->GetChildAt(1));
+  } else if (comparison != nullptr) {
+    CompileComparison(comparison, node);
+  }
+  node.end = nodes_.size();
+  nodes_[index] = node;
+}
+
+bool CompiledPredicate::CompileComparison(const ComparisonExpression *comparison, Node &node) {
+  auto op = comparison->GetComparisonOperator();
+  auto column = dynamic_cast<ColumnValueExpression *>(comparison->GetChildAt(0).get());
+  auto constant = dynamic_cast<ConstantValueExpression *>(comparison->GetChildAt(1).get());
+  if (column == nullptr && op != ComparisonType::IsNull && op != ComparisonType::IsNotNull) {
+    // constant op column
+    column = dynamic_cast<ColumnValueExpression *>(comparison->GetChildAt(1).get());
+    constant = dynamic_cast<ConstantValueExpression *>(comparison->GetChildAt(0).get());
+    op = Mirror(op);
+  }
+  if (column == nullptr || constant == nullptr) {
+    return false;
+  }
+  node.op = op;
+  node.column = column->GetColIdx();
+  if (op == ComparisonType::IsNull || op == ComparisonType::IsNotNull) {
+    node.type = op == ComparisonType::IsNull ? NodeType::IsNull : NodeType::IsNotNull;
+    return true;
+  }
+  const Field &value = constant->val_;
+  if (value.GetTypeId() != column->GetReturnType()) {
+    return false;
+  }
+  if (value.IsNull()) {
+    // a comparison with null is never true
+    node.type = NodeType::False;
+    return true;
+  }
+  switch (value.GetTypeId()) {
+    case TypeId::kTypeInt:
+      node.type = NodeType::CompareInt;
+      node.int_value = value.value_.integer_;
+      return true;
+    case TypeId::kTypeFloat:
+      node.type = NodeType::CompareFloat;
+      node.float_value = value.value_.float_;
+      return true;
+    case TypeId::kTypeChar:
+      node.type = NodeType::CompareChar;
+      node.chars_begin = chars_.size();
+      node.chars_length = value.len_;
+      chars_.insert(chars_.end(), value.value_.chars_, value.value_.chars_ + value.len_);
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool CompiledPredicate::Evaluate(const Row &row) const { return nodes_.empty() || Evaluate(0, row); }
+
+bool CompiledPredicate::Evaluate(uint32_t index, const Row &row) const {
+  const Node &node = nodes_[index];
+  const Field *field = nullptr;
+  switch (node.type) {
+    case NodeType::And:
+      return Evaluate(index + 1, row) && Evaluate(nodes_[index + 1].end, row);
+    case NodeType::Or:
+      return Evaluate(index + 1, row) || Evaluate(nodes_[index + 1].end, row);
+    case NodeType::IsNull:
+      return row.GetField(node.column)->IsNull();
+    case NodeType::IsNotNull:
+      return !row.GetField(node.column)->IsNull();
+    case NodeType::False:
+      return false;
+    case NodeType::Expression:
+      return node.expression->Evaluate(&row).CompareEquals(Field(kTypeInt, 1)) == CmpBool::kTrue;
+    default:
+      field = row.GetField(node.column);
+  }
+  if (field->IsNull()) {
+    return false;
+  }
+  switch (node.type) {
+    case NodeType::CompareInt:
+      return Matches(node.op, Sign(field->value_.integer_, node.int_value));
+    case NodeType::CompareFloat:
+      return Matches(node.op, Sign(field->value_.float_, node.float_value));
+    default:
+      return Matches(node.op, CompareChars(field->value_.chars_, field->len_, chars_.data() + node.chars_begin,
+                                           node.chars_length));
+  }
+}
+
+void CompiledPredicate::EvaluateBatch(const RowBatch &batch, std::vector<uint32_t> &selection) const {
+  if (!nodes_.empty() && !selection.empty()) {
+    EvaluateBatch(0, batch, selection);
+  }
+}
+
+/*
+ * AND evaluates its right side on the rows its left side kept, OR evaluates
+ * its right side on the rows its left side rejected and merges both. INT and
+ * FLOAT comparisons and CHAR (in)equality run a filter kernel over the whole
+ * column, whose bitmap then refines the selection.
+ */
+void CompiledPredicate::EvaluateBatch(uint32_t index, const RowBatch &batch, std::vector<uint32_t> &selection) const {
+  const Node &node = nodes_[index];
+  switch (node.type) {
+    case NodeType::And: {
+      EvaluateBatch(index + 1, batch, selection);
+      if (!selection.empty()) {
+        EvaluateBatch(nodes_[index + 1].end, batch, selection);
+      }
+      return;
+    }
+    case NodeType::Or: {
+      std::vector<uint32_t> left(selection);
+      EvaluateBatch(index + 1, batch, left);
+      std::vector<uint32_t> right;
+      std::set_difference(selection.begin(), selection.end(), left.begin(), left.end(), std::back_inserter(right));
+      if (!right.empty()) {
+        EvaluateBatch(nodes_[index + 1].end, batch, right);
+      }
+      selection.clear();
+      std::merge(left.begin(), left.end(), right.begin(), right.end(), std::back_inserter(selection));
+      return;
+    }
+    case NodeType::False:
+      selection.clear();
+      return;
+    case NodeType::Expression:
+      node.expression->EvaluateBatch(batch, selection);
+      return;
+    default:
+      break;
+  }
+  const ColumnVector &values = batch.GetColumn(node.column);
+  const uint8_t *nulls = values.GetNulls();
+  switch (node.type) {
+    case NodeType::IsNull:
+      KeepIf(selection, [nulls](uint32_t i) { return nulls[i] != 0; });
+      break;
+    case NodeType::IsNotNull:
+      KeepIf(selection, [nulls](uint32_t i) { return nulls[i] == 0; });
+      break;
+    case NodeType::CompareInt: {
+      std::vector<uint64_t> bitmap(FilterKernel::BitmapWords(values.GetSize()));
+      FilterKernel::Compare(values.GetInts(), values.GetSize(), node.op, node.int_value, bitmap.data());
+      FilterKernel::Select(bitmap.data(), nulls, false, selection);
+      break;
+    }
+    case NodeType::CompareFloat: {
+      std::vector<uint64_t> bitmap(FilterKernel::BitmapWords(values.GetSize()));
+      FilterKernel::Compare(values.GetFloats(), values.GetSize(), node.op, node.float_value, bitmap.data());
+      FilterKernel::Select(bitmap.data(), nulls, false, selection);
+      break;
+    }
+    default: {
+      if (node.op == ComparisonType::Equal || node.op == ComparisonType::NotEqual) {
+        std::vector<uint64_t> bitmap(FilterKernel::BitmapWords(values.GetSize()));
+        FilterKernel::EqualChars(values.GetCharData(), values.GetOffsets(), values.GetSize(),
+                                 chars_.data() + node.chars_begin, node.chars_length, bitmap.data());
+        FilterKernel::Select(bitmap.data(), nulls, node.op == ComparisonType::NotEqual, selection);
+        break;
+      }
+      const char *chars = chars_.data() + node.chars_begin;
+      uint32_t length = node.chars_length;
+      KeepMatching(node.op, nulls, selection, [&values, chars, length](uint32_t i) {
+        return CompareChars(values.GetChars(i), values.GetCharLength(i), chars, length);
+      });
+    }
+  }
+}
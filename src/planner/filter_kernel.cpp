@@ -0,0 +1,221 @@
+#include "planner/expressions/filter_kernel.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define FILTER_KERNEL_X86
+#endif
+
+/*****************************************************************************
+ * SCALAR
+ *****************************************************************************/
+template <ComparisonType op, typename T>
+static inline bool Matches(T a, T b) {
+  switch (op) {
+    case ComparisonType::Equal:
+      return a == b;
+    case ComparisonType::NotEqual:
+      return a != b;
+    case ComparisonType::LessThan:
+      return a < b;
+    case ComparisonType::LessThanOrEqual:
+      return a <= b;
+    case ComparisonType::GreaterThan:
+      return a > b;
+    default:
+      return a >= b;
+  }
+}
+
+template <ComparisonType op, typename T>
+static void ScalarCompare(const T *values, uint32_t n, T value, uint64_t *bitmap) {
+  for (uint32_t i = 0; i < n; i += 64) {
+    uint32_t count = std::min(n - i, 64u);
+    uint64_t word = 0;
+    for (uint32_t j = 0; j < count; j++) {
+      word |= static_cast<uint64_t>(Matches<op>(values[i + j], value)) << j;
+    }
+    bitmap[i / 64] = word;
+  }
+}
+
+template <typename T>
+static void ScalarCompare(const T *values, uint32_t n, ComparisonType op, T value, uint64_t *bitmap) {
+  switch (op) {
+    case ComparisonType::Equal:
+      return ScalarCompare<ComparisonType::Equal>(values, n, value, bitmap);
+    case ComparisonType::NotEqual:
+      return ScalarCompare<ComparisonType::NotEqual>(values, n, value, bitmap);
+    case ComparisonType::LessThan:
+      return ScalarCompare<ComparisonType::LessThan>(values, n, value, bitmap);
+    case ComparisonType::LessThanOrEqual:
+      return ScalarCompare<ComparisonType::LessThanOrEqual>(values, n, value, bitmap);
+    case ComparisonType::GreaterThan:
+      return ScalarCompare<ComparisonType::GreaterThan>(values, n, value, bitmap);
+    default:
+      return ScalarCompare<ComparisonType::GreaterThanOrEqual>(values, n, value, bitmap);
+  }
+}
+
+#ifdef FILTER_KERNEL_X86
+/*****************************************************************************
+ * AVX2
+ *****************************************************************************/
+// one bit for each of the 8 lanes of v op target
+template <ComparisonType op>
+__attribute__((target("avx2"))) static inline uint32_t Avx2Lanes(__m256i v, __m256i target) {
+  switch (op) {
+    case ComparisonType::Equal:
+      return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, target)));
+    case ComparisonType::NotEqual:
+      return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, target))) ^ 0xFFu;
+    case ComparisonType::LessThan:
+      return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(target, v)));
+    case ComparisonType::LessThanOrEqual:
+      return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, target))) ^ 0xFFu;
+    case ComparisonType::GreaterThan:
+      return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, target)));
+    default:
+      return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(target, v))) ^ 0xFFu;
+  }
+}
+
+// the ordered predicates are false for NaN, not equal is true for it, as the scalar operators are
+template <ComparisonType op>
+__attribute__((target("avx2"))) static inline uint32_t Avx2Lanes(__m256 v, __m256 target) {
+  switch (op) {
+    case ComparisonType::Equal:
+      return _mm256_movemask_ps(_mm256_cmp_ps(v, target, _CMP_EQ_OQ));
+    case ComparisonType::NotEqual:
+      return _mm256_movemask_ps(_mm256_cmp_ps(v, target, _CMP_NEQ_UQ));
+    case ComparisonType::LessThan:
+      return _mm256_movemask_ps(_mm256_cmp_ps(v, target, _CMP_LT_OQ));
+    case ComparisonType::LessThanOrEqual:
+      return _mm256_movemask_ps(_mm256_cmp_ps(v, target, _CMP_LE_OQ));
+    case ComparisonType::GreaterThan:
+      return _mm256_movemask_ps(_mm256_cmp_ps(v, target, _CMP_GT_OQ));
+    default:
+      return _mm256_movemask_ps(_mm256_cmp_ps(v, target, _CMP_GE_OQ));
+  }
+}
+
+template <ComparisonType op>
+__attribute__((target("avx2"))) static void Avx2Compare(const int32_t *values, uint32_t n, int32_t value,
+                                                        uint64_t *bitmap) {
+  const __m256i target = _mm256_set1_epi32(value);
+  uint32_t i = 0;
+  for (; i + 64 <= n; i += 64) {
+    uint64_t word = 0;
+    for (uint32_t j = 0; j < 64; j += 8) {
+      __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i + j));
+      word |= static_cast<uint64_t>(Avx2Lanes<op>(v, target)) << j;
+    }
+    bitmap[i / 64] = word;
+  }
+  ScalarCompare<op>(values + i, n - i, value, bitmap + i / 64);
+}
+
+template <ComparisonType op>
+__attribute__((target("avx2"))) static void Avx2Compare(const float *values, uint32_t n, float value,
+                                                        uint64_t *bitmap) {
+  const __m256 target = _mm256_set1_ps(value);
+  uint32_t i = 0;
+  for (; i + 64 <= n; i += 64) {
+    uint64_t word = 0;
+    for (uint32_t j = 0; j < 64; j += 8) {
+      word |= static_cast<uint64_t>(Avx2Lanes<op>(_mm256_loadu_ps(values + i + j), target)) << j;
+    }
+    bitmap[i / 64] = word;
+  }
+  ScalarCompare<op>(values + i, n - i, value, bitmap + i / 64);
+}
+
+template <typename T>
+static void Avx2Compare(const T *values, uint32_t n, ComparisonType op, T value, uint64_t *bitmap) {
+  switch (op) {
+    case ComparisonType::Equal:
+      return Avx2Compare<ComparisonType::Equal>(values, n, value, bitmap);
+    case ComparisonType::NotEqual:
+      return Avx2Compare<ComparisonType::NotEqual>(values, n, value, bitmap);
+    case ComparisonType::LessThan:
+      return Avx2Compare<ComparisonType::LessThan>(values, n, value, bitmap);
+    case ComparisonType::LessThanOrEqual:
+      return Avx2Compare<ComparisonType::LessThanOrEqual>(values, n, value, bitmap);
+    case ComparisonType::GreaterThan:
+      return Avx2Compare<ComparisonType::GreaterThan>(values, n, value, bitmap);
+    default:
+      return Avx2Compare<ComparisonType::GreaterThanOrEqual>(values, n, value, bitmap);
+  }
+}
+
+#endif  // FILTER_KERNEL_X86
+
+/*****************************************************************************
+ * DISPATCH
+ *****************************************************************************/
+FilterKernel::Isa FilterKernel::isa_ = FilterKernel::DetectIsa();
+
+FilterKernel::Isa FilterKernel::DetectIsa() {
+#ifdef FILTER_KERNEL_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return Isa::kAVX2;
+  }
+#endif
+  return Isa::kScalar;
+}
+
+void FilterKernel::SetIsa(Isa isa) {
+  Isa detected = DetectIsa();
+  isa_ = static_cast<int>(isa) <= static_cast<int>(detected) ? isa : detected;
+}
+
+void FilterKernel::Compare(const int32_t *values, uint32_t n, ComparisonType op, int32_t value, uint64_t *bitmap) {
+#ifdef FILTER_KERNEL_X86
+  if (isa_ == Isa::kAVX2) {
+    return Avx2Compare(values, n, op, value, bitmap);
+  }
+#endif
+  ScalarCompare(values, n, op, value, bitmap);
+}
+
+void FilterKernel::Compare(const float *values, uint32_t n, ComparisonType op, float value, uint64_t *bitmap) {
+#ifdef FILTER_KERNEL_X86
+  if (isa_ == Isa::kAVX2) {
+    return Avx2Compare(values, n, op, value, bitmap);
+  }
+#endif
+  ScalarCompare(values, n, op, value, bitmap);
+}
+
+/*
+ * memcmp of the C library is vectorized already, a compare of our own measured
+ * slower for short and long names alike, so CHAR equality has one kernel that
+ * only calls memcmp for values of the right length.
+ */
+void FilterKernel::EqualChars(const char *chars, const uint32_t *offsets, uint32_t n, const char *value,
+                              uint32_t length, uint64_t *bitmap) {
+  for (uint32_t i = 0; i < n; i += 64) {
+    uint32_t count = std::min(n - i, 64u);
+    uint64_t word = 0;
+    for (uint32_t j = 0; j < count; j++) {
+      uint32_t begin = offsets[i + j];
+      bool equal = offsets[i + j + 1] - begin == length && memcmp(chars + begin, value, length) == 0;
+      word |= static_cast<uint64_t>(equal) << j;
+    }
+    bitmap[i / 64] = word;
+  }
+}
+
+void FilterKernel::Select(const uint64_t *bitmap, const uint8_t *nulls, bool negate, std::vector<uint32_t> &selection) {
+  size_t kept = 0;
+  for (auto i : selection) {
+    bool set = (bitmap[i / 64] >> (i % 64)) & 1;
+    if (!nulls[i] && set != negate) {
+      selection[kept++] = i;
+    }
+  }
+  selection.resize(kept);
+}
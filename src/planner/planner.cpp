@@ -35,24 +35,216 @@ void Planner::PlanQuery(pSyntaxNode ast) {
 }
 AbstractPlanNodeRef Planner::PlanSelect(std::shared_ptr<SelectStatement> statement) {
   auto out_schema = MakeOutputSchema(statement->column_list_);
+  if (statement->IsJoin()) {
+    return PlanJoin(statement, out_schema);
+  }
+  return PlanScan(out_schema, statement->table_name_, statement->where_, statement->column_in_condition_,
+                  statement->has_or);
+}
+
+AbstractPlanNodeRef Planner::PlanScan(const Schema *out_schema, const std::string &table_name,
+                                      const AbstractExpressionRef &predicate,
+                                      const std::vector<uint32_t> &column_in_condition, bool has_or) {
   vector<IndexInfo *> indexes;
   vector<IndexInfo *> available_index;
-  context_->GetCatalog()->GetTableIndexes(statement->table_name_, indexes);
+  context_->GetCatalog()->GetTableIndexes(table_name, indexes);
+  auto equality_columns = EqualityColumns(predicate);
+  auto contains = [](const std::vector<uint32_t> &columns, uint32_t col_id) {
+    return std::find(columns.begin(), columns.end(), col_id) != columns.end();
+  };
   for (auto index : indexes) {
-    if (index->GetIndexKeySchema()->GetColumns().size() == 1) {
-      auto col_id = index->GetIndexKeySchema()->GetColumn(0)->GetTableInd();
-      if (std::find(statement->column_in_condition_.begin(), statement->column_in_condition_.end(), col_id) !=
-          statement->column_in_condition_.end()) {
-        available_index.push_back(index);
+    const auto &key_columns = index->GetIndexKeySchema()->GetColumns();
+    bool usable;
+    if (index->IsPartial() && !ImpliesIndexPredicate(predicate, index->GetIndexMetadata()->GetPredicate())) {
+      // a partial index misses the rows its predicate rejects, the query may need them
+      usable = false;
+    } else if (index->IsOrdered()) {
+      // an ordered index serves a predicate on its leading column, the executor
+      // narrows the range further with equalities and a range on the following ones
+      usable = contains(column_in_condition, key_columns[0]->GetTableInd());
+    } else {
+      // a hash index is only of use when every key column is compared for equality
+      usable = std::all_of(key_columns.begin(), key_columns.end(),
+                           [&](const Column *column) { return contains(equality_columns, column->GetTableInd()); });
+    }
+    // with statistics, an index reading more pages than a scan of the table is left out
+    if (usable && !has_or && index->GetStatistics().IsAnalyzed()) {
+      const auto &stats = index->GetStatistics();
+      usable = stats.ScanCost(LeadingSelectivity(predicate, index)) < stats.GetTablePages();
+    }
+    if (usable) {
+      available_index.push_back(index);
+    }
+  }
+  // an OR is scanned through the union of index bitmaps, every branch needs an index
+  if (available_index.empty() || (has_or && !AnsweredByIndexes(predicate, available_index))) {
+    return make_shared<SeqScanPlanNode>(out_schema, table_name, predicate);
+  }
+  return make_shared<IndexScanPlanNode>(out_schema, table_name, available_index,
+                                        available_index.size() != column_in_condition.size(),
+                                        predicate);
+}
+
+/*
+ * The conjuncts of the WHERE clause reading one table are pushed down into the
+ * scan of that table, equalities between a column of each table become the
+ * join keys and the rest is checked on the joined rows.
+ *
+ * With an index on the join columns of a table the join looks up the matches
+ * of each row of the other side in it, as long as the other side is filtered.
+ * When both tables can be read in join key order through an ordered index, an
+ * unfiltered side is rather merged with them in one pass. A single ordered side
+ * is merged with the other side sorted, only without any index the two tables
+ * are hash joined.
+ */
+AbstractPlanNodeRef Planner::PlanJoin(std::shared_ptr<SelectStatement> statement, const Schema *out_schema) {
+  std::vector<AbstractExpressionRef> conjuncts;
+  std::vector<AbstractExpressionRef> stack;
+  if (statement->where_ != nullptr) {
+    stack.push_back(statement->where_);
+  }
+  while (!stack.empty()) {
+    auto expr = stack.back();
+    stack.pop_back();
+    auto logic = dynamic_pointer_cast<LogicExpression>(expr);
+    if (logic != nullptr && logic->logic_type_ == LogicType::And) {
+      stack.push_back(logic->GetChildAt(1));
+      stack.push_back(logic->GetChildAt(0));
+    } else {
+      conjuncts.push_back(expr);
+    }
+  }
+  auto conjoin = [](const AbstractExpressionRef &lhs, const AbstractExpressionRef &rhs) -> AbstractExpressionRef {
+    return lhs == nullptr ? rhs : std::make_shared<LogicExpression>(lhs, rhs, LogicType::And);
+  };
+  AbstractExpressionRef side_predicates[2];
+  std::vector<AbstractExpressionRef> left_keys;
+  std::vector<AbstractExpressionRef> right_keys;
+  std::vector<AbstractExpressionRef> key_conjuncts;
+  AbstractExpressionRef predicate;
+  for (const auto &conjunct : conjuncts) {
+    uint32_t sides = JoinSides(conjunct);
+    auto comparison = dynamic_pointer_cast<ComparisonExpression>(conjunct);
+    if (sides == 3 && comparison != nullptr && comparison->GetComparisonType() == "=") {
+      auto lhs = dynamic_pointer_cast<ColumnValueExpression>(comparison->GetChildAt(0));
+      auto rhs = dynamic_pointer_cast<ColumnValueExpression>(comparison->GetChildAt(1));
+      if (lhs->GetRowIdx() == 1) {
+        std::swap(lhs, rhs);
+      }
+      left_keys.push_back(ToSingleTable(lhs));
+      right_keys.push_back(ToSingleTable(rhs));
+      key_conjuncts.push_back(conjunct);
+    } else if (sides == 1 || sides == 2) {
+      side_predicates[sides - 1] = conjoin(side_predicates[sides - 1], ToSingleTable(conjunct));
+    } else {
+      predicate = conjoin(predicate, conjunct);
+    }
+  }
+  if (left_keys.empty()) {
+    throw std::logic_error("a join needs a column of each table compared for equality");
+  }
+  const std::string tables[] = {statement->table_name_, statement->join_table_name_};
+  auto plan_side = [&](uint32_t side) {
+    TableInfo *info = nullptr;
+    context_->GetCatalog()->GetTable(tables[side], info);
+    std::vector<uint32_t> column_in_condition;
+    bool has_or = false;
+    ConditionColumns(side_predicates[side], column_in_condition, has_or);
+    return PlanScan(info->GetSchema(), tables[side], side_predicates[side], column_in_condition, has_or);
+  };
+  std::vector<AbstractExpressionRef> output_exprs;
+  for (const auto &column : statement->column_list_) {
+    output_exprs.push_back(column.second);
+  }
+  // key equalities the join does not use as keys are checked on the joined rows
+  auto residual = [&](const std::vector<bool> &covered) {
+    AbstractExpressionRef join_predicate = predicate;
+    for (size_t k = 0; k < key_conjuncts.size(); k++) {
+      if (!covered[k]) {
+        join_predicate = conjoin(join_predicate, key_conjuncts[k]);
+      }
+    }
+    return join_predicate;
+  };
+  // a side read through its ordered index keeps to index order, the other one is sorted
+  IndexInfo *ordered[2] = {nullptr, nullptr};
+  std::vector<size_t> positions[2];
+  for (uint32_t side : {0u, 1u}) {
+    ordered[side] = OrderedJoinIndex(tables[side], side == 0 ? left_keys : right_keys, side_predicates[side],
+                                     positions[side]);
+  }
+  auto merge_join = [&](const std::vector<size_t> &merge_positions, bool sort_left, bool sort_right) {
+    std::vector<AbstractExpressionRef> merge_keys[2];
+    std::vector<bool> covered(key_conjuncts.size(), false);
+    for (auto k : merge_positions) {
+      merge_keys[0].push_back(left_keys[k]);
+      merge_keys[1].push_back(right_keys[k]);
+      covered[k] = true;
+    }
+    const bool sorts[] = {sort_left, sort_right};
+    AbstractPlanNodeRef scans[2];
+    for (uint32_t side : {0u, 1u}) {
+      if (sorts[side]) {
+        scans[side] = plan_side(side);
+        continue;
+      }
+      TableInfo *info = nullptr;
+      context_->GetCatalog()->GetTable(tables[side], info);
+      scans[side] = std::make_shared<IndexScanPlanNode>(info->GetSchema(), tables[side],
+                                                        std::vector<IndexInfo *>{ordered[side]}, true,
+                                                        side_predicates[side], true);
+    }
+    return std::make_shared<MergeJoinPlanNode>(out_schema, scans[0], scans[1], merge_keys[0], merge_keys[1],
+                                               residual(covered), output_exprs, sort_left, sort_right);
+  };
+  // both orders agree on the keys of their common prefix
+  std::vector<size_t> common;
+  if (ordered[0] != nullptr && ordered[1] != nullptr) {
+    for (size_t i = 0; i < positions[0].size() && i < positions[1].size() && positions[0][i] == positions[1][i];
+         i++) {
+      common.push_back(positions[0][i]);
+    }
+  }
+  // an index on the join columns of one table answers the lookups of the other
+  // side's rows, the second table is preferred as the inner one
+  const std::vector<AbstractExpressionRef> *keys[] = {&left_keys, &right_keys};
+  for (uint32_t inner : {1u, 0u}) {
+    IndexInfo *index = JoinIndex(tables[inner], *keys[inner], side_predicates[inner]);
+    if (index == nullptr) {
+      continue;
+    }
+    uint32_t outer = 1 - inner;
+    if (side_predicates[outer] == nullptr && !common.empty()) {
+      // every row of the outer table would be looked up, merging reads each index once
+      continue;
+    }
+    std::vector<AbstractExpressionRef> outer_keys;
+    std::vector<bool> covered(key_conjuncts.size(), false);
+    for (auto column : index->GetIndexKeySchema()->GetColumns()) {
+      for (size_t k = 0; k < key_conjuncts.size(); k++) {
+        auto inner_key = dynamic_pointer_cast<ColumnValueExpression>((*keys[inner])[k]);
+        if (!covered[k] && inner_key->GetColIdx() == column->GetTableInd()) {
+          outer_keys.push_back((*keys[outer])[k]);
+          covered[k] = true;
+          break;
+        }
       }
     }
+    return std::make_shared<IndexNestedLoopJoinPlanNode>(out_schema, plan_side(outer), tables[inner], index,
+                                                         outer_keys, side_predicates[inner], residual(covered),
+                                                         output_exprs, inner == 0);
+  }
+  if (!common.empty()) {
+    return merge_join(common, false, false);
   }
-  if (available_index.empty() || statement->has_or) {
-    return make_shared<SeqScanPlanNode>(out_schema, statement->table_name_, statement->where_);
+  for (uint32_t side : {0u, 1u}) {
+    if (ordered[side] != nullptr) {
+      return merge_join(positions[side], side != 0, side != 1);
+    }
   }
-  return make_shared<IndexScanPlanNode>(out_schema, statement->table_name_, available_index,
-                                        available_index.size() != statement->column_in_condition_.size(),
-                                        statement->where_);
+  AbstractPlanNodeRef scans[] = {plan_side(0), plan_side(1)};
+  return std::make_shared<HashJoinPlanNode>(out_schema, scans[0], scans[1], left_keys, right_keys, predicate,
+                                            output_exprs);
 }
 
 AbstractPlanNodeRef Planner::PlanInsert(std::shared_ptr<InsertStatement> statement) {
@@ -89,3 +281,256 @@ Schema *Planner::MakeOutputSchema(const vector<std::pair<std::string, AbstractEx
   }
   return new Schema(cols);
 }
+
+std::vector<uint32_t> Planner::EqualityColumns(const AbstractExpressionRef &predicate) {
+  std::vector<uint32_t> columns;
+  std::vector<AbstractExpressionRef> stack;
+  if (predicate != nullptr) {
+    stack.push_back(predicate);
+  }
+  while (!stack.empty()) {
+    auto expr = stack.back();
+    stack.pop_back();
+    auto logic = dynamic_pointer_cast<LogicExpression>(expr);
+    if (logic != nullptr && logic->logic_type_ == LogicType::And) {
+      stack.push_back(logic->GetChildAt(0));
+      stack.push_back(logic->GetChildAt(1));
+      continue;
+    }
+    auto comparison = dynamic_pointer_cast<ComparisonExpression>(expr);
+    if (comparison != nullptr && comparison->GetComparisonType() == "=" &&
+        dynamic_pointer_cast<ConstantValueExpression>(comparison->GetChildAt(1)) != nullptr) {
+      auto column = dynamic_pointer_cast<ColumnValueExpression>(comparison->GetChildAt(0));
+      if (column != nullptr) {
+        columns.push_back(column->GetColIdx());
+      }
+    }
+  }
+  return columns;
+}
+
+double Planner::LeadingSelectivity(const AbstractExpressionRef &predicate, IndexInfo *index) {
+  const auto &stats = index->GetStatistics();
+  auto *key_schema = index->GetIndexKeySchema();
+  uint32_t leading = key_schema->GetColumn(0)->GetTableInd();
+  double equal_selectivity = 1;
+  bool has_lower = false;
+  bool has_upper = false;
+  bool lower_inclusive = true;
+  bool upper_inclusive = true;
+  std::string lower;
+  std::string upper;
+  std::vector<AbstractExpressionRef> stack{predicate};
+  while (!stack.empty()) {
+    auto expr = stack.back();
+    stack.pop_back();
+    auto logic = dynamic_pointer_cast<LogicExpression>(expr);
+    if (logic != nullptr && logic->logic_type_ == LogicType::And) {
+      stack.push_back(logic->GetChildAt(0));
+      stack.push_back(logic->GetChildAt(1));
+      continue;
+    }
+    auto comparison = dynamic_pointer_cast<ComparisonExpression>(expr);
+    if (comparison == nullptr) {
+      continue;
+    }
+    auto column = dynamic_pointer_cast<ColumnValueExpression>(comparison->GetChildAt(0));
+    auto constant = dynamic_pointer_cast<ConstantValueExpression>(comparison->GetChildAt(1));
+    std::string value;
+    if (column == nullptr || constant == nullptr || column->GetColIdx() != leading ||
+        !IndexStatistics::EncodeValue(constant->val_, key_schema, value)) {
+      continue;
+    }
+    // keep the tightest bound on each side
+    const auto &type = comparison->GetComparisonType();
+    if (type == "=") {
+      equal_selectivity = std::min(equal_selectivity, stats.EqualSelectivity(value));
+    } else if ((type == ">" || type == ">=") && (!has_lower || value >= lower)) {
+      lower_inclusive = type == ">=" && (!has_lower || value > lower || lower_inclusive);
+      lower = value;
+      has_lower = true;
+    } else if ((type == "<" || type == "<=") && (!has_upper || value <= upper)) {
+      upper_inclusive = type == "<=" && (!has_upper || value < upper || upper_inclusive);
+      upper = value;
+      has_upper = true;
+    }
+  }
+  if (!has_lower && !has_upper) {
+    return equal_selectivity;
+  }
+  double range_selectivity = stats.RangeSelectivity(has_lower ? &lower : nullptr, lower_inclusive,
+                                                    has_upper ? &upper : nullptr, upper_inclusive);
+  return std::min(equal_selectivity, range_selectivity);
+}
+
+/*
+ * Each term of the index predicate has to follow from a single conjunct at the
+ * top of the predicate, a term implied only by every branch of an OR is missed.
+ */
+bool Planner::ImpliesIndexPredicate(const AbstractExpressionRef &predicate, const IndexPredicate &index_predicate) {
+  std::vector<std::shared_ptr<ComparisonExpression>> conjuncts;
+  std::vector<AbstractExpressionRef> stack;
+  if (predicate != nullptr) {
+    stack.push_back(predicate);
+  }
+  while (!stack.empty()) {
+    auto expr = stack.back();
+    stack.pop_back();
+    auto logic = dynamic_pointer_cast<LogicExpression>(expr);
+    if (logic != nullptr && logic->logic_type_ == LogicType::And) {
+      stack.push_back(logic->GetChildAt(0));
+      stack.push_back(logic->GetChildAt(1));
+      continue;
+    }
+    auto comparison = dynamic_pointer_cast<ComparisonExpression>(expr);
+    if (comparison != nullptr && dynamic_pointer_cast<ColumnValueExpression>(comparison->GetChildAt(0)) != nullptr &&
+        dynamic_pointer_cast<ConstantValueExpression>(comparison->GetChildAt(1)) != nullptr) {
+      conjuncts.push_back(comparison);
+    }
+  }
+  for (const auto &term : index_predicate.GetTerms()) {
+    bool implied = std::any_of(conjuncts.begin(), conjuncts.end(), [&term](const auto &comparison) {
+      auto column = dynamic_pointer_cast<ColumnValueExpression>(comparison->GetChildAt(0));
+      auto constant = dynamic_pointer_cast<ConstantValueExpression>(comparison->GetChildAt(1));
+      return IndexPredicate::Implies(column->GetColIdx(), comparison->GetComparisonType(), constant->val_, term);
+    });
+    if (!implied) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool Planner::AnsweredByIndexes(const AbstractExpressionRef &predicate, const std::vector<IndexInfo *> &indexes) {
+  auto logic = dynamic_pointer_cast<LogicExpression>(predicate);
+  if (logic != nullptr) {
+    bool left = AnsweredByIndexes(logic->GetChildAt(0), indexes);
+    bool right = AnsweredByIndexes(logic->GetChildAt(1), indexes);
+    return logic->logic_type_ == LogicType::And ? left || right : left && right;
+  }
+  auto comparison = dynamic_pointer_cast<ComparisonExpression>(predicate);
+  if (comparison == nullptr || dynamic_pointer_cast<ConstantValueExpression>(comparison->GetChildAt(1)) == nullptr) {
+    return false;
+  }
+  auto column = dynamic_pointer_cast<ColumnValueExpression>(comparison->GetChildAt(0));
+  if (column == nullptr) {
+    return false;
+  }
+  for (auto index : indexes) {
+    auto key_schema = index->GetIndexKeySchema();
+    if (key_schema->GetColumnCount() == 1 && key_schema->GetColumn(0)->GetTableInd() == column->GetColIdx() &&
+        (index->IsOrdered() || comparison->GetComparisonType() == "=")) {
+      return true;
+    }
+  }
+  return false;
+}
+
+uint32_t Planner::JoinSides(const AbstractExpressionRef &expr) {
+  auto column = dynamic_pointer_cast<ColumnValueExpression>(expr);
+  if (column != nullptr) {
+    return 1 << column->GetRowIdx();
+  }
+  uint32_t sides = 0;
+  for (const auto &child : expr->GetChildren()) {
+    sides |= JoinSides(child);
+  }
+  return sides;
+}
+
+AbstractExpressionRef Planner::ToSingleTable(const AbstractExpressionRef &expr) {
+  auto column = dynamic_pointer_cast<ColumnValueExpression>(expr);
+  if (column != nullptr) {
+    return std::make_shared<ColumnValueExpression>(0, column->GetColIdx(), column->GetReturnType());
+  }
+  auto comparison = dynamic_pointer_cast<ComparisonExpression>(expr);
+  if (comparison != nullptr) {
+    return std::make_shared<ComparisonExpression>(ToSingleTable(comparison->GetChildAt(0)),
+                                                  ToSingleTable(comparison->GetChildAt(1)),
+                                                  comparison->GetComparisonType());
+  }
+  auto logic = dynamic_pointer_cast<LogicExpression>(expr);
+  if (logic != nullptr) {
+    return std::make_shared<LogicExpression>(ToSingleTable(logic->GetChildAt(0)), ToSingleTable(logic->GetChildAt(1)),
+                                             logic->logic_type_);
+  }
+  return expr;
+}
+
+void Planner::ConditionColumns(const AbstractExpressionRef &predicate, std::vector<uint32_t> &columns, bool &has_or) {
+  auto logic = dynamic_pointer_cast<LogicExpression>(predicate);
+  if (logic != nullptr) {
+    has_or = has_or || logic->logic_type_ == LogicType::Or;
+    ConditionColumns(logic->GetChildAt(0), columns, has_or);
+    ConditionColumns(logic->GetChildAt(1), columns, has_or);
+    return;
+  }
+  auto comparison = dynamic_pointer_cast<ComparisonExpression>(predicate);
+  if (comparison == nullptr || dynamic_pointer_cast<ConstantValueExpression>(comparison->GetChildAt(1)) == nullptr) {
+    return;
+  }
+  auto column = dynamic_pointer_cast<ColumnValueExpression>(comparison->GetChildAt(0));
+  if (column != nullptr && std::find(columns.begin(), columns.end(), column->GetColIdx()) == columns.end()) {
+    columns.push_back(column->GetColIdx());
+  }
+}
+
+/*
+ * Every column of the index key has to be a join column of the table. A partial
+ * index serves only if the conjuncts on the table imply its predicate.
+ */
+IndexInfo *Planner::JoinIndex(const std::string &table_name, const std::vector<AbstractExpressionRef> &keys,
+                              const AbstractExpressionRef &predicate) {
+  std::vector<IndexInfo *> indexes;
+  context_->GetCatalog()->GetTableIndexes(table_name, indexes);
+  IndexInfo *result = nullptr;
+  for (auto index : indexes) {
+    if (index->IsPartial() && !ImpliesIndexPredicate(predicate, index->GetIndexMetadata()->GetPredicate())) {
+      continue;
+    }
+    const auto &key_columns = index->GetIndexKeySchema()->GetColumns();
+    bool covered = std::all_of(key_columns.begin(), key_columns.end(), [&keys](const Column *column) {
+      return std::any_of(keys.begin(), keys.end(), [column](const AbstractExpressionRef &key) {
+        return dynamic_pointer_cast<ColumnValueExpression>(key)->GetColIdx() == column->GetTableInd();
+      });
+    });
+    // the index covering more of the join columns finds fewer rows
+    if (covered && (result == nullptr || key_columns.size() > result->GetIndexKeySchema()->GetColumnCount())) {
+      result = index;
+    }
+  }
+  return result;
+}
+
+/*
+ * Only the leading key columns matter for the order, every key column after
+ * them orders rows with equal join keys among each other.
+ */
+IndexInfo *Planner::OrderedJoinIndex(const std::string &table_name, const std::vector<AbstractExpressionRef> &keys,
+                                     const AbstractExpressionRef &predicate, std::vector<size_t> &positions) {
+  std::vector<IndexInfo *> indexes;
+  context_->GetCatalog()->GetTableIndexes(table_name, indexes);
+  IndexInfo *result = nullptr;
+  positions.clear();
+  for (auto index : indexes) {
+    if (!index->IsOrdered() ||
+        (index->IsPartial() && !ImpliesIndexPredicate(predicate, index->GetIndexMetadata()->GetPredicate()))) {
+      continue;
+    }
+    std::vector<size_t> leading;
+    for (auto column : index->GetIndexKeySchema()->GetColumns()) {
+      auto key = std::find_if(keys.begin(), keys.end(), [column](const AbstractExpressionRef &key) {
+        return dynamic_pointer_cast<ColumnValueExpression>(key)->GetColIdx() == column->GetTableInd();
+      });
+      if (key == keys.end()) {
+        break;
+      }
+      leading.push_back(key - keys.begin());
+    }
+    if (leading.size() > positions.size()) {
+      result = index;
+      positions = leading;
+    }
+  }
+  return result;
+}
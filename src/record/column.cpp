@@ -89,12 +89,8 @@ uint32_t Column::DeserializeFrom(char *buf, Column *&column) {
   size += sizeof(uint32_t);
 
   uint32_t name_len = MACH_READ_UINT32(buf+size);
-  std::string name = new char[name_len];
-  uint32_t i = 0;
-  for (; i < name_len; ++i) {
-    name[i] = MACH_READ_FROM(char, buf+size+i);
-  }
-  name[i] = '\0';
+  size += sizeof(uint32_t);
+  std::string name(buf+size, name_len);
   size += name_len;
 
   TypeId type = MACH_READ_FROM(TypeId, buf+size);
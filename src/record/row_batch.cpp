@@ -0,0 +1,177 @@
+#include "record/row_batch.h"
+
+void ColumnVector::Clear() {
+  nulls_.clear();
+  ints_.clear();
+  floats_.clear();
+  chars_.clear();
+  offsets_.resize(1);
+}
+
+void ColumnVector::Append(const Field &field) {
+  if (type_id_ == TypeId::kTypeChar && !field.IsNull()) {
+    nulls_.push_back(0);
+    chars_.insert(chars_.end(), field.GetData(), field.GetData() + field.GetLength());
+    offsets_.push_back(chars_.size());
+    return;
+  }
+  char buf[sizeof(int64_t)];
+  if (!field.IsNull()) {
+    field.SerializeTo(buf);
+  }
+  AppendSerialized(buf, field.IsNull());
+}
+
+uint32_t ColumnVector::AppendSerialized(const char *buf, bool is_null) {
+  nulls_.push_back(is_null);
+  switch (type_id_) {
+    case TypeId::kTypeInt:
+      ints_.push_back(is_null ? 0 : MACH_READ_INT32(buf));
+      return is_null ? 0 : sizeof(int32_t);
+    case TypeId::kTypeFloat:
+      floats_.push_back(is_null ? 0 : MACH_READ_FROM(float, buf));
+      return is_null ? 0 : sizeof(float);
+    case TypeId::kTypeChar: {
+      uint32_t len = is_null ? 0 : MACH_READ_UINT32(buf);
+      if (!is_null) {
+        chars_.insert(chars_.end(), buf + sizeof(uint32_t), buf + sizeof(uint32_t) + len);
+      }
+      offsets_.push_back(chars_.size());
+      return is_null ? 0 : len + sizeof(uint32_t);
+    }
+    default:
+      ASSERT(false, "Unsupported column type.");
+      return 0;
+  }
+}
+
+void ColumnVector::AppendFrom(const ColumnVector &other, uint32_t i) {
+  nulls_.push_back(other.nulls_[i]);
+  switch (type_id_) {
+    case TypeId::kTypeInt:
+      ints_.push_back(other.ints_[i]);
+      break;
+    case TypeId::kTypeFloat:
+      floats_.push_back(other.floats_[i]);
+      break;
+    case TypeId::kTypeChar:
+      chars_.insert(chars_.end(), other.GetChars(i), other.GetChars(i) + other.GetCharLength(i));
+      offsets_.push_back(chars_.size());
+      break;
+    default:
+      ASSERT(false, "Unsupported column type.");
+  }
+}
+
+Field *ColumnVector::NewField(uint32_t i) const {
+  if (IsNull(i)) {
+    return new Field(type_id_);
+  }
+  switch (type_id_) {
+    case TypeId::kTypeInt:
+      return new Field(type_id_, ints_[i]);
+    case TypeId::kTypeFloat:
+      return new Field(type_id_, floats_[i]);
+    default:
+      return new Field(type_id_, const_cast<char *>(GetChars(i)), GetCharLength(i), true);
+  }
+}
+
+void RowBatch::Init(const Schema *schema) {
+  const auto &columns = schema->GetColumns();
+  bool matches = columns_.size() == columns.size();
+  for (size_t i = 0; matches && i < columns.size(); i++) {
+    matches = columns_[i].GetTypeId() == columns[i]->GetType();
+  }
+  if (!matches) {
+    columns_.clear();
+    for (auto column : columns) {
+      columns_.emplace_back(column->GetType());
+    }
+  }
+  Reset();
+}
+
+void RowBatch::Reset() {
+  for (auto &column : columns_) {
+    column.Clear();
+  }
+  row_ids_.clear();
+  selection_.clear();
+}
+
+void RowBatch::Clear() {
+  columns_.clear();
+  Reset();
+}
+
+void RowBatch::AppendRow(const Row &row) {
+  bool matches = columns_.size() == row.GetFieldCount();
+  for (uint32_t i = 0; matches && i < columns_.size(); i++) {
+    matches = columns_[i].GetTypeId() == row.GetField(i)->GetTypeId();
+  }
+  if (row_ids_.empty() && !matches) {
+    columns_.clear();
+    for (uint32_t i = 0; i < row.GetFieldCount(); i++) {
+      columns_.emplace_back(row.GetField(i)->GetTypeId());
+    }
+  }
+  for (uint32_t i = 0; i < columns_.size(); i++) {
+    columns_[i].Append(*row.GetField(i));
+  }
+  selection_.push_back(row_ids_.size());
+  row_ids_.push_back(row.GetRowId());
+}
+
+/*
+ * The tuple starts with the field count and a bitmap with a set bit for every
+ * non-null field, the values of the non-null fields follow.
+ */
+uint32_t RowBatch::AppendSerialized(const char *buf, RowId row_id) {
+  uint32_t size = sizeof(uint32_t);
+  uint64_t not_null = MACH_READ_FROM(uint64_t, buf + size);
+  size += sizeof(uint64_t);
+  for (auto &column : columns_) {
+    size += column.AppendSerialized(buf + size, (not_null & 1) == 0);
+    not_null >>= 1;
+  }
+  selection_.push_back(row_ids_.size());
+  row_ids_.push_back(row_id);
+  return size;
+}
+
+void RowBatch::AppendRowId(RowId row_id) {
+  selection_.push_back(row_ids_.size());
+  row_ids_.push_back(row_id);
+}
+
+void RowBatch::Project(const RowBatch &source, const std::vector<uint32_t> &column_map) {
+  // the columns of the previous batch are reused for their memory
+  bool matches = columns_.size() == column_map.size();
+  for (size_t j = 0; matches && j < column_map.size(); j++) {
+    matches = columns_[j].GetTypeId() == source.columns_[column_map[j]].GetTypeId();
+  }
+  if (!matches) {
+    columns_.clear();
+    for (auto column : column_map) {
+      columns_.emplace_back(source.columns_[column].GetTypeId());
+    }
+  }
+  Reset();
+  for (auto i : source.selection_) {
+    for (size_t j = 0; j < column_map.size(); j++) {
+      columns_[j].AppendFrom(source.columns_[column_map[j]], i);
+    }
+    AppendRowId(source.row_ids_[i]);
+  }
+}
+
+void RowBatch::GetRow(uint32_t i, Row &row) const {
+  row.destroy();
+  row.SetRowId(row_ids_[i]);
+  auto &fields = row.GetFields();
+  fields.reserve(columns_.size());
+  for (const auto &column : columns_) {
+    fields.push_back(column.NewField(i));
+  }
+}
@@ -0,0 +1,56 @@
+#include "storage/bloom_filter.h"
+
+#include <algorithm>
+
+BloomFilter::BloomFilter(const std::vector<uint64_t> &hashes, size_t bits_per_key) {
+  // k = bits_per_key * ln 2 minimizes the false positive rate
+  probes_ = std::clamp<uint32_t>(static_cast<uint32_t>(bits_per_key * 69 / 100), 1, 30);
+  // a power of two blocks, so that picking the block is a mask instead of a division
+  size_t block_count = 1;
+  while (block_count * BLOCK_BITS < hashes.size() * bits_per_key) {
+    block_count <<= 1;
+  }
+  bits_.assign(block_count * BLOCK_BITS / 64, 0);
+  for (uint64_t hash : hashes) {
+    uint64_t *block = &bits_[((hash >> 32) & (block_count - 1)) * (BLOCK_BITS / 64)];
+    uint32_t probe = static_cast<uint32_t>(hash);
+    uint32_t delta = probe >> 17 | probe << 15;
+    for (uint32_t i = 0; i < probes_; i++) {
+      uint32_t bit = probe % BLOCK_BITS;
+      block[bit / 64] |= uint64_t{1} << (bit % 64);
+      probe += delta;
+    }
+  }
+}
+
+uint64_t BloomFilter::Hash(std::string_view key) {
+  // FNV-1a followed by a 64-bit finalizer so that nearby keys spread over all bits
+  uint64_t hash = 14695981039346656037ULL;
+  for (char c : key) {
+    hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+  }
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+bool BloomFilter::MayContain(uint64_t hash) const {
+  if (bits_.empty()) {
+    return false;
+  }
+  size_t block_count = bits_.size() * 64 / BLOCK_BITS;
+  const uint64_t *block = &bits_[((hash >> 32) & (block_count - 1)) * (BLOCK_BITS / 64)];
+  uint32_t probe = static_cast<uint32_t>(hash);
+  uint32_t delta = probe >> 17 | probe << 15;
+  for (uint32_t i = 0; i < probes_; i++) {
+    uint32_t bit = probe % BLOCK_BITS;
+    if ((block[bit / 64] & (uint64_t{1} << (bit % 64))) == 0) {
+      return false;
+    }
+    probe += delta;
+  }
+  return true;
+}
@@ -38,11 +38,13 @@ void DiskManager::Close() {
 }
 
 void DiskManager::ReadPage(page_id_t logical_page_id, char *page_data) {
+  std::scoped_lock<std::recursive_mutex> lock(db_io_latch_);
   ASSERT(logical_page_id >= 0, "Invalid page id.");
   ReadPhysicalPage(MapPageId(logical_page_id), page_data);
 }
 
 void DiskManager::WritePage(page_id_t logical_page_id, const char *page_data) {
+  std::scoped_lock<std::recursive_mutex> lock(db_io_latch_);
   ASSERT(logical_page_id >= 0, "Invalid page id.");
   WritePhysicalPage(MapPageId(logical_page_id), page_data);
 }
@@ -52,6 +54,7 @@ void DiskManager::WritePage(page_id_t logical_page_id, const char *page_data) {
  * TODO: Student Implement
  */
 page_id_t DiskManager::AllocatePage() {
+  std::scoped_lock<std::recursive_mutex> lock(db_io_latch_);
   DiskFileMetaPage *meta_page_ = reinterpret_cast<DiskFileMetaPage *>(meta_data_); // 获取元数据页
   bool flag = false;
   uint32_t extent_id;
@@ -95,6 +98,7 @@ page_id_t DiskManager::AllocatePage() {
  * TODO: Student Implement
  */
 void DiskManager::DeAllocatePage(page_id_t logical_page_id) {
+  std::scoped_lock<std::recursive_mutex> lock(db_io_latch_);
   if (IsPageFree(logical_page_id)) {
     // 已经空了
     return;
@@ -103,6 +107,7 @@ void DiskManager::DeAllocatePage(page_id_t logical_page_id) {
   ReadPhysicalPage(1 + logical_page_id / BITMAP_SIZE * (BITMAP_SIZE + 1), bitmap_page_data);
   BitmapPage<PAGE_SIZE> *bitmap_page = reinterpret_cast<BitmapPage<PAGE_SIZE> *>(bitmap_page_data); // 获取对应bitmap
   bitmap_page->DeAllocatePage(logical_page_id % BITMAP_SIZE); // 释放该页
+  WritePhysicalPage(1 + logical_page_id / BITMAP_SIZE * (BITMAP_SIZE + 1), bitmap_page_data); // 写回bitmap
   DiskFileMetaPage *meta_page = reinterpret_cast<DiskFileMetaPage *>(meta_data_);
   meta_page->num_allocated_pages_ -= 1; // 更新已分配页数
   meta_page->extent_used_page_[logical_page_id / BITMAP_SIZE] -= 1;
@@ -113,6 +118,7 @@ void DiskManager::DeAllocatePage(page_id_t logical_page_id) {
  * TODO: Student Implement
  */
 bool DiskManager::IsPageFree(page_id_t logical_page_id) {
+  std::scoped_lock<std::recursive_mutex> lock(db_io_latch_);
   char bitmap_page_data[PAGE_SIZE];
   page_id_t bimap_page_id = 1 + logical_page_id / BITMAP_SIZE * (BITMAP_SIZE + 1); // 获取bitmap物理页号
   ReadPhysicalPage(bimap_page_id, bitmap_page_data); // 读入bitmap数据
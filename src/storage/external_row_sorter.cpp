@@ -0,0 +1,118 @@
+#include "storage/external_row_sorter.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+ExternalRowSorter::ExternalRowSorter(const Schema *schema, Compare compare, size_t memory_limit)
+    : schema_(const_cast<Schema *>(schema)), compare_(std::move(compare)), memory_limit_(memory_limit) {}
+
+ExternalRowSorter::~ExternalRowSorter() {
+  for (auto &run : runs_) {
+    fclose(run.file);
+  }
+}
+
+void ExternalRowSorter::Add(const Row &row) {
+  ASSERT(!finished_, "Add after Finish.");
+  // the serialized size stands for the fields, plus the Row and the Field objects holding them
+  size_t bytes = row.GetSerializedSize(schema_) + sizeof(Row) + row.GetFieldCount() * (sizeof(Field) + sizeof(void *));
+  if (!buffer_.empty() && buffer_bytes_ + bytes > memory_limit_) {
+    SpillRun();
+  }
+  buffer_.push_back(row);
+  buffer_bytes_ += bytes;
+}
+
+void ExternalRowSorter::Finish() {
+  ASSERT(!finished_, "Finish called twice.");
+  finished_ = true;
+  if (runs_.empty()) {
+    SortBuffer();
+    return;
+  }
+  if (!buffer_.empty()) {
+    SpillRun();
+  }
+  std::vector<Row>().swap(buffer_);
+  for (size_t i = 0; i < runs_.size(); i++) {
+    rewind(runs_[i].file);
+    if (Refill(runs_[i])) {
+      heap_.push(i);
+    }
+  }
+}
+
+bool ExternalRowSorter::Next(Row &row) {
+  ASSERT(finished_, "Next called before Finish.");
+  if (runs_.empty()) {
+    if (read_pos_ >= order_.size()) {
+      return false;
+    }
+    // hand the fields over instead of copying them, every row is returned once
+    Row &source = buffer_[order_[read_pos_++]];
+    row.destroy();
+    row.SetRowId(source.GetRowId());
+    row.GetFields().swap(source.GetFields());
+    return true;
+  }
+  if (heap_.empty()) {
+    return false;
+  }
+  size_t i = heap_.top();
+  heap_.pop();
+  Run &run = runs_[i];
+  row.destroy();
+  row.SetRowId(run.head.GetRowId());
+  row.GetFields().swap(run.head.GetFields());
+  if (Refill(run)) {
+    heap_.push(i);
+  }
+  return true;
+}
+
+/*
+ * Rows are sorted through their positions, moving a Row copies all of its
+ * fields.
+ */
+void ExternalRowSorter::SortBuffer() {
+  order_.resize(buffer_.size());
+  std::iota(order_.begin(), order_.end(), 0);
+  std::sort(order_.begin(), order_.end(), [this](uint32_t a, uint32_t b) { return compare_(buffer_[a], buffer_[b]); });
+  read_pos_ = 0;
+}
+
+void ExternalRowSorter::SpillRun() {
+  SortBuffer();
+  FILE *file = tmpfile();
+  if (file == nullptr) {
+    throw std::runtime_error("failed to create sort run file");
+  }
+  runs_.push_back(Run{file, Row()});
+  for (auto i : order_) {
+    uint32_t size = buffer_[i].GetSerializedSize(schema_);
+    io_buffer_.resize(sizeof(uint32_t) + size);
+    MACH_WRITE_UINT32(io_buffer_.data(), size);
+    buffer_[i].SerializeTo(io_buffer_.data() + sizeof(uint32_t), schema_);
+    if (fwrite(io_buffer_.data(), 1, io_buffer_.size(), file) != io_buffer_.size()) {
+      throw std::runtime_error("failed to write sort run file");
+    }
+  }
+  buffer_.clear();
+  order_.clear();
+  buffer_bytes_ = 0;
+}
+
+bool ExternalRowSorter::Refill(Run &run) {
+  uint32_t size;
+  if (fread(&size, sizeof(uint32_t), 1, run.file) != 1) {
+    return false;
+  }
+  io_buffer_.resize(size);
+  if (fread(io_buffer_.data(), 1, size, run.file) != size) {
+    throw std::runtime_error("failed to read sort run file");
+  }
+  run.head.destroy();
+  run.head.DeserializeFrom(io_buffer_.data(), schema_);
+  return true;
+}
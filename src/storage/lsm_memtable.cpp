@@ -0,0 +1,127 @@
+#include "storage/lsm_memtable.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+LsmMemTable::LsmMemTable() : head_(NewNode(MAX_HEIGHT, std::string())) {}
+
+LsmMemTable::~LsmMemTable() {
+  // the arena frees the memory, only the entries own anything
+  Node *node = head_;
+  while (node != nullptr) {
+    Node *next = node->next[0];
+    node->entry->~Entry();
+    node = next;
+  }
+}
+
+LsmMemTable::Node *LsmMemTable::NewNode(int height, const std::string &key) {
+  // the next pointers of the upper levels live right after the node, the entry after them
+  size_t node_size = sizeof(Node) + sizeof(Node *) * (height - 1);
+  size_t size = node_size + sizeof(Entry);
+  if (arena_used_ + size > ARENA_BLOCK_SIZE) {
+    arena_.emplace_back(new char[ARENA_BLOCK_SIZE]);
+    arena_used_ = 0;
+  }
+  char *buf = arena_.back().get() + arena_used_;
+  arena_used_ += (size + alignof(Entry) - 1) / alignof(Entry) * alignof(Entry);
+  Node *node = reinterpret_cast<Node *>(buf);
+  node->prefix = KeyPrefix(key);
+  node->entry = new (buf + node_size) Entry();
+  node->entry->key = key;
+  for (int i = 0; i < height; i++) {
+    node->next[i] = nullptr;
+  }
+  return node;
+}
+
+uint64_t LsmMemTable::KeyPrefix(const std::string &key) {
+  uint64_t prefix = 0;
+  for (size_t i = 0; i < 8; i++) {
+    prefix = prefix << 8 | (i < key.size() ? static_cast<uint8_t>(key[i]) : 0);
+  }
+  return prefix;
+}
+
+int LsmMemTable::Compare(const Node *node, const std::string &key, uint64_t prefix) {
+  if (node->prefix != prefix) {
+    return node->prefix < prefix ? -1 : 1;
+  }
+  // equal prefixes may still differ in the later bytes or in length
+  return node->entry->key.compare(key);
+}
+
+int LsmMemTable::RandomHeight() {
+  // every level holds about a quarter of the nodes of the level below
+  int height = 1;
+  while (height < MAX_HEIGHT && (rng_() & 3) == 0) {
+    height++;
+  }
+  return height;
+}
+
+LsmMemTable::Node *LsmMemTable::FindPredecessors(const std::string &key, bool inclusive, Node **prev) const {
+  uint64_t prefix = KeyPrefix(key);
+  Node *node = head_;
+  for (int level = height_ - 1; level >= 0; level--) {
+    while (node->next[level] != nullptr) {
+      int cmp = Compare(node->next[level], key, prefix);
+      if (cmp > 0 || (cmp == 0 && inclusive)) {
+        break;
+      }
+      node = node->next[level];
+    }
+    if (prev != nullptr) {
+      prev[level] = node;
+    }
+  }
+  return node;
+}
+
+void LsmMemTable::Put(const std::string &key, int64_t value, bool deleted) {
+  Splice splice;
+  Entry *entry = Find(key, splice);
+  if (entry != nullptr) {
+    entry->value = value;
+    entry->deleted = deleted;
+    return;
+  }
+  Insert(splice, key, value, deleted);
+}
+
+LsmMemTable::Entry *LsmMemTable::Find(const std::string &key, Splice &splice) {
+  Node *node = FindPredecessors(key, true, splice.prev_)->next[0];
+  if (node != nullptr && node->entry->key == key) {
+    return node->entry;
+  }
+  return nullptr;
+}
+
+void LsmMemTable::Insert(const Splice &splice, const std::string &key, int64_t value, bool deleted) {
+  int height = RandomHeight();
+  Node *node = NewNode(height, key);
+  node->entry->value = value;
+  node->entry->deleted = deleted;
+  for (int level = 0; level < height; level++) {
+    // levels above the current height start at the head
+    Node *prev = level < height_ ? splice.prev_[level] : head_;
+    node->next[level] = prev->next[level];
+    prev->next[level] = node;
+  }
+  height_ = std::max(height_, height);
+  size_++;
+  bytes_ += sizeof(Node) + sizeof(Node *) * (height - 1) + sizeof(Entry) + key.size();
+}
+
+const LsmMemTable::Entry *LsmMemTable::Get(const std::string &key) const {
+  Node *node = FindPredecessors(key, true, nullptr)->next[0];
+  if (node != nullptr && node->entry->key == key) {
+    return node->entry;
+  }
+  return nullptr;
+}
+
+LsmMemTable::Iterator LsmMemTable::Seek(const std::string &key, bool inclusive) const {
+  return Iterator(FindPredecessors(key, inclusive, nullptr)->next[0]);
+}
@@ -0,0 +1,517 @@
+#include "storage/lsm_tree.h"
+
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+
+#include "glog/logging.h"
+#include "page/index_roots_page.h"
+
+LsmTree::LsmTree(index_id_t index_id, BufferPoolManager *buffer_pool_manager)
+    : index_id_(index_id), buffer_pool_manager_(buffer_pool_manager), memtable_(std::make_unique<LsmMemTable>()) {
+  Page *roots_page = buffer_pool_manager_->FetchPage(INDEX_ROOTS_PAGE_ID);
+  roots_page->RLatch();
+  if (!reinterpret_cast<IndexRootsPage *>(roots_page->GetData())->GetRootId(index_id_, &manifest_page_id_)) {
+    manifest_page_id_ = INVALID_PAGE_ID;
+  }
+  roots_page->RUnlatch();
+  buffer_pool_manager_->UnpinPage(INDEX_ROOTS_PAGE_ID, false);
+  if (manifest_page_id_ != INVALID_PAGE_ID) {
+    auto *manifest = reinterpret_cast<LsmManifestPage *>(buffer_pool_manager_->FetchPage(manifest_page_id_)->GetData());
+    for (int i = 0; i < manifest->GetRunCount(); i++) {
+      uint32_t level = manifest->GetLevel(i);
+      if (levels_.size() <= level) {
+        levels_.resize(level + 1);
+      }
+      levels_[level].push_back(LoadRun(manifest->GetFirstPageId(i)));
+    }
+    buffer_pool_manager_->UnpinPage(manifest_page_id_, false);
+  }
+  StartBackground();
+}
+
+LsmTree::~LsmTree() {
+  StopBackground();
+  if (memtable_->GetSize() > 0) {
+    immutable_ = std::move(memtable_);
+    memtable_ = std::make_unique<LsmMemTable>();
+    FlushImmutable();
+  }
+}
+
+void LsmTree::StartBackground() {
+  stop_ = false;
+  flush_thread_ = std::thread(&LsmTree::FlushWork, this);
+  compaction_thread_ = std::thread(&LsmTree::CompactionWork, this);
+}
+
+void LsmTree::StopBackground() {
+  {
+    std::unique_lock<std::shared_mutex> guard(latch_);
+    stop_ = true;
+  }
+  work_cv_.notify_all();
+  flush_thread_.join();
+  compaction_thread_.join();
+}
+
+void LsmTree::UpdateRootPageId(bool insert_record) {
+  Page *roots_page = buffer_pool_manager_->FetchPage(INDEX_ROOTS_PAGE_ID);
+  auto *roots = reinterpret_cast<IndexRootsPage *>(roots_page->GetData());
+  roots_page->WLatch();
+  if (insert_record) {
+    roots->Insert(index_id_, manifest_page_id_);
+  } else {
+    roots->Delete(index_id_);
+  }
+  roots_page->WUnlatch();
+  buffer_pool_manager_->UnpinPage(INDEX_ROOTS_PAGE_ID, true);
+}
+
+/*****************************************************************************
+ * RUNS
+ *****************************************************************************/
+void LsmTree::RunIterator::LoadPage(size_t page_index) {
+  page_index_ = page_index;
+  entries_.clear();
+  pos_ = 0;
+  if (page_index >= run_->pages.size()) {
+    return;
+  }
+  page_id_t page_id = run_->pages[page_index];
+  reinterpret_cast<LsmRunPage *>(buffer_pool_manager_->FetchPage(page_id)->GetData())->Decode(entries_);
+  buffer_pool_manager_->UnpinPage(page_id, false);
+}
+
+void LsmTree::RunIterator::SeekToFirst() { LoadPage(0); }
+
+void LsmTree::RunIterator::Seek(const std::string &key, bool inclusive) {
+  auto fence = std::upper_bound(run_->fences.begin(), run_->fences.end(), key);
+  LoadPage(fence == run_->fences.begin() ? 0 : fence - run_->fences.begin() - 1);
+  while (pos_ < entries_.size()) {
+    int cmp = entries_[pos_].key.compare(key);
+    if (cmp > 0 || (cmp == 0 && inclusive)) {
+      return;
+    }
+    pos_++;
+  }
+  // every key of the next page is greater than key
+  LoadPage(page_index_ + 1);
+}
+
+void LsmTree::RunIterator::Next() {
+  pos_++;
+  if (pos_ >= entries_.size() && page_index_ + 1 < run_->pages.size()) {
+    LoadPage(page_index_ + 1);
+  }
+}
+
+/*
+ * Pages are allocated as the run grows and linked to the previous one, the
+ * run is written front to back exactly once.
+ */
+void LsmTree::RunWriter::Append(const Entry &entry) {
+  if (page_ == nullptr || !page_->Append(entry.key, entry.value, entry.deleted)) {
+    page_id_t page_id;
+    Page *page = buffer_pool_manager_->NewPage(page_id);
+    if (page == nullptr) {
+      throw std::runtime_error("out of memory");
+    }
+    auto *new_page = reinterpret_cast<LsmRunPage *>(page->GetData());
+    new_page->Init();
+    if (page_ != nullptr) {
+      page_->SetNextPageId(page_id);
+      buffer_pool_manager_->UnpinPage(run_->pages.back(), true);
+    }
+    page_ = new_page;
+    page_->Append(entry.key, entry.value, entry.deleted);
+    run_->pages.push_back(page_id);
+    run_->fences.push_back(entry.key);
+  }
+  hashes_.push_back(BloomFilter::Hash(entry.key));
+  run_->max_key = entry.key;
+  run_->entries++;
+}
+
+std::shared_ptr<LsmTree::Run> LsmTree::RunWriter::Finish() {
+  if (page_ == nullptr) {
+    return nullptr;
+  }
+  buffer_pool_manager_->UnpinPage(run_->pages.back(), true);
+  page_ = nullptr;
+  run_->bloom = BloomFilter(hashes_, LSM_BLOOM_BITS_PER_KEY);
+  return run_;
+}
+
+std::shared_ptr<LsmTree::Run> LsmTree::LoadRun(page_id_t first_page_id) {
+  auto run = std::make_shared<Run>();
+  std::vector<uint64_t> hashes;
+  std::vector<Entry> entries;
+  page_id_t page_id = first_page_id;
+  while (page_id != INVALID_PAGE_ID) {
+    auto *page = reinterpret_cast<LsmRunPage *>(buffer_pool_manager_->FetchPage(page_id)->GetData());
+    entries.clear();
+    page->Decode(entries);
+    run->pages.push_back(page_id);
+    run->fences.push_back(entries.front().key);
+    for (const auto &entry : entries) {
+      hashes.push_back(BloomFilter::Hash(entry.key));
+    }
+    run->max_key = entries.back().key;
+    run->entries += entries.size();
+    page_id_t next_page_id = page->GetNextPageId();
+    buffer_pool_manager_->UnpinPage(page_id, false);
+    page_id = next_page_id;
+  }
+  run->bloom = BloomFilter(hashes, LSM_BLOOM_BITS_PER_KEY);
+  return run;
+}
+
+void LsmTree::DeleteRun(const Run &run) {
+  for (page_id_t page_id : run.pages) {
+    buffer_pool_manager_->DeletePage(page_id);
+  }
+}
+
+void LsmTree::SaveManifest() {
+  if (manifest_page_id_ == INVALID_PAGE_ID) {
+    Page *page = buffer_pool_manager_->NewPage(manifest_page_id_);
+    if (page == nullptr) {
+      throw std::runtime_error("out of memory");
+    }
+    buffer_pool_manager_->UnpinPage(manifest_page_id_, true);
+    UpdateRootPageId(true);
+  }
+  auto *manifest = reinterpret_cast<LsmManifestPage *>(buffer_pool_manager_->FetchPage(manifest_page_id_)->GetData());
+  manifest->Init();
+  for (uint32_t level = 0; level < levels_.size(); level++) {
+    for (const auto &run : levels_[level]) {
+      if (!manifest->AddRun(level, run->pages.front())) {
+        LOG(ERROR) << "Too many runs in the LSM manifest";
+      }
+    }
+  }
+  buffer_pool_manager_->UnpinPage(manifest_page_id_, true);
+}
+
+/*****************************************************************************
+ * SEARCH
+ *****************************************************************************/
+bool LsmTree::FindInRun(const Run &run, const std::string &key, uint64_t hash, Entry &entry) {
+  if (key < run.fences.front() || key > run.max_key) {
+    return false;
+  }
+  if (!run.bloom.MayContain(hash)) {
+    bloom_skips_++;
+    return false;
+  }
+  auto fence = std::upper_bound(run.fences.begin(), run.fences.end(), key);
+  page_id_t page_id = run.pages[fence - run.fences.begin() - 1];
+  auto *page = reinterpret_cast<LsmRunPage *>(buffer_pool_manager_->FetchPage(page_id)->GetData());
+  bool found = page->Find(key, entry.value, entry.deleted);
+  buffer_pool_manager_->UnpinPage(page_id, false);
+  if (found) {
+    entry.key = key;
+  }
+  return found;
+}
+
+bool LsmTree::Find(const std::string &key, Entry &entry, bool skip_memtable) {
+  for (const LsmMemTable *memtable : {skip_memtable ? nullptr : memtable_.get(), immutable_.get()}) {
+    const Entry *found = memtable == nullptr ? nullptr : memtable->Get(key);
+    if (found != nullptr) {
+      entry = *found;
+      return true;
+    }
+  }
+  uint64_t hash = BloomFilter::Hash(key);
+  for (const auto &level : levels_) {
+    for (const auto &run : level) {
+      if (FindInRun(*run, key, hash, entry)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+bool LsmTree::GetValue(const std::string &key, RowId &value) {
+  std::shared_lock<std::shared_mutex> guard(latch_);
+  Entry entry;
+  if (!Find(key, entry) || entry.deleted) {
+    return false;
+  }
+  value = RowId(entry.value);
+  return true;
+}
+
+bool LsmTree::NextMerged(std::vector<Source> &sources, Entry &entry) {
+  const Source *newest = nullptr;
+  for (const auto &source : sources) {
+    if (source.Valid() && (newest == nullptr || source.Get().key < newest->Get().key)) {
+      newest = &source;
+    }
+  }
+  if (newest == nullptr) {
+    return false;
+  }
+  entry = newest->Get();
+  for (auto &source : sources) {
+    if (source.Valid() && source.Get().key == entry.key) {
+      source.Next();
+    }
+  }
+  return true;
+}
+
+void LsmTree::Scan(const std::string &from, bool inclusive, size_t max_count, std::vector<Entry> &entries) {
+  std::shared_lock<std::shared_mutex> guard(latch_);
+  std::vector<Source> sources;
+  for (const LsmMemTable *memtable : {memtable_.get(), immutable_.get()}) {
+    if (memtable != nullptr) {
+      sources.emplace_back();
+      sources.back().mem = memtable->Seek(from, inclusive);
+    }
+  }
+  for (const auto &level : levels_) {
+    for (const auto &run : level) {
+      if (run->max_key < from || (run->max_key == from && !inclusive)) {
+        continue;
+      }
+      sources.emplace_back();
+      sources.back().run = std::make_unique<RunIterator>(buffer_pool_manager_, run.get());
+      sources.back().run->Seek(from, inclusive);
+    }
+  }
+  Entry entry;
+  size_t count = 0;
+  while (count < max_count && NextMerged(sources, entry)) {
+    if (!entry.deleted) {
+      entries.push_back(std::move(entry));
+      count++;
+    }
+  }
+}
+
+/*****************************************************************************
+ * INSERTION & REMOVE
+ *****************************************************************************/
+bool LsmTree::Insert(const std::string &key, const RowId &value) {
+  if (key.size() > MAX_KEY_SIZE) {
+    return false;
+  }
+  std::unique_lock<std::shared_mutex> guard(latch_);
+  LsmMemTable::Splice splice;
+  Entry *current = memtable_->Find(key, splice);
+  if (current != nullptr) {
+    if (!current->deleted) {
+      return false;
+    }
+    current->value = value.Get();
+    current->deleted = false;
+    return true;
+  }
+  Entry entry;
+  if (Find(key, entry, true) && !entry.deleted) {
+    return false;
+  }
+  memtable_->Insert(splice, key, value.Get(), false);
+  if (memtable_->GetApproximateBytes() >= LSM_MEMTABLE_SIZE) {
+    RotateMemTable(guard);
+  }
+  return true;
+}
+
+bool LsmTree::Remove(const std::string &key) {
+  std::unique_lock<std::shared_mutex> guard(latch_);
+  Entry entry;
+  if (!Find(key, entry) || entry.deleted) {
+    return false;
+  }
+  memtable_->Put(key, 0, true);
+  if (memtable_->GetApproximateBytes() >= LSM_MEMTABLE_SIZE) {
+    RotateMemTable(guard);
+  }
+  return true;
+}
+
+void LsmTree::RotateMemTable(std::unique_lock<std::shared_mutex> &guard) {
+  done_cv_.wait(guard, [this] {
+    return immutable_ == nullptr && (levels_.empty() || levels_[0].size() < LSM_L0_STOP_WRITES_TRIGGER);
+  });
+  immutable_ = std::move(memtable_);
+  memtable_ = std::make_unique<LsmMemTable>();
+  work_cv_.notify_all();
+}
+
+void LsmTree::Flush() {
+  std::unique_lock<std::shared_mutex> guard(latch_);
+  if (memtable_->GetSize() > 0) {
+    RotateMemTable(guard);
+  }
+  done_cv_.wait(guard, [this] { return immutable_ == nullptr && !compacting_ && PickCompaction() < 0; });
+}
+
+/*****************************************************************************
+ * FLUSH & COMPACTION
+ *****************************************************************************/
+void LsmTree::FlushWork() {
+  std::unique_lock<std::shared_mutex> guard(latch_);
+  while (true) {
+    work_cv_.wait(guard, [this] { return stop_ || immutable_ != nullptr; });
+    if (immutable_ == nullptr) {
+      return;
+    }
+    // only this thread clears immutable_, it stays readable while the run is written
+    guard.unlock();
+    FlushImmutable();
+    guard.lock();
+  }
+}
+
+void LsmTree::CompactionWork() {
+  std::unique_lock<std::shared_mutex> guard(latch_);
+  while (true) {
+    work_cv_.wait(guard, [this] { return stop_ || PickCompaction() >= 0; });
+    if (stop_) {
+      return;
+    }
+    compacting_ = true;
+    Compact(PickCompaction(), guard);
+    compacting_ = false;
+    done_cv_.notify_all();
+  }
+}
+
+int LsmTree::PickCompaction() const {
+  if (!levels_.empty() && levels_[0].size() >= LSM_L0_COMPACTION_TRIGGER) {
+    return 0;
+  }
+  size_t max_size = LSM_LEVEL1_SIZE;
+  for (size_t level = 1; level < levels_.size(); level++) {
+    if (!levels_[level].empty() && levels_[level][0]->pages.size() * PAGE_SIZE > max_size) {
+      return static_cast<int>(level);
+    }
+    max_size *= LSM_LEVEL_SIZE_RATIO;
+  }
+  return -1;
+}
+
+void LsmTree::FlushImmutable() {
+  RunWriter writer(buffer_pool_manager_);
+  for (auto iter = immutable_->Begin(); iter.Valid(); iter.Next()) {
+    writer.Append(*iter);
+  }
+  auto run = writer.Finish();
+  std::unique_lock<std::shared_mutex> guard(latch_);
+  if (run != nullptr) {
+    if (levels_.empty()) {
+      levels_.resize(1);
+    }
+    levels_[0].insert(levels_[0].begin(), run);
+    SaveManifest();
+  }
+  immutable_.reset();
+  flushes_++;
+  done_cv_.notify_all();
+  // level 0 may need a compaction now
+  work_cv_.notify_all();
+}
+
+/*
+ * Merge every run of level with the run of the next level into a new run of
+ * the next level. Tombstones are dropped when no deeper level is left for
+ * them to hide keys in. Levels below 1 are only changed by this thread, level 0
+ * may get new runs from flushes while the merge runs without the latch.
+ */
+void LsmTree::Compact(int level, std::unique_lock<std::shared_mutex> &guard) {
+  std::vector<std::shared_ptr<Run>> inputs = levels_[level];
+  size_t output_level = level + 1;
+  if (output_level < levels_.size()) {
+    inputs.insert(inputs.end(), levels_[output_level].begin(), levels_[output_level].end());
+  }
+  bool bottom = true;
+  for (size_t i = output_level + 1; i < levels_.size(); i++) {
+    bottom = bottom && levels_[i].empty();
+  }
+  guard.unlock();
+  std::vector<Source> sources(inputs.size());
+  for (size_t i = 0; i < inputs.size(); i++) {
+    sources[i].run = std::make_unique<RunIterator>(buffer_pool_manager_, inputs[i].get());
+    sources[i].run->SeekToFirst();
+  }
+  RunWriter writer(buffer_pool_manager_);
+  Entry entry;
+  while (NextMerged(sources, entry)) {
+    if (!entry.deleted || !bottom) {
+      writer.Append(entry);
+    }
+  }
+  sources.clear();
+  auto run = writer.Finish();
+  guard.lock();
+  if (levels_.size() <= output_level) {
+    levels_.resize(output_level + 1);
+  }
+  auto &runs = levels_[level];
+  for (const auto &input : inputs) {
+    runs.erase(std::remove(runs.begin(), runs.end(), input), runs.end());
+  }
+  levels_[output_level].clear();
+  if (run != nullptr) {
+    levels_[output_level].push_back(run);
+  }
+  SaveManifest();
+  compactions_++;
+  // readers of the inputs held latch_ shared and are gone
+  guard.unlock();
+  for (const auto &input : inputs) {
+    DeleteRun(*input);
+  }
+  guard.lock();
+}
+
+/*****************************************************************************
+ * UTILITIES
+ *****************************************************************************/
+LsmTree::Stats LsmTree::GetStats() {
+  std::shared_lock<std::shared_mutex> guard(latch_);
+  Stats stats;
+  stats.memtable_entries = memtable_->GetSize() + (immutable_ == nullptr ? 0 : immutable_->GetSize());
+  for (const auto &level : levels_) {
+    stats.level_runs.push_back(level.size());
+    uint64_t entries = 0;
+    uint64_t pages = 0;
+    for (const auto &run : level) {
+      entries += run->entries;
+      pages += run->pages.size();
+      stats.bloom_bytes += run->bloom.GetMemoryBytes();
+    }
+    stats.level_entries.push_back(entries);
+    stats.level_pages.push_back(pages);
+  }
+  stats.flushes = flushes_;
+  stats.compactions = compactions_;
+  stats.bloom_skips = bloom_skips_;
+  return stats;
+}
+
+void LsmTree::Destroy() {
+  StopBackground();
+  {
+    std::unique_lock<std::shared_mutex> guard(latch_);
+    for (const auto &level : levels_) {
+      for (const auto &run : level) {
+        DeleteRun(*run);
+      }
+    }
+    levels_.clear();
+    memtable_ = std::make_unique<LsmMemTable>();
+    if (manifest_page_id_ != INVALID_PAGE_ID) {
+      buffer_pool_manager_->DeletePage(manifest_page_id_);
+      manifest_page_id_ = INVALID_PAGE_ID;
+      UpdateRootPageId(false);
+    }
+  }
+  StartBackground();
+}
@@ -0,0 +1,92 @@
+#include "storage/row_id_bitmap.h"
+
+void RowIdBitmap::Add(const RowId &rid) {
+  auto &words = pages_[rid.GetPageId()];
+  uint32_t word = rid.GetSlotNum() / 64;
+  if (word >= words.size()) {
+    words.resize(word + 1, 0);
+  }
+  words[word] |= 1ULL << (rid.GetSlotNum() % 64);
+}
+
+bool RowIdBitmap::Contains(const RowId &rid) const {
+  auto iter = pages_.find(rid.GetPageId());
+  if (iter == pages_.end()) {
+    return false;
+  }
+  uint32_t word = rid.GetSlotNum() / 64;
+  return word < iter->second.size() && (iter->second[word] >> (rid.GetSlotNum() % 64) & 1);
+}
+
+/*
+ * Both maps are ordered by page id, so they are walked side by side.
+ */
+void RowIdBitmap::Intersect(const RowIdBitmap &other) {
+  auto iter = pages_.begin();
+  auto other_iter = other.pages_.begin();
+  while (iter != pages_.end()) {
+    while (other_iter != other.pages_.end() && other_iter->first < iter->first) {
+      ++other_iter;
+    }
+    if (other_iter == other.pages_.end() || other_iter->first != iter->first) {
+      iter = pages_.erase(iter);
+      continue;
+    }
+    auto &words = iter->second;
+    const auto &other_words = other_iter->second;
+    if (words.size() > other_words.size()) {
+      words.resize(other_words.size());
+    }
+    bool any = false;
+    for (size_t i = 0; i < words.size(); i++) {
+      words[i] &= other_words[i];
+      any = any || words[i] != 0;
+    }
+    iter = any ? std::next(iter) : pages_.erase(iter);
+  }
+}
+
+void RowIdBitmap::Union(const RowIdBitmap &other) {
+  for (const auto &page : other.pages_) {
+    auto &words = pages_[page.first];
+    if (words.size() < page.second.size()) {
+      words.resize(page.second.size(), 0);
+    }
+    for (size_t i = 0; i < page.second.size(); i++) {
+      words[i] |= page.second[i];
+    }
+  }
+}
+
+size_t RowIdBitmap::Size() const {
+  size_t size = 0;
+  for (const auto &page : pages_) {
+    for (auto word : page.second) {
+      size += __builtin_popcountll(word);
+    }
+  }
+  return size;
+}
+
+void RowIdBitmap::DecodeSlots(const std::vector<uint64_t> &words, std::vector<uint32_t> &slots) {
+  for (size_t i = 0; i < words.size(); i++) {
+    uint64_t word = words[i];
+    while (word != 0) {
+      slots.push_back(static_cast<uint32_t>(i * 64 + __builtin_ctzll(word)));
+      word &= word - 1;
+    }
+  }
+}
+
+std::vector<RowId> RowIdBitmap::ToRowIds() const {
+  std::vector<RowId> row_ids;
+  std::vector<uint32_t> slots;
+  for (const auto &page : pages_) {
+    slots.clear();
+    DecodeSlots(page.second, slots);
+    for (auto slot : slots) {
+      row_ids.emplace_back(page.first, slot);
+    }
+  }
+  return row_ids;
+}
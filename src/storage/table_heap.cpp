@@ -128,6 +128,44 @@ bool TableHeap::GetTuple(Row *row, Txn *txn) {
   return result;
 }
 
+void TableHeap::GetTuples(page_id_t page_id, const std::vector<uint32_t> &slots, std::vector<Row> &rows, Txn *txn) {
+  auto page = reinterpret_cast<TablePage *>(buffer_pool_manager_->FetchPage(page_id));
+  if (page == nullptr) {
+    return;
+  }
+  rows.reserve(rows.size() + slots.size());
+  page->RLatch();
+  for (auto slot : slots) {
+    rows.emplace_back(RowId(page_id, slot));
+    if (!page->GetTuple(&rows.back(), schema_, txn, lock_manager_)) {
+      rows.pop_back();
+    }
+  }
+  page->RUnlatch();
+  buffer_pool_manager_->UnpinPage(page_id, false);
+}
+
+bool TableHeap::ScanBatch(RowId &position, RowBatch &batch, Txn *txn) {
+  if (position.GetPageId() == INVALID_PAGE_ID) {
+    return false;
+  }
+  while (position.GetPageId() != INVALID_PAGE_ID && !batch.IsFull()) {
+    page_id_t page_id = position.GetPageId();
+    auto page = reinterpret_cast<TablePage *>(buffer_pool_manager_->FetchPage(page_id));
+    if (page == nullptr) {
+      position.Set(INVALID_PAGE_ID, 0);
+      break;
+    }
+    page->RLatch();
+    uint32_t slot_num = page->GetTuples(position.GetSlotNum(), batch);
+    // the page is read to its end unless the batch filled up first
+    position.Set(batch.IsFull() ? page_id : page->GetNextPageId(), batch.IsFull() ? slot_num : 0);
+    page->RUnlatch();
+    buffer_pool_manager_->UnpinPage(page_id, false);
+  }
+  return true;
+}
+
 void TableHeap::DeleteTable(page_id_t page_id) {
   if (page_id != INVALID_PAGE_ID) {
     auto temp_table_page = reinterpret_cast<TablePage *>(buffer_pool_manager_->FetchPage(page_id));  // 删除table_heap
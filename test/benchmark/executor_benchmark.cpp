@@ -0,0 +1,51 @@
+#include <chrono>
+#include <iostream>
+
+#include "../execution/executor_test_util.h"  // NOLINT
+#include "executor/executors/seq_scan_executor.h"
+#include "executor/plans/seq_scan_plan.h"
+
+// SELECT id FROM table-1 WHERE id < n / 2 AND account > 0, row at a time and batched
+TEST_F(ExecutorTest, BatchScanBenchmark) {
+  TableInfo *table_info;
+  GetExecutorContext()->GetCatalog()->GetTable("table-1", table_info);
+  const Schema *schema = table_info->GetSchema();
+  const int n = 50000;
+  for (int i = 1000; i < n; i++) {
+    std::vector<Field> fields{Field(kTypeInt, i), Field(kTypeChar, const_cast<char *>("name"), 4, true),
+                              Field(kTypeFloat, RandomUtils::RandomFloat(-999.f, 999.f))};
+    Row row(fields);
+    ASSERT_TRUE(table_info->GetTableHeap()->InsertTuple(row, GetTxn()));
+  }
+  auto col_id = MakeColumnValueExpression(*schema, 0, "id");
+  auto col_account = MakeColumnValueExpression(*schema, 0, "account");
+  auto predicate = std::make_shared<LogicExpression>(
+      MakeComparisonExpression(col_id, MakeConstantValueExpression(Field(kTypeInt, n / 2)), "<"),
+      MakeComparisonExpression(col_account, MakeConstantValueExpression(Field(kTypeFloat, 0.f)), ">"), LogicType::And);
+  auto plan =
+      std::make_shared<SeqScanPlanNode>(MakeOutputSchema({{"id", col_id}}), table_info->GetTableName(), predicate);
+
+  SeqScanExecutor row_executor(GetExecutorContext(), plan.get());
+  auto start = std::chrono::steady_clock::now();
+  row_executor.Init();
+  size_t row_count = 0;
+  Row row;
+  RowId rid;
+  while (row_executor.Next(&row, &rid)) {
+    row_count++;
+  }
+  auto row_cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  SeqScanExecutor batch_executor(GetExecutorContext(), plan.get());
+  start = std::chrono::steady_clock::now();
+  batch_executor.Init();
+  size_t batch_count = 0;
+  RowBatch batch;
+  while (batch_executor.NextBatch(batch)) {
+    batch_count += batch.GetSelection().size();
+  }
+  auto batch_cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  ASSERT_EQ(row_count, batch_count);
+  std::cout << "filtered scan of " << n << " rows: row at a time " << row_cost << " s, batched " << batch_cost << " s"
+            << std::endl;
+}
@@ -0,0 +1,48 @@
+#include <chrono>
+#include <iostream>
+
+#include "common/instance.h"
+#include "gtest/gtest.h"
+#include "index/extendible_hash_index.h"
+#include "index/typed_b_plus_tree_index.h"
+#include "utils/utils.h"
+
+static const std::string db_name = "extendible_hash_index_benchmark.db";
+
+TEST(ExtendibleHashIndexTest, PointLookupBenchmark) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("id", TypeId::kTypeInt, 0, false, false)};
+  std::vector<uint32_t> index_key_map{0};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  const int n = 200000;
+  std::vector<int32_t> keys;
+  for (int i = 0; i < n; i++) {
+    keys.push_back(i);
+  }
+  ShuffleArray(keys);
+  auto hash_index = std::make_unique<ExtendibleHashIndex>(0, index_schema, 16, engine.bpm_);
+  auto tree_index =
+      std::make_unique<TypedBPlusTreeIndex<int32_t, BasicComparator<int32_t>>>(1, index_schema, engine.bpm_);
+  for (auto key : keys) {
+    std::vector<Field> fields{Field(TypeId::kTypeInt, key)};
+    ASSERT_EQ(DB_SUCCESS, hash_index->InsertEntry(Row(fields), RowId(key), nullptr));
+    ASSERT_EQ(DB_SUCCESS, tree_index->InsertEntry(Row(fields), RowId(key), nullptr));
+  }
+  ShuffleArray(keys);
+  for (Index *index : {static_cast<Index *>(hash_index.get()), static_cast<Index *>(tree_index.get())}) {
+    std::vector<RowId> result;
+    auto start = std::chrono::steady_clock::now();
+    for (auto key : keys) {
+      std::vector<Field> fields{Field(TypeId::kTypeInt, key)};
+      result.clear();
+      ASSERT_EQ(DB_SUCCESS, index->ScanKey(Row(fields), result, nullptr));
+    }
+    auto cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << (index == hash_index.get() ? "hash" : "b+ tree") << " point lookup of " << n << " keys: " << cost
+              << " s" << std::endl;
+  }
+  hash_index->Destroy();
+  tree_index->Destroy();
+  delete index_schema;
+}
@@ -0,0 +1,72 @@
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "planner/expressions/filter_kernel.h"
+#include "utils/utils.h"
+
+static const std::vector<FilterKernel::Isa> isa_list = {FilterKernel::Isa::kScalar, FilterKernel::Isa::kAVX2};
+
+static const char *IsaName(FilterKernel::Isa isa) { return isa == FilterKernel::Isa::kAVX2 ? "avx2" : "scalar"; }
+
+TEST(FilterKernelTest, ThroughputBenchmark) {
+  FilterKernel::Isa origin = FilterKernel::GetIsa();
+  const uint32_t n = 1024;
+  const int rounds = 20000;
+  std::vector<int32_t> ints;
+  std::vector<float> floats;
+  std::string chars;
+  std::vector<uint32_t> offsets{0};
+  std::string long_chars;
+  std::vector<uint32_t> long_offsets{0};
+  const std::string suffix = "-minisql-name";
+  for (uint32_t i = 0; i < n; i++) {
+    ints.push_back(RandomUtils::RandomInt(0, 1000));
+    floats.push_back(RandomUtils::RandomFloat(0.f, 1000.f));
+    // equal prefixes, so the whole value is compared
+    std::string digit = std::to_string(RandomUtils::RandomInt(0, 9));
+    chars += suffix + digit;
+    offsets.push_back(chars.size());
+    long_chars += suffix + suffix + suffix + digit;
+    long_offsets.push_back(long_chars.size());
+  }
+  std::string target = suffix + "5";
+  std::string long_target = suffix + suffix + suffix + "5";
+  std::vector<uint64_t> bitmap(FilterKernel::BitmapWords(n));
+  std::vector<uint64_t> upper(FilterKernel::BitmapWords(n));
+  for (auto isa : isa_list) {
+    FilterKernel::SetIsa(isa);
+    uint64_t matches = 0;
+    auto measure = [&](const char *name, const std::function<void()> &kernel) {
+      auto start = std::chrono::steady_clock::now();
+      for (int r = 0; r < rounds; r++) {
+        kernel();
+        matches += bitmap[0] & 1;
+      }
+      auto cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      std::cout << IsaName(FilterKernel::GetIsa()) << " " << name << ": " << n * rounds / cost / 1e6
+                << " M rows/s per core" << std::endl;
+    };
+    measure("int <", [&]() { FilterKernel::Compare(ints.data(), n, ComparisonType::LessThan, 500, bitmap.data()); });
+    // BETWEEN is the AND of the bitmaps of both bounds
+    measure("float between", [&]() {
+      FilterKernel::Compare(floats.data(), n, ComparisonType::GreaterThanOrEqual, 250.f, bitmap.data());
+      FilterKernel::Compare(floats.data(), n, ComparisonType::LessThanOrEqual, 750.f, upper.data());
+      for (size_t w = 0; w < bitmap.size(); w++) {
+        bitmap[w] &= upper[w];
+      }
+    });
+    measure("char(14) =", [&]() {
+      FilterKernel::EqualChars(chars.data(), offsets.data(), n, target.data(), target.size(), bitmap.data());
+    });
+    measure("char(40) =", [&]() {
+      FilterKernel::EqualChars(long_chars.data(), long_offsets.data(), n, long_target.data(), long_target.size(),
+                               bitmap.data());
+    });
+    ASSERT_LE(matches, 3u * rounds);
+  }
+  FilterKernel::SetIsa(origin);
+}
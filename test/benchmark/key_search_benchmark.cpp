@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "index/basic_comparator.h"
+#include "index/key_search.h"
+#include "page/b_plus_tree_typed_internal_page.h"
+#include "page/b_plus_tree_typed_leaf_page.h"
+
+static const std::vector<KeySearch::Isa> isa_list = {KeySearch::Isa::kScalar, KeySearch::Isa::kSSE42,
+                                                     KeySearch::Isa::kAVX2};
+
+static const char *IsaName(KeySearch::Isa isa) {
+  switch (isa) {
+    case KeySearch::Isa::kAVX2:
+      return "avx2";
+    case KeySearch::Isa::kSSE42:
+      return "sse4.2";
+    default:
+      return "scalar";
+  }
+}
+
+/**
+ * The typed pages as they were laid out before keys and values were split:
+ * one array of (key, value) pairs behind the page header, searched by binary
+ * search with the comparator. Kept here as the baseline of the benchmark.
+ */
+template <typename ValueType, int HeaderSize>
+class InterleavedPage : public BPlusTreePage {
+ public:
+  using MappingType = std::pair<int32_t, ValueType>;
+
+  static constexpr int Capacity() { return static_cast<int>((PAGE_SIZE - HeaderSize) / sizeof(MappingType)); }
+
+  void Init(IndexPageType page_type) {
+    SetPageType(page_type);
+    SetSize(0);
+    SetMaxSize(Capacity() - 1);
+  }
+
+  void Append(int32_t key, ValueType value) {
+    Entries()[GetSize()] = MappingType(key, value);
+    IncreaseSize(1);
+  }
+
+  // the former BPlusTreeTypedLeafPage::KeyIndex
+  int KeyIndex(int32_t key, const BasicComparator<int32_t> &comparator) const {
+    int left = 0;
+    int right = GetSize();
+    while (left < right) {
+      int mid = left + (right - left) / 2;
+      if (comparator(Entries()[mid].first, key) < 0) {
+        left = mid + 1;
+      } else {
+        right = mid;
+      }
+    }
+    return left;
+  }
+
+  // the former BPlusTreeTypedInternalPage::Lookup
+  ValueType Lookup(int32_t key, const BasicComparator<int32_t> &comparator) const {
+    int left = 1;
+    int right = GetSize();
+    while (left < right) {
+      int mid = left + (right - left) / 2;
+      if (comparator(Entries()[mid].first, key) <= 0) {
+        left = mid + 1;
+      } else {
+        right = mid;
+      }
+    }
+    return Entries()[left - 1].second;
+  }
+
+ private:
+  MappingType *Entries() { return reinterpret_cast<MappingType *>(reinterpret_cast<char *>(this) + HeaderSize); }
+
+  const MappingType *Entries() const {
+    return reinterpret_cast<const MappingType *>(reinterpret_cast<const char *>(this) + HeaderSize);
+  }
+};
+
+/**
+ * Per-page lookup micro benchmark, compares the former interleaved key/value
+ * pages with the split layout under each instruction set.
+ */
+TEST(KeySearchTest, PageLookupBenchmark) {
+  using LeafPage = BPlusTreeTypedLeafPage<int32_t, BasicComparator<int32_t>>;
+  using InternalPage = BPlusTreeTypedInternalPage<int32_t, BasicComparator<int32_t>>;
+  // the former headers: 28 bytes, and the next page id of a leaf
+  using OldLeafPage = InterleavedPage<RowId, 32>;
+  using OldInternalPage = InterleavedPage<page_id_t, 28>;
+  const int lookups = 200000;
+  BasicComparator<int32_t> comparator;
+  alignas(8) char leaf_buf[PAGE_SIZE];
+  alignas(8) char internal_buf[PAGE_SIZE];
+  alignas(8) char old_leaf_buf[PAGE_SIZE];
+  alignas(8) char old_internal_buf[PAGE_SIZE];
+  auto *leaf = reinterpret_cast<LeafPage *>(leaf_buf);
+  auto *internal = reinterpret_cast<InternalPage *>(internal_buf);
+  auto *old_leaf = reinterpret_cast<OldLeafPage *>(old_leaf_buf);
+  auto *old_internal = reinterpret_cast<OldInternalPage *>(old_internal_buf);
+  leaf->Init(0);
+  internal->Init(1);
+  old_leaf->Init(IndexPageType::LEAF_PAGE);
+  old_internal->Init(IndexPageType::INTERNAL_PAGE);
+  // both layouts hold the same entries, as many as the smaller page takes
+  int leaf_size = std::min(leaf->GetMaxSize(), old_leaf->GetMaxSize());
+  for (int i = 0; i < leaf_size; i++) {
+    leaf->Insert(2 * i, RowId(i), comparator);
+    old_leaf->Append(2 * i, RowId(i));
+  }
+  int internal_size = std::min(internal->GetMaxSize(), old_internal->GetMaxSize());
+  internal->PopulateNewRoot(0, 2, 1);
+  old_internal->Append(0, 0);
+  old_internal->Append(2, 1);
+  for (int i = 2; i < internal_size; i++) {
+    internal->InsertNodeAfter(i - 1, 2 * i, i);
+    old_internal->Append(2 * i, i);
+  }
+  std::vector<int32_t> probes;
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<int32_t> dist(0, 2 * leaf_size);
+  for (int i = 0; i < lookups; i++) {
+    probes.push_back(dist(rng));
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  int64_t leaf_expect = 0;
+  for (auto probe : probes) {
+    leaf_expect += old_leaf->KeyIndex(probe, comparator);
+  }
+  auto cost = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  std::cout << "interleaved leaf KeyIndex: " << cost / lookups << " ns/lookup" << std::endl;
+
+  start = std::chrono::steady_clock::now();
+  int64_t internal_expect = 0;
+  for (auto probe : probes) {
+    internal_expect += old_internal->Lookup(probe, comparator);
+  }
+  cost = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  std::cout << "interleaved internal Lookup: " << cost / lookups << " ns/lookup" << std::endl;
+
+  KeySearch::Isa origin = KeySearch::GetIsa();
+  for (auto isa : isa_list) {
+    KeySearch::SetIsa(isa);
+    if (KeySearch::GetIsa() != isa) {
+      continue;
+    }
+    start = std::chrono::steady_clock::now();
+    int64_t leaf_sum = 0;
+    for (auto probe : probes) {
+      leaf_sum += leaf->KeyIndex(probe, comparator);
+    }
+    cost = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    std::cout << IsaName(isa) << " leaf KeyIndex: " << cost / lookups << " ns/lookup" << std::endl;
+    ASSERT_EQ(leaf_expect, leaf_sum);
+
+    start = std::chrono::steady_clock::now();
+    int64_t internal_sum = 0;
+    for (auto probe : probes) {
+      internal_sum += internal->Lookup(probe, comparator);
+    }
+    cost = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    std::cout << IsaName(isa) << " internal Lookup: " << cost / lookups << " ns/lookup" << std::endl;
+    ASSERT_EQ(internal_expect, internal_sum);
+  }
+  KeySearch::SetIsa(origin);
+}
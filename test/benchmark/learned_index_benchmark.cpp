@@ -0,0 +1,92 @@
+#include <chrono>
+#include <iostream>
+#include <random>
+
+#include "common/instance.h"
+#include "gtest/gtest.h"
+#include "index/learned_index.h"
+#include "index/typed_b_plus_tree_index.h"
+#include "storage/disk_manager.h"
+#include "utils/utils.h"
+
+static const std::string db_name = "learned_index_benchmark.db";
+
+// n unique keys with random gaps, in increasing order
+static std::vector<int32_t> GappedKeys(int n, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::vector<int32_t> keys;
+  int32_t key = -1000000;
+  for (int i = 0; i < n; i++) {
+    // dense runs broken by a few large jumps, so the model needs several segments
+    key += (i % 5000 == 0) ? 100000 + static_cast<int32_t>(rng() % 100000) : 1 + static_cast<int32_t>(rng() % 8);
+    keys.push_back(key);
+  }
+  return keys;
+}
+
+static dberr_t Load(Index *index, const std::vector<int32_t> &keys) {
+  std::vector<int32_t> shuffled(keys);
+  ShuffleArray(shuffled);
+  size_t pos = 0;
+  auto next = [&](Row &key, RowId &row_id) {
+    if (pos >= shuffled.size()) {
+      return false;
+    }
+    std::vector<Field> fields{Field(TypeId::kTypeInt, shuffled[pos])};
+    key = Row(fields);
+    row_id = RowId(shuffled[pos]);
+    pos++;
+    return true;
+  };
+  return index->BulkLoad(next, nullptr);
+}
+
+static Row KeyRow(int32_t key) {
+  std::vector<Field> fields{Field(TypeId::kTypeInt, key)};
+  return Row(fields);
+}
+
+TEST(LearnedIndexTest, LookupBenchmark) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("id", TypeId::kTypeInt, 0, false, false)};
+  std::vector<uint32_t> index_key_map{0};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  const int n = 500000;
+  std::vector<int32_t> keys = GappedKeys(n, 2);
+  auto *meta_page = reinterpret_cast<DiskFileMetaPage *>(engine.disk_mgr_->GetMetaData());
+  uint32_t allocated = meta_page->GetAllocatedPages();
+  auto tree_index =
+      std::make_unique<TypedBPlusTreeIndex<int32_t, BasicComparator<int32_t>>>(0, index_schema, engine.bpm_);
+  ASSERT_EQ(DB_SUCCESS, Load(tree_index.get(), keys));
+  uint32_t tree_pages = meta_page->GetAllocatedPages() - allocated;
+  allocated = meta_page->GetAllocatedPages();
+  auto learned_index = std::make_unique<LearnedIndex>(1, index_schema, engine.bpm_);
+  ASSERT_EQ(DB_SUCCESS, Load(learned_index.get(), keys));
+  uint32_t learned_pages = meta_page->GetAllocatedPages() - allocated;
+  auto stats = learned_index->GetStats();
+  uint32_t tree_height;
+  uint32_t tree_leaves;
+  tree_index->GetShape(tree_height, tree_leaves);
+  std::cout << "b+ tree: " << tree_pages << " pages, " << tree_pages - tree_leaves << " of them inner, height "
+            << tree_height << std::endl;
+  std::cout << "learned: " << learned_pages << " pages, " << stats.segments << " segments in " << stats.model_bytes
+            << " bytes of model" << std::endl;
+  ASSERT_LT(stats.model_bytes, (tree_pages - tree_leaves) * PAGE_SIZE);
+  std::vector<int32_t> probes(keys);
+  ShuffleArray(probes);
+  for (Index *index : {static_cast<Index *>(tree_index.get()), static_cast<Index *>(learned_index.get())}) {
+    std::vector<RowId> result;
+    auto start = std::chrono::steady_clock::now();
+    for (auto key : probes) {
+      result.clear();
+      ASSERT_EQ(DB_SUCCESS, index->ScanKey(KeyRow(key), result, nullptr));
+    }
+    auto cost = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    std::cout << (index == tree_index.get() ? "b+ tree" : "learned") << " lookup: " << cost / n << " ns/lookup"
+              << std::endl;
+  }
+  tree_index->Destroy();
+  learned_index->Destroy();
+  delete index_schema;
+}
@@ -0,0 +1,49 @@
+#include <chrono>
+#include <iostream>
+
+#include "common/instance.h"
+#include "gtest/gtest.h"
+#include "index/lsm_index.h"
+#include "index/typed_b_plus_tree_index.h"
+#include "utils/utils.h"
+
+static const std::string db_name = "lsm_tree_benchmark.db";
+
+/**
+ * Sustained random inserts into an index larger than the buffer pool, the
+ * typed B+ tree against the LSM tree.
+ */
+TEST(LsmTreeTest, InsertBenchmark) {
+  const int n = 2000000;
+  std::vector<int32_t> keys;
+  for (int i = 0; i < n; i++) {
+    keys.push_back(i);
+  }
+  ShuffleArray(keys);
+  std::vector<Column *> columns = {new Column("id", TypeId::kTypeInt, 0, false, false)};
+  std::vector<uint32_t> index_key_map{0};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  for (bool lsm : {false, true}) {
+    DBStorageEngine engine(db_name, true, 1024);
+    std::unique_ptr<Index> index;
+    if (lsm) {
+      index = std::make_unique<LsmIndex>(0, index_schema, engine.bpm_);
+    } else {
+      index = std::make_unique<TypedBPlusTreeIndex<int32_t, BasicComparator<int32_t>>>(0, index_schema, engine.bpm_);
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) {
+      std::vector<Field> fields{Field(TypeId::kTypeInt, keys[i])};
+      ASSERT_EQ(DB_SUCCESS, index->InsertEntry(Row(fields), RowId(keys[i]), nullptr));
+    }
+    if (lsm) {
+      static_cast<LsmIndex *>(index.get())->Flush();
+    }
+    auto cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << (lsm ? "LSM tree" : "B+ tree") << " insert of " << n << " keys: " << cost << " s, "
+              << n / cost << " inserts/s" << std::endl;
+    index->Destroy();
+  }
+  delete index_schema;
+}
@@ -0,0 +1,117 @@
+#include <iostream>
+
+#include "common/instance.h"
+#include "gtest/gtest.h"
+#include "index/prefix_b_plus_tree_index.h"
+#include "index/typed_b_plus_tree_index.h"
+#include "page/b_plus_tree_internal_page.h"
+#include "page/b_plus_tree_leaf_page.h"
+#include "utils/utils.h"
+
+static const std::string db_name = "prefix_b_plus_tree_index_benchmark.db";
+
+static Row MakeCharKey(const std::string &value) {
+  std::vector<Field> fields{Field(TypeId::kTypeChar, const_cast<char *>(value.data()), value.size(), true)};
+  return Row(fields);
+}
+
+static Row MakeIntKey(int32_t value) {
+  std::vector<Field> fields{Field(TypeId::kTypeInt, value)};
+  return Row(fields);
+}
+
+/*
+ * Bytes per entry of the leaves for INT keys of rows inserted in key order,
+ * about 50 rows per heap page, with and without the row id compression.
+ */
+TEST(PrefixBPlusTreeIndexTest, LeafCompressionBenchmark) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("id", TypeId::kTypeInt, 0, false, false)};
+  std::vector<uint32_t> index_key_map{0};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  auto *index = new PrefixBPlusTreeIndex(0, index_schema, engine.bpm_);
+  auto *typed_index = new TypedBPlusTreeIndex<int32_t, BasicComparator<int32_t>>(1, index_schema, engine.bpm_);
+  const int n = 200000;
+  std::vector<int> order(n);
+  for (int i = 0; i < n; i++) {
+    order[i] = i;
+  }
+  ShuffleArray(order);
+  for (auto i : order) {
+    RowId row_id(i / 50, i % 50);
+    ASSERT_EQ(DB_SUCCESS, index->InsertEntry(MakeIntKey(i), row_id, nullptr));
+    ASSERT_EQ(DB_SUCCESS, typed_index->InsertEntry(MakeIntKey(i), row_id, nullptr));
+  }
+  auto stats = index->GetStats();
+  ASSERT_EQ(n, stats.entries);
+  uint32_t typed_height;
+  uint32_t typed_leaves;
+  typed_index->GetShape(typed_height, typed_leaves);
+  double compressed = static_cast<double>(stats.leaf_bytes) / n;
+  // the same entries with 8-byte row ids
+  double plain = static_cast<double>(stats.leaf_bytes - stats.value_bytes + n * sizeof(RowId)) / n;
+  std::cout << "prefix b+ tree leaves: " << compressed << " bytes per entry (" << plain
+            << " with 8-byte row ids), row ids take " << static_cast<double>(stats.value_bytes) / n << " bytes"
+            << std::endl;
+  std::cout << "prefix b+ tree: " << stats.leaf_pages << " leaves, typed b+ tree: " << typed_leaves << " leaves ("
+            << sizeof(int32_t) + sizeof(RowId) << " bytes per entry)" << std::endl;
+  ASSERT_LT(compressed, plain);
+  ASSERT_LT(stats.leaf_pages, typed_leaves);
+  index->Destroy();
+  typed_index->Destroy();
+  delete index;
+  delete typed_index;
+  delete index_schema;
+}
+
+/*
+ * Fan-out and height for long string keys sharing long prefixes, compared
+ * with the fixed-size GenericKey pages the same CHAR(64) key would need.
+ */
+TEST(PrefixBPlusTreeIndexTest, FanoutBenchmark) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("url", TypeId::kTypeChar, 64, 0, false, false)};
+  std::vector<uint32_t> index_key_map{0};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  auto *index = new PrefixBPlusTreeIndex(0, index_schema, engine.bpm_);
+  const int n = 200000;
+  std::vector<int> order(n);
+  for (int i = 0; i < n; i++) {
+    order[i] = i;
+  }
+  ShuffleArray(order);
+  char buf[64];
+  for (auto i : order) {
+    snprintf(buf, sizeof(buf), "https://shop.example.com/catalog/dept-%02d/item-%08d", i % 40, i);
+    ASSERT_EQ(DB_SUCCESS, index->InsertEntry(MakeCharKey(buf), RowId(i), nullptr));
+  }
+  auto stats = index->GetStats();
+  ASSERT_EQ(n, stats.entries);
+  // a GenericKey of CHAR(64) takes 4 + 1 + 4 + 64 bytes, rounded up to 128
+  const size_t generic_key_size = 128;
+  size_t generic_leaf_max = (PAGE_SIZE - LEAF_PAGE_HEADER_SIZE) / (generic_key_size + sizeof(RowId));
+  size_t generic_internal_max = (PAGE_SIZE - INTERNAL_PAGE_HEADER_SIZE) / (generic_key_size + sizeof(page_id_t));
+  // full pages are split in half, so a tree built by random inserts is about 3/4 full
+  uint64_t generic_leaves = (n + generic_leaf_max * 3 / 4 - 1) / (generic_leaf_max * 3 / 4);
+  uint32_t generic_height = 1;
+  for (uint64_t pages = generic_leaves; pages > 1; generic_height++) {
+    pages = (pages + generic_internal_max * 3 / 4 - 1) / (generic_internal_max * 3 / 4);
+  }
+  double fanout = stats.internal_pages == 0
+                      ? 0
+                      : static_cast<double>(stats.leaf_pages + stats.internal_pages - 1) / stats.internal_pages;
+  std::cout << n << " keys of " << static_cast<double>(stats.key_bytes) / n << " bytes" << std::endl;
+  std::cout << "prefix b+ tree: height " << stats.height << ", " << stats.leaf_pages << " leaves ("
+            << static_cast<double>(n) / stats.leaf_pages << " keys per leaf), " << stats.internal_pages
+            << " internal pages (fan-out " << fanout << ")" << std::endl;
+  std::cout << "generic key b+ tree: height " << generic_height << ", about " << generic_leaves << " leaves (at most "
+            << generic_leaf_max << " keys per leaf, fan-out at most " << generic_internal_max + 1 << ")" << std::endl;
+  ASSERT_LE(stats.height, generic_height);
+  ASSERT_LT(stats.leaf_pages, generic_leaves);
+  ASSERT_TRUE(engine.bpm_->CheckAllUnpinned());
+  index->Destroy();
+  delete index;
+  delete index_schema;
+}
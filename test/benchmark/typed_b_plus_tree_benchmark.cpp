@@ -0,0 +1,201 @@
+#include <chrono>
+#include <deque>
+#include <iostream>
+
+#include "common/instance.h"
+#include "gtest/gtest.h"
+#include "index/basic_comparator.h"
+#include "index/typed_b_plus_tree.h"
+#include "index/typed_b_plus_tree_index.h"
+#include "utils/utils.h"
+
+static const std::string db_name = "typed_bp_tree_benchmark.db";
+
+TEST(TypedBPlusTreeTests, IndexBulkLoadBenchmark) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("id", TypeId::kTypeInt, 0, false, false)};
+  std::vector<uint32_t> index_key_map{0};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  const int n = 200000;
+  vector<int32_t> keys;
+  for (int i = 0; i < n; i++) {
+    keys.push_back(i);
+  }
+  ShuffleArray(keys);
+  auto bulk_index = std::make_unique<TypedBPlusTreeIndex<int32_t, BasicComparator<int32_t>>>(0, index_schema, engine.bpm_);
+  int pos = 0;
+  auto start = std::chrono::steady_clock::now();
+  ASSERT_EQ(DB_SUCCESS, bulk_index->BulkLoad(
+                            [&](Row &key, RowId &row_id) {
+                              if (pos >= n) {
+                                return false;
+                              }
+                              std::vector<Field> fields{Field(TypeId::kTypeInt, keys[pos])};
+                              key = Row(fields);
+                              row_id = RowId(keys[pos++]);
+                              return true;
+                            },
+                            nullptr));
+  auto cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  std::cout << "bulk load of " << n << " keys: " << cost << " s" << std::endl;
+  int32_t expect = 0;
+  for (auto iter = bulk_index->GetBeginIterator(); iter != bulk_index->GetEndIterator(); ++iter) {
+    ASSERT_EQ(expect, (*iter).first);
+    ASSERT_EQ(expect, (*iter).second.Get());
+    expect++;
+  }
+  ASSERT_EQ(n, expect);
+
+  auto insert_index =
+      std::make_unique<TypedBPlusTreeIndex<int32_t, BasicComparator<int32_t>>>(1, index_schema, engine.bpm_);
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < n; i++) {
+    std::vector<Field> fields{Field(TypeId::kTypeInt, keys[i])};
+    ASSERT_EQ(DB_SUCCESS, insert_index->InsertEntry(Row(fields), RowId(keys[i]), nullptr));
+  }
+  cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  std::cout << "one by one insert of " << n << " keys: " << cost << " s" << std::endl;
+  bulk_index->Destroy();
+  insert_index->Destroy();
+  delete index_schema;
+}
+
+/*
+ * Duplicate key probes of a multi-row insert: one ScanKey per key against one
+ * ScanKeys call per batch.
+ */
+TEST(TypedBPlusTreeTests, BatchedLookupBenchmark) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("id", TypeId::kTypeInt, 0, false, false)};
+  std::vector<uint32_t> index_key_map{0};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  auto index = std::make_unique<TypedBPlusTreeIndex<int32_t, BasicComparator<int32_t>>>(0, index_schema, engine.bpm_);
+  const int n = 200000;
+  std::vector<Row> keys;
+  std::vector<RowId> row_ids;
+  for (int i = 0; i < n; i++) {
+    std::vector<Field> fields{Field(TypeId::kTypeInt, i)};
+    keys.emplace_back(fields);
+    row_ids.emplace_back(i);
+  }
+  ASSERT_EQ(DB_SUCCESS, index->InsertEntries(keys, row_ids, nullptr));
+  // the same rows again are all duplicates
+  ASSERT_EQ(DB_FAILED, index->InsertEntries(keys, row_ids, nullptr));
+  std::vector<int32_t> probe_keys;
+  for (int i = 0; i < n; i++) {
+    probe_keys.push_back(2 * i);
+  }
+  ShuffleArray(probe_keys);
+  std::vector<Row> probes;
+  for (auto key : probe_keys) {
+    std::vector<Field> fields{Field(TypeId::kTypeInt, key)};
+    probes.emplace_back(fields);
+  }
+  int found = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (auto &probe : probes) {
+    std::vector<RowId> result;
+    found += index->ScanKey(probe, result, nullptr) == DB_SUCCESS;
+  }
+  auto cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  std::cout << "ScanKey of " << n << " keys: " << cost << " s" << std::endl;
+  ASSERT_EQ(n / 2, found);
+  found = 0;
+  start = std::chrono::steady_clock::now();
+  for (size_t begin = 0; begin < probes.size(); begin += INDEX_BATCH_SIZE) {
+    size_t end = std::min(probes.size(), begin + INDEX_BATCH_SIZE);
+    std::vector<Row> batch(probes.begin() + begin, probes.begin() + end);
+    std::vector<std::vector<RowId>> result;
+    index->ScanKeys(batch, result, nullptr);
+    for (size_t i = 0; i < batch.size(); i++) {
+      if (!result[i].empty()) {
+        ASSERT_EQ(probe_keys[begin + i], result[i][0].Get());
+        found++;
+      }
+    }
+  }
+  cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  std::cout << "ScanKeys of " << n << " keys in batches of " << INDEX_BATCH_SIZE << ": " << cost << " s" << std::endl;
+  ASSERT_EQ(n / 2, found);
+  index->Destroy();
+  delete index_schema;
+}
+
+/**
+ * Point lookups concentrated on a hot set of keys, with and without the
+ * adaptive hash.
+ */
+TEST(TypedBPlusTreeTests, AdaptiveHashBenchmark) {
+  DBStorageEngine engine(db_name);
+  TypedBPlusTree<int64_t, BasicComparator<int64_t>> tree(0, engine.bpm_);
+  const int n = 200000;
+  const int hot = 2000;
+  const int lookups = 500000;
+  for (int i = 0; i < n; i++) {
+    ASSERT_TRUE(tree.Insert(i, RowId(i)));
+  }
+  vector<int64_t> hot_keys;
+  for (int i = 0; i < hot; i++) {
+    hot_keys.push_back(i * (n / hot));
+  }
+  for (bool enabled : {false, true}) {
+    tree.SetAdaptiveHashEnabled(enabled);
+    auto start = std::chrono::steady_clock::now();
+    vector<RowId> result;
+    for (int i = 0; i < lookups; i++) {
+      result.clear();
+      ASSERT_TRUE(tree.GetValue(hot_keys[i % hot], result));
+    }
+    auto cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    auto stats = tree.GetAdaptiveHashStats();
+    std::cout << "hot lookups with adaptive hash " << (enabled ? "on: " : "off: ") << cost << " s, hit rate "
+              << stats.HitRate() << ", " << stats.memory_bytes << " bytes" << std::endl;
+  }
+  tree.Destroy();
+}
+
+/**
+ * The latest 10 entries of a large index, read with a descending range
+ * against scanning the range forward and keeping the tail.
+ */
+TEST(TypedBPlusTreeTests, LatestEntriesBenchmark) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("ts", TypeId::kTypeInt, 0, false, false)};
+  std::vector<uint32_t> index_key_map{0};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  auto *index = new TypedBPlusTreeIndex<int32_t, BasicComparator<int32_t>>(0, index_schema, engine.bpm_);
+  const int n = 1000000;
+  const int limit = 10;
+  const int queries = 20;
+  for (int i = 0; i < n; i++) {
+    std::vector<Field> fields{Field(TypeId::kTypeInt, i)};
+    ASSERT_EQ(DB_SUCCESS, index->InsertEntry(Row(fields), RowId(i), nullptr));
+  }
+  std::vector<Field> since_fields{Field(TypeId::kTypeInt, n / 2)};
+  Row since(since_fields);
+  for (bool descending : {false, true}) {
+    auto start = std::chrono::steady_clock::now();
+    for (int q = 0; q < queries; q++) {
+      std::deque<RowId> latest;
+      auto cursor = index->ScanRange({&since, true, nullptr, true, descending}, nullptr);
+      RowId row_id;
+      while ((!descending || static_cast<int>(latest.size()) < limit) && cursor->Next(row_id)) {
+        latest.push_back(row_id);
+        if (static_cast<int>(latest.size()) > limit) {
+          latest.pop_front();
+        }
+      }
+      ASSERT_EQ(limit, latest.size());
+      ASSERT_EQ(descending ? n - 1 : n - limit, latest.front().Get());
+    }
+    auto cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "latest " << limit << " of " << n / 2 << " entries " << (descending ? "descending: " : "forward: ")
+              << cost / queries * 1000 << " ms per query" << std::endl;
+  }
+  index->Destroy();
+  delete index;
+  delete index_schema;
+}
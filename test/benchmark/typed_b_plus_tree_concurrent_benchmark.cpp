@@ -0,0 +1,69 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <thread>
+
+#include "common/instance.h"
+#include "gtest/gtest.h"
+#include "index/basic_comparator.h"
+#include "index/typed_b_plus_tree.h"
+
+static const std::string db_name = "typed_bp_tree_concurrent_benchmark.db";
+
+using Int32Tree = TypedBPlusTree<int32_t, BasicComparator<int32_t>>;
+
+template <typename F>
+static void RunThreads(int thread_num, F &&task) {
+  std::vector<std::thread> threads;
+  for (int t = 0; t < thread_num; t++) {
+    threads.emplace_back(task, t);
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+}
+
+TEST(TypedBPlusTreeConcurrentTests, ThroughputBenchmark) {
+  DBStorageEngine engine(db_name);
+  const int n = 100000;
+  std::vector<int32_t> keys(n);
+  for (int i = 0; i < n; i++) {
+    keys[i] = i;
+  }
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(0));
+  index_id_t index_id = 0;
+  for (int thread_num = 1; thread_num <= 32; thread_num *= 2) {
+    Int32Tree tree(index_id++, engine.bpm_, BasicComparator<int32_t>());
+    auto start = std::chrono::steady_clock::now();
+    RunThreads(thread_num, [&](int t) {
+      for (int i = t; i < n; i += thread_num) {
+        tree.Insert(keys[i], RowId(keys[i]));
+      }
+    });
+    double insert_cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    start = std::chrono::steady_clock::now();
+    std::atomic<int> found{0};
+    RunThreads(thread_num, [&](int t) {
+      std::vector<RowId> result;
+      for (int i = t; i < n; i += thread_num) {
+        result.clear();
+        found += tree.GetValue(keys[i], result) ? 1 : 0;
+      }
+    });
+    double lookup_cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    ASSERT_EQ(n, found);
+    start = std::chrono::steady_clock::now();
+    RunThreads(thread_num, [&](int t) {
+      for (int i = t; i < n; i += thread_num) {
+        tree.Remove(keys[i]);
+      }
+    });
+    double remove_cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    ASSERT_TRUE(tree.IsEmpty());
+    std::cout << thread_num << " threads: insert " << n / insert_cost / 1e6 << " Mops/s, lookup "
+              << n / lookup_cost / 1e6 << " Mops/s, remove " << n / remove_cost / 1e6 << " Mops/s" << std::endl;
+  }
+  ASSERT_TRUE(engine.bpm_->CheckAllUnpinned());
+}
@@ -0,0 +1,52 @@
+#include "catalog/index_predicate.h"
+
+#include "gtest/gtest.h"
+
+static Field Int(int32_t value) { return Field(TypeId::kTypeInt, value); }
+
+TEST(IndexPredicateTest, ImpliesTest) {
+  IndexPredicate::Term lower(0, ">=", Int(10));
+  // equalities imply the term when they satisfy it
+  ASSERT_TRUE(IndexPredicate::Implies(0, "=", Int(10), lower));
+  ASSERT_FALSE(IndexPredicate::Implies(0, "=", Int(9), lower));
+  // a bound on the same side is implied by a tighter or equal one
+  ASSERT_TRUE(IndexPredicate::Implies(0, ">", Int(10), lower));
+  ASSERT_TRUE(IndexPredicate::Implies(0, ">=", Int(10), lower));
+  ASSERT_FALSE(IndexPredicate::Implies(0, ">=", Int(9), lower));
+  ASSERT_FALSE(IndexPredicate::Implies(0, "<", Int(100), lower));
+  ASSERT_FALSE(IndexPredicate::Implies(1, ">", Int(100), lower));
+  IndexPredicate::Term strict(0, ">", Int(10));
+  ASSERT_TRUE(IndexPredicate::Implies(0, ">", Int(10), strict));
+  ASSERT_FALSE(IndexPredicate::Implies(0, ">=", Int(10), strict));
+  IndexPredicate::Term upper(0, "<=", Int(10));
+  ASSERT_TRUE(IndexPredicate::Implies(0, "<", Int(10), upper));
+  ASSERT_FALSE(IndexPredicate::Implies(0, "<", Int(11), upper));
+  // an inequality is implied by a range that excludes its value
+  IndexPredicate::Term not_equal(0, "<>", Int(10));
+  ASSERT_TRUE(IndexPredicate::Implies(0, ">", Int(10), not_equal));
+  ASSERT_FALSE(IndexPredicate::Implies(0, ">=", Int(10), not_equal));
+  ASSERT_TRUE(IndexPredicate::Implies(0, "<>", Int(10), not_equal));
+  ASSERT_FALSE(IndexPredicate::Implies(0, "<>", Int(11), not_equal));
+  // values of another type are never compared
+  ASSERT_FALSE(IndexPredicate::Implies(0, "=", Field(TypeId::kTypeFloat, 10.f), lower));
+}
+
+TEST(IndexPredicateTest, SerializeTest) {
+  IndexPredicate predicate;
+  predicate.AddTerm(0, ">=", Int(10));
+  predicate.AddTerm(1, "<>", Field(TypeId::kTypeChar, const_cast<char *>("abc"), 3, true));
+  char buf[PAGE_SIZE];
+  uint32_t size = predicate.SerializeTo(buf);
+  ASSERT_EQ(predicate.GetSerializedSize(), size);
+  IndexPredicate loaded;
+  ASSERT_EQ(size, IndexPredicate::DeserializeFrom(buf, loaded));
+  ASSERT_EQ(2u, loaded.GetTerms().size());
+  // rows with a null field are left out
+  std::vector<Field> accepted{Int(10), Field(TypeId::kTypeChar, const_cast<char *>("abd"), 3, true)};
+  ASSERT_TRUE(loaded.Evaluate(Row(accepted)));
+  std::vector<Field> rejected{Int(10), Field(TypeId::kTypeChar, const_cast<char *>("abc"), 3, true)};
+  ASSERT_FALSE(loaded.Evaluate(Row(rejected)));
+  std::vector<Field> null_key{Field(TypeId::kTypeInt), Field(TypeId::kTypeChar, const_cast<char *>("abd"), 3, true)};
+  ASSERT_FALSE(loaded.Evaluate(Row(null_key)));
+  ASSERT_TRUE(IndexPredicate().Evaluate(Row(null_key)));
+}
@@ -0,0 +1,130 @@
+#include "catalog/index_statistics.h"
+
+#include <random>
+
+#include "catalog/catalog.h"
+#include "common/instance.h"
+#include "gtest/gtest.h"
+#include "storage/bloom_filter.h"
+#include "utils/utils.h"
+
+static const std::string db_name = "index_statistics_test.db";
+
+static std::string Encode(int32_t value, const IndexSchema *key_schema) {
+  std::string encoded;
+  EXPECT_TRUE(IndexStatistics::EncodeValue(Field(TypeId::kTypeInt, value), key_schema, encoded));
+  return encoded;
+}
+
+TEST(IndexStatisticsTest, HyperLogLogTest) {
+  for (uint64_t n : {100u, 10000u, 1000000u}) {
+    HyperLogLog sketch;
+    for (uint64_t i = 0; i < n; i++) {
+      // duplicates must not count
+      sketch.Add(BloomFilter::Hash(std::to_string(i)));
+      sketch.Add(BloomFilter::Hash(std::to_string(i)));
+    }
+    ASSERT_NEAR(static_cast<double>(n), static_cast<double>(sketch.Estimate()), n * 0.1);
+  }
+}
+
+TEST(IndexStatisticsTest, SelectivityTest) {
+  std::vector<Column *> columns = {new Column("id", TypeId::kTypeInt, 0, false, false)};
+  std::vector<uint32_t> index_key_map{0};
+  const TableSchema table_schema(columns);
+  auto *key_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  // half of the keys are 7, the rest are spread over [0, 100000)
+  IndexStatisticsBuilder builder(key_schema);
+  std::mt19937 rng(0);
+  const int n = 200000;
+  for (int i = 0; i < n; i++) {
+    std::vector<Field> fields{Field(TypeId::kTypeInt, i % 2 == 0 ? 7 : static_cast<int32_t>(rng() % 100000))};
+    builder.Add(Row(fields));
+  }
+  IndexStatistics stats;
+  ASSERT_FALSE(stats.IsAnalyzed());
+  builder.Finish(3, 500, 2000, stats);
+  ASSERT_TRUE(stats.IsAnalyzed());
+  ASSERT_EQ(n, stats.GetEntryCount());
+  ASSERT_NEAR(63000.0, static_cast<double>(stats.GetLeadingDistinct()), 63000 * 0.1);
+  ASSERT_NEAR(0.5, stats.EqualSelectivity(Encode(7, key_schema)), 0.05);
+  ASSERT_NEAR(1.0 / 63000, stats.EqualSelectivity(Encode(50000, key_schema)), 1e-5);
+  std::string low = Encode(20000, key_schema);
+  std::string high = Encode(60000, key_schema);
+  ASSERT_NEAR(0.2, stats.RangeSelectivity(&low, true, &high, false), 0.03);
+  ASSERT_NEAR(0.2, stats.RangeSelectivity(&high, true, nullptr, false), 0.03);
+  ASSERT_NEAR(0.6, stats.RangeSelectivity(nullptr, false, &low, false), 0.03);
+  std::string above = Encode(200000, key_schema);
+  ASSERT_EQ(0, stats.RangeSelectivity(&above, true, nullptr, false));
+  // a few rows are fetched one by one, a large fraction costs more than the table
+  ASSERT_LT(stats.ScanCost(stats.EqualSelectivity(Encode(50000, key_schema))), 20);
+  ASSERT_GT(stats.ScanCost(0.5), 2000);
+  // histogram buckets are merged to fit a small buffer
+  char buf[PAGE_SIZE];
+  uint32_t size = stats.SerializeTo(buf, 1500);
+  ASSERT_GE(1500u, size);
+  IndexStatistics copy;
+  ASSERT_EQ(size, copy.DeserializeFrom(buf, size));
+  ASSERT_LT(copy.GetBucketCount(), stats.GetBucketCount());
+  ASSERT_EQ(stats.GetEntryCount(), copy.GetEntryCount());
+  ASSERT_EQ(stats.GetDistinctKeys(), copy.GetDistinctKeys());
+  ASSERT_NEAR(0.2, copy.RangeSelectivity(&low, true, &high, false), 0.05);
+  // bytes written by something else leave the statistics unanalyzed
+  memset(buf, 0, sizeof(buf));
+  ASSERT_EQ(0u, copy.DeserializeFrom(buf, PAGE_SIZE));
+  ASSERT_FALSE(copy.IsAnalyzed());
+  delete key_schema;
+}
+
+TEST(IndexStatisticsTest, AnalyzeTableTest) {
+  auto *db_01 = new DBStorageEngine(db_name, true);
+  auto &catalog_01 = db_01->catalog_mgr_;
+  std::vector<Column *> columns = {new Column("id", TypeId::kTypeInt, 0, false, false),
+                                   new Column("name", TypeId::kTypeChar, 16, 1, true, false)};
+  auto schema = std::make_shared<Schema>(columns);
+  Txn txn;
+  TableInfo *table_info = nullptr;
+  ASSERT_EQ(DB_SUCCESS, catalog_01->CreateTable("t", schema.get(), &txn, table_info));
+  const int n = 5000;
+  for (int i = 0; i < n; i++) {
+    std::string name = "name_" + std::to_string(i % 100);
+    std::vector<Field> fields{Field(TypeId::kTypeInt, i),
+                              Field(TypeId::kTypeChar, const_cast<char *>(name.c_str()), name.size(), true)};
+    Row row(fields);
+    ASSERT_TRUE(table_info->GetTableHeap()->InsertTuple(row, &txn));
+  }
+  IndexInfo *id_index = nullptr;
+  IndexInfo *name_index = nullptr;
+  ASSERT_EQ(DB_SUCCESS, catalog_01->CreateIndex("t", "id_idx", {"id"}, &txn, id_index, "bptree"));
+  ASSERT_EQ(DB_SUCCESS, catalog_01->CreateIndex("t", "name_idx", {"name", "id"}, &txn, name_index, "bptree"));
+  ASSERT_FALSE(id_index->GetStatistics().IsAnalyzed());
+  ASSERT_EQ(DB_TABLE_NOT_EXIST, catalog_01->AnalyzeTable("u", &txn));
+  ASSERT_EQ(DB_SUCCESS, catalog_01->AnalyzeTable("t", &txn));
+  const auto &id_stats = id_index->GetStatistics();
+  ASSERT_EQ(n, id_stats.GetEntryCount());
+  ASSERT_EQ(2u, id_stats.GetHeight());
+  ASSERT_LT(1u, id_stats.GetLeafPages());
+  ASSERT_LT(1u, id_stats.GetTablePages());
+  ASSERT_NEAR(n, static_cast<double>(id_stats.GetDistinctKeys()), n * 0.1);
+  ASSERT_NEAR(100, static_cast<double>(name_index->GetStatistics().GetLeadingDistinct()), 10);
+  // executors keep the entry count current between two runs
+  std::vector<Field> fields{Field(TypeId::kTypeInt, n)};
+  id_index->RecordInsert(Row(fields));
+  ASSERT_EQ(n + 1, id_stats.GetEntryCount());
+  uint32_t leaf_pages = id_stats.GetLeafPages();
+  uint32_t buckets = id_stats.GetBucketCount();
+  delete db_01;
+  // statistics are read back with the catalog
+  auto *db_02 = new DBStorageEngine(db_name, false);
+  IndexInfo *loaded = nullptr;
+  ASSERT_EQ(DB_SUCCESS, db_02->catalog_mgr_->GetIndex("t", "id_idx", loaded));
+  const auto &loaded_stats = loaded->GetStatistics();
+  ASSERT_TRUE(loaded_stats.IsAnalyzed());
+  ASSERT_EQ(n + 1, loaded_stats.GetEntryCount());
+  ASSERT_EQ(leaf_pages, loaded_stats.GetLeafPages());
+  ASSERT_EQ(buckets, loaded_stats.GetBucketCount());
+  std::string low = Encode(1000, loaded->GetIndexKeySchema());
+  std::string high = Encode(2000, loaded->GetIndexKeySchema());
+  ASSERT_NEAR(0.2, loaded_stats.RangeSelectivity(&low, true, &high, false), 0.03);
+  delete db_02;
+}
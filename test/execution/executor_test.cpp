@@ -1,12 +1,16 @@
 //
 // Created by njz on 2023/1/26.
 //
+#include "executor/executors/hash_join_executor.h"
+#include "executor/executors/merge_join_executor.h"
+#include "executor/executors/seq_scan_executor.h"
 #include "executor/plans/delete_plan.h"
 #include "executor/plans/insert_plan.h"
 #include "executor/plans/seq_scan_plan.h"
 #include "executor/plans/update_plan.h"
 #include "executor/plans/values_plan.h"
 #include "executor_test_util.h"  // NOLINT
+#include "planner/planner.h"
 
 // SELECT id FROM table-1 WHERE id < 500
 TEST_F(ExecutorTest, SimpleSeqScanTest) {
@@ -155,3 +159,484 @@ TEST_F(ExecutorTest, SimpleUpdateTest) {
     ASSERT_TRUE(row.GetField(1)->CompareEquals(Field(kTypeChar, const_cast<char *>("minisql"), 7, false)));
   }
 }
+
+// CREATE INDEX index-1 ON table-1 (id) WHERE account >= 0;
+TEST_F(ExecutorTest, PartialIndexTest) {
+  TableInfo *table_info;
+  GetExecutorContext()->GetCatalog()->GetTable("table-1", table_info);
+  const Schema *schema = table_info->GetSchema();
+  IndexPredicate index_predicate;
+  index_predicate.AddTerm(2, ">=", Field(kTypeFloat, 0.f));
+  IndexInfo *index_info = nullptr;
+  ASSERT_EQ(DB_SUCCESS, GetExecutorContext()->GetCatalog()->CreateIndex("table-1", "index-1", {"id"}, GetTxn(),
+                                                                        index_info, "bptree", index_predicate));
+  ASSERT_TRUE(index_info->IsPartial());
+  // only the rows with a non-negative account are indexed
+  auto indexed_key = [&](const Field &id) {
+    std::vector<RowId> rids;
+    Fields fields;
+    fields.emplace_back(id);
+    index_info->GetIndex()->ScanKey(Row(fields), rids, GetTxn());
+    return !rids.empty();
+  };
+  auto indexed = [&](int32_t id) { return indexed_key(Field(kTypeInt, id)); };
+  size_t included = 0;
+  for (auto iter = table_info->GetTableHeap()->Begin(GetTxn()); iter != table_info->GetTableHeap()->End(); ++iter) {
+    bool expected = iter->GetField(2)->CompareGreaterThanEquals(Field(kTypeFloat, 0.f)) == CmpBool::kTrue;
+    ASSERT_EQ(expected, indexed_key(*iter->GetField(0)));
+    included += expected;
+  }
+  ASSERT_LT(0u, included);
+  ASSERT_GT(1000u, included);
+
+  // INSERT INTO table-1 VALUES (1001, "aaa", 5), (1002, "bbb", -5);
+  auto name = MakeConstantValueExpression(Field(kTypeChar, const_cast<char *>("aaa"), 3, false));
+  std::vector<std::vector<AbstractExpressionRef>> raw_values{
+      {MakeConstantValueExpression(Field(kTypeInt, 1001)), name, MakeConstantValueExpression(Field(kTypeFloat, 5.f))},
+      {MakeConstantValueExpression(Field(kTypeInt, 1002)), name, MakeConstantValueExpression(Field(kTypeFloat, -5.f))}};
+  auto insert_plan =
+      std::make_shared<InsertPlanNode>(nullptr, std::make_shared<ValuesPlanNode>(nullptr, raw_values), "table-1");
+  std::vector<Row> result_set;
+  GetExecutionEngine()->ExecutePlan(insert_plan, &result_set, GetTxn(), GetExecutorContext());
+  ASSERT_TRUE(indexed(1001));
+  ASSERT_FALSE(indexed(1002));
+
+  // UPDATE table-1 SET account = -1 WHERE id = 1001, and account = 1 WHERE id = 1002
+  auto col_id = MakeColumnValueExpression(*schema, 0, "id");
+  auto update = [&](int32_t id, float account) {
+    auto predicate = MakeComparisonExpression(col_id, MakeConstantValueExpression(Field(kTypeInt, id)), "=");
+    auto scan_plan = std::make_shared<SeqScanPlanNode>(schema, "table-1", predicate);
+    std::unordered_map<uint32_t, AbstractExpressionRef> update_attrs{
+        {2, MakeConstantValueExpression(Field(kTypeFloat, account))}};
+    auto update_plan = std::make_shared<UpdatePlanNode>(schema, scan_plan, "table-1", update_attrs);
+    std::vector<Row> updated;
+    GetExecutionEngine()->ExecutePlan(update_plan, &updated, GetTxn(), GetExecutorContext());
+  };
+  update(1001, -1.f);
+  update(1002, 1.f);
+  ASSERT_FALSE(indexed(1001));
+  ASSERT_TRUE(indexed(1002));
+
+  // DELETE FROM table-1 WHERE id = 1002
+  auto delete_predicate = MakeComparisonExpression(col_id, MakeConstantValueExpression(Field(kTypeInt, 1002)), "=");
+  auto delete_plan = std::make_shared<DeletePlanNode>(
+      schema, std::make_shared<SeqScanPlanNode>(schema, "table-1", delete_predicate), "table-1");
+  GetExecutionEngine()->ExecutePlan(delete_plan, &result_set, GetTxn(), GetExecutorContext());
+  ASSERT_FALSE(indexed(1002));
+
+  // the planner reads the index only when the query implies its predicate
+  auto col_account = MakeColumnValueExpression(*schema, 0, "account");
+  auto id_below_100 = MakeComparisonExpression(col_id, MakeConstantValueExpression(Field(kTypeInt, 100)), "<");
+  auto plan_select = [&](const AbstractExpressionRef &where, const std::vector<uint32_t> &columns) {
+    auto statement = std::make_shared<SelectStatement>(nullptr, GetExecutorContext());
+    statement->table_name_ = "table-1";
+    statement->column_list_ = {{"id", col_id}, {"account", col_account}};
+    statement->column_in_condition_ = columns;
+    statement->where_ = where;
+    Planner planner(GetExecutorContext());
+    return planner.PlanSelect(statement);
+  };
+  auto account_at_least = [&](float account, const std::string &op) {
+    auto bound = MakeComparisonExpression(col_account, MakeConstantValueExpression(Field(kTypeFloat, account)), op);
+    return std::make_shared<LogicExpression>(id_below_100, bound, LogicType::And);
+  };
+  ASSERT_EQ(PlanType::SeqScan, plan_select(id_below_100, {0})->GetType());
+  ASSERT_EQ(PlanType::SeqScan, plan_select(account_at_least(-1.f, ">="), {0, 2})->GetType());
+  ASSERT_EQ(PlanType::IndexScan, plan_select(account_at_least(0.f, ">"), {0, 2})->GetType());
+  auto plan = plan_select(account_at_least(10.f, ">="), {0, 2});
+  ASSERT_EQ(PlanType::IndexScan, plan->GetType());
+  // and the index scan finds the same rows as a scan of the table
+  std::vector<Row> index_result;
+  GetExecutionEngine()->ExecutePlan(plan, &index_result, GetTxn(), GetExecutorContext());
+  std::vector<Row> seq_result;
+  auto seq_plan = std::make_shared<SeqScanPlanNode>(plan->OutputSchema(), "table-1", account_at_least(10.f, ">="));
+  GetExecutionEngine()->ExecutePlan(seq_plan, &seq_result, GetTxn(), GetExecutorContext());
+  ASSERT_LT(0u, seq_result.size());
+  ASSERT_EQ(seq_result.size(), index_result.size());
+}
+
+// SELECT account, id FROM table-1 WHERE (id < 500 AND account > 0) OR id >= 900 OR name = "" OR name IS NULL
+TEST_F(ExecutorTest, BatchScanTest) {
+  TableInfo *table_info;
+  GetExecutorContext()->GetCatalog()->GetTable("table-1", table_info);
+  const Schema *schema = table_info->GetSchema();
+  // a row with a null name and an empty name
+  std::vector<Field> null_name{Field(kTypeInt, 2000), Field(kTypeChar), Field(kTypeFloat, -1.f)};
+  Row null_row(null_name);
+  ASSERT_TRUE(table_info->GetTableHeap()->InsertTuple(null_row, GetTxn()));
+  std::vector<Field> empty_name{Field(kTypeInt, 2001), Field(kTypeChar, const_cast<char *>(""), 0, true),
+                                Field(kTypeFloat, -1.f)};
+  Row empty_row(empty_name);
+  ASSERT_TRUE(table_info->GetTableHeap()->InsertTuple(empty_row, GetTxn()));
+  auto col_id = MakeColumnValueExpression(*schema, 0, "id");
+  auto col_name = MakeColumnValueExpression(*schema, 0, "name");
+  auto col_account = MakeColumnValueExpression(*schema, 0, "account");
+  auto low_id = MakeComparisonExpression(col_id, MakeConstantValueExpression(Field(kTypeInt, 500)), "<");
+  auto positive = MakeComparisonExpression(col_account, MakeConstantValueExpression(Field(kTypeFloat, 0.f)), ">");
+  auto high_id = MakeComparisonExpression(col_id, MakeConstantValueExpression(Field(kTypeInt, 900)), ">=");
+  auto no_name = MakeComparisonExpression(
+      col_name, MakeConstantValueExpression(Field(kTypeChar, const_cast<char *>(""), 0, true)), "=");
+  auto null = MakeComparisonExpression(col_name, MakeConstantValueExpression(Field(kTypeChar)), "is");
+  auto predicate = std::make_shared<LogicExpression>(
+      std::make_shared<LogicExpression>(std::make_shared<LogicExpression>(low_id, positive, LogicType::And), high_id,
+                                        LogicType::Or),
+      std::make_shared<LogicExpression>(no_name, null, LogicType::Or), LogicType::Or);
+  auto out_schema = MakeOutputSchema({{"account", col_account}, {"id", col_id}});
+  auto plan = std::make_shared<SeqScanPlanNode>(out_schema, table_info->GetTableName(), predicate);
+
+  // the rows of the batches are the rows returned by Next
+  SeqScanExecutor row_executor(GetExecutorContext(), plan.get());
+  row_executor.Init();
+  std::vector<Row> expected;
+  Row row;
+  RowId rid;
+  while (row_executor.Next(&row, &rid)) {
+    row.SetRowId(rid);
+    expected.push_back(row);
+  }
+  ASSERT_LT(0u, expected.size());
+  SeqScanExecutor batch_executor(GetExecutorContext(), plan.get());
+  batch_executor.Init();
+  RowBatch batch;
+  size_t count = 0;
+  while (batch_executor.NextBatch(batch)) {
+    ASSERT_EQ(2u, batch.GetColumnCount());
+    for (auto i : batch.GetSelection()) {
+      ASSERT_LT(count, expected.size());
+      batch.GetRow(i, row);
+      ASSERT_EQ(expected[count].GetRowId(), row.GetRowId());
+      ASSERT_EQ(CmpBool::kTrue, expected[count].GetField(0)->CompareEquals(*row.GetField(0)));
+      ASSERT_EQ(CmpBool::kTrue, expected[count].GetField(1)->CompareEquals(*row.GetField(1)));
+      count++;
+    }
+  }
+  ASSERT_EQ(expected.size(), count);
+  size_t matches = 0;
+  for (auto iter = table_info->GetTableHeap()->Begin(GetTxn()); iter != table_info->GetTableHeap()->End(); ++iter) {
+    int32_t id = 0;
+    iter->GetField(0)->SerializeTo(reinterpret_cast<char *>(&id));
+    bool positive_account = iter->GetField(2)->CompareGreaterThan(Field(kTypeFloat, 0.f)) == CmpBool::kTrue;
+    bool no_name = iter->GetField(1)->IsNull() || iter->GetField(1)->GetLength() == 0;
+    matches += (id < 500 && positive_account) || id >= 900 || no_name;
+  }
+  ASSERT_EQ(matches, count);
+
+  // SELECT * FROM table-1 through the execute engine
+  std::vector<Row> result_set;
+  auto all_plan = std::make_shared<SeqScanPlanNode>(schema, table_info->GetTableName(), nullptr);
+  GetExecutionEngine()->ExecutePlan(all_plan, &result_set, GetTxn(), GetExecutorContext());
+  ASSERT_EQ(1002u, result_set.size());
+  for (const auto &result : result_set) {
+    if (result.GetField(0)->CompareEquals(Field(kTypeInt, 2000)) == CmpBool::kTrue) {
+      ASSERT_TRUE(result.GetField(1)->IsNull());
+    } else {
+      ASSERT_FALSE(result.GetField(1)->IsNull());
+    }
+  }
+}
+
+// the compiled predicates accept the rows the expression trees evaluate to true
+TEST_F(ExecutorTest, CompiledPredicateTest) {
+  TableInfo *table_info;
+  GetExecutorContext()->GetCatalog()->GetTable("table-1", table_info);
+  const Schema *schema = table_info->GetSchema();
+  std::vector<Field> null_name{Field(kTypeInt, 2000), Field(kTypeChar), Field(kTypeFloat, -1.f)};
+  Row null_row(null_name);
+  ASSERT_TRUE(table_info->GetTableHeap()->InsertTuple(null_row, GetTxn()));
+  auto col_id = MakeColumnValueExpression(*schema, 0, "id");
+  auto col_name = MakeColumnValueExpression(*schema, 0, "name");
+  auto col_account = MakeColumnValueExpression(*schema, 0, "account");
+  auto int_of = [&](int32_t value) { return MakeConstantValueExpression(Field(kTypeInt, value)); };
+  auto float_of = [&](float value) { return MakeConstantValueExpression(Field(kTypeFloat, value)); };
+  auto m = MakeConstantValueExpression(Field(kTypeChar, const_cast<char *>("m"), 1, true));
+  auto both = [](const AbstractExpressionRef &left, const AbstractExpressionRef &right) {
+    return std::make_shared<LogicExpression>(left, right, LogicType::And);
+  };
+  auto either = [](const AbstractExpressionRef &left, const AbstractExpressionRef &right) {
+    return std::make_shared<LogicExpression>(left, right, LogicType::Or);
+  };
+  std::vector<AbstractExpressionRef> predicates{
+      MakeComparisonExpression(col_id, int_of(500), "<="),
+      MakeComparisonExpression(int_of(500), col_id, "<"),
+      MakeComparisonExpression(col_account, float_of(0.f), ">="),
+      MakeComparisonExpression(col_name, m, "<"),
+      MakeComparisonExpression(m, col_name, "<>"),
+      MakeComparisonExpression(col_name, MakeConstantValueExpression(Field(kTypeChar)), "not"),
+      MakeComparisonExpression(col_id, MakeConstantValueExpression(Field(kTypeInt)), "="),
+      MakeComparisonExpression(col_id, col_id, "="),
+      both(MakeComparisonExpression(col_id, int_of(100), ">"), MakeComparisonExpression(col_name, m, ">=")),
+      either(both(MakeComparisonExpression(col_id, int_of(100), "<"),
+                  MakeComparisonExpression(col_account, float_of(100.f), ">")),
+             either(MakeComparisonExpression(col_name, MakeConstantValueExpression(Field(kTypeChar)), "is"),
+                    MakeComparisonExpression(col_id, int_of(900), "=")))};
+  for (const auto &predicate : predicates) {
+    CompiledPredicate compiled(predicate);
+    size_t accepted = 0;
+    RowBatch batch;
+    batch.Init(schema);
+    for (auto iter = table_info->GetTableHeap()->Begin(GetTxn()); iter != table_info->GetTableHeap()->End(); ++iter) {
+      bool expected = predicate->Evaluate(&*iter).CompareEquals(Field(kTypeInt, 1)) == CmpBool::kTrue;
+      ASSERT_EQ(expected, compiled.Evaluate(*iter));
+      accepted += expected;
+      batch.AppendRow(*iter);
+    }
+    compiled.EvaluateBatch(batch, batch.GetSelection());
+    ASSERT_EQ(accepted, batch.GetSelection().size());
+  }
+  ASSERT_TRUE(CompiledPredicate(nullptr).Evaluate(null_row));
+}
+
+/**
+ * Create table-2 of orders (id, owner, amount): two orders for each of 1500
+ * owners, the last 500 of them not in table-1, and 100 orders without owner.
+ * With null_owners unset the owner column is non-null (as posting indexes
+ * need) and those orders have owner -1 instead, which no user has either.
+ */
+static TableInfo *CreateOrders(ExecuteContext *context, Txn *txn, bool null_owners = true) {
+  std::vector<Column *> columns = {new Column("id", TypeId::kTypeInt, 0, false, false),
+                                   new Column("owner", TypeId::kTypeInt, 1, null_owners, false),
+                                   new Column("amount", TypeId::kTypeInt, 2, true, false)};
+  Schema orders_schema(columns);
+  TableInfo *orders = nullptr;
+  EXPECT_EQ(DB_SUCCESS, context->GetCatalog()->CreateTable("table-2", &orders_schema, txn, orders));
+  for (int32_t i = 0; i < 3100; i++) {
+    std::vector<Field> fields;
+    fields.emplace_back(kTypeInt, i);
+    if (i < 3000) {
+      fields.emplace_back(kTypeInt, i % 1500);
+    } else if (null_owners) {
+      fields.emplace_back(kTypeInt);
+    } else {
+      fields.emplace_back(kTypeInt, -1);
+    }
+    fields.emplace_back(kTypeInt, i % 100);
+    Row row(fields);
+    EXPECT_TRUE(orders->GetTableHeap()->InsertTuple(row, txn));
+  }
+  return orders;
+}
+
+// the sorted (owner, amount) pairs of the orders of owners below max_owner with an amount below max_amount
+static std::vector<std::pair<int32_t, int32_t>> ExpectedOrders(int32_t max_owner, int32_t max_amount) {
+  std::vector<std::pair<int32_t, int32_t>> expected;
+  for (int32_t i = 0; i < 3000; i++) {
+    if (i % 1500 < max_owner && i % 100 < max_amount) {
+      expected.emplace_back(i % 1500, i % 100);
+    }
+  }
+  std::sort(expected.begin(), expected.end());
+  return expected;
+}
+
+// the sorted pairs of the two INT columns of the rows
+static std::vector<std::pair<int32_t, int32_t>> IdPairs(const std::vector<Row> &rows) {
+  std::vector<std::pair<int32_t, int32_t>> pairs;
+  for (const auto &row : rows) {
+    int32_t first;
+    int32_t second;
+    row.GetField(0)->SerializeTo(reinterpret_cast<char *>(&first));
+    row.GetField(1)->SerializeTo(reinterpret_cast<char *>(&second));
+    pairs.emplace_back(first, second);
+  }
+  std::sort(pairs.begin(), pairs.end());
+  return pairs;
+}
+
+// SELECT table-1.id, table-2.amount FROM table-1, table-2 WHERE table-1.id = table-2.owner AND table-2.amount < 50
+TEST_F(ExecutorTest, HashJoinTest) {
+  TableInfo *users;
+  GetExecutorContext()->GetCatalog()->GetTable("table-1", users);
+  TableInfo *orders = CreateOrders(GetExecutorContext(), GetTxn());
+  auto statement = std::make_shared<SelectStatement>(nullptr, GetExecutorContext());
+  statement->table_name_ = "table-1";
+  statement->join_table_name_ = "table-2";
+  // columns are found by table name, or by their name when only one table has them
+  ASSERT_EQ(1u, statement->MakeJoinColumnValueExpression("owner")->GetRowIdx());
+  ASSERT_EQ(0u, statement->MakeJoinColumnValueExpression("table-1.id")->GetRowIdx());
+  ASSERT_EQ(1u, statement->MakeJoinColumnValueExpression("table-2.id")->GetRowIdx());
+  ASSERT_THROW(statement->MakeJoinColumnValueExpression("id"), std::logic_error);
+  auto user_id = MakeColumnValueExpression(*users->GetSchema(), 0, "id");
+  auto owner = MakeColumnValueExpression(*orders->GetSchema(), 1, "owner");
+  auto amount = MakeColumnValueExpression(*orders->GetSchema(), 1, "amount");
+  statement->column_list_ = {{"id", user_id}, {"amount", amount}};
+  statement->where_ = std::make_shared<LogicExpression>(
+      MakeComparisonExpression(user_id, owner, "="),
+      MakeComparisonExpression(amount, MakeConstantValueExpression(Field(kTypeInt, 50)), "<"), LogicType::And);
+  Planner planner(GetExecutorContext());
+  auto plan = planner.PlanSelect(statement);
+  ASSERT_EQ(PlanType::HashJoin, plan->GetType());
+  // the condition on amount is pushed down into the scan of table-2
+  auto join_plan = dynamic_pointer_cast<const HashJoinPlanNode>(plan);
+  ASSERT_EQ(nullptr, join_plan->GetPredicate());
+  ASSERT_NE(nullptr, dynamic_pointer_cast<const SeqScanPlanNode>(join_plan->GetRightPlan())->GetPredicate());
+
+  auto expected = ExpectedOrders(1000, 50);
+  std::vector<Row> result_set;
+  ASSERT_EQ(DB_SUCCESS, GetExecutionEngine()->ExecutePlan(plan, &result_set, GetTxn(), GetExecutorContext()));
+  ASSERT_EQ(expected, IdPairs(result_set));
+
+  // a budget of a few rows partitions both sides to disk, partitions still too large are split again
+  for (size_t budget : {size_t{4096}, size_t{64}}) {
+    auto spill_plan = std::make_shared<HashJoinPlanNode>(
+        plan->OutputSchema(), join_plan->GetLeftPlan(), join_plan->GetRightPlan(), join_plan->GetLeftKeys(),
+        join_plan->GetRightKeys(), nullptr, join_plan->GetOutputExprs(), budget);
+    HashJoinExecutor executor(
+        GetExecutorContext(), spill_plan.get(),
+        std::make_unique<SeqScanExecutor>(
+            GetExecutorContext(), dynamic_cast<const SeqScanPlanNode *>(join_plan->GetLeftPlan().get())),
+        std::make_unique<SeqScanExecutor>(
+            GetExecutorContext(), dynamic_cast<const SeqScanPlanNode *>(join_plan->GetRightPlan().get())));
+    executor.Init();
+    ASSERT_TRUE(executor.IsSpilled());
+    std::vector<Row> spilled;
+    Row row;
+    RowId rid;
+    while (executor.Next(&row, &rid)) {
+      spilled.push_back(row);
+    }
+    ASSERT_EQ(expected, IdPairs(spilled));
+  }
+  delete plan->OutputSchema();
+}
+
+// SELECT table-1.id, table-2.amount FROM table-1, table-2 WHERE table-1.id = table-2.owner AND ...
+TEST_F(ExecutorTest, IndexNestedLoopJoinTest) {
+  TableInfo *users;
+  GetExecutorContext()->GetCatalog()->GetTable("table-1", users);
+  TableInfo *orders = CreateOrders(GetExecutorContext(), GetTxn(), false);
+  auto user_id = MakeColumnValueExpression(*users->GetSchema(), 0, "id");
+  auto owner = MakeColumnValueExpression(*orders->GetSchema(), 1, "owner");
+  auto amount = MakeColumnValueExpression(*orders->GetSchema(), 1, "amount");
+  auto plan_join = [&](const AbstractExpressionRef &condition) {
+    auto statement = std::make_shared<SelectStatement>(nullptr, GetExecutorContext());
+    statement->table_name_ = "table-1";
+    statement->join_table_name_ = "table-2";
+    statement->column_list_ = {{"id", user_id}, {"amount", amount}};
+    statement->where_ = std::make_shared<LogicExpression>(MakeComparisonExpression(user_id, owner, "="), condition,
+                                                          LogicType::And);
+    Planner planner(GetExecutorContext());
+    return planner.PlanSelect(statement);
+  };
+  auto amount_below = MakeComparisonExpression(amount, MakeConstantValueExpression(Field(kTypeInt, 50)), "<");
+  auto id_below = MakeComparisonExpression(user_id, MakeConstantValueExpression(Field(kTypeInt, 600)), "<");
+  auto check = [&](const AbstractPlanNodeRef &plan, const std::vector<std::pair<int32_t, int32_t>> &expected) {
+    std::vector<Row> result_set;
+    ASSERT_EQ(DB_SUCCESS, GetExecutionEngine()->ExecutePlan(plan, &result_set, GetTxn(), GetExecutorContext()));
+    ASSERT_EQ(expected, IdPairs(result_set));
+    delete plan->OutputSchema();
+  };
+
+  // the unique index on table-1.id makes table-1 the inner table, probed by the orders
+  IndexInfo *id_index = nullptr;
+  ASSERT_EQ(DB_SUCCESS, GetExecutorContext()->GetCatalog()->CreateIndex("table-1", "index-id", {"id"}, GetTxn(),
+                                                                        id_index, "bptree"));
+  auto plan = plan_join(amount_below);
+  ASSERT_EQ(PlanType::IndexNestedLoopJoin, plan->GetType());
+  auto join_plan = dynamic_pointer_cast<const IndexNestedLoopJoinPlanNode>(plan);
+  ASSERT_EQ(id_index, join_plan->GetIndex());
+  ASSERT_TRUE(join_plan->IsInnerLeft());
+  check(plan, ExpectedOrders(1000, 50));
+  // a condition on the inner table filters the rows found in the index
+  plan = plan_join(id_below);
+  ASSERT_NE(nullptr, dynamic_pointer_cast<const IndexNestedLoopJoinPlanNode>(plan)->GetInnerPredicate());
+  check(plan, ExpectedOrders(600, 100));
+
+  // with an index on table-2.owner as well, the second table is the inner one and the owners repeat in it
+  IndexInfo *owner_index = nullptr;
+  ASSERT_EQ(DB_SUCCESS, GetExecutorContext()->GetCatalog()->CreateIndex("table-2", "index-owner", {"owner"},
+                                                                        GetTxn(), owner_index, "posting"));
+  plan = plan_join(id_below);
+  join_plan = dynamic_pointer_cast<const IndexNestedLoopJoinPlanNode>(plan);
+  ASSERT_EQ(owner_index, join_plan->GetIndex());
+  ASSERT_FALSE(join_plan->IsInnerLeft());
+  check(plan, ExpectedOrders(600, 100));
+  check(plan_join(amount_below), ExpectedOrders(1000, 50));
+}
+
+// SELECT table-1.id, table-2.amount FROM table-1, table-2 WHERE table-1.id = table-2.owner AND ...
+TEST_F(ExecutorTest, MergeJoinTest) {
+  TableInfo *users;
+  GetExecutorContext()->GetCatalog()->GetTable("table-1", users);
+  TableInfo *orders = CreateOrders(GetExecutorContext(), GetTxn(), false);
+  auto user_id = MakeColumnValueExpression(*users->GetSchema(), 0, "id");
+  auto owner = MakeColumnValueExpression(*orders->GetSchema(), 1, "owner");
+  auto amount = MakeColumnValueExpression(*orders->GetSchema(), 1, "amount");
+  auto plan_join = [&](const AbstractExpressionRef &condition) {
+    auto statement = std::make_shared<SelectStatement>(nullptr, GetExecutorContext());
+    statement->table_name_ = "table-1";
+    statement->join_table_name_ = "table-2";
+    statement->column_list_ = {{"id", user_id}, {"amount", amount}};
+    statement->where_ = std::make_shared<LogicExpression>(MakeComparisonExpression(user_id, owner, "="), condition,
+                                                          LogicType::And);
+    Planner planner(GetExecutorContext());
+    return planner.PlanSelect(statement);
+  };
+  auto amount_below = MakeComparisonExpression(amount, MakeConstantValueExpression(Field(kTypeInt, 50)), "<");
+  auto id_below = MakeComparisonExpression(user_id, MakeConstantValueExpression(Field(kTypeInt, 600)), "<");
+  auto check = [&](const AbstractPlanNodeRef &plan, const std::vector<std::pair<int32_t, int32_t>> &expected) {
+    std::vector<Row> result_set;
+    ASSERT_EQ(DB_SUCCESS, GetExecutionEngine()->ExecutePlan(plan, &result_set, GetTxn(), GetExecutorContext()));
+    ASSERT_EQ(expected, IdPairs(result_set));
+    delete plan->OutputSchema();
+  };
+
+  // an index led by table-2.owner returns the orders in join key order, table-1 is sorted to be merged with them
+  IndexInfo *owner_index = nullptr;
+  ASSERT_EQ(DB_SUCCESS, GetExecutorContext()->GetCatalog()->CreateIndex("table-2", "index-owner-id",
+                                                                        {"owner", "id"}, GetTxn(), owner_index,
+                                                                        "bptree"));
+  auto plan = plan_join(amount_below);
+  ASSERT_EQ(PlanType::MergeJoin, plan->GetType());
+  auto join_plan = dynamic_pointer_cast<const MergeJoinPlanNode>(plan);
+  ASSERT_TRUE(join_plan->SortsLeft());
+  ASSERT_FALSE(join_plan->SortsRight());
+  ASSERT_TRUE(dynamic_pointer_cast<const IndexScanPlanNode>(join_plan->GetRightPlan())->IsKeyOrdered());
+  check(plan, ExpectedOrders(1000, 50));
+
+  // with table-1 ordered as well, both sides are merged as the indexes return them
+  IndexInfo *id_index = nullptr;
+  ASSERT_EQ(DB_SUCCESS, GetExecutorContext()->GetCatalog()->CreateIndex("table-1", "index-id", {"id"}, GetTxn(),
+                                                                        id_index, "bptree"));
+  plan = plan_join(id_below);
+  ASSERT_EQ(PlanType::MergeJoin, plan->GetType());
+  join_plan = dynamic_pointer_cast<const MergeJoinPlanNode>(plan);
+  ASSERT_FALSE(join_plan->SortsLeft());
+  ASSERT_FALSE(join_plan->SortsRight());
+  check(plan, ExpectedOrders(600, 100));
+  // a filtered table-2 is rather joined by looking its rows up in the index on table-1.id
+  plan = plan_join(amount_below);
+  ASSERT_EQ(PlanType::IndexNestedLoopJoin, plan->GetType());
+  check(plan, ExpectedOrders(1000, 50));
+
+  // the orders joined with themselves on the owner, every owner repeats on both sides and
+  // the sorts of a few KB spill to disk
+  auto left_owner = MakeColumnValueExpression(*orders->GetSchema(), 0, "owner");
+  auto left_id = MakeColumnValueExpression(*orders->GetSchema(), 0, "id");
+  auto right_id = MakeColumnValueExpression(*orders->GetSchema(), 1, "id");
+  auto scan = std::make_shared<SeqScanPlanNode>(orders->GetSchema(), "table-2", nullptr);
+  auto self_plan = std::make_shared<MergeJoinPlanNode>(
+      nullptr, scan, scan, std::vector<AbstractExpressionRef>{left_owner}, std::vector<AbstractExpressionRef>{owner},
+      MakeComparisonExpression(left_id, right_id, "<>"), std::vector<AbstractExpressionRef>{left_id, right_id}, true,
+      true, 4096);
+  MergeJoinExecutor executor(GetExecutorContext(), self_plan.get(),
+                             std::make_unique<SeqScanExecutor>(GetExecutorContext(), scan.get()),
+                             std::make_unique<SeqScanExecutor>(GetExecutorContext(), scan.get()));
+  executor.Init();
+  ASSERT_LT(1u, executor.GetRunCount());
+  std::vector<Row> result_set;
+  Row row;
+  RowId rid;
+  while (executor.Next(&row, &rid)) {
+    result_set.push_back(row);
+  }
+  std::vector<std::pair<int32_t, int32_t>> expected;
+  for (int32_t i = 0; i < 3100; i++) {
+    for (int32_t j = 0; j < 3100; j++) {
+      bool same_owner = i < 3000 ? j < 3000 && i % 1500 == j % 1500 : j >= 3000;
+      if (same_owner && i != j) {
+        expected.emplace_back(i, j);
+      }
+    }
+  }
+  ASSERT_EQ(expected, IdPairs(result_set));
+}
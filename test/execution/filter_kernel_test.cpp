@@ -0,0 +1,105 @@
+#include "planner/expressions/filter_kernel.h"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utils/utils.h"
+
+static const std::vector<FilterKernel::Isa> isa_list = {FilterKernel::Isa::kScalar, FilterKernel::Isa::kAVX2};
+
+static const std::vector<ComparisonType> op_list = {ComparisonType::Equal,           ComparisonType::NotEqual,
+                                                    ComparisonType::LessThan,        ComparisonType::LessThanOrEqual,
+                                                    ComparisonType::GreaterThan,     ComparisonType::GreaterThanOrEqual};
+
+template <typename T>
+static bool Expected(T a, ComparisonType op, T b) {
+  switch (op) {
+    case ComparisonType::Equal:
+      return a == b;
+    case ComparisonType::NotEqual:
+      return a != b;
+    case ComparisonType::LessThan:
+      return a < b;
+    case ComparisonType::LessThanOrEqual:
+      return a <= b;
+    case ComparisonType::GreaterThan:
+      return a > b;
+    default:
+      return a >= b;
+  }
+}
+
+template <typename T>
+static void CheckCompare(const std::vector<T> &values, T value) {
+  uint32_t n = values.size();
+  for (auto op : op_list) {
+    // the kernels must not write past the words of n values
+    std::vector<uint64_t> bitmap(FilterKernel::BitmapWords(n) + 1, 0xABCDu);
+    FilterKernel::Compare(values.data(), n, op, value, bitmap.data());
+    for (uint32_t i = 0; i < n; i++) {
+      ASSERT_EQ(Expected(values[i], op, value), ((bitmap[i / 64] >> (i % 64)) & 1) != 0);
+    }
+    ASSERT_EQ(0xABCDu, bitmap.back());
+  }
+}
+
+TEST(FilterKernelTest, CompareTest) {
+  FilterKernel::Isa origin = FilterKernel::GetIsa();
+  for (auto isa : isa_list) {
+    FilterKernel::SetIsa(isa);
+    for (uint32_t n : {0u, 1u, 7u, 8u, 63u, 64u, 65u, 200u, 1024u}) {
+      std::vector<int32_t> ints;
+      std::vector<float> floats;
+      for (uint32_t i = 0; i < n; i++) {
+        ints.push_back(RandomUtils::RandomInt(-10, 10));
+        floats.push_back(static_cast<float>(ints.back()) / 4);
+      }
+      for (int32_t value : {INT32_MIN, -3, 0, 5, INT32_MAX}) {
+        CheckCompare(ints, value);
+        CheckCompare(floats, static_cast<float>(value) / 4);
+      }
+    }
+  }
+  FilterKernel::SetIsa(origin);
+}
+
+TEST(FilterKernelTest, EqualCharsTest) {
+  FilterKernel::Isa origin = FilterKernel::GetIsa();
+  // values differing in the length, the first or the last byte
+  std::string value(40, 'x');
+  std::vector<std::string> strings{"", "x", value, value.substr(0, 32), value.substr(0, 33), value + "x"};
+  std::string last(value);
+  last.back() = 'y';
+  strings.push_back(last);
+  std::string first(value);
+  first.front() = 'y';
+  strings.push_back(first);
+  std::string chars;
+  std::vector<uint32_t> offsets{0};
+  for (int i = 0; i < 100; i++) {
+    chars += strings[i % strings.size()];
+    offsets.push_back(chars.size());
+  }
+  uint32_t n = offsets.size() - 1;
+  for (auto isa : isa_list) {
+    FilterKernel::SetIsa(isa);
+    for (const auto &target : strings) {
+      std::vector<uint64_t> bitmap(FilterKernel::BitmapWords(n));
+      FilterKernel::EqualChars(chars.data(), offsets.data(), n, target.data(), target.size(), bitmap.data());
+      for (uint32_t i = 0; i < n; i++) {
+        ASSERT_EQ(strings[i % strings.size()] == target, ((bitmap[i / 64] >> (i % 64)) & 1) != 0);
+      }
+    }
+  }
+  FilterKernel::SetIsa(origin);
+  // null positions are never selected
+  std::vector<uint64_t> bitmap{0b1011};
+  std::vector<uint8_t> nulls{0, 1, 0, 0};
+  std::vector<uint32_t> selection{0, 1, 2, 3};
+  FilterKernel::Select(bitmap.data(), nulls.data(), false, selection);
+  ASSERT_EQ((std::vector<uint32_t>{0, 3}), selection);
+  selection = {0, 1, 2, 3};
+  FilterKernel::Select(bitmap.data(), nulls.data(), true, selection);
+  ASSERT_EQ((std::vector<uint32_t>{2}), selection);
+}
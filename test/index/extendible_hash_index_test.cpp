@@ -0,0 +1,139 @@
+#include "index/extendible_hash_index.h"
+
+#include <cstring>
+
+#include "common/instance.h"
+#include "gtest/gtest.h"
+#include "utils/utils.h"
+
+static const std::string db_name = "extendible_hash_index_test.db";
+
+TEST(ExtendibleHashIndexTest, InsertRemoveTest) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("id", TypeId::kTypeInt, 0, false, false)};
+  std::vector<uint32_t> index_key_map{0};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  auto *index = new ExtendibleHashIndex(0, index_schema, 16, engine.bpm_);
+  const int n = 50000;
+  std::vector<int32_t> keys;
+  for (int i = 0; i < n; i++) {
+    keys.push_back(i);
+  }
+  ShuffleArray(keys);
+  auto make_key = [](int32_t value) {
+    std::vector<Field> fields{Field(TypeId::kTypeInt, value)};
+    return Row(fields);
+  };
+  for (auto key : keys) {
+    ASSERT_EQ(DB_SUCCESS, index->InsertEntry(make_key(key), RowId(key), nullptr));
+  }
+  // unique keys only
+  ASSERT_EQ(DB_FAILED, index->InsertEntry(make_key(keys[0]), RowId(0), nullptr));
+  std::vector<RowId> result;
+  for (int i = 0; i < n; i++) {
+    result.clear();
+    ASSERT_EQ(DB_SUCCESS, index->ScanKey(make_key(i), result, nullptr));
+    ASSERT_EQ(1, result.size());
+    ASSERT_EQ(i, result[0].Get());
+  }
+  ASSERT_EQ(DB_KEY_NOT_FOUND, index->ScanKey(make_key(n), result, nullptr));
+  // no order, no ranges
+  ASSERT_EQ(DB_FAILED, index->ScanKey(make_key(0), result, nullptr, ">"));
+  Row point = make_key(42);
+  auto cursor = index->ScanRange({&point, true, &point, true}, nullptr);
+  RowId row_id;
+  ASSERT_TRUE(cursor->Next(row_id));
+  ASSERT_EQ(42, row_id.Get());
+  ASSERT_FALSE(cursor->Next(row_id));
+  // remove the odd keys, then the rest, merging the buckets back
+  for (int round = 1; round >= 0; round--) {
+    for (auto key : keys) {
+      if (key % 2 == round) {
+        ASSERT_EQ(DB_SUCCESS, index->RemoveEntry(make_key(key), RowId(key), nullptr));
+      }
+    }
+    for (int i = 0; i < n; i++) {
+      result.clear();
+      ASSERT_EQ(round == 1 && i % 2 == 0 ? DB_SUCCESS : DB_KEY_NOT_FOUND, index->ScanKey(make_key(i), result, nullptr));
+    }
+  }
+  // the emptied table keeps working
+  ASSERT_EQ(DB_SUCCESS, index->InsertEntry(make_key(7), RowId(7), nullptr));
+  result.clear();
+  ASSERT_EQ(DB_SUCCESS, index->ScanKey(make_key(7), result, nullptr));
+  ASSERT_TRUE(engine.bpm_->CheckAllUnpinned());
+  index->Destroy();
+  delete index;
+}
+
+TEST(ExtendibleHashIndexTest, CompositeCharKeyTest) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("region", TypeId::kTypeChar, 16, 0, false, false),
+                                   new Column("id", TypeId::kTypeInt, 1, false, false)};
+  std::vector<uint32_t> index_key_map{0, 1};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  auto *index = new ExtendibleHashIndex(0, index_schema, 40, engine.bpm_);
+  const char *regions[] = {"north", "south", "east", "west"};
+  auto make_key = [&](int i) {
+    const char *region = regions[i % 4];
+    std::vector<Field> fields{Field(TypeId::kTypeChar, const_cast<char *>(region), strlen(region), true),
+                              Field(TypeId::kTypeInt, i / 4)};
+    return Row(fields);
+  };
+  const int n = 20000;
+  for (int i = 0; i < n; i++) {
+    ASSERT_EQ(DB_SUCCESS, index->InsertEntry(make_key(i), RowId(i), nullptr));
+  }
+  std::vector<RowId> result;
+  for (int i = 0; i < n; i++) {
+    result.clear();
+    ASSERT_EQ(DB_SUCCESS, index->ScanKey(make_key(i), result, nullptr));
+    ASSERT_EQ(i, result[0].Get());
+  }
+  std::vector<Field> missing{Field(TypeId::kTypeChar, const_cast<char *>("up"), 2, true),
+                             Field(TypeId::kTypeInt, 0)};
+  ASSERT_EQ(DB_KEY_NOT_FOUND, index->ScanKey(Row(missing), result, nullptr));
+  index->Destroy();
+  delete index;
+}
+
+TEST(ExtendibleHashIndexTest, BufferPoolFullTest) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("id", TypeId::kTypeInt, 0, false, false)};
+  std::vector<uint32_t> index_key_map{0};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  auto *index = new ExtendibleHashIndex(0, index_schema, 16, engine.bpm_);
+  auto make_key = [](int32_t value) {
+    std::vector<Field> fields{Field(TypeId::kTypeInt, value)};
+    return Row(fields);
+  };
+  for (int i = 0; i < 100; i++) {
+    ASSERT_EQ(DB_SUCCESS, index->InsertEntry(make_key(i), RowId(i), nullptr));
+  }
+  // pin every frame, the pages of the index can no longer be fetched
+  std::vector<page_id_t> pinned;
+  page_id_t page_id;
+  while (engine.bpm_->NewPage(page_id) != nullptr) {
+    pinned.push_back(page_id);
+  }
+  std::vector<RowId> result;
+  ASSERT_EQ(DB_FAILED, index->ScanKey(make_key(1), result, nullptr));
+  ASSERT_EQ(DB_FAILED, index->InsertEntry(make_key(100), RowId(100), nullptr));
+  ASSERT_EQ(DB_FAILED, index->RemoveEntry(make_key(1), RowId(1), nullptr));
+  ASSERT_EQ(DB_FAILED, index->Destroy());
+  for (auto id : pinned) {
+    engine.bpm_->UnpinPage(id, false);
+    engine.bpm_->DeletePage(id);
+  }
+  // nothing was changed by the failed calls
+  for (int i = 0; i <= 100; i++) {
+    result.clear();
+    ASSERT_EQ(i < 100 ? DB_SUCCESS : DB_KEY_NOT_FOUND, index->ScanKey(make_key(i), result, nullptr));
+  }
+  ASSERT_TRUE(engine.bpm_->CheckAllUnpinned());
+  ASSERT_EQ(DB_SUCCESS, index->Destroy());
+  delete index;
+}
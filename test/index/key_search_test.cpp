@@ -0,0 +1,55 @@
+#include "index/key_search.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utils/utils.h"
+
+static const std::vector<KeySearch::Isa> isa_list = {KeySearch::Isa::kScalar, KeySearch::Isa::kSSE42,
+                                                     KeySearch::Isa::kAVX2};
+
+template <typename T>
+static void CheckBounds(const std::vector<T> &keys, const std::vector<T> &probes) {
+  for (auto probe : probes) {
+    int lower = static_cast<int>(std::lower_bound(keys.begin(), keys.end(), probe) - keys.begin());
+    int upper = static_cast<int>(std::upper_bound(keys.begin(), keys.end(), probe) - keys.begin());
+    ASSERT_EQ(lower, KeySearch::LowerBound(keys.data(), static_cast<int>(keys.size()), probe));
+    ASSERT_EQ(upper, KeySearch::UpperBound(keys.data(), static_cast<int>(keys.size()), probe));
+  }
+}
+
+TEST(KeySearchTest, BoundsTest) {
+  KeySearch::Isa origin = KeySearch::GetIsa();
+  for (auto isa : isa_list) {
+    KeySearch::SetIsa(isa);
+    for (int n : {0, 1, 3, 7, 8, 9, 31, 64, 65, 200, 700}) {
+      std::vector<int32_t> ints;
+      std::vector<int64_t> longs;
+      std::vector<float> floats;
+      for (int i = 0; i < n; i++) {
+        // duplicates and negative keys on purpose
+        int32_t v = RandomUtils::RandomInt(-n, n);
+        ints.push_back(v);
+        longs.push_back(static_cast<int64_t>(v) * 10000000000LL);
+        floats.push_back(static_cast<float>(v) / 4);
+      }
+      std::sort(ints.begin(), ints.end());
+      std::sort(longs.begin(), longs.end());
+      std::sort(floats.begin(), floats.end());
+      std::vector<int32_t> int_probes{INT32_MIN, INT32_MAX};
+      std::vector<int64_t> long_probes{INT64_MIN, INT64_MAX};
+      std::vector<float> float_probes;
+      for (int v = -n - 1; v <= n + 1; v++) {
+        int_probes.push_back(v);
+        long_probes.push_back(static_cast<int64_t>(v) * 10000000000LL);
+        float_probes.push_back(static_cast<float>(v) / 4);
+        float_probes.push_back(static_cast<float>(v) / 4 + 0.1f);
+      }
+      CheckBounds(ints, int_probes);
+      CheckBounds(longs, long_probes);
+      CheckBounds(floats, float_probes);
+    }
+  }
+  KeySearch::SetIsa(origin);
+}
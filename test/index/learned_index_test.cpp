@@ -0,0 +1,160 @@
+#include "index/learned_index.h"
+
+#include <random>
+
+#include "common/instance.h"
+#include "gtest/gtest.h"
+#include "utils/utils.h"
+
+static const std::string db_name = "learned_index_test.db";
+
+// n unique keys with random gaps, in increasing order
+static std::vector<int32_t> GappedKeys(int n, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::vector<int32_t> keys;
+  int32_t key = -1000000;
+  for (int i = 0; i < n; i++) {
+    // dense runs broken by a few large jumps, so the model needs several segments
+    key += (i % 5000 == 0) ? 100000 + static_cast<int32_t>(rng() % 100000) : 1 + static_cast<int32_t>(rng() % 8);
+    keys.push_back(key);
+  }
+  return keys;
+}
+
+static dberr_t Load(Index *index, const std::vector<int32_t> &keys) {
+  std::vector<int32_t> shuffled(keys);
+  ShuffleArray(shuffled);
+  size_t pos = 0;
+  auto next = [&](Row &key, RowId &row_id) {
+    if (pos >= shuffled.size()) {
+      return false;
+    }
+    std::vector<Field> fields{Field(TypeId::kTypeInt, shuffled[pos])};
+    key = Row(fields);
+    row_id = RowId(shuffled[pos]);
+    pos++;
+    return true;
+  };
+  return index->BulkLoad(next, nullptr);
+}
+
+static Row KeyRow(int32_t key) {
+  std::vector<Field> fields{Field(TypeId::kTypeInt, key)};
+  return Row(fields);
+}
+
+TEST(LearnedIndexTest, LookupTest) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("id", TypeId::kTypeInt, 0, false, false)};
+  std::vector<uint32_t> index_key_map{0};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  const int n = 100000;
+  std::vector<int32_t> keys = GappedKeys(n, 0);
+  auto *index = new LearnedIndex(0, index_schema, engine.bpm_);
+  ASSERT_EQ(DB_SUCCESS, Load(index, keys));
+  auto stats = index->GetStats();
+  ASSERT_EQ(n, stats.entries);
+  ASSERT_LT(1u, stats.segments);
+  ASSERT_EQ((n + LearnedIndexLeafPage::CAPACITY - 1) / LearnedIndexLeafPage::CAPACITY, stats.leaf_pages);
+  // the index is built once
+  ASSERT_EQ(DB_FAILED, Load(index, keys));
+  ASSERT_EQ(DB_FAILED, index->InsertEntry(KeyRow(keys.back() + 1), RowId(0), nullptr));
+  ASSERT_EQ(DB_FAILED, index->RemoveEntry(KeyRow(keys[0]), RowId(keys[0]), nullptr));
+  std::vector<RowId> result;
+  for (auto key : keys) {
+    result.clear();
+    ASSERT_EQ(DB_SUCCESS, index->ScanKey(KeyRow(key), result, nullptr));
+    ASSERT_EQ(1u, result.size());
+    ASSERT_EQ(key, result[0].Get());
+  }
+  // absent keys, between two keys and beyond both ends
+  std::mt19937 rng(1);
+  for (int i = 0; i < 10000; i++) {
+    int32_t key = keys.front() - 10 + static_cast<int32_t>(rng() % (keys.back() - keys.front() + 20));
+    result.clear();
+    bool present = std::binary_search(keys.begin(), keys.end(), key);
+    ASSERT_EQ(present ? DB_SUCCESS : DB_KEY_NOT_FOUND, index->ScanKey(KeyRow(key), result, nullptr));
+    if (i % 50 != 0) {
+      continue;
+    }
+    // the range operators agree with the sorted keys
+    auto lower = std::lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+    result.clear();
+    index->ScanKey(KeyRow(key), result, nullptr, "<");
+    ASSERT_EQ(lower, result.size());
+    result.clear();
+    index->ScanKey(KeyRow(key), result, nullptr, ">=");
+    ASSERT_EQ(n - lower, result.size());
+    if (!result.empty()) {
+      ASSERT_EQ(keys[lower], result[0].Get());
+    }
+  }
+  result.clear();
+  ASSERT_EQ(DB_SUCCESS, index->ScanKey(KeyRow(keys[10]), result, nullptr, "<>"));
+  ASSERT_EQ(n - 1, result.size());
+  // a descending range is read from its upper bound down, with the keys
+  Row lower_key = KeyRow(keys[1000]);
+  Row upper_key = KeyRow(keys[5000]);
+  auto cursor = index->ScanRange({&lower_key, false, &upper_key, true, true}, nullptr);
+  RowId row_id;
+  Row key;
+  for (int i = 5000; i > 1000; i--) {
+    ASSERT_TRUE(cursor->NextEntry(row_id, key));
+    ASSERT_EQ(keys[i], row_id.Get());
+    ASSERT_EQ(CmpBool::kTrue, key.GetField(0)->CompareEquals(Field(TypeId::kTypeInt, keys[i])));
+  }
+  ASSERT_FALSE(cursor->Next(row_id));
+  delete index;
+  // the model is read back from its pages
+  index = new LearnedIndex(0, index_schema, engine.bpm_);
+  ASSERT_EQ(stats.segments, index->GetStats().segments);
+  for (int i = 0; i < n; i += 7) {
+    result.clear();
+    ASSERT_EQ(DB_SUCCESS, index->ScanKey(KeyRow(keys[i]), result, nullptr));
+    ASSERT_EQ(keys[i], result[0].Get());
+  }
+  index->Destroy();
+  delete index;
+  // duplicate keys cannot be indexed
+  index = new LearnedIndex(1, index_schema, engine.bpm_);
+  keys.push_back(keys.back());
+  ASSERT_EQ(DB_FAILED, Load(index, keys));
+  delete index;
+  delete index_schema;
+}
+
+TEST(LearnedIndexTest, ReadOnlyTableTest) {
+  auto *engine = new DBStorageEngine(db_name, true);
+  auto &catalog = engine->catalog_mgr_;
+  std::vector<Column *> columns = {new Column("id", TypeId::kTypeInt, 0, false, false),
+                                   new Column("name", TypeId::kTypeChar, 16, 1, true, false)};
+  auto schema = std::make_shared<Schema>(columns);
+  Txn txn;
+  TableInfo *table_info = nullptr;
+  ASSERT_EQ(DB_SUCCESS, catalog->CreateTable("t", schema.get(), &txn, table_info));
+  for (int i = 0; i < 3000; i++) {
+    std::string name = "name_" + std::to_string(i);
+    std::vector<Field> fields{Field(TypeId::kTypeInt, i * 3),
+                              Field(TypeId::kTypeChar, const_cast<char *>(name.c_str()), name.size(), true)};
+    Row row(fields);
+    ASSERT_TRUE(table_info->GetTableHeap()->InsertTuple(row, &txn));
+  }
+  IndexInfo *index_info = nullptr;
+  ASSERT_EQ(DB_FAILED, catalog->CreateIndex("t", "name_idx", {"name"}, &txn, index_info, "learned"));
+  ASSERT_EQ(DB_SUCCESS, catalog->CreateIndex("t", "id_idx", {"id"}, &txn, index_info, "learned"));
+  ASSERT_TRUE(index_info->GetIndex()->IsReadOnly());
+  // evenly spaced keys fit one segment
+  auto *learned = dynamic_cast<LearnedIndex *>(index_info->GetIndex());
+  ASSERT_NE(nullptr, learned);
+  ASSERT_EQ(1u, learned->GetStats().segments);
+  delete engine;
+  engine = new DBStorageEngine(db_name, false);
+  ASSERT_EQ(DB_SUCCESS, engine->catalog_mgr_->GetIndex("t", "id_idx", index_info));
+  std::vector<RowId> result;
+  ASSERT_EQ(DB_SUCCESS, index_info->GetIndex()->ScanKey(KeyRow(300), result, nullptr));
+  ASSERT_EQ(1u, result.size());
+  result.clear();
+  ASSERT_EQ(DB_KEY_NOT_FOUND, index_info->GetIndex()->ScanKey(KeyRow(301), result, nullptr));
+  delete engine;
+}
@@ -0,0 +1,149 @@
+#include "index/posting_list_index.h"
+
+#include <algorithm>
+#include <map>
+
+#include "common/instance.h"
+#include "gtest/gtest.h"
+#include "index/basic_comparator.h"
+#include "utils/utils.h"
+
+static const std::string db_name = "posting_list_index_test.db";
+
+using Int32PostingIndex = PostingListIndex<int32_t, BasicComparator<int32_t>>;
+
+static Row MakeKey(int32_t value) {
+  std::vector<Field> fields{Field(TypeId::kTypeInt, value)};
+  return Row(fields);
+}
+
+static std::vector<int64_t> Lookup(Index *index, int32_t value, const std::string &op = "=") {
+  std::vector<RowId> row_ids;
+  index->ScanKey(MakeKey(value), row_ids, nullptr, op);
+  std::vector<int64_t> result;
+  for (auto &row_id : row_ids) {
+    result.push_back(row_id.Get());
+  }
+  return result;
+}
+
+TEST(PostingListIndexTest, DuplicateKeyTest) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("status", TypeId::kTypeInt, 0, false, false)};
+  std::vector<uint32_t> index_key_map{0};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  auto *index = new Int32PostingIndex(0, index_schema, engine.bpm_);
+  // a few hot keys with many rows each, in random row order so that lists are
+  // both appended to and split in the middle
+  const int n = 30000;
+  const int key_count = 4;
+  std::vector<RowId> row_ids;
+  for (int i = 0; i < n; i++) {
+    row_ids.emplace_back(i / 50, i % 50);
+  }
+  ShuffleArray(row_ids);
+  std::map<int32_t, std::vector<int64_t>> expected;
+  for (auto &row_id : row_ids) {
+    int32_t status = row_id.Get() % key_count;
+    ASSERT_EQ(DB_SUCCESS, index->InsertEntry(MakeKey(status), row_id, nullptr));
+    expected[status].push_back(row_id.Get());
+  }
+  // a key with a single row keeps it inline
+  ASSERT_EQ(DB_SUCCESS, index->InsertEntry(MakeKey(100), RowId(7, 7), nullptr));
+  expected[100].push_back(RowId(7, 7).Get());
+  // the same (key, row) pair can not be inserted twice
+  ASSERT_EQ(DB_FAILED, index->InsertEntry(MakeKey(row_ids[0].Get() % key_count), row_ids[0], nullptr));
+  ASSERT_EQ(DB_FAILED, index->InsertEntry(MakeKey(100), RowId(7, 7), nullptr));
+  for (auto &entry : expected) {
+    std::sort(entry.second.begin(), entry.second.end());
+    ASSERT_EQ(entry.second, Lookup(index, entry.first));
+  }
+  ASSERT_TRUE(Lookup(index, 5).empty());
+  // range scans expand the posting lists in key order
+  auto above = Lookup(index, 1, ">");
+  ASSERT_EQ(expected[2].size() + expected[3].size() + 1, above.size());
+  ASSERT_EQ(expected[2], std::vector<int64_t>(above.begin(), above.begin() + expected[2].size()));
+  ASSERT_EQ(n + 1 - expected[2].size(), Lookup(index, 2, "<>").size());
+  // every row of a list comes with the key of the list
+  Row low = MakeKey(3);
+  auto cursor = index->ScanRange({&low, true, nullptr, true}, nullptr);
+  RowId row_id;
+  Row key;
+  size_t rows = 0;
+  while (cursor->NextEntry(row_id, key)) {
+    ASSERT_EQ(CmpBool::kTrue,
+              key.GetField(0)->CompareEquals(Field(TypeId::kTypeInt, rows < expected[3].size() ? 3 : 100)));
+    rows++;
+  }
+  ASSERT_EQ(expected[3].size() + 1, rows);
+  cursor.reset();
+  // remove every other row, and then the rest
+  for (int round = 0; round < 2; round++) {
+    for (size_t i = round; i < row_ids.size(); i += 2) {
+      int32_t status = row_ids[i].Get() % key_count;
+      ASSERT_EQ(DB_SUCCESS, index->RemoveEntry(MakeKey(status), row_ids[i], nullptr));
+    }
+    for (int32_t status = 0; status < key_count; status++) {
+      std::vector<int64_t> remaining;
+      for (size_t i = 1; round == 0 && i < row_ids.size(); i += 2) {
+        if (row_ids[i].Get() % key_count == status) {
+          remaining.push_back(row_ids[i].Get());
+        }
+      }
+      std::sort(remaining.begin(), remaining.end());
+      ASSERT_EQ(remaining, Lookup(index, status));
+    }
+  }
+  // emptied keys are gone and their lists freed, the inline key is untouched
+  std::vector<RowId> result;
+  ASSERT_EQ(DB_KEY_NOT_FOUND, index->ScanKey(MakeKey(0), result, nullptr));
+  ASSERT_EQ(expected[100], Lookup(index, 100));
+  ASSERT_EQ(DB_SUCCESS, index->RemoveEntry(MakeKey(100), RowId(7, 7), nullptr));
+  ASSERT_TRUE(Lookup(index, 100).empty());
+  ASSERT_TRUE(engine.bpm_->CheckAllUnpinned());
+  index->Destroy();
+  delete index;
+}
+
+TEST(PostingListIndexTest, BulkLoadTest) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("region", TypeId::kTypeInt, 0, false, false)};
+  std::vector<uint32_t> index_key_map{0};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  auto *index = new Int32PostingIndex(0, index_schema, engine.bpm_);
+  // region 0..9 repeat, region 1000 + i is unique
+  const int n = 50000;
+  std::vector<std::pair<int32_t, RowId>> entries;
+  std::map<int32_t, std::vector<int64_t>> expected;
+  for (int i = 0; i < n; i++) {
+    int32_t region = i % 3 == 0 ? 1000 + i : i % 10;
+    entries.emplace_back(region, RowId(i / 30, i % 30));
+    expected[region].push_back(RowId(i / 30, i % 30).Get());
+  }
+  ShuffleArray(entries);
+  size_t pos = 0;
+  ASSERT_EQ(DB_SUCCESS, index->BulkLoad(
+                            [&](Row &key, RowId &row_id) {
+                              if (pos == entries.size()) {
+                                return false;
+                              }
+                              key = MakeKey(entries[pos].first);
+                              row_id = entries[pos++].second;
+                              return true;
+                            },
+                            nullptr));
+  for (int32_t region : {0, 1, 5, 9, 1003, 1000 + 3 * 1234}) {
+    ASSERT_EQ(expected[region], Lookup(index, region));
+  }
+  ASSERT_EQ(n, Lookup(index, -1, ">").size());
+  // the loaded lists keep accepting new rows
+  ASSERT_EQ(DB_SUCCESS, index->InsertEntry(MakeKey(5), RowId(0, 29), nullptr));
+  ASSERT_EQ(DB_SUCCESS, index->InsertEntry(MakeKey(1003), RowId(100000, 0), nullptr));
+  ASSERT_EQ(expected[5].size() + 1, Lookup(index, 5).size());
+  ASSERT_EQ(2, Lookup(index, 1003).size());
+  ASSERT_TRUE(engine.bpm_->CheckAllUnpinned());
+  index->Destroy();
+  delete index;
+}
@@ -0,0 +1,252 @@
+#include "index/prefix_b_plus_tree_index.h"
+
+#include <cstring>
+#include <random>
+
+#include "common/instance.h"
+#include "gtest/gtest.h"
+#include "utils/utils.h"
+
+static const std::string db_name = "prefix_b_plus_tree_index_test.db";
+
+static Row MakeCharKey(const std::string &value) {
+  std::vector<Field> fields{Field(TypeId::kTypeChar, const_cast<char *>(value.data()), value.size(), true)};
+  return Row(fields);
+}
+
+TEST(PrefixBPlusTreeIndexTest, StringKeyTest) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("name", TypeId::kTypeChar, 32, 0, false, false)};
+  std::vector<uint32_t> index_key_map{0};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  auto *index = new PrefixBPlusTreeIndex(0, index_schema, engine.bpm_);
+  const int n = 30000;
+  std::vector<std::string> keys;
+  char buf[32];
+  for (int i = 0; i < n; i++) {
+    snprintf(buf, sizeof(buf), "user_%08d", i);
+    keys.emplace_back(buf);
+  }
+  // embedded zero bytes and prefixes of other keys keep their order
+  keys.emplace_back(std::string("user_", 5));
+  keys.emplace_back(std::string("user_\0", 6));
+  std::vector<int> order(keys.size());
+  for (size_t i = 0; i < keys.size(); i++) {
+    order[i] = static_cast<int>(i);
+  }
+  ShuffleArray(order);
+  for (auto i : order) {
+    ASSERT_EQ(DB_SUCCESS, index->InsertEntry(MakeCharKey(keys[i]), RowId(i), nullptr));
+  }
+  // unique keys only
+  ASSERT_EQ(DB_FAILED, index->InsertEntry(MakeCharKey(keys[0]), RowId(0), nullptr));
+  std::vector<RowId> result;
+  for (size_t i = 0; i < keys.size(); i++) {
+    result.clear();
+    ASSERT_EQ(DB_SUCCESS, index->ScanKey(MakeCharKey(keys[i]), result, nullptr));
+    ASSERT_EQ(1, result.size());
+    ASSERT_EQ(i, result[0].Get());
+  }
+  result.clear();
+  ASSERT_EQ(DB_KEY_NOT_FOUND, index->ScanKey(MakeCharKey("user"), result, nullptr));
+  // full scan in key order
+  auto cursor = index->ScanRange({}, nullptr);
+  RowId row_id;
+  Row key;
+  std::vector<int64_t> scanned;
+  while (cursor->NextEntry(row_id, key)) {
+    std::string name(key.GetField(0)->GetData(), key.GetField(0)->GetLength());
+    ASSERT_EQ(keys[row_id.Get()], name);
+    scanned.push_back(row_id.Get());
+  }
+  ASSERT_EQ(keys.size(), scanned.size());
+  ASSERT_EQ(n, scanned[0]);
+  ASSERT_EQ(n + 1, scanned[1]);
+  for (int i = 0; i < n; i++) {
+    ASSERT_EQ(i, scanned[i + 2]);
+  }
+  // range bounds
+  Row lower = MakeCharKey(keys[100]);
+  Row upper = MakeCharKey(keys[200]);
+  cursor = index->ScanRange({&lower, false, &upper, true}, nullptr);
+  for (int i = 101; i <= 200; i++) {
+    ASSERT_TRUE(cursor->Next(row_id));
+    ASSERT_EQ(i, row_id.Get());
+  }
+  ASSERT_FALSE(cursor->Next(row_id));
+  result.clear();
+  ASSERT_EQ(DB_SUCCESS, index->ScanKey(upper, result, nullptr, "<"));
+  ASSERT_EQ(202, result.size());
+  // remove the odd keys
+  for (int i = 1; i < n; i += 2) {
+    ASSERT_EQ(DB_SUCCESS, index->RemoveEntry(MakeCharKey(keys[i]), RowId(i), nullptr));
+  }
+  for (int i = 0; i < n; i++) {
+    result.clear();
+    ASSERT_EQ(i % 2 == 0 ? DB_SUCCESS : DB_KEY_NOT_FOUND, index->ScanKey(MakeCharKey(keys[i]), result, nullptr));
+  }
+  result.clear();
+  ASSERT_EQ(DB_SUCCESS, index->ScanKey(lower, result, nullptr, ">="));
+  ASSERT_EQ(n / 2 - 50, result.size());
+  ASSERT_TRUE(engine.bpm_->CheckAllUnpinned());
+  index->Destroy();
+  delete index;
+}
+
+TEST(PrefixBPlusTreeIndexTest, BatchedInsertLookupTest) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("name", TypeId::kTypeChar, 32, 0, false, false)};
+  std::vector<uint32_t> index_key_map{0};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  auto *index = new PrefixBPlusTreeIndex(0, index_schema, engine.bpm_);
+  const int n = 20000;
+  std::vector<int> order(n);
+  for (int i = 0; i < n; i++) {
+    order[i] = i;
+  }
+  ShuffleArray(order);
+  char buf[32];
+  for (int start = 0; start < n; start += 1000) {
+    std::vector<Row> keys;
+    std::vector<RowId> row_ids;
+    for (int i = start; i < start + 1000; i++) {
+      snprintf(buf, sizeof(buf), "item-%06d", 2 * order[i]);
+      keys.push_back(MakeCharKey(buf));
+      row_ids.emplace_back(order[i]);
+    }
+    ASSERT_EQ(DB_SUCCESS, index->InsertEntries(keys, row_ids, nullptr));
+    // a duplicate within the batch fails, the other entries are still inserted
+    keys.push_back(keys[0]);
+    row_ids.push_back(row_ids[0]);
+    ASSERT_EQ(DB_FAILED, index->InsertEntries(keys, row_ids, nullptr));
+  }
+  std::vector<Row> probes;
+  for (int i = 0; i < 2 * n; i++) {
+    snprintf(buf, sizeof(buf), "item-%06d", i);
+    probes.push_back(MakeCharKey(buf));
+  }
+  std::vector<std::vector<RowId>> result;
+  ASSERT_EQ(DB_SUCCESS, index->ScanKeys(probes, result, nullptr));
+  for (int i = 0; i < 2 * n; i++) {
+    ASSERT_EQ(i % 2 == 0 ? 1 : 0, result[i].size());
+    if (i % 2 == 0) {
+      ASSERT_EQ(i / 2, result[i][0].Get());
+    }
+  }
+  ASSERT_TRUE(engine.bpm_->CheckAllUnpinned());
+  index->Destroy();
+  delete index;
+}
+
+TEST(PrefixBPlusTreeIndexTest, CompositePrefixTest) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("region", TypeId::kTypeChar, 16, 0, false, false),
+                                   new Column("id", TypeId::kTypeInt, 1, false, false)};
+  std::vector<uint32_t> index_key_map{0, 1};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  auto *index = new PrefixBPlusTreeIndex(0, index_schema, engine.bpm_);
+  const char *regions[] = {"east", "north", "south", "west"};
+  auto make_key = [&](int i) {
+    const char *region = regions[i % 4];
+    std::vector<Field> fields{Field(TypeId::kTypeChar, const_cast<char *>(region), strlen(region), true),
+                              Field(TypeId::kTypeInt, i / 4 - 1000)};
+    return Row(fields);
+  };
+  const int n = 20000;
+  for (int i = 0; i < n; i++) {
+    ASSERT_EQ(DB_SUCCESS, index->InsertEntry(make_key(i), RowId(i), nullptr));
+  }
+  // equality on the leading column
+  Row north = MakeCharKey("north");
+  std::vector<RowId> result;
+  ASSERT_EQ(DB_SUCCESS, index->ScanKey(north, result, nullptr));
+  ASSERT_EQ(n / 4, result.size());
+  for (size_t i = 0; i < result.size(); i++) {
+    ASSERT_EQ(4 * i + 1, result[i].Get());
+  }
+  // past and up to a prefix
+  result.clear();
+  ASSERT_EQ(DB_SUCCESS, index->ScanKey(north, result, nullptr, ">"));
+  ASSERT_EQ(n / 2, result.size());
+  result.clear();
+  ASSERT_EQ(DB_SUCCESS, index->ScanKey(north, result, nullptr, "<="));
+  ASSERT_EQ(n / 2, result.size());
+  // region = 'south' and id between -10 and 10, negative ids sort first
+  std::vector<Field> low_fields{Field(TypeId::kTypeChar, const_cast<char *>("south"), 5, true),
+                                Field(TypeId::kTypeInt, -10)};
+  std::vector<Field> high_fields{Field(TypeId::kTypeChar, const_cast<char *>("south"), 5, true),
+                                 Field(TypeId::kTypeInt, 10)};
+  Row low(low_fields);
+  Row high(high_fields);
+  auto cursor = index->ScanRange({&low, true, &high, true}, nullptr);
+  RowId row_id;
+  Row key;
+  for (int id = -10; id <= 10; id++) {
+    ASSERT_TRUE(cursor->NextEntry(row_id, key));
+    ASSERT_EQ((id + 1000) * 4 + 2, row_id.Get());
+    ASSERT_EQ(0, strncmp("south", key.GetField(0)->GetData(), key.GetField(0)->GetLength()));
+    ASSERT_EQ(CmpBool::kTrue, key.GetField(1)->CompareEquals(Field(TypeId::kTypeInt, id)));
+  }
+  ASSERT_FALSE(cursor->Next(row_id));
+  ASSERT_TRUE(engine.bpm_->CheckAllUnpinned());
+  index->Destroy();
+  delete index;
+}
+
+static Row MakeIntKey(int32_t value) {
+  std::vector<Field> fields{Field(TypeId::kTypeInt, value)};
+  return Row(fields);
+}
+
+/*
+ * Row ids far from the base page id of a leaf, and below it, are encoded with
+ * more bytes or rebuild the page, they must read back unchanged.
+ */
+TEST(PrefixBPlusTreeIndexTest, RowIdCompressionTest) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("id", TypeId::kTypeInt, 0, false, false)};
+  std::vector<uint32_t> index_key_map{0};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  auto *index = new PrefixBPlusTreeIndex(0, index_schema, engine.bpm_);
+  const int n = 50000;
+  std::mt19937 rng(0);
+  std::vector<int> order(n);
+  std::vector<RowId> row_ids;
+  for (int i = 0; i < n; i++) {
+    order[i] = i;
+    // mostly clustered, some far away pages and large slot numbers
+    if (i % 97 == 0) {
+      row_ids.emplace_back(static_cast<page_id_t>(rng() % 1000000), static_cast<uint32_t>(rng()));
+    } else {
+      row_ids.emplace_back(static_cast<page_id_t>(1000 + rng() % 500), static_cast<uint32_t>(rng() % 60));
+    }
+  }
+  ShuffleArray(order);
+  for (auto i : order) {
+    ASSERT_EQ(DB_SUCCESS, index->InsertEntry(MakeIntKey(i), row_ids[i], nullptr));
+  }
+  std::vector<RowId> result;
+  for (int i = 0; i < n; i++) {
+    result.clear();
+    ASSERT_EQ(DB_SUCCESS, index->ScanKey(MakeIntKey(i), result, nullptr));
+    ASSERT_EQ(row_ids[i], result[0]);
+  }
+  for (int i = 0; i < n; i += 2) {
+    ASSERT_EQ(DB_SUCCESS, index->RemoveEntry(MakeIntKey(i), row_ids[i], nullptr));
+  }
+  auto cursor = index->ScanRange({}, nullptr);
+  RowId row_id;
+  for (int i = 1; i < n; i += 2) {
+    ASSERT_TRUE(cursor->Next(row_id));
+    ASSERT_EQ(row_ids[i], row_id);
+  }
+  ASSERT_FALSE(cursor->Next(row_id));
+  ASSERT_TRUE(engine.bpm_->CheckAllUnpinned());
+  index->Destroy();
+  delete index;
+  delete index_schema;
+}
@@ -0,0 +1,109 @@
+#include <atomic>
+#include <thread>
+
+#include "common/instance.h"
+#include "gtest/gtest.h"
+#include "index/basic_comparator.h"
+#include "index/typed_b_plus_tree.h"
+
+static const std::string db_name = "typed_bp_tree_concurrent_test.db";
+
+using Int32Tree = TypedBPlusTree<int32_t, BasicComparator<int32_t>>;
+
+template <typename F>
+static void RunThreads(int thread_num, F &&task) {
+  std::vector<std::thread> threads;
+  for (int t = 0; t < thread_num; t++) {
+    threads.emplace_back(task, t);
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+}
+
+TEST(TypedBPlusTreeConcurrentTests, StressTest) {
+  DBStorageEngine engine(db_name);
+  // small pages so that splits and merges happen all the time
+  Int32Tree tree(0, engine.bpm_, BasicComparator<int32_t>(), 16, 8);
+  const int thread_num = 8;
+  const int n = 20000;
+  std::atomic<bool> done{false};
+  std::atomic<int> reader_errors{0};
+  // readers only check invariants that hold at any point: ordered iteration, found values match keys
+  auto reader = [&]() {
+    while (!done) {
+      int32_t last = -1;
+      for (auto iter = tree.Begin(); iter != tree.End(); ++iter) {
+        auto item = *iter;
+        if (item.first <= last || item.second.Get() != item.first) {
+          reader_errors++;
+        }
+        last = item.first;
+      }
+      for (int32_t key = 0; key < n; key += 97) {
+        std::vector<RowId> result;
+        if (tree.GetValue(key, result) && result[0].Get() != key) {
+          reader_errors++;
+        }
+      }
+    }
+  };
+
+  // 1. concurrent inserts, threads own interleaved keys
+  std::thread reader_thread(reader);
+  RunThreads(thread_num, [&](int t) {
+    for (int32_t key = t; key < n; key += thread_num) {
+      ASSERT_TRUE(tree.Insert(key, RowId(key)));
+    }
+  });
+  done = true;
+  reader_thread.join();
+  ASSERT_EQ(0, reader_errors);
+  for (int32_t key = 0; key < n; key++) {
+    std::vector<RowId> result;
+    ASSERT_TRUE(tree.GetValue(key, result));
+    ASSERT_EQ(key, result[0].Get());
+  }
+  ASSERT_TRUE(tree.Check());
+
+  // 2. concurrent removes of even keys mixed with duplicate inserts, odd keys must stay visible
+  done = false;
+  std::thread checker([&]() {
+    while (!done) {
+      for (int32_t key = 1; key < n; key += 2 * 31) {
+        std::vector<RowId> result;
+        if (!tree.GetValue(key, result)) {
+          reader_errors++;
+        }
+      }
+    }
+  });
+  reader_thread = std::thread(reader);
+  RunThreads(thread_num, [&](int t) {
+    for (int32_t key = 2 * t; key < n; key += 2 * thread_num) {
+      tree.Remove(key);
+      ASSERT_FALSE(tree.Insert(key + 1, RowId(key + 1)));
+    }
+  });
+  done = true;
+  reader_thread.join();
+  checker.join();
+  ASSERT_EQ(0, reader_errors);
+  int32_t expect = 1;
+  for (auto iter = tree.Begin(); iter != tree.End(); ++iter) {
+    ASSERT_EQ(expect, (*iter).first);
+    expect += 2;
+  }
+  ASSERT_EQ(n + 1, expect);
+  ASSERT_TRUE(tree.Check());
+
+  // 3. drain the tree from all threads
+  RunThreads(thread_num, [&](int t) {
+    for (int32_t key = 2 * t + 1; key < n; key += 2 * thread_num) {
+      tree.Remove(key);
+    }
+  });
+  ASSERT_TRUE(tree.IsEmpty());
+  ASSERT_TRUE(tree.Begin() == tree.End());
+  ASSERT_TRUE(tree.Check());
+}
@@ -0,0 +1,546 @@
+#include "index/typed_b_plus_tree.h"
+
+#include <algorithm>
+#include <set>
+
+#include "common/instance.h"
+#include "gtest/gtest.h"
+#include "index/basic_comparator.h"
+#include "index/typed_b_plus_tree_index.h"
+#include "utils/utils.h"
+
+static const std::string db_name = "typed_bp_tree_test.db";
+
+TEST(TypedBPlusTreeTests, Int32InsertRemoveTest) {
+  DBStorageEngine engine(db_name);
+  // small pages to force multi-level splits and merges
+  TypedBPlusTree<int32_t, BasicComparator<int32_t>> tree(0, engine.bpm_, BasicComparator<int32_t>(), 8, 6);
+  const int n = 2000;
+  vector<int32_t> keys;
+  for (int i = 0; i < n; i++) {
+    keys.push_back(i);
+  }
+  ShuffleArray(keys);
+  for (int i = 0; i < n; i++) {
+    ASSERT_TRUE(tree.Insert(keys[i], RowId(keys[i])));
+  }
+  ASSERT_FALSE(tree.Insert(keys[0], RowId(keys[0])));
+  ASSERT_TRUE(tree.Check());
+  // Search keys
+  vector<RowId> ans;
+  for (int i = 0; i < n; i++) {
+    ASSERT_TRUE(tree.GetValue(i, ans));
+    ASSERT_EQ(RowId(i).Get(), ans[i].Get());
+  }
+  ASSERT_TRUE(tree.Check());
+  // Ordered iteration
+  int32_t expect = 0;
+  for (auto iter = tree.Begin(); iter != tree.End(); ++iter) {
+    ASSERT_EQ(expect, (*iter).first);
+    expect++;
+  }
+  ASSERT_EQ(n, expect);
+  ASSERT_TRUE(tree.Check());
+  // Delete half keys
+  ShuffleArray(keys);
+  for (int i = 0; i < n / 2; i++) {
+    tree.Remove(keys[i]);
+  }
+  ASSERT_TRUE(tree.Check());
+  ans.clear();
+  for (int i = 0; i < n / 2; i++) {
+    ASSERT_FALSE(tree.GetValue(keys[i], ans));
+  }
+  for (int i = n / 2; i < n; i++) {
+    ASSERT_TRUE(tree.GetValue(keys[i], ans));
+    ASSERT_EQ(RowId(keys[i]).Get(), ans.back().Get());
+  }
+  // Remaining keys are still ordered
+  int count = 0;
+  int32_t last = -1;
+  for (auto iter = tree.Begin(3); iter != tree.End(); ++iter) {
+    ASSERT_LT(last, (*iter).first);
+    ASSERT_LE(3, (*iter).first);
+    last = (*iter).first;
+    count++;
+  }
+  ASSERT_GT(count, 0);
+  // Delete the rest, the tree shrinks back to empty
+  for (int i = n / 2; i < n; i++) {
+    tree.Remove(keys[i]);
+  }
+  ASSERT_TRUE(tree.IsEmpty());
+  ASSERT_TRUE(tree.Begin() == tree.End());
+  ASSERT_TRUE(tree.Check());
+}
+
+TEST(TypedBPlusTreeTests, FloatIndexScanKeyTest) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("id", TypeId::kTypeInt, 0, false, false),
+                                   new Column("account", TypeId::kTypeFloat, 1, false, false)};
+  std::vector<uint32_t> index_key_map{1};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  auto *index = new TypedBPlusTreeIndex<float, BasicComparator<float>>(0, index_schema, engine.bpm_);
+  const int n = 500;
+  for (int i = 0; i < n; i++) {
+    std::vector<Field> fields{Field(TypeId::kTypeFloat, static_cast<float>(i) / 2)};
+    ASSERT_EQ(DB_SUCCESS, index->InsertEntry(Row(fields), RowId(1000, i), nullptr));
+  }
+  std::vector<Field> fields{Field(TypeId::kTypeFloat, 100.0f)};
+  Row key(fields);
+  std::vector<RowId> ret;
+  ASSERT_EQ(DB_SUCCESS, index->ScanKey(key, ret, nullptr, "="));
+  ASSERT_EQ(1, ret.size());
+  ASSERT_EQ(200, ret[0].GetSlotNum());
+  ret.clear();
+  ASSERT_EQ(DB_SUCCESS, index->ScanKey(key, ret, nullptr, ">"));
+  ASSERT_EQ(n - 201, ret.size());
+  ret.clear();
+  ASSERT_EQ(DB_SUCCESS, index->ScanKey(key, ret, nullptr, ">="));
+  ASSERT_EQ(n - 200, ret.size());
+  ret.clear();
+  ASSERT_EQ(DB_SUCCESS, index->ScanKey(key, ret, nullptr, "<"));
+  ASSERT_EQ(200, ret.size());
+  ret.clear();
+  ASSERT_EQ(DB_SUCCESS, index->ScanKey(key, ret, nullptr, "<="));
+  ASSERT_EQ(201, ret.size());
+  ret.clear();
+  ASSERT_EQ(DB_SUCCESS, index->ScanKey(key, ret, nullptr, "<>"));
+  ASSERT_EQ(n - 1, ret.size());
+  index->Destroy();
+  delete index;
+}
+
+TEST(TypedBPlusTreeTests, RangeCursorTest) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("id", TypeId::kTypeInt, 0, false, false)};
+  std::vector<uint32_t> index_key_map{0};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  auto *index = new TypedBPlusTreeIndex<int32_t, BasicComparator<int32_t>>(0, index_schema, engine.bpm_);
+  const int n = 1000;
+  for (int i = 0; i < n; i++) {
+    std::vector<Field> fields{Field(TypeId::kTypeInt, 2 * i)};
+    ASSERT_EQ(DB_SUCCESS, index->InsertEntry(Row(fields), RowId(2 * i), nullptr));
+  }
+  auto make_key = [](int32_t value) {
+    std::vector<Field> fields{Field(TypeId::kTypeInt, value)};
+    return Row(fields);
+  };
+  auto drain = [&](const IndexRange &range) {
+    std::vector<int64_t> result;
+    auto cursor = index->ScanRange(range, nullptr);
+    RowId row_id;
+    while (cursor->Next(row_id)) {
+      result.push_back(row_id.Get());
+    }
+    return result;
+  };
+  Row low = make_key(100);
+  Row high = make_key(200);
+  auto closed = drain({&low, true, &high, true});
+  ASSERT_EQ(51, closed.size());
+  ASSERT_EQ(100, closed.front());
+  ASSERT_EQ(200, closed.back());
+  ASSERT_TRUE(std::is_sorted(closed.begin(), closed.end()));
+  auto open = drain({&low, false, &high, false});
+  ASSERT_EQ(49, open.size());
+  ASSERT_EQ(102, open.front());
+  ASSERT_EQ(198, open.back());
+  // bounds between keys
+  Row odd_low = make_key(101);
+  Row odd_high = make_key(105);
+  ASSERT_EQ((std::vector<int64_t>{102, 104}), drain({&odd_low, false, &odd_high, false}));
+  // one sided and unbounded ranges
+  ASSERT_EQ(50, drain({nullptr, true, &low, false}).size());
+  ASSERT_EQ(n - 50, drain({&low, true, nullptr, true}).size());
+  ASSERT_EQ(n, drain({nullptr, true, nullptr, true}).size());
+  ASSERT_TRUE(drain({&high, true, &low, true}).empty());
+  // the cursor returns the first row ids without reading the rest of the range
+  auto cursor = index->ScanRange({nullptr, true, nullptr, true}, nullptr);
+  RowId row_id;
+  ASSERT_TRUE(cursor->Next(row_id));
+  ASSERT_EQ(0, row_id.Get());
+  ASSERT_TRUE(cursor->Next(row_id));
+  ASSERT_EQ(2, row_id.Get());
+  cursor.reset();
+  index->Destroy();
+  delete index;
+}
+
+TEST(TypedBPlusTreeTests, FloatBoundOnIntKeyTest) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("id", TypeId::kTypeInt, 0, false, false),
+                                   new Column("owner", TypeId::kTypeInt, 1, false, false)};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, {0});
+  auto *index = new TypedBPlusTreeIndex<int32_t, BasicComparator<int32_t>>(0, index_schema, engine.bpm_);
+  auto *pair_schema = Schema::ShallowCopySchema(&table_schema, {0, 1});
+  auto *pair_index = new TypedBPlusTreeIndex<int64_t, BasicComparator<int64_t>>(1, pair_schema, engine.bpm_);
+  const int n = 10;
+  for (int i = -n; i < n; i++) {
+    std::vector<Field> fields{Field(TypeId::kTypeInt, i)};
+    ASSERT_EQ(DB_SUCCESS, index->InsertEntry(Row(fields), RowId(i + n), nullptr));
+    std::vector<Field> pair_fields{Field(TypeId::kTypeInt, i), Field(TypeId::kTypeInt, 0)};
+    ASSERT_EQ(DB_SUCCESS, pair_index->InsertEntry(Row(pair_fields), RowId(i + n), nullptr));
+  }
+  // scan with a FLOAT constant, return the INT keys found
+  auto scan = [&](Index *target, float value, const std::string &compare_operator) {
+    std::vector<Field> fields{Field(TypeId::kTypeFloat, value)};
+    std::vector<RowId> result;
+    target->ScanKey(Row(fields), result, nullptr, compare_operator);
+    std::vector<int64_t> keys;
+    for (auto &row_id : result) {
+      keys.push_back(row_id.Get() - n);
+    }
+    std::sort(keys.begin(), keys.end());
+    return keys;
+  };
+  for (Index *target : {static_cast<Index *>(index), static_cast<Index *>(pair_index)}) {
+    // a value between keys is not truncated towards zero
+    ASSERT_TRUE(scan(target, 2.5f, "=").empty());
+    ASSERT_EQ((std::vector<int64_t>{3}), scan(target, 3.0f, "="));
+    ASSERT_EQ((std::vector<int64_t>{8, 9}), scan(target, 7.5f, ">"));
+    ASSERT_EQ((std::vector<int64_t>{8, 9}), scan(target, 7.5f, ">="));
+    ASSERT_EQ((std::vector<int64_t>{-10, -9}), scan(target, -8.5f, "<"));
+    ASSERT_EQ((std::vector<int64_t>{-10, -9}), scan(target, -8.5f, "<="));
+    ASSERT_EQ(n + 2, scan(target, -2.5f, ">").size());
+    ASSERT_EQ(n - 2, scan(target, -2.5f, "<").size());
+    ASSERT_EQ(2 * n, scan(target, 2.5f, "<>").size());
+    // constants past the INT range
+    ASSERT_EQ(2 * n, scan(target, 1e10f, "<").size());
+    ASSERT_TRUE(scan(target, 1e10f, ">").empty());
+    ASSERT_EQ(2 * n, scan(target, -1e10f, ">=").size());
+    ASSERT_TRUE(scan(target, -1e10f, "<=").empty());
+  }
+  index->Destroy();
+  pair_index->Destroy();
+  delete index;
+  delete pair_index;
+}
+
+TEST(TypedBPlusTreeTests, ReverseIteratorTest) {
+  DBStorageEngine engine(db_name);
+  TypedBPlusTree<int32_t, BasicComparator<int32_t>> tree(0, engine.bpm_, BasicComparator<int32_t>(), 8, 6);
+  ASSERT_TRUE(tree.RBegin() == tree.End());
+  const int n = 2000;
+  vector<int32_t> keys;
+  for (int i = 0; i < n; i++) {
+    keys.push_back(2 * i);
+  }
+  ShuffleArray(keys);
+  std::set<int32_t> expect;
+  for (auto key : keys) {
+    ASSERT_TRUE(tree.Insert(key, RowId(key)));
+    expect.insert(key);
+  }
+  // removed keys leave separators below the first key of their leaves
+  for (int32_t key = 600; key < 1400; key += 2) {
+    tree.Remove(key);
+    expect.erase(key);
+  }
+  for (int32_t key = 1401; key < 2400; key += 8) {
+    tree.Remove(key + 1);
+    expect.erase(key + 1);
+  }
+  auto check_from = [&](auto iter, auto expect_iter) {
+    for (; expect_iter != expect.rend(); ++expect_iter, ++iter) {
+      ASSERT_TRUE(iter != tree.End());
+      ASSERT_EQ(*expect_iter, (*iter).first);
+      ASSERT_EQ(*expect_iter, (*iter).second.Get());
+    }
+    ASSERT_TRUE(iter == tree.End());
+  };
+  check_from(tree.RBegin(), expect.rbegin());
+  for (int32_t key : {-1, 0, 1, 599, 600, 1000, 1400, 1401, 3001, 3998, 3999, 5000}) {
+    check_from(tree.RBegin(key), std::make_reverse_iterator(expect.upper_bound(key)));
+    check_from(tree.RBegin(key, false), std::make_reverse_iterator(expect.lower_bound(key)));
+  }
+  ASSERT_TRUE(tree.Check());
+  tree.Destroy();
+}
+
+TEST(TypedBPlusTreeTests, DescendingRangeCursorTest) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("id", TypeId::kTypeInt, 0, false, false)};
+  std::vector<uint32_t> index_key_map{0};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  auto *index = new TypedBPlusTreeIndex<int32_t, BasicComparator<int32_t>>(0, index_schema, engine.bpm_);
+  ASSERT_TRUE(index->SupportsDescendingScan());
+  const int n = 1000;
+  for (int i = 0; i < n; i++) {
+    std::vector<Field> fields{Field(TypeId::kTypeInt, 2 * i)};
+    ASSERT_EQ(DB_SUCCESS, index->InsertEntry(Row(fields), RowId(2 * i), nullptr));
+  }
+  auto make_key = [](int32_t value) {
+    std::vector<Field> fields{Field(TypeId::kTypeInt, value)};
+    return Row(fields);
+  };
+  auto drain = [&](IndexRange range) {
+    range.descending = true;
+    std::vector<int64_t> result;
+    auto cursor = index->ScanRange(range, nullptr);
+    RowId row_id;
+    while (cursor->Next(row_id)) {
+      result.push_back(row_id.Get());
+    }
+    return result;
+  };
+  Row low = make_key(100);
+  Row high = make_key(200);
+  auto closed = drain({&low, true, &high, true});
+  ASSERT_EQ(51, closed.size());
+  ASSERT_EQ(200, closed.front());
+  ASSERT_EQ(100, closed.back());
+  ASSERT_TRUE(std::is_sorted(closed.rbegin(), closed.rend()));
+  auto open = drain({&low, false, &high, false});
+  ASSERT_EQ(49, open.size());
+  ASSERT_EQ(198, open.front());
+  ASSERT_EQ(102, open.back());
+  Row odd_low = make_key(101);
+  Row odd_high = make_key(105);
+  ASSERT_EQ((std::vector<int64_t>{104, 102}), drain({&odd_low, false, &odd_high, false}));
+  ASSERT_EQ(50, drain({nullptr, true, &low, false}).size());
+  ASSERT_EQ(n - 50, drain({&low, true, nullptr, true}).size());
+  ASSERT_TRUE(drain({&high, true, &low, true}).empty());
+  // the latest entries come first, read from the last leaf only
+  auto cursor = index->ScanRange({nullptr, true, nullptr, true, true}, nullptr);
+  RowId row_id;
+  Row key;
+  ASSERT_TRUE(cursor->NextEntry(row_id, key));
+  ASSERT_EQ(2 * (n - 1), row_id.Get());
+  ASSERT_EQ(CmpBool::kTrue, key.GetField(0)->CompareEquals(Field(TypeId::kTypeInt, 2 * (n - 1))));
+  ASSERT_TRUE(cursor->Next(row_id));
+  ASSERT_EQ(2 * (n - 2), row_id.Get());
+  cursor.reset();
+  index->Destroy();
+  delete index;
+}
+
+TEST(TypedBPlusTreeTests, CompositeKeyPrefixTest) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("tenant_id", TypeId::kTypeInt, 0, false, false),
+                                   new Column("ts", TypeId::kTypeFloat, 1, false, false)};
+  std::vector<uint32_t> index_key_map{0, 1};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  auto *index = new TypedBPlusTreeIndex<int64_t, BasicComparator<int64_t>>(0, index_schema, engine.bpm_);
+  // tenants -3..3, timestamps -50..49.5 in steps of 0.5, inserted out of order
+  std::vector<int> ids;
+  for (int i = 0; i < 7 * 200; i++) {
+    ids.push_back(i);
+  }
+  ShuffleArray(ids);
+  for (int id : ids) {
+    std::vector<Field> fields{Field(TypeId::kTypeInt, id / 200 - 3),
+                              Field(TypeId::kTypeFloat, (id % 200 - 100) / 2.0f)};
+    ASSERT_EQ(DB_SUCCESS, index->InsertEntry(Row(fields), RowId(id), nullptr));
+  }
+  auto drain = [&](const IndexRange &range) {
+    std::vector<int64_t> result;
+    auto cursor = index->ScanRange(range, nullptr);
+    RowId row_id;
+    while (cursor->Next(row_id)) {
+      result.push_back(row_id.Get());
+    }
+    return result;
+  };
+  // keys are ordered by tenant, then timestamp
+  auto all = drain({nullptr, true, nullptr, true});
+  ASSERT_EQ(7 * 200, all.size());
+  ASSERT_TRUE(std::is_sorted(all.begin(), all.end()));
+  // equality on the prefix
+  std::vector<Field> tenant_fields{Field(TypeId::kTypeInt, -1)};
+  Row tenant(tenant_fields);
+  std::vector<RowId> result;
+  ASSERT_EQ(DB_SUCCESS, index->ScanKey(tenant, result, nullptr));
+  ASSERT_EQ(200, result.size());
+  ASSERT_EQ(400, result.front().Get());
+  ASSERT_EQ(599, result.back().Get());
+  // tenant_id = -1 AND ts > -0.5, and the same bounded above by ts <= 2
+  std::vector<Field> low_fields{Field(TypeId::kTypeInt, -1), Field(TypeId::kTypeFloat, -0.5f)};
+  std::vector<Field> high_fields{Field(TypeId::kTypeInt, -1), Field(TypeId::kTypeFloat, 2.0f)};
+  Row low(low_fields);
+  Row high(high_fields);
+  auto after = drain({&low, false, &tenant, true});
+  ASSERT_EQ(100, after.size());
+  ASSERT_EQ(500, after.front());
+  ASSERT_EQ(599, after.back());
+  ASSERT_EQ((std::vector<int64_t>{500, 501, 502, 503, 504}), drain({&low, false, &high, true}));
+  // the cursor hands out the decoded keys for index-only scans
+  ASSERT_TRUE(index->SupportsIndexOnlyScan());
+  auto cursor = index->ScanRange({&low, false, &high, true}, nullptr);
+  RowId row_id;
+  Row key;
+  for (int i = 0; i < 5; i++) {
+    ASSERT_TRUE(cursor->NextEntry(row_id, key));
+    ASSERT_EQ(500 + i, row_id.Get());
+    ASSERT_EQ(2, key.GetFieldCount());
+    ASSERT_EQ(CmpBool::kTrue, key.GetField(0)->CompareEquals(Field(TypeId::kTypeInt, -1)));
+    ASSERT_EQ(CmpBool::kTrue, key.GetField(1)->CompareEquals(Field(TypeId::kTypeFloat, i / 2.0f)));
+  }
+  ASSERT_FALSE(cursor->NextEntry(row_id, key));
+  cursor.reset();
+  // ts < -49 within the tenant, and whole tenants through prefix bounds
+  std::vector<Field> early_fields{Field(TypeId::kTypeInt, -1), Field(TypeId::kTypeFloat, -49.0f)};
+  Row early(early_fields);
+  ASSERT_EQ((std::vector<int64_t>{400, 401}), drain({&tenant, true, &early, false}));
+  ASSERT_EQ(4 * 200, drain({&tenant, false, nullptr, true}).size());
+  ASSERT_EQ(2 * 200, drain({nullptr, true, &tenant, false}).size());
+  // -0.0 and 0.0 are the same timestamp
+  std::vector<Field> zero_fields{Field(TypeId::kTypeInt, -1), Field(TypeId::kTypeFloat, -0.0f)};
+  result.clear();
+  ASSERT_EQ(DB_SUCCESS, index->ScanKey(Row(zero_fields), result, nullptr));
+  ASSERT_EQ(500, result[0].Get());
+  index->Destroy();
+  delete index;
+}
+
+TEST(TypedBPlusTreeTests, BulkLoadTest) {
+  DBStorageEngine engine(db_name);
+  index_id_t index_id = 0;
+  for (double fill_factor : {0.5, 0.7, 1.0}) {
+    // sizes around page boundaries exercise merging and balancing of the last page of a level
+    for (int n : {0, 1, 7, 8, 9, 17, 300, 5000}) {
+      TypedBPlusTree<int32_t, BasicComparator<int32_t>> tree(index_id++, engine.bpm_, BasicComparator<int32_t>(), 8,
+                                                              6);
+      int32_t next_key = 0;
+      ASSERT_TRUE(tree.BulkLoad(
+          [&](std::pair<int32_t, RowId> &item) {
+            if (next_key >= n) {
+              return false;
+            }
+            item = {2 * next_key, RowId(next_key)};
+            next_key++;
+            return true;
+          },
+          fill_factor));
+      ASSERT_TRUE(tree.Check());
+      ASSERT_EQ(n == 0, tree.IsEmpty());
+      int count = 0;
+      for (auto iter = tree.Begin(); iter != tree.End(); ++iter) {
+        ASSERT_EQ(2 * count, (*iter).first);
+        count++;
+      }
+      ASSERT_EQ(n, count);
+      // the loaded tree keeps working for point queries and updates
+      for (int i = 0; i < n; i++) {
+        std::vector<RowId> result;
+        ASSERT_TRUE(tree.GetValue(2 * i, result));
+        ASSERT_EQ(i, result[0].Get());
+        ASSERT_TRUE(tree.Insert(2 * i + 1, RowId(i)));
+      }
+      for (int i = 0; i < 2 * n; i++) {
+        tree.Remove(i);
+      }
+      ASSERT_TRUE(tree.IsEmpty());
+      ASSERT_TRUE(tree.Check());
+    }
+  }
+  // duplicate keys are rejected and leave the tree empty
+  TypedBPlusTree<int32_t, BasicComparator<int32_t>> tree(index_id++, engine.bpm_, BasicComparator<int32_t>(), 8, 6);
+  int32_t next_key = 0;
+  ASSERT_FALSE(tree.BulkLoad([&](std::pair<int32_t, RowId> &item) {
+    item = {next_key == 100 ? 99 : next_key, RowId(next_key)};
+    return next_key++ < 200;
+  }));
+  ASSERT_TRUE(tree.IsEmpty());
+  ASSERT_TRUE(tree.Check());
+}
+
+TEST(TypedBPlusTreeTests, BatchedInsertLookupTest) {
+  DBStorageEngine engine(db_name);
+  // small pages so that a batch spans many leaves and splits them
+  TypedBPlusTree<int32_t, BasicComparator<int32_t>> tree(0, engine.bpm_, BasicComparator<int32_t>(), 8, 6);
+  const int n = 3000;
+  vector<int32_t> keys;
+  for (int i = 0; i < n; i++) {
+    keys.push_back(2 * i);
+  }
+  ShuffleArray(keys);
+  for (int start = 0; start < n; start += 500) {
+    std::vector<std::pair<int32_t, RowId>> entries;
+    for (int i = start; i < start + 500; i++) {
+      entries.emplace_back(keys[i], RowId(keys[i]));
+    }
+    // a key of the batch that is already in the tree
+    if (start > 0) {
+      entries.emplace_back(keys[0], RowId(0));
+    }
+    std::sort(entries.begin(), entries.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+    std::vector<bool> inserted;
+    tree.InsertBatch(entries, inserted);
+    for (size_t i = 0; i < entries.size(); i++) {
+      ASSERT_EQ(start == 0 || entries[i].first != keys[0], inserted[i]);
+    }
+  }
+  ASSERT_TRUE(tree.Check());
+  // every even key is found, no odd one
+  std::vector<int32_t> probes;
+  for (int i = -1; i < 2 * n + 1; i++) {
+    probes.push_back(i);
+  }
+  std::vector<RowId> values;
+  std::vector<bool> found;
+  tree.GetValues(probes, values, found);
+  for (size_t i = 0; i < probes.size(); i++) {
+    bool even = probes[i] >= 0 && probes[i] % 2 == 0 && probes[i] < 2 * n;
+    ASSERT_EQ(even, found[i]);
+    if (even) {
+      ASSERT_EQ(probes[i], values[i].Get());
+    }
+  }
+  ASSERT_TRUE(tree.Check());
+  tree.Destroy();
+}
+
+TEST(TypedBPlusTreeTests, AdaptiveHashTest) {
+  DBStorageEngine engine(db_name);
+  // small pages so that inserts and removes keep splitting and merging hashed leaves
+  TypedBPlusTree<int32_t, BasicComparator<int32_t>> tree(0, engine.bpm_, BasicComparator<int32_t>(), 8, 6);
+  const int n = 1000;
+  for (int i = 0; i < n; i += 2) {
+    ASSERT_TRUE(tree.Insert(i, RowId(i)));
+  }
+  // hammer the first hundred keys until their leaves are hashed
+  vector<RowId> result;
+  for (uint32_t round = 0; round < 2 * ADAPTIVE_HASH_BUILD_THRESHOLD; round++) {
+    for (int i = 0; i < 100; i += 2) {
+      result.clear();
+      ASSERT_TRUE(tree.GetValue(i, result));
+      ASSERT_EQ(i, result[0].Get());
+    }
+  }
+  auto stats = tree.GetAdaptiveHashStats();
+  ASSERT_GT(stats.hashed_pages, 0u);
+  ASSERT_GT(stats.hits, 0u);
+  ASSERT_GT(stats.HitRate(), 0.5);
+  ASSERT_GT(stats.memory_bytes, 0u);
+  // odd keys split the hashed leaves, removing even ones merges them
+  for (int i = 1; i < n; i += 2) {
+    ASSERT_TRUE(tree.Insert(i, RowId(i)));
+  }
+  for (int i = 0; i < n; i++) {
+    result.clear();
+    ASSERT_TRUE(tree.GetValue(i, result));
+    ASSERT_EQ(i, result[0].Get());
+  }
+  for (int i = 0; i < n; i += 2) {
+    tree.Remove(i);
+  }
+  for (int round = 0; round < 2; round++) {
+    for (int i = 0; i < 100; i++) {
+      result.clear();
+      ASSERT_EQ(i % 2 == 1, tree.GetValue(i, result));
+      if (i % 2 == 1) {
+        ASSERT_EQ(i, result[0].Get());
+      }
+    }
+  }
+  ASSERT_TRUE(tree.Check());
+  tree.SetAdaptiveHashEnabled(false);
+  ASSERT_EQ(0u, tree.GetAdaptiveHashStats().entries);
+  tree.Destroy();
+}
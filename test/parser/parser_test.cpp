@@ -0,0 +1,82 @@
+#include <string>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+int yyparse(void);
+#include "parser/minisql_lex.h"
+#include "parser/parser.h"
+}
+
+class ParserTest : public testing::Test {
+ protected:
+  void TearDown() override { Finish(); }
+
+  // parse one statement, its syntax tree lives until the next Parse
+  pSyntaxNode Parse(const std::string &sql) {
+    Finish();
+    buffer_ = yy_scan_string(sql.c_str());
+    yy_switch_to_buffer(buffer_);
+    MinisqlParserInit();
+    yyparse();
+    return MinisqlParserGetError() ? nullptr : MinisqlGetParserRootNode();
+  }
+
+  void Finish() {
+    if (buffer_ == nullptr) {
+      return;
+    }
+    MinisqlParserFinish();
+    yy_delete_buffer(buffer_);
+    yylex_destroy();
+    buffer_ = nullptr;
+  }
+
+  YY_BUFFER_STATE buffer_{nullptr};
+};
+
+TEST_F(ParserTest, AnalyzeTest) {
+  auto root = Parse("analyze table orders;");
+  ASSERT_NE(nullptr, root);
+  ASSERT_EQ(kNodeAnalyze, root->type_);
+  ASSERT_EQ(kNodeIdentifier, root->child_->type_);
+  ASSERT_STREQ("orders", root->child_->val_);
+  ASSERT_NE(nullptr, Parse("select * from orders where amount >= 1.5 and note <> \"a;b\";"));
+  // "analyze" is a keyword now, it no longer names a table
+  ASSERT_EQ(nullptr, Parse("select * from analyze;"));
+}
+
+TEST_F(ParserTest, PartialIndexTest) {
+  for (std::string type : {"", " using bptree"}) {
+    auto root = Parse("create index idx on orders(owner)" + type + " where amount > 3 and owner <> 0;");
+    ASSERT_NE(nullptr, root);
+    ASSERT_EQ(kNodeCreateIndex, root->type_);
+    auto node = root->child_;
+    while (node->next_ != nullptr) {
+      node = node->next_;
+    }
+    // the predicate is the last child of the statement
+    ASSERT_EQ(kNodeConditions, node->type_);
+    ASSERT_EQ(kNodeConnector, node->child_->type_);
+  }
+}
+
+TEST_F(ParserTest, JoinTest) {
+  auto root = Parse("select users.name, amount from users, orders where users.id = orders.owner and amount < 1.5;");
+  ASSERT_NE(nullptr, root);
+  ASSERT_EQ(kNodeSelect, root->type_);
+  auto columns = root->child_;
+  ASSERT_STREQ("users.name", columns->child_->val_);
+  ASSERT_STREQ("amount", columns->child_->next_->val_);
+  ASSERT_STREQ("users", columns->next_->val_);
+  ASSERT_STREQ("orders", columns->next_->next_->val_);
+  auto conditions = columns->next_->next_->next_;
+  ASSERT_EQ(kNodeConditions, conditions->type_);
+  // a comparison of two qualified columns
+  auto equal = conditions->child_->child_;
+  ASSERT_EQ(kNodeCompareOperator, equal->type_);
+  ASSERT_STREQ("users.id", equal->child_->val_);
+  ASSERT_EQ(kNodeIdentifier, equal->child_->next_->type_);
+  ASSERT_STREQ("orders.owner", equal->child_->next_->val_);
+  ASSERT_NE(nullptr, Parse("select * from users, orders;"));
+}
@@ -5,6 +5,7 @@
 #include "page/table_page.h"
 #include "record/field.h"
 #include "record/row.h"
+#include "record/row_batch.h"
 #include "record/schema.h"
 
 char *chars[] = {const_cast<char *>(""), const_cast<char *>("hello"), const_cast<char *>("world!"),
@@ -100,4 +101,64 @@ TEST(TupleTest, RowTest) {
   }
   ASSERT_TRUE(table_page.MarkDelete(row.GetRowId(), nullptr, nullptr, nullptr));
   table_page.ApplyDelete(row.GetRowId(), nullptr, nullptr);
-}
\ No newline at end of file
+}
+
+TEST(TupleTest, RowBatchTest) {
+  TablePage table_page;
+  std::vector<Column *> columns = {new Column("id", TypeId::kTypeInt, 0, false, false),
+                                   new Column("name", TypeId::kTypeChar, 64, 1, true, false),
+                                   new Column("account", TypeId::kTypeFloat, 2, true, false)};
+  auto schema = std::make_shared<Schema>(columns);
+  table_page.Init(0, INVALID_PAGE_ID, nullptr, nullptr);
+  std::vector<RowId> rids;
+  for (int i = 0; i < 4; i++) {
+    std::vector<Field> fields;
+    fields.emplace_back(int_fields[i]);
+    fields.emplace_back(i == 1 ? null_fields[2] : char_fields[i]);
+    fields.emplace_back(i == 2 ? null_fields[1] : float_fields[i]);
+    Row row(fields);
+    ASSERT_TRUE(table_page.InsertTuple(row, schema.get(), nullptr, nullptr, nullptr));
+    rids.push_back(row.GetRowId());
+  }
+  ASSERT_TRUE(table_page.MarkDelete(rids[0], nullptr, nullptr, nullptr));
+  table_page.ApplyDelete(rids[0], nullptr, nullptr);
+  // the live tuples of the page are decoded into the columns
+  RowBatch batch;
+  batch.Init(schema.get());
+  ASSERT_EQ(4u, table_page.GetTuples(0, batch));
+  ASSERT_EQ(3u, batch.GetSize());
+  ASSERT_EQ(3u, batch.GetSelection().size());
+  ASSERT_TRUE(batch.GetColumn(1).IsNull(0));
+  ASSERT_TRUE(batch.GetColumn(2).IsNull(1));
+  ASSERT_EQ(-77.7f, batch.GetColumn(2).GetFloat(2));
+  ASSERT_EQ(strlen(chars[2]), batch.GetColumn(1).GetCharLength(1));
+  Row row;
+  for (uint32_t i = 0; i < batch.GetSize(); i++) {
+    Row expected(rids[i + 1]);
+    ASSERT_TRUE(table_page.GetTuple(&expected, schema.get(), nullptr, nullptr));
+    batch.GetRow(i, row);
+    ASSERT_EQ(rids[i + 1], row.GetRowId());
+    for (uint32_t j = 0; j < 3; j++) {
+      ASSERT_EQ(expected.GetField(j)->IsNull(), row.GetField(j)->IsNull());
+      if (!row.GetField(j)->IsNull()) {
+        ASSERT_EQ(CmpBool::kTrue, expected.GetField(j)->CompareEquals(*row.GetField(j)));
+      }
+    }
+  }
+  // a projection copies the selected rows only
+  batch.GetSelection() = {0, 2};
+  RowBatch projected;
+  projected.Project(batch, {2, 0});
+  ASSERT_EQ(2u, projected.GetColumnCount());
+  ASSERT_EQ(2u, projected.GetSize());
+  ASSERT_EQ(rids[3], projected.GetRowId(1));
+  ASSERT_EQ(-77.7f, projected.GetColumn(0).GetFloat(1));
+  ASSERT_EQ(0, projected.GetColumn(1).GetInt(1));
+  // rows appended one by one give the batch its columns
+  RowBatch appended;
+  appended.AppendRow(row);
+  ASSERT_EQ(3u, appended.GetColumnCount());
+  ASSERT_EQ(kTypeFloat, appended.GetColumn(2).GetTypeId());
+  appended.Clear();
+  ASSERT_EQ(0u, appended.GetColumnCount());
+}
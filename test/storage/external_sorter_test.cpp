@@ -0,0 +1,94 @@
+#include "storage/external_sorter.h"
+
+#include <random>
+
+#include "gtest/gtest.h"
+#include "storage/external_row_sorter.h"
+
+TEST(ExternalSorterTest, SpillAndMergeTest) {
+  std::mt19937 rng(0);
+  // memory budgets below and above the input size, the smaller ones force several runs
+  for (size_t memory_limit : {100 * sizeof(int64_t), 1000 * sizeof(int64_t), 100000 * sizeof(int64_t)}) {
+    ExternalSorter<int64_t> sorter(memory_limit);
+    std::vector<int64_t> expect;
+    for (int i = 0; i < 20000; i++) {
+      int64_t value = rng() % 5000;
+      sorter.Add(value);
+      expect.push_back(value);
+    }
+    sorter.Finish();
+    std::sort(expect.begin(), expect.end());
+    if (memory_limit < expect.size() * sizeof(int64_t)) {
+      ASSERT_LT(1, sorter.GetRunCount());
+    } else {
+      ASSERT_EQ(0, sorter.GetRunCount());
+    }
+    int64_t value;
+    for (auto e : expect) {
+      ASSERT_TRUE(sorter.Next(value));
+      ASSERT_EQ(e, value);
+    }
+    ASSERT_FALSE(sorter.Next(value));
+  }
+}
+
+TEST(ExternalSorterTest, RowSpillTest) {
+  std::vector<Column *> columns = {new Column("key", TypeId::kTypeInt, 0, true, false),
+                                   new Column("name", TypeId::kTypeChar, 16, 1, false, false)};
+  Schema schema(columns);
+  // rows are ordered on their key and then their name, null keys first
+  auto less = [](const Row &a, const Row &b) {
+    for (uint32_t i = 0; i < 2; i++) {
+      const Field *lhs = a.GetField(i);
+      const Field *rhs = b.GetField(i);
+      if (lhs->IsNull() != rhs->IsNull()) {
+        return lhs->IsNull();
+      }
+      if (!lhs->IsNull() && lhs->CompareLessThan(*rhs) == CmpBool::kTrue) {
+        return true;
+      }
+      if (!lhs->IsNull() && rhs->CompareLessThan(*lhs) == CmpBool::kTrue) {
+        return false;
+      }
+    }
+    return false;
+  };
+  std::mt19937 rng(0);
+  for (size_t memory_limit : {size_t{4096}, size_t{64 << 10}, size_t{16 << 20}}) {
+    ExternalRowSorter sorter(&schema, less, memory_limit);
+    std::vector<std::pair<int32_t, std::string>> expect;
+    for (int i = 0; i < 5000; i++) {
+      int32_t key = static_cast<int32_t>(rng() % 1000) - 1;
+      std::string name = "row-" + std::to_string(rng() % 50);
+      std::vector<Field> fields;
+      if (key < 0) {
+        fields.emplace_back(kTypeInt);
+      } else {
+        fields.emplace_back(kTypeInt, key);
+      }
+      fields.emplace_back(kTypeChar, const_cast<char *>(name.c_str()), name.size(), true);
+      sorter.Add(Row(fields));
+      expect.emplace_back(key, name);
+    }
+    sorter.Finish();
+    std::sort(expect.begin(), expect.end());
+    if (memory_limit < (16 << 20)) {
+      ASSERT_LT(1, sorter.GetRunCount());
+    } else {
+      ASSERT_EQ(0, sorter.GetRunCount());
+    }
+    Row row;
+    for (const auto &e : expect) {
+      ASSERT_TRUE(sorter.Next(row));
+      if (e.first < 0) {
+        ASSERT_TRUE(row.GetField(0)->IsNull());
+      } else {
+        int32_t key;
+        row.GetField(0)->SerializeTo(reinterpret_cast<char *>(&key));
+        ASSERT_EQ(e.first, key);
+      }
+      ASSERT_EQ(e.second, std::string(row.GetField(1)->GetData(), row.GetField(1)->GetLength()));
+    }
+    ASSERT_FALSE(sorter.Next(row));
+  }
+}
@@ -0,0 +1,113 @@
+#include "storage/lsm_tree.h"
+
+#include <map>
+#include <random>
+
+#include "common/instance.h"
+#include "gtest/gtest.h"
+#include "index/lsm_index.h"
+#include "utils/utils.h"
+
+static const std::string db_name = "lsm_tree_test.db";
+
+static std::string MakeKey(uint32_t value) {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "key_%08u", value);
+  return buf;
+}
+
+TEST(LsmTreeTest, InsertRemoveCompactTest) {
+  DBStorageEngine engine(db_name);
+  const int n = 300000;
+  std::vector<uint32_t> values;
+  for (int i = 0; i < n; i++) {
+    values.push_back(i);
+  }
+  ShuffleArray(values);
+  {
+    LsmTree tree(0, engine.bpm_);
+    for (auto value : values) {
+      ASSERT_TRUE(tree.Insert(MakeKey(value), RowId(value)));
+    }
+    // unique keys only, also once the key has been flushed
+    tree.Flush();
+    ASSERT_FALSE(tree.Insert(MakeKey(values[0]), RowId(0)));
+    for (int i = 0; i < n; i += 3) {
+      ASSERT_TRUE(tree.Remove(MakeKey(i)));
+    }
+    ASSERT_FALSE(tree.Remove(MakeKey(0)));
+    // a removed key can be inserted again
+    ASSERT_TRUE(tree.Insert(MakeKey(3), RowId(3)));
+    tree.Flush();
+    auto stats = tree.GetStats();
+    ASSERT_LT(0u, stats.flushes);
+    ASSERT_LT(0u, stats.compactions);
+    ASSERT_GT(LSM_L0_COMPACTION_TRIGGER, stats.level_runs[0]);
+    ASSERT_LT(0u, stats.bloom_skips);
+  }
+  // reopen from the manifest
+  LsmTree tree(0, engine.bpm_);
+  RowId row_id;
+  for (int i = 0; i < n; i++) {
+    bool live = i % 3 != 0 || i == 3;
+    ASSERT_EQ(live, tree.GetValue(MakeKey(i), row_id));
+    if (live) {
+      ASSERT_EQ(i, row_id.Get());
+    }
+  }
+  ASSERT_FALSE(tree.GetValue("key_", row_id));
+  // scan in key order, tombstones skipped
+  std::vector<LsmTree::Entry> entries;
+  tree.Scan(MakeKey(100), false, 5, entries);
+  std::vector<int64_t> expect{101, 103, 104, 106, 107};
+  ASSERT_EQ(expect.size(), entries.size());
+  for (size_t i = 0; i < expect.size(); i++) {
+    ASSERT_EQ(MakeKey(expect[i]), entries[i].key);
+    ASSERT_EQ(expect[i], entries[i].value);
+  }
+  tree.Destroy();
+  ASSERT_FALSE(tree.GetValue(MakeKey(1), row_id));
+}
+
+TEST(LsmTreeTest, IndexScanTest) {
+  DBStorageEngine engine(db_name);
+  std::vector<Column *> columns = {new Column("device", TypeId::kTypeInt, 0, false, false),
+                                   new Column("ts", TypeId::kTypeInt, 1, false, false)};
+  std::vector<uint32_t> index_key_map{0, 1};
+  const TableSchema table_schema(columns);
+  auto *index_schema = Schema::ShallowCopySchema(&table_schema, index_key_map);
+  auto *index = new LsmIndex(0, index_schema, engine.bpm_);
+  std::map<std::pair<int32_t, int32_t>, int64_t> expect;
+  std::mt19937 rng(0);
+  for (int i = 0; i < 100000; i++) {
+    int32_t device = static_cast<int32_t>(rng() % 100) - 50;
+    int32_t ts = static_cast<int32_t>(rng() % 100000);
+    std::vector<Field> fields{Field(TypeId::kTypeInt, device), Field(TypeId::kTypeInt, ts)};
+    bool fresh = expect.emplace(std::make_pair(device, ts), i).second;
+    ASSERT_EQ(fresh ? DB_SUCCESS : DB_FAILED, index->InsertEntry(Row(fields), RowId(i), nullptr));
+  }
+  index->Flush();
+  // every event of one device, a prefix of the key
+  std::vector<Field> prefix_fields{Field(TypeId::kTypeInt, -7)};
+  Row prefix(prefix_fields);
+  std::vector<RowId> result;
+  ASSERT_EQ(DB_SUCCESS, index->ScanKey(prefix, result, nullptr));
+  auto iter = expect.lower_bound({-7, INT32_MIN});
+  for (const auto &row_id : result) {
+    ASSERT_EQ(-7, iter->first.first);
+    ASSERT_EQ(iter->second, row_id.Get());
+    ++iter;
+  }
+  ASSERT_TRUE(iter == expect.end() || iter->first.first != -7);
+  // index-only scan decodes the keys, the range starts after every key of the prefix
+  auto cursor = index->ScanRange({&prefix, false, nullptr, true}, nullptr);
+  RowId row_id;
+  Row key;
+  ASSERT_TRUE(cursor->NextEntry(row_id, key));
+  ASSERT_EQ(CmpBool::kTrue, key.GetField(0)->CompareEquals(Field(TypeId::kTypeInt, iter->first.first)));
+  ASSERT_EQ(CmpBool::kTrue, key.GetField(1)->CompareEquals(Field(TypeId::kTypeInt, iter->first.second)));
+  ASSERT_EQ(iter->second, row_id.Get());
+  index->Destroy();
+  delete index;
+  delete index_schema;
+}
@@ -0,0 +1,104 @@
+#include "storage/row_id_bitmap.h"
+
+#include <algorithm>
+#include <set>
+
+#include "common/instance.h"
+#include "gtest/gtest.h"
+#include "storage/table_heap.h"
+#include "utils/utils.h"
+
+static std::set<int64_t> ToSet(const RowIdBitmap &bitmap) {
+  std::set<int64_t> result;
+  for (const auto &row_id : bitmap.ToRowIds()) {
+    result.insert(row_id.Get());
+  }
+  return result;
+}
+
+TEST(RowIdBitmapTest, SetOperationTest) {
+  RowIdBitmap multiples_of_2;
+  RowIdBitmap multiples_of_3;
+  std::set<int64_t> both;
+  std::set<int64_t> either;
+  // slots beyond one word, pages out of order
+  for (int page = 9; page >= 0; page--) {
+    for (uint32_t slot = 0; slot < 200; slot++) {
+      RowId row_id(page, slot);
+      if ((page * 200 + slot) % 2 == 0) {
+        multiples_of_2.Add(row_id);
+        either.insert(row_id.Get());
+      }
+      if ((page * 200 + slot) % 3 == 0 && page < 5) {
+        multiples_of_3.Add(row_id);
+        either.insert(row_id.Get());
+        if ((page * 200 + slot) % 2 == 0) {
+          both.insert(row_id.Get());
+        }
+      }
+    }
+  }
+  ASSERT_EQ(1000, multiples_of_2.Size());
+  ASSERT_TRUE(multiples_of_2.Contains(RowId(3, 198)));
+  ASSERT_FALSE(multiples_of_2.Contains(RowId(3, 199)));
+  ASSERT_FALSE(multiples_of_2.Contains(RowId(3, 1000)));
+  // row ids come out in page order
+  auto row_ids = multiples_of_2.ToRowIds();
+  ASSERT_TRUE(std::is_sorted(row_ids.begin(), row_ids.end(),
+                             [](const RowId &a, const RowId &b) { return a.Get() < b.Get(); }));
+  RowIdBitmap intersection = multiples_of_2;
+  intersection.Intersect(multiples_of_3);
+  ASSERT_EQ(both, ToSet(intersection));
+  ASSERT_EQ(5, intersection.PageCount());
+  RowIdBitmap union_bitmap = multiples_of_3;
+  union_bitmap.Union(multiples_of_2);
+  ASSERT_EQ(either, ToSet(union_bitmap));
+  // pages left without rows are dropped
+  RowIdBitmap odd;
+  odd.Add(RowId(3, 1));
+  odd.Add(RowId(20, 0));
+  odd.Intersect(multiples_of_2);
+  ASSERT_TRUE(odd.Empty());
+}
+
+TEST(RowIdBitmapTest, PageReadTest) {
+  const std::string db_name = "row_id_bitmap_test.db";
+  remove(db_name.c_str());
+  auto disk_manager = new DiskManager(db_name);
+  auto bpm = new BufferPoolManager(DEFAULT_BUFFER_POOL_SIZE, disk_manager);
+  std::vector<Column *> columns = {new Column("id", TypeId::kTypeInt, 0, false, false)};
+  auto schema = std::make_shared<Schema>(columns);
+  TableHeap *table_heap = TableHeap::Create(bpm, schema.get(), nullptr, nullptr, nullptr);
+  RowIdBitmap bitmap;
+  std::vector<int32_t> expected;
+  for (int i = 0; i < 3000; i++) {
+    std::vector<Field> fields{Field(TypeId::kTypeInt, i)};
+    Row row(fields);
+    ASSERT_TRUE(table_heap->InsertTuple(row, nullptr));
+    if (i % 7 == 0) {
+      bitmap.Add(row.GetRowId());
+      expected.push_back(i);
+    }
+  }
+  ASSERT_GT(bitmap.PageCount(), 1);
+  // every page is read once with all of its rows of the bitmap, pages in
+  // ascending order hold the rows in insertion order
+  size_t count = 0;
+  for (auto iter = bitmap.Begin(); iter != bitmap.End(); ++iter) {
+    std::vector<uint32_t> slots;
+    RowIdBitmap::DecodeSlots(iter->second, slots);
+    std::vector<Row> rows;
+    table_heap->GetTuples(iter->first, slots, rows, nullptr);
+    ASSERT_EQ(slots.size(), rows.size());
+    for (auto &row : rows) {
+      ASSERT_EQ(iter->first, row.GetRowId().GetPageId());
+      ASSERT_EQ(CmpBool::kTrue, row.GetField(0)->CompareEquals(Field(TypeId::kTypeInt, expected[count++])));
+    }
+  }
+  ASSERT_EQ(expected.size(), count);
+  ASSERT_TRUE(bpm->CheckAllUnpinned());
+  delete table_heap;
+  delete bpm;
+  delete disk_manager;
+  remove(db_name.c_str());
+}